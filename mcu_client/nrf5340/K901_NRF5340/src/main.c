@@ -47,6 +47,7 @@
 #include "task_interrupt.h"
 #include "bspal_watchdog.h"
 #include "task_lc3_codec.h"
+#include "task_lc3_uplink.h"
 #define TAG "MAIN"
 
 static struct bt_conn *my_current_conn;
@@ -557,6 +558,7 @@ int main(void)
 	task_process_thread();
 	task_interrupt_thread();
 	task_lc3_codec_thread();
+	task_lc3_uplink_thread();
 
 	uint8_t mac[BT_ADDR_LE_STR_LEN] = {0};
 	get_ble_mac_addr(mac, sizeof(mac));
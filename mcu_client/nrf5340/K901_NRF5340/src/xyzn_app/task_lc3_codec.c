@@ -12,13 +12,22 @@
 #include "xyzn_pdm.h"
 #include "bsp_log.h"
 #include "task_lc3_codec.h"
+#include "task_lc3_uplink.h"
+#ifdef CONFIG_XYZN_LC3_ENCODER_LIBLC3
+#include "lc3.h"
+#else
 #include "sw_codec_lc3.h"
+#endif
 
 #define TAG "TASK_LC3_CODEC"
 #define TASK_NAME "TASK_LC3_CODEC"
 
+#ifdef CONFIG_XYZN_LC3_ENCODER_LIBLC3
+#define TASK_LC3_CODEC_THREAD_STACK_SIZE (6144) // liblc3 的工作缓存在栈上，按 48kHz 最大帧长分配
+#else
 #define TASK_LC3_CODEC_THREAD_STACK_SIZE (4096)
-#define TASK_LC3_CODEC_THREAD_PRIORITY 5
+#endif
+#define TASK_LC3_CODEC_THREAD_PRIORITY 3 // 高于显示与蓝牙线程，保证每帧在截止时间内编码完成
 K_THREAD_STACK_DEFINE(task_lc3_codec_stack_area, TASK_LC3_CODEC_THREAD_STACK_SIZE);
 static struct k_thread task_lc3_codec_thread_data;
 k_tid_t task_lc3_codec_thread_handle;
@@ -30,6 +39,43 @@ k_tid_t task_lc3_codec_thread_handle;
 #define LC3_NUM_CHANNELS 1      // 2            // LC3 编码器通道数，立体声为 2
 #define AUDIO_CH_L 0            // 左声道
 #define AUDIO_CH_R 1            // 右声道
+#ifdef CONFIG_XYZN_LC3_ENCODER_LIBLC3
+// liblc3 编码器状态放在静态内存，不占用堆
+static LC3_ENCODER_MEM_T(LC3_FRAME_SIZE_US, PCM_SAMPLE_RATE) lc3_encoder_mem;
+static lc3_encoder_t lc3_encoder;
+static int lc3_frame_bytes_enc;
+
+int user_sw_codec_lc3_init(void)
+{
+    lc3_encoder = lc3_setup_encoder(LC3_FRAME_SIZE_US, PCM_SAMPLE_RATE, 0, &lc3_encoder_mem);
+    lc3_frame_bytes_enc = lc3_frame_bytes(LC3_FRAME_SIZE_US, LC3_BITRATE);
+    if (lc3_encoder == NULL || lc3_frame_bytes_enc < 0)
+    {
+        BSP_LOGE(TAG, "liblc3 encoder initialization failed");
+        return XYZN_OS_ERROR;
+    }
+    BSP_LOGI(TAG, "liblc3 %d.%d.%d encoder, %d bytes per frame",
+             LC3_VERSION_MAJOR, LC3_VERSION_MINOR, LC3_VERSION_PATCH, lc3_frame_bytes_enc);
+    return 0;
+}
+
+// 编码一帧 PDM_PCM_REQ_BUFFER_SIZE 个采样点，成功返回 0
+static int lc3_encode_frame(const int16_t *pcm, uint8_t *out, uint16_t out_size, uint16_t *written)
+{
+    if (out_size < lc3_frame_bytes_enc)
+    {
+        return -EINVAL;
+    }
+    if (lc3_encode(lc3_encoder, LC3_PCM_FORMAT_S16, pcm, 1, lc3_frame_bytes_enc, out) != 0)
+    {
+        return -EINVAL;
+    }
+    *written = lc3_frame_bytes_enc;
+    return 0;
+}
+
+#else
+
 static uint16_t pcm_bytes_req_enc;
 // 初始化LC3编解码器
 int user_sw_codec_lc3_init(void)
@@ -64,44 +110,132 @@ int user_sw_codec_lc3_init(void)
     return 0;
 }
 
+static int lc3_encode_frame(const int16_t *pcm, uint8_t *out, uint16_t out_size, uint16_t *written)
+{
+    return sw_codec_lc3_enc_run(pcm,
+                                PDM_PCM_REQ_BUFFER_SIZE * sizeof(int16_t),
+                                LC3_USE_BITRATE_FROM_INIT,
+                                AUDIO_CH_L,
+                                out_size,
+                                out,
+                                written);
+}
+
+#endif
+
+static K_MUTEX_DEFINE(lc3_codec_stats_mutex);
+static lc3_codec_stats_t lc3_codec_stats;
+static uint64_t encode_us_sum;
+static uint64_t latency_us_sum;
+static uint64_t jitter_us_sum;
+
+void lc3_codec_get_stats(lc3_codec_stats_t *stats)
+{
+    xyzn_os_mutex_lock(&lc3_codec_stats_mutex, XYZN_OS_WAIT_FOREVER);
+    *stats = lc3_codec_stats;
+    if (stats->frames > 0)
+    {
+        stats->encode_avg_us = (uint32_t)(encode_us_sum / stats->frames);
+        stats->latency_avg_us = (uint32_t)(latency_us_sum / stats->frames);
+    }
+    if (stats->frames > 1)
+    {
+        stats->jitter_avg_us = (uint32_t)(jitter_us_sum / (stats->frames - 1));
+    }
+    xyzn_os_mutex_unlock(&lc3_codec_stats_mutex);
+    pdm_get_stats(&stats->pdm);
+}
+
+// 记录一帧的编码耗时、采样到编码完成的延时、帧就绪间隔的抖动，返回是否超过一帧时长的截止时间
+static bool lc3_codec_stats_update(uint32_t ready_cycles, uint32_t start_cycles, uint32_t done_cycles)
+{
+    static uint32_t last_ready_cycles;
+    uint32_t encode_us = k_cyc_to_us_floor32(done_cycles - start_cycles);
+    uint32_t latency_us = k_cyc_to_us_floor32(done_cycles - ready_cycles);
+    bool missed = latency_us > LC3_FRAME_SIZE_US;
+
+    xyzn_os_mutex_lock(&lc3_codec_stats_mutex, XYZN_OS_WAIT_FOREVER);
+    if (lc3_codec_stats.frames > 0)
+    {
+        uint32_t interval_us = k_cyc_to_us_floor32(ready_cycles - last_ready_cycles);
+        uint32_t jitter_us = interval_us > LC3_FRAME_SIZE_US ? interval_us - LC3_FRAME_SIZE_US
+                                                             : LC3_FRAME_SIZE_US - interval_us;
+        jitter_us_sum += jitter_us;
+        lc3_codec_stats.jitter_max_us = MAX(lc3_codec_stats.jitter_max_us, jitter_us);
+    }
+    last_ready_cycles = ready_cycles;
+    lc3_codec_stats.frames++;
+    encode_us_sum += encode_us;
+    latency_us_sum += latency_us;
+    lc3_codec_stats.encode_max_us = MAX(lc3_codec_stats.encode_max_us, encode_us);
+    lc3_codec_stats.latency_max_us = MAX(lc3_codec_stats.latency_max_us, latency_us);
+    if (missed)
+    {
+        lc3_codec_stats.deadline_misses++;
+    }
+    xyzn_os_mutex_unlock(&lc3_codec_stats_mutex);
+    return missed;
+}
+
 void task_lc3_codec_init(void *p1, void *p2, void *p3)
 {
     int ret;
-    // Initialize LC3 codec here
-    // This is a placeholder function, actual implementation will depend on the codec library used
-    BSP_LOGI(TAG, "LC3 codec initialized");
-    int16_t pcm_req_buffer[PDM_PCM_REQ_BUFFER_SIZE] = {0};
     static uint8_t audio_encoded_l[PDM_PCM_REQ_BUFFER_SIZE];
     static uint16_t encoded_bytes_written_l;
-    user_sw_codec_lc3_init();
+    pdm_stats_t pdm_stats;
+    uint32_t pdm_drops = 0;
+    uint32_t deadline_misses = 0;
+    if (user_sw_codec_lc3_init() != 0)
+    {
+        return;
+    }
+    BSP_LOGI(TAG, "LC3 codec initialized");
 
     pdm_init();
     pdm_start();
+    /*
+     * 纯事件驱动：阻塞等待 PDM 采样完成的帧，到达即编码，不再轮询延时。
+     * 每帧须在下一帧就绪前编码完成（截止时间为一帧时长），
+     * 偶尔超时的帧由缓存环排队补上，不丢帧；持续超时才会由缓存环丢弃最旧帧并计数。
+     */
     while (1)
     {
-        if (!get_pdm_sample(pcm_req_buffer, PDM_PCM_REQ_BUFFER_SIZE))
+        int16_t *pcm_frame = pdm_frame_get(XYZN_OS_WAIT_FOREVER);
+        if (pcm_frame == NULL)
         {
-            // Process PCM data here
-            // For example, encode it using LC3 codec
-            ret = sw_codec_lc3_enc_run(pcm_req_buffer,
-                                       sizeof(pcm_req_buffer),
-                                       LC3_USE_BITRATE_FROM_INIT,
-                                       AUDIO_CH_L,
-                                       sizeof(audio_encoded_l),
-                                       audio_encoded_l,
-                                       &encoded_bytes_written_l);
-            if (ret < 0)
-            {
-                BSP_LOGE(TAG, "LC3 encoding failed with error: %d", ret);
-            }
-            else
+            continue;
+        }
+        uint32_t ready_cycles = pdm_frame_cycles(pcm_frame);
+        uint32_t start_cycles = k_cycle_get_32();
+        // 直接编码缓存环中的槽，编码完成后归还
+        ret = lc3_encode_frame(pcm_frame, audio_encoded_l, sizeof(audio_encoded_l), &encoded_bytes_written_l);
+        pdm_frame_release(pcm_frame);
+        if (ret < 0)
+        {
+            xyzn_os_mutex_lock(&lc3_codec_stats_mutex, XYZN_OS_WAIT_FOREVER);
+            lc3_codec_stats.encode_errors++;
+            xyzn_os_mutex_unlock(&lc3_codec_stats_mutex);
+            BSP_LOGE(TAG, "LC3 encoding failed with error: %d", ret);
+            continue;
+        }
+        // 交给上行发送线程打包发送，不阻塞编码
+        lc3_uplink_frame_push(audio_encoded_l, encoded_bytes_written_l);
+
+        if (lc3_codec_stats_update(ready_cycles, start_cycles, k_cycle_get_32()))
+        {
+            // 限制打印频率，避免日志本身拖慢编码
+            if (deadline_misses++ % 100 == 0)
             {
-                BSP_LOGI(TAG, "LC3 encoding successful, bytes written: %d", encoded_bytes_written_l);
-                BSP_LOG_BUFFER_HEX(TAG, audio_encoded_l, encoded_bytes_written_l);
-                // Here you can send the encoded data over BLE or store it
+                BSP_LOGW(TAG, "LC3 encode deadline missed: %d", deadline_misses);
             }
         }
-        xyzn_os_delay_ms(10); // Adjust delay as needed
+        pdm_get_stats(&pdm_stats);
+        if (pdm_stats.overruns + pdm_stats.overflows != pdm_drops)
+        {
+            pdm_drops = pdm_stats.overruns + pdm_stats.overflows;
+            BSP_LOGE(TAG, "pdm frames: %d, overruns: %d, overflows: %d",
+                     pdm_stats.frames, pdm_stats.overruns, pdm_stats.overflows);
+        }
     }
 }
 
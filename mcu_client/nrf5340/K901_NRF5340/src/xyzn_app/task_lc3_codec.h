@@ -11,8 +11,25 @@
 #ifndef _TASK_LC3_CODEC_H_
 #define _TASK_LC3_CODEC_H_
 
+#include <stdint.h>
+#include "xyzn_pdm.h"
 
+typedef struct
+{
+    uint32_t frames;          // 已编码帧数
+    uint32_t encode_errors;   // 编码失败帧数
+    uint32_t deadline_misses; // 采样完成到编码完成超过一帧时长的帧数
+    uint32_t encode_avg_us;   // 单帧编码耗时
+    uint32_t encode_max_us;
+    uint32_t latency_avg_us;  // PDM 帧就绪到编码完成的延时
+    uint32_t latency_max_us;
+    uint32_t jitter_avg_us;   // 相邻帧就绪间隔与帧长之差
+    uint32_t jitter_max_us;
+    pdm_stats_t pdm;          // 采样统计，overruns + overflows 为丢失的帧
+} lc3_codec_stats_t;
 
+// 读取编码统计，自启动起累计
+void lc3_codec_get_stats(lc3_codec_stats_t *stats);
 
 void task_lc3_codec_thread(void);
 
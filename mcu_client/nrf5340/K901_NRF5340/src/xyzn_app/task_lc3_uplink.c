@@ -0,0 +1,222 @@
+/*
+ * @Author       : XK
+ * @Date         : 2025-07-21 10:12:08
+ * @LastEditTime : 2025-07-21 10:12:08
+ * @FilePath     : task_lc3_uplink.c
+ * @Description  : LC3 麦克风音频上行：编码线程 -> 帧队列 -> 打包 -> BLE 通知
+ *
+ * Copyright (c) XingYiZhiNeng 2025 , All Rights Reserved.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include "bal_os.h"
+#include "bsp_log.h"
+#include "main.h"
+#include "xyzn_ble.h"
+#include "xyzn_ble_service.h"
+#include "task_lc3_uplink.h"
+
+#define TAG "TASK_LC3_UPLINK"
+#define TASK_NAME "TASK_LC3_UPLINK"
+
+#define TASK_LC3_UPLINK_THREAD_STACK_SIZE (2048)
+#define TASK_LC3_UPLINK_THREAD_PRIORITY 6 // 低于编码线程，发送阻塞时不影响采样编码
+K_THREAD_STACK_DEFINE(task_lc3_uplink_stack_area, TASK_LC3_UPLINK_THREAD_STACK_SIZE);
+static struct k_thread task_lc3_uplink_thread_data;
+k_tid_t task_lc3_uplink_thread_handle;
+
+#define LC3_UPLINK_FRAME_MS 10
+#define LC3_UPLINK_HEADER_SIZE 2 // [0xA0][序号]
+#define LC3_UPLINK_REPORT_MS 1000
+
+typedef struct
+{
+    uint32_t cycles; // 编码完成时刻 k_cycle_get_32()
+    uint16_t len;
+    uint8_t data[LC3_UPLINK_FRAME_MAX];
+} lc3_uplink_frame_t;
+
+// 帧队列，存储由 msgq 预分配
+K_MSGQ_DEFINE(lc3_uplink_msgq, sizeof(lc3_uplink_frame_t), LC3_UPLINK_QUEUE_DEPTH, 4);
+
+static uint8_t uplink_packet[LC3_UPLINK_HEADER_SIZE + LC3_UPLINK_FRAMES_PER_PACKET_MAX * LC3_UPLINK_FRAME_MAX];
+static uint8_t uplink_seq;
+static uint8_t uplink_frames_per_packet; // 0: 按 MTU 打满
+static atomic_t uplink_dropped;
+// 除 dropped 外只由发送线程写入，读取方在 BLE/命令上下文，整体拷贝须加锁
+static K_MUTEX_DEFINE(uplink_stats_mutex);
+static lc3_uplink_stats_t uplink_stats;
+
+void lc3_uplink_frame_push(const uint8_t *data, uint16_t len)
+{
+    lc3_uplink_frame_t frame;
+    if (data == NULL || len == 0 || len > LC3_UPLINK_FRAME_MAX)
+    {
+        BSP_LOGE(TAG, "lc3 uplink frame err len=%d", len);
+        return;
+    }
+    frame.cycles = k_cycle_get_32();
+    frame.len = len;
+    memcpy(frame.data, data, len);
+    // 发送线程来不及发送时丢弃最旧的帧，保证实时性
+    while (k_msgq_put(&lc3_uplink_msgq, &frame, K_NO_WAIT) != 0)
+    {
+        lc3_uplink_frame_t oldest;
+        if (k_msgq_get(&lc3_uplink_msgq, &oldest, K_NO_WAIT) == 0)
+        {
+            atomic_inc(&uplink_dropped);
+        }
+    }
+}
+
+void lc3_uplink_set_frames_per_packet(uint8_t frames)
+{
+    uplink_frames_per_packet = MIN(frames, LC3_UPLINK_FRAMES_PER_PACKET_MAX);
+}
+
+void lc3_uplink_get_stats(lc3_uplink_stats_t *stats)
+{
+    xyzn_os_mutex_lock(&uplink_stats_mutex, XYZN_OS_WAIT_FOREVER);
+    *stats = uplink_stats;
+    xyzn_os_mutex_unlock(&uplink_stats_mutex);
+    stats->dropped = (uint32_t)atomic_get(&uplink_dropped);
+}
+
+// 当前 MTU 下每包可打包的帧数，0 表示一帧也放不下
+static uint16_t lc3_uplink_packet_size(uint16_t frame_len)
+{
+    uint16_t payload = MIN(get_ble_payload_mtu(), sizeof(uplink_packet));
+    if (payload < LC3_UPLINK_HEADER_SIZE + frame_len)
+    {
+        return 0;
+    }
+    uint16_t frames = (payload - LC3_UPLINK_HEADER_SIZE) / frame_len;
+    if (uplink_frames_per_packet != 0)
+    {
+        frames = MIN(frames, uplink_frames_per_packet);
+    }
+    return LC3_UPLINK_HEADER_SIZE + MIN(frames, LC3_UPLINK_FRAMES_PER_PACKET_MAX) * frame_len;
+}
+
+void task_lc3_uplink_init(void *p1, void *p2, void *p3)
+{
+    static lc3_uplink_frame_t frame;
+    bool pending = false; // frame 中有上一包放不下的帧
+    int64_t window_start = k_uptime_get();
+    uint32_t window_packets = 0;
+    uint32_t window_frames = 0;
+    uint64_t window_latency_us = 0;
+    uint32_t window_latency_max_us = 0;
+
+    BSP_LOGI(TAG, "LC3 uplink started");
+    while (1)
+    {
+        if (!pending && k_msgq_get(&lc3_uplink_msgq, &frame, K_FOREVER) != 0)
+        {
+            continue;
+        }
+        pending = false;
+
+        /*
+         * [0xA0][序号][LC3 帧 0][LC3 帧 1]...
+         * 与 parse_single_packet 解析的 BLE_OPCODE_AUDIO_BLOCK 格式一致，第二字节为包序号，
+         * 接收端据此检测丢包，帧长由编码参数决定，接收端按固定帧长拆分。
+         */
+        uint16_t packet_size = lc3_uplink_packet_size(frame.len);
+        if (packet_size == 0)
+        {
+            xyzn_os_mutex_lock(&uplink_stats_mutex, XYZN_OS_WAIT_FOREVER);
+            uplink_stats.send_failed++;
+            xyzn_os_mutex_unlock(&uplink_stats_mutex);
+            continue;
+        }
+        uint32_t first_cycles = frame.cycles;
+        uint16_t len = LC3_UPLINK_HEADER_SIZE;
+        uint16_t frames = 0;
+        while (1)
+        {
+            memcpy(&uplink_packet[len], frame.data, frame.len);
+            len += frame.len;
+            frames++;
+            if (len + frame.len > packet_size)
+            {
+                break;
+            }
+            // 等下一帧，超过两帧时长未到（采样停止）则先发送已打包的帧
+            if (k_msgq_get(&lc3_uplink_msgq, &frame, K_MSEC(2 * LC3_UPLINK_FRAME_MS)) != 0)
+            {
+                break;
+            }
+            if (len + frame.len > packet_size)
+            {
+                pending = true; // 帧长变化放不下，留给下一包
+                break;
+            }
+        }
+        uplink_packet[0] = BLE_OPCODE_AUDIO_BLOCK;
+        uplink_packet[1] = uplink_seq++;
+
+        int err = -ENOTCONN;
+        if (get_ble_connected_status())
+        {
+            // 协议栈发送缓存满时阻塞，帧队列随之积压并丢弃最旧帧
+            err = custom_nus_send(NULL, uplink_packet, len);
+        }
+        if (err != 0)
+        {
+            xyzn_os_mutex_lock(&uplink_stats_mutex, XYZN_OS_WAIT_FOREVER);
+            uplink_stats.send_failed += frames;
+            xyzn_os_mutex_unlock(&uplink_stats_mutex);
+        }
+        else
+        {
+            uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - first_cycles);
+            xyzn_os_mutex_lock(&uplink_stats_mutex, XYZN_OS_WAIT_FOREVER);
+            uplink_stats.packets++;
+            uplink_stats.frames += frames;
+            xyzn_os_mutex_unlock(&uplink_stats_mutex);
+            window_packets++;
+            window_frames += frames;
+            window_latency_us += latency_us;
+            window_latency_max_us = MAX(window_latency_max_us, latency_us);
+        }
+
+        int64_t now = k_uptime_get();
+        if (now - window_start >= LC3_UPLINK_REPORT_MS)
+        {
+            lc3_uplink_stats_t report;
+            xyzn_os_mutex_lock(&uplink_stats_mutex, XYZN_OS_WAIT_FOREVER);
+            uplink_stats.packets_per_sec = window_packets;
+            uplink_stats.frames_per_sec = window_frames;
+            uplink_stats.latency_avg_us = window_packets ? (uint32_t)(window_latency_us / window_packets) : 0;
+            uplink_stats.latency_max_us = window_latency_max_us;
+            report = uplink_stats;
+            xyzn_os_mutex_unlock(&uplink_stats_mutex);
+            BSP_LOGI(TAG, "uplink %d pkt/s %d frame/s, latency avg %d us max %d us, dropped %d, send failed %d",
+                     report.packets_per_sec, report.frames_per_sec,
+                     report.latency_avg_us, report.latency_max_us,
+                     (uint32_t)atomic_get(&uplink_dropped), report.send_failed);
+            window_start = now;
+            window_packets = 0;
+            window_frames = 0;
+            window_latency_us = 0;
+            window_latency_max_us = 0;
+        }
+    }
+}
+
+void task_lc3_uplink_thread(void)
+{
+    task_lc3_uplink_thread_handle = k_thread_create(&task_lc3_uplink_thread_data,
+                                                    task_lc3_uplink_stack_area,
+                                                    K_THREAD_STACK_SIZEOF(task_lc3_uplink_stack_area),
+                                                    task_lc3_uplink_init,
+                                                    NULL,
+                                                    NULL,
+                                                    NULL,
+                                                    TASK_LC3_UPLINK_THREAD_PRIORITY,
+                                                    0,
+                                                    XYZN_OS_NO_WAIT);
+    k_thread_name_set(task_lc3_uplink_thread_handle, TASK_NAME);
+}
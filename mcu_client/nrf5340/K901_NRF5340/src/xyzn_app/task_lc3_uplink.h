@@ -0,0 +1,49 @@
+/***
+ * @Author       : XK
+ * @Date         : 2025-07-21 10:12:08
+ * @LastEditTime : 2025-07-21 10:12:08
+ * @FilePath     : task_lc3_uplink.h
+ * @Description  :
+ * @
+ * @Copyright (c) XingYiZhiNeng 2025 , All Rights Reserved.
+ */
+
+#ifndef _TASK_LC3_UPLINK_H_
+#define _TASK_LC3_UPLINK_H_
+
+#include <stdint.h>
+
+#define LC3_UPLINK_FRAME_MAX 80              // 单帧 LC3 最大字节数（10ms 帧，最高 64kbps）
+#define LC3_UPLINK_FRAMES_PER_PACKET_MAX 12  // 每包最多打包帧数
+#define LC3_UPLINK_QUEUE_DEPTH 16            // 编码线程与发送线程之间的帧队列深度（160ms）
+
+typedef struct
+{
+    uint32_t packets;         // 累计发送包数
+    uint32_t frames;          // 累计发送帧数
+    uint32_t dropped;         // 队列满时丢弃的最旧帧数
+    uint32_t send_failed;     // 未连接、MTU 不足或发送失败丢弃的帧数
+    uint32_t packets_per_sec; // 最近一秒发送包数
+    uint32_t frames_per_sec;  // 最近一秒发送帧数
+    uint32_t latency_avg_us;  // 最近一秒，编码完成到交给蓝牙协议栈的平均延时
+    uint32_t latency_max_us;  // 最近一秒，最大延时
+} lc3_uplink_stats_t;
+
+/*
+ * 编码线程提交一帧 LC3 数据，拷入预分配的帧队列，不阻塞。
+ * 队列满时丢弃最旧的一帧。
+ */
+void lc3_uplink_frame_push(const uint8_t *data, uint16_t len);
+
+/*
+ * 设置每包打包的帧数，0 为按当前 MTU 打满。
+ * 帧数越多包越少，但每包最早一帧的延时增加 (帧数 - 1) * 10ms。
+ */
+void lc3_uplink_set_frames_per_packet(uint8_t frames);
+
+// 读取上行统计
+void lc3_uplink_get_stats(lc3_uplink_stats_t *stats);
+
+void task_lc3_uplink_thread(void);
+
+#endif // _TASK_LC3_UPLINK_H_
@@ -16,6 +16,8 @@
 #include "xyzn_ble_service.h"
 
 #include "protocol_image_stream.h"
+#include "task_lc3_codec.h"
+#include "task_lc3_uplink.h"
 
 #define TAG "XYZN_BLE"
 #define TASK_NAME "XYZN_BLE"
@@ -206,6 +208,81 @@ uint32_t parse_single_packet(const uint8_t *data, uint32_t len, ble_packet *out)
     }
 }
 
+/**
+ * @brief 回复音频诊断信息：编码耗时、延时、抖动、截止超时，采样丢帧，上行发送统计
+ * @param msg_id 请求的 msg_id
+ */
+static void ble_send_audio_diagnostics(const char *msg_id)
+{
+    lc3_codec_stats_t codec;
+    lc3_uplink_stats_t uplink;
+    lc3_codec_get_stats(&codec);
+    lc3_uplink_get_stats(&uplink);
+
+    cJSON *root = cJSON_CreateObject();
+    if (root == NULL)
+    {
+        BSP_LOGE(TAG, "Failed to create JSON object");
+        return;
+    }
+    cJSON_AddStringToObject(root, "type", "audio_diagnostics");
+    cJSON_AddStringToObject(root, "msg_id", msg_id);
+    cJSON *e = cJSON_AddObjectToObject(root, "encoder");
+    cJSON_AddNumberToObject(e, "frames", codec.frames);
+    cJSON_AddNumberToObject(e, "errors", codec.encode_errors);
+    cJSON_AddNumberToObject(e, "deadline_misses", codec.deadline_misses);
+    cJSON_AddNumberToObject(e, "encode_avg_us", codec.encode_avg_us);
+    cJSON_AddNumberToObject(e, "encode_max_us", codec.encode_max_us);
+    cJSON_AddNumberToObject(e, "latency_avg_us", codec.latency_avg_us);
+    cJSON_AddNumberToObject(e, "latency_max_us", codec.latency_max_us);
+    cJSON_AddNumberToObject(e, "jitter_avg_us", codec.jitter_avg_us);
+    cJSON_AddNumberToObject(e, "jitter_max_us", codec.jitter_max_us);
+    cJSON *p = cJSON_AddObjectToObject(root, "pdm");
+    cJSON_AddNumberToObject(p, "frames", codec.pdm.frames);
+    cJSON_AddNumberToObject(p, "overruns", codec.pdm.overruns);
+    cJSON_AddNumberToObject(p, "overflows", codec.pdm.overflows);
+    cJSON *u = cJSON_AddObjectToObject(root, "uplink");
+    cJSON_AddNumberToObject(u, "packets", uplink.packets);
+    cJSON_AddNumberToObject(u, "frames", uplink.frames);
+    cJSON_AddNumberToObject(u, "dropped", uplink.dropped);
+    cJSON_AddNumberToObject(u, "send_failed", uplink.send_failed);
+    cJSON_AddNumberToObject(u, "packets_per_sec", uplink.packets_per_sec);
+    cJSON_AddNumberToObject(u, "latency_avg_us", uplink.latency_avg_us);
+    cJSON_AddNumberToObject(u, "latency_max_us", uplink.latency_max_us);
+    char *json = cJSON_PrintUnformatted(root);
+    if (json != NULL)
+    {
+        ble_send_data(json, strlen(json));
+        cJSON_free(json);
+    }
+    cJSON_Delete(root);
+}
+
+/**
+ * @brief 设置上行每包打包的 LC3 帧数，0 为按当前 MTU 打满
+ * @param json_str 命令 JSON，"frames" 取 0 ~ LC3_UPLINK_FRAMES_PER_PACKET_MAX
+ */
+static void ble_set_audio_frames_per_packet(const char *json_str)
+{
+    cJSON *root = cJSON_Parse(json_str);
+    if (root == NULL)
+    {
+        BSP_LOGE(TAG, "JSON parse failed: %s ", cJSON_GetErrorPtr());
+        return;
+    }
+    const cJSON *frames = cJSON_GetObjectItemCaseSensitive(root, "frames");
+    if (!cJSON_IsNumber(frames) || frames->valueint < 0 ||
+        frames->valueint > LC3_UPLINK_FRAMES_PER_PACKET_MAX)
+    {
+        BSP_LOGE(TAG, "Invalid or missing frames");
+        cJSON_Delete(root);
+        return;
+    }
+    lc3_uplink_set_frames_per_packet((uint8_t)frames->valueint);
+    BSP_LOGI(TAG, "audio frames per packet=%d", frames->valueint);
+    cJSON_Delete(root);
+}
+
 void handle_ble_packet(const ble_packet *pkt)
 {
     // 根据数据包的操作码进行不同的处理
@@ -272,6 +349,18 @@ void handle_ble_packet(const ble_packet *pkt)
             // 调整 VAD 灵敏度阈值 （0–100）
             BSP_LOGI(TAG, "configure_vad");
         }
+        else if (strcmp(pkt->payload.ping.type, "request_audio_diagnostics") == 0)
+        {
+            // 报告麦克风采样、LC3 编码与上行发送的诊断统计
+            BSP_LOGI(TAG, "request_audio_diagnostics");
+            ble_send_audio_diagnostics(pkt->payload.ping.msg_id);
+        }
+        else if (strcmp(pkt->payload.ping.type, "set_audio_frames_per_packet") == 0)
+        {
+            // 设置上行每包打包的 LC3 帧数，以延时换取更少的通知包
+            BSP_LOGI(TAG, "set_audio_frames_per_packet");
+            ble_set_audio_frames_per_packet(pkt->payload.ping.raw_json);
+        }
         else if (strcmp(pkt->payload.ping.type, "display_text") == 0)
         {
             // 显示文本
@@ -0,0 +1,58 @@
+/***
+ * @Author       : XK
+ * @Date         : 2025-07-16 15:46:18
+ * @LastEditTime : 2025-07-18 10:54:04
+ * @FilePath     : xyzn_pdm.h
+ * @Description  :
+ * @
+ * @Copyright (c) XingYiZhiNeng 2025 , All Rights Reserved.
+ */
+
+#ifndef _XYZN_PDM_H_
+#define _XYZN_PDM_H_
+
+#include <stdint.h>
+
+#define PDM_PCM_SAMPLE_RATE 16000 // PCM 采样率，单位为 Hz
+#define PDM_PCM_FRAME_MS 10       // 一帧时长，单位为 ms，与 LC3 帧长一致
+// 一帧 PCM 采样点数
+#define PDM_PCM_REQ_BUFFER_SIZE (PDM_PCM_SAMPLE_RATE / 1000 * PDM_PCM_FRAME_MS)
+
+/*
+ * 采样缓存环的槽数。DMA 同时占用 2 个槽（正在采样 + 下一个），
+ * 其余槽给消费者排队，消费者最多可落后 (PDM_PCM_RING_DEPTH - 2) 帧不丢数据。
+ */
+#define PDM_PCM_RING_DEPTH 6
+
+typedef struct
+{
+    uint32_t frames;    // 采样完成的帧数
+    uint32_t overruns;  // 消费者来不及取走，被丢弃的最旧帧数
+    uint32_t overflows; // 没有空闲槽交给 DMA，或 PDM 硬件溢出的次数
+} pdm_stats_t;
+
+void pdm_init(void);
+void pdm_start(void);
+void pdm_stop(void);
+
+/*
+ * 取一帧采样完成的 PCM，PDM_PCM_REQ_BUFFER_SIZE 个采样点，无拷贝，直接指向缓存环的槽。
+ * 槽归消费者所有，DMA 不会再写入，用完后必须调用 pdm_frame_release 归还。
+ * timeout: 等待时间 ms，或 XYZN_OS_WAIT_FOREVER / XYZN_OS_WAIT_ON
+ * 返回: 帧指针，超时返回 NULL
+ */
+int16_t *pdm_frame_get(int64_t timeout);
+
+// 归还 pdm_frame_get 取到的槽
+void pdm_frame_release(int16_t *frame);
+
+// 帧采样完成（DMA 交回）时的 k_cycle_get_32()，用于统计采样到编码的延时与抖动
+uint32_t pdm_frame_cycles(const int16_t *frame);
+
+// 读取采样统计，自 pdm_start 起累计
+void pdm_get_stats(pdm_stats_t *stats);
+
+// 兼容接口：阻塞等待一帧并拷贝到 pdm_pcm_data，成功返回 0
+uint32_t get_pdm_sample(int16_t *pdm_pcm_data, uint32_t pdm_pcm_szie);
+
+#endif // _XYZN_PDM_H_
@@ -9,14 +9,157 @@
  */
 
 // #include <bluetooth/audio/lc3.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#ifdef CONFIG_NRFX_PDM
 #include <nrfx_pdm.h>
+#endif
 #include "xyzn_pdm.h"
 #include "bsp_log.h"
 #include "bal_os.h"
 
 #define TAG "XYZN_LE_AUDIO"
 
-static K_SEM_DEFINE(pcmsem, 0, 1);
+//==============================================================================================
+/*
+ * PCM 采样缓存环：
+ * 空闲槽索引在 pdm_free_msgq，采样完成的槽索引在 pdm_filled_msgq。
+ * 生产者（PDM 中断 / 仿真定时器）从空闲队列取槽交给 DMA，采样完成后放入完成队列；
+ * 消费者按指针取走完成的槽，编码后归还空闲队列。
+ * 一个槽任意时刻只属于 DMA、队列、消费者之一，DMA 不会写正在被读的槽，读取无需拷贝。
+ */
+static int16_t pcm_ring[PDM_PCM_RING_DEPTH][PDM_PCM_REQ_BUFFER_SIZE] __aligned(4);
+static uint32_t pcm_ring_cycles[PDM_PCM_RING_DEPTH]; // 各槽采样完成时刻
+K_MSGQ_DEFINE(pdm_free_msgq, sizeof(uint8_t), PDM_PCM_RING_DEPTH, 1);
+K_MSGQ_DEFINE(pdm_filled_msgq, sizeof(uint8_t), PDM_PCM_RING_DEPTH, 1);
+// 生产者（DMA）持有的槽，按位记录。停止采样时 DMA 不再交回，由 pdm_ring_reset 回收
+static atomic_t pdm_producer_slots;
+
+static atomic_t pdm_frames;
+static atomic_t pdm_overruns;
+static atomic_t pdm_overflows;
+
+/*
+ * 完成队列与生产者持有的槽归还空闲队列，统计清零。只能在采样停止时调用。
+ * 消费者持有的槽不在其中，仍由 pdm_frame_release 归还，同一个槽不会重复进入空闲队列。
+ */
+static void pdm_ring_reset(void)
+{
+    static bool pdm_ring_ready;
+    uint8_t id;
+    if (!pdm_ring_ready)
+    {
+        // 首次启动，所有槽都空闲
+        for (id = 0; id < PDM_PCM_RING_DEPTH; id++)
+        {
+            k_msgq_put(&pdm_free_msgq, &id, K_NO_WAIT);
+        }
+        pdm_ring_ready = true;
+    }
+    while (k_msgq_get(&pdm_filled_msgq, &id, K_NO_WAIT) == 0)
+    {
+        k_msgq_put(&pdm_free_msgq, &id, K_NO_WAIT);
+    }
+    for (id = 0; id < PDM_PCM_RING_DEPTH; id++)
+    {
+        if (atomic_test_and_clear_bit(&pdm_producer_slots, id))
+        {
+            k_msgq_put(&pdm_free_msgq, &id, K_NO_WAIT);
+        }
+    }
+    atomic_set(&pdm_frames, 0);
+    atomic_set(&pdm_overruns, 0);
+    atomic_set(&pdm_overflows, 0);
+}
+
+// 生产者申请一个槽。没有空闲槽时丢弃完成队列中最旧的一帧，复用它的槽
+static int16_t *pdm_ring_acquire(void)
+{
+    uint8_t id;
+    if (k_msgq_get(&pdm_free_msgq, &id, K_NO_WAIT) == 0)
+    {
+        atomic_set_bit(&pdm_producer_slots, id);
+        return pcm_ring[id];
+    }
+    if (k_msgq_get(&pdm_filled_msgq, &id, K_NO_WAIT) == 0)
+    {
+        atomic_inc(&pdm_overruns);
+        atomic_set_bit(&pdm_producer_slots, id);
+        return pcm_ring[id];
+    }
+    // 所有槽都在 DMA 或消费者手里
+    atomic_inc(&pdm_overflows);
+    return NULL;
+}
+
+// 生产者提交一个采样完成的槽
+static void pdm_ring_commit(int16_t *buffer)
+{
+    uint8_t id = (uint8_t)((buffer - pcm_ring[0]) / PDM_PCM_REQ_BUFFER_SIZE);
+    // 停止后迟到交回的槽已被 pdm_ring_reset 回收，不再提交
+    if (!atomic_test_and_clear_bit(&pdm_producer_slots, id))
+    {
+        return;
+    }
+    pcm_ring_cycles[id] = k_cycle_get_32();
+    atomic_inc(&pdm_frames);
+    // 完成队列深度与槽数相同，不会满
+    k_msgq_put(&pdm_filled_msgq, &id, K_NO_WAIT);
+}
+
+int16_t *pdm_frame_get(int64_t timeout)
+{
+    uint8_t id;
+    if (xyzn_os_msgq_receive(&pdm_filled_msgq, &id, timeout) != 0)
+    {
+        return NULL;
+    }
+    return pcm_ring[id];
+}
+
+void pdm_frame_release(int16_t *frame)
+{
+    if (frame == NULL)
+    {
+        return;
+    }
+    uint8_t id = (uint8_t)((frame - pcm_ring[0]) / PDM_PCM_REQ_BUFFER_SIZE);
+    if (id >= PDM_PCM_RING_DEPTH || frame != pcm_ring[id])
+    {
+        BSP_LOGE(TAG, "pdm frame release err %p", frame);
+        return;
+    }
+    k_msgq_put(&pdm_free_msgq, &id, K_NO_WAIT);
+}
+
+uint32_t pdm_frame_cycles(const int16_t *frame)
+{
+    uint8_t id = (uint8_t)((frame - pcm_ring[0]) / PDM_PCM_REQ_BUFFER_SIZE);
+    return id < PDM_PCM_RING_DEPTH ? pcm_ring_cycles[id] : 0;
+}
+
+void pdm_get_stats(pdm_stats_t *stats)
+{
+    stats->frames = (uint32_t)atomic_get(&pdm_frames);
+    stats->overruns = (uint32_t)atomic_get(&pdm_overruns);
+    stats->overflows = (uint32_t)atomic_get(&pdm_overflows);
+}
+
+uint32_t get_pdm_sample(int16_t *pdm_pcm_data, uint32_t pdm_pcm_szie)
+{
+    int16_t *frame = pdm_frame_get(XYZN_OS_WAIT_FOREVER);
+    if (frame == NULL)
+    {
+        return 1; // 未获取到数据
+    }
+    if (pdm_pcm_szie > PDM_PCM_REQ_BUFFER_SIZE)
+    {
+        pdm_pcm_szie = PDM_PCM_REQ_BUFFER_SIZE;
+    }
+    memcpy(pdm_pcm_data, frame, pdm_pcm_szie * sizeof(int16_t));
+    pdm_frame_release(frame);
+    return 0;
+}
 
 #ifdef CONFIG_NRFX_PDM
 
@@ -24,30 +167,27 @@ static K_SEM_DEFINE(pcmsem, 0, 1);
 #define NRF_GPIO_PIN_MAP(port, pin) (((port) << 5) | ((pin) & 0x1F))
 #define PDM_CLK NRF_GPIO_PIN_MAP(1, 12)
 #define PDM_DIN NRF_GPIO_PIN_MAP(1, 11)
-int16_t pcm_req_buffer[2][PDM_PCM_REQ_BUFFER_SIZE] = {0};
-uint8_t pcm_req_id = 0;
-uint8_t pdm_req_flag = 0;
-uint32_t pcm_req_buffer_size = (PDM_PCM_REQ_BUFFER_SIZE << 1);
 
 static const nrfx_pdm_t m_pdm = NRFX_PDM_INSTANCE(0);
 static void pcm_buffer_req_evt_handle(const nrfx_pdm_evt_t *evt)
 {
+    // 采样完成的缓存，先提交，保证申请时能丢弃的是最旧的一帧
+    if (evt->buffer_released != NULL)
+    {
+        pdm_ring_commit(evt->buffer_released);
+    }
     // 申请PCM采样缓存事件
     if (evt->buffer_requested)
     {
-        // 申请本次PCM采样缓存
-        nrfx_pdm_buffer_set(&m_pdm, pcm_req_buffer[pcm_req_id], PDM_PCM_REQ_BUFFER_SIZE);
-
-        // 切换采样buffer
-        pcm_req_id ^= 1;
-
-        // 设置采样到一组数据标志
-#if 1
-  
-        xyzn_os_sem_give(&pcmsem);
-#else
-        pdm_req_flag = 1;
-#endif
+        int16_t *buffer = pdm_ring_acquire();
+        if (buffer != NULL)
+        {
+            nrfx_pdm_buffer_set(&m_pdm, buffer, PDM_PCM_REQ_BUFFER_SIZE);
+        }
+    }
+    if (evt->error != NRFX_PDM_NO_ERROR)
+    {
+        atomic_inc(&pdm_overflows);
     }
 }
 
@@ -83,6 +223,7 @@ void pdm_init(void)
 void pdm_start(void)
 {
     BSP_LOGI(TAG, "pdm_start");
+    pdm_ring_reset();
     uint32_t err_code = nrfx_pdm_start(&m_pdm);
     if (err_code != NRFX_SUCCESS)
     {
@@ -108,35 +249,49 @@ void pdm_stop(void)
     }
 }
 
-uint32_t get_pdm_sample(int16_t *pdm_pcm_data, uint32_t pdm_pcm_szie)
-{
-    uint32_t err_code = 0;
-#if 1
-    xyzn_os_sem_take(&pcmsem, XYZN_OS_WAIT_FOREVER);
-    for (uint32_t i = 0; i < pdm_pcm_szie; i++)
-    {
-        pdm_pcm_data[i] = pcm_req_buffer[pcm_req_id][i];
-    }
-    // BSP_LOGI(TAG, "GET PCM DATA:%d", pdm_pcm_szie);
-    // BSP_LOG_BUFFER_HEX(TAG, pdm_pcm_data, pdm_pcm_szie * sizeof(int16_t));
-#else
+#elif defined(CONFIG_BOARD_NATIVE_SIM)
 
-    if (pdm_req_flag)
-    {
-        pdm_req_flag = 0;
+//==============================================================================================
+/*
+ * native_sim 仿真 PDM：定时器每 PDM_PCM_FRAME_MS 产生一帧，走与 PDM 中断相同的缓存环。
+ * 采样值为连续递增的采样计数（16 位回绕），消费者可据此检查帧的连续性与丢帧。
+ */
+static struct k_timer pdm_sim_timer;
+static uint16_t pdm_sim_sample;
 
-        for (uint32_t i = 0; i < pdm_pcm_szie; i++)
-        {
-            pdm_pcm_data[i] = pcm_req_buffer[pcm_req_id][i];
-        }
+static void pdm_sim_timer_handle(struct k_timer *timer)
+{
+    int16_t *buffer = pdm_ring_acquire();
+    if (buffer == NULL)
+    {
+        // 与硬件一致，没有槽时这一帧采样丢失
+        pdm_sim_sample += PDM_PCM_REQ_BUFFER_SIZE;
+        return;
     }
-    else
+    for (uint32_t i = 0; i < PDM_PCM_REQ_BUFFER_SIZE; i++)
     {
-        err_code = 1; // 未获取到数据
+        buffer[i] = (int16_t)pdm_sim_sample++;
     }
-#endif
+    pdm_ring_commit(buffer);
+}
 
-    return err_code;
+void pdm_init(void)
+{
+    xyzn_os_timer_create(&pdm_sim_timer, pdm_sim_timer_handle);
+}
+
+void pdm_start(void)
+{
+    BSP_LOGI(TAG, "pdm_start (native_sim)");
+    pdm_ring_reset();
+    pdm_sim_sample = 0;
+    xyzn_os_timer_start(&pdm_sim_timer, true, PDM_PCM_FRAME_MS);
 }
 
-#endif
\ No newline at end of file
+void pdm_stop(void)
+{
+    BSP_LOGI(TAG, "pdm_stop (native_sim)");
+    xyzn_os_timer_stop(&pdm_sim_timer);
+}
+
+#endif
@@ -0,0 +1,164 @@
+/*
+ * @FilePath     : main.c
+ * @Description  : PDM 采样缓存环测试：丢帧与溢出计数、启停前后槽的归属
+ *
+ * Copyright (c) XingYiZhiNeng 2025 , All Rights Reserved.
+ */
+
+#include <zephyr/ztest.h>
+#include "xyzn_pdm.c"
+
+#define FRAME PDM_PCM_REQ_BUFFER_SIZE
+
+/*
+ * 启动即停止：缓存环复位、统计清零、仿真采样计数归零，定时器不会触发，
+ * 帧全部由测试调用 pdm_sim_timer_handle 产生，结果确定。
+ */
+static void pdm_restart(void)
+{
+    pdm_start();
+    pdm_stop();
+}
+
+// 产生 n 帧，与仿真定时器触发一次相同
+static void pdm_produce(int n)
+{
+    while (n-- > 0)
+    {
+        pdm_sim_timer_handle(&pdm_sim_timer);
+    }
+}
+
+// 空闲与完成队列中的槽数，加上 held 个消费者持有的槽，应为全部槽，且无重复
+static void pdm_check_slots(int held)
+{
+    zassert_equal(k_msgq_num_used_get(&pdm_free_msgq) + k_msgq_num_used_get(&pdm_filled_msgq) + held,
+                  PDM_PCM_RING_DEPTH, "slots lost or duplicated");
+}
+
+static void *pdm_suite_setup(void)
+{
+    pdm_init();
+    return NULL;
+}
+
+static void pdm_before(void *fixture)
+{
+    int16_t *frame;
+    ARG_UNUSED(fixture);
+    pdm_restart();
+    while ((frame = pdm_frame_get(XYZN_OS_WAIT_ON)) != NULL)
+    {
+        pdm_frame_release(frame);
+    }
+    pdm_restart();
+}
+
+ZTEST(xyzn_pdm, test_frames_in_order)
+{
+    pdm_stats_t stats;
+    pdm_produce(3);
+    for (int i = 0; i < 3; i++)
+    {
+        int16_t *frame = pdm_frame_get(XYZN_OS_WAIT_ON);
+        zassert_not_null(frame);
+        zassert_equal(frame[0], i * FRAME);
+        zassert_equal(frame[FRAME - 1], i * FRAME + FRAME - 1);
+        pdm_frame_release(frame);
+    }
+    zassert_is_null(pdm_frame_get(XYZN_OS_WAIT_ON));
+    pdm_get_stats(&stats);
+    zassert_equal(stats.frames, 3);
+    zassert_equal(stats.overruns, 0);
+    zassert_equal(stats.overflows, 0);
+    pdm_check_slots(0);
+}
+
+// 消费者来不及取走时丢弃最旧的帧，保留最新的 PDM_PCM_RING_DEPTH 帧
+ZTEST(xyzn_pdm, test_overrun_drops_oldest)
+{
+    pdm_stats_t stats;
+    pdm_produce(PDM_PCM_RING_DEPTH + 2);
+    pdm_get_stats(&stats);
+    zassert_equal(stats.frames, PDM_PCM_RING_DEPTH + 2);
+    zassert_equal(stats.overruns, 2);
+    zassert_equal(stats.overflows, 0);
+    for (int i = 2; i < PDM_PCM_RING_DEPTH + 2; i++)
+    {
+        int16_t *frame = pdm_frame_get(XYZN_OS_WAIT_ON);
+        zassert_not_null(frame);
+        zassert_equal(frame[0], i * FRAME);
+        pdm_frame_release(frame);
+    }
+    zassert_is_null(pdm_frame_get(XYZN_OS_WAIT_ON));
+    pdm_check_slots(0);
+}
+
+// 消费者持有全部槽时，采样没有槽可用，计为溢出，持有的帧不被覆盖
+ZTEST(xyzn_pdm, test_overflow_keeps_held_frames)
+{
+    int16_t *held[PDM_PCM_RING_DEPTH];
+    pdm_stats_t stats;
+    pdm_produce(PDM_PCM_RING_DEPTH);
+    for (int i = 0; i < PDM_PCM_RING_DEPTH; i++)
+    {
+        held[i] = pdm_frame_get(XYZN_OS_WAIT_ON);
+        zassert_not_null(held[i]);
+    }
+    pdm_produce(2);
+    pdm_get_stats(&stats);
+    zassert_equal(stats.frames, PDM_PCM_RING_DEPTH);
+    zassert_equal(stats.overruns, 0);
+    zassert_equal(stats.overflows, 2);
+    for (int i = 0; i < PDM_PCM_RING_DEPTH; i++)
+    {
+        zassert_equal(held[i][0], i * FRAME);
+        pdm_frame_release(held[i]);
+    }
+    pdm_check_slots(0);
+}
+
+/*
+ * 编码中停止再启动：消费者持有的槽不回到空闲队列，新的采样不会覆盖它；
+ * 停止时 DMA 持有的槽被回收，停止后迟到交回也不会重复进入队列。
+ */
+ZTEST(xyzn_pdm, test_restart_while_frame_held)
+{
+    pdm_stats_t stats;
+    pdm_produce(2);
+    int16_t *held = pdm_frame_get(XYZN_OS_WAIT_ON);
+    zassert_not_null(held);
+    int16_t *dma = pdm_ring_acquire(); // 停止时 DMA 正在采样的槽
+    zassert_not_null(dma);
+
+    pdm_restart();
+    pdm_get_stats(&stats);
+    zassert_equal(stats.frames, 0);
+    zassert_equal(k_msgq_num_used_get(&pdm_filled_msgq), 0);
+    pdm_check_slots(1);
+
+    pdm_ring_commit(dma); // 迟到交回
+    zassert_equal(k_msgq_num_used_get(&pdm_filled_msgq), 0);
+    pdm_check_slots(1);
+
+    // 其余槽全部采满并循环覆盖，均不是消费者持有的槽
+    pdm_produce(2 * PDM_PCM_RING_DEPTH);
+    for (int i = 0; i < FRAME; i++)
+    {
+        zassert_equal(held[i], i, "held frame overwritten");
+    }
+    pdm_get_stats(&stats);
+    zassert_equal(stats.overruns, PDM_PCM_RING_DEPTH + 1);
+    zassert_equal(stats.overflows, 0);
+    int16_t *frame;
+    while ((frame = pdm_frame_get(XYZN_OS_WAIT_ON)) != NULL)
+    {
+        zassert_not_equal(frame, held);
+        pdm_frame_release(frame);
+    }
+
+    pdm_frame_release(held);
+    pdm_check_slots(0);
+}
+
+ZTEST_SUITE(xyzn_pdm, NULL, pdm_suite_setup, pdm_before, NULL, NULL);
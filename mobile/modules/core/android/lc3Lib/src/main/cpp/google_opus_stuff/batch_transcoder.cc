@@ -0,0 +1,821 @@
+#include "batch_transcoder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include "lc3.h"
+#include "ogg_opus_decoder.h"
+#include "lc3_opus_transcoder.h"
+#include "work_stealing_thread_pool.h"
+
+extern "C" {
+#include "opusenc.h"
+}
+
+namespace audio_util {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Duration of the PCM read, encoded and decoded at once.
+constexpr int kChunkMs = 20;
+
+// Quality of the resampling of the inputs, as opusenc below 48 kHz.
+constexpr int kResampleQuality = 5;
+
+double MillisecondsSince(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+bool EndsWith(const std::string& s, const std::string& suffix) {
+  return s.size() >= suffix.size() &&
+         s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+const char* CodecName(BatchJob::Codec codec) {
+  switch (codec) {
+    case BatchJob::Codec::kOpus:
+      return "opus";
+    case BatchJob::Codec::kLc3:
+      return "lc3";
+    case BatchJob::Codec::kLc3Opus:
+      return "lc3+opus";
+  }
+  return "";
+}
+
+bool ParseInt(const std::string& s, int* value) {
+  char* end = nullptr;
+  long x = strtol(s.c_str(), &end, 10);
+  if (s.empty() || *end != '\0' || x < 0 || x > 0x7fffffff) {
+    return false;
+  }
+  *value = static_cast<int>(x);
+  return true;
+}
+
+// LC3 frame size of the encoding, 0 when not encoding LC3.
+int Lc3FrameBytes(const BatchJob& job) {
+  switch (job.codec) {
+    case BatchJob::Codec::kOpus:
+      return 0;
+    case BatchJob::Codec::kLc3:
+      return job.lc3_frame_bytes > 0
+                 ? job.lc3_frame_bytes
+                 : lc3_frame_bytes(job.lc3_frame_us, job.bitrate_bps);
+    case BatchJob::Codec::kLc3Opus:
+      // As sent by the glasses.
+      return job.lc3_frame_bytes > 0 ? job.lc3_frame_bytes : 40;
+  }
+  return 0;
+}
+
+bool IsLc3Input(const BatchJob& job) { return EndsWith(job.input, ".lc3"); }
+
+// Settings of `job` the codecs do not support, as an error, empty if none.
+std::string CheckJob(const BatchJob& job) {
+  const int rate = job.sample_rate_hz;
+  const OggOpusEncoder::Options& options = job.opus_options;
+  if (job.codec != BatchJob::Codec::kLc3) {
+    if (rate != 8000 && rate != 12000 && rate != 16000 && rate != 24000 &&
+        rate != 48000) {
+      return "samplerate not supported by Opus";
+    }
+    const int d = options.frame_duration_us;
+    if (d != 2500 && d != 5000 && d != 10000 && d != 20000 && d != 40000 &&
+        d != 60000) {
+      return "Opus frame duration not supported";
+    }
+    if (options.complexity < 0 || options.complexity > 10 ||
+        job.bitrate_bps <= 0) {
+      return "Opus complexity or bitrate out of range";
+    }
+  }
+  if (job.codec != BatchJob::Codec::kOpus) {
+    if (lc3_frame_samples(job.lc3_frame_us, rate) < 0) {
+      return "samplerate or frame duration not supported by LC3";
+    }
+    const int bytes = Lc3FrameBytes(job);
+    if (bytes < LC3_MIN_FRAME_BYTES || bytes > LC3_MAX_FRAME_BYTES) {
+      return "LC3 frame size out of range";
+    }
+  }
+  if (IsLc3Input(job)) {
+    if (lc3_frame_samples(job.lc3_frame_us, job.input_rate_hz) < 0 ||
+        job.input_rate_hz > rate) {
+      return "LC3 input samplerate not supported";
+    }
+    if (job.input_frame_bytes < LC3_MIN_FRAME_BYTES ||
+        job.input_frame_bytes > LC3_MAX_FRAME_BYTES) {
+      return "LC3 input frame size out of range";
+    }
+  }
+  return std::string();
+}
+
+// Mono PCM at the codec samplerate, read by chunks.
+class PcmSource {
+ public:
+  virtual ~PcmSource() {}
+
+  // Reads up to `max_samples`; returns the number read, 0 at the end.
+  virtual size_t Read(int16_t* pcm, size_t max_samples) = 0;
+};
+
+// WAV or AIFF file, read by audio-in.c, downmixed and resampled as by
+// opusenc, in one pass.
+class AudioFileSource : public PcmSource {
+ public:
+  AudioFileSource()
+      : file_(nullptr),
+        format_(nullptr),
+        converted_(false),
+        skip_(0) {}
+
+  ~AudioFileSource() override {
+    if (converted_) {
+      clear_pipeline(&opt_);
+    }
+    if (format_) {
+      format_->close_func(opt_.readdata);
+    }
+    if (file_) {
+      fclose(file_);
+    }
+  }
+
+  std::string Open(const BatchJob& job, size_t max_samples) {
+    file_ = fopen(job.input.c_str(), "rb");
+    if (!file_) {
+      return "cannot open the input";
+    }
+    opt_ = oe_enc_opt();
+    opt_.infilename = const_cast<char*>(job.input.c_str());
+    format_ = open_audio_file(file_, &opt_);
+    if (!format_) {
+      return "input format not supported";
+    }
+    oe_pipeline_opt pipeline = {};
+    pipeline.scale = 1;
+    pipeline.channels = 1;
+    pipeline.rate = job.sample_rate_hz;
+    pipeline.quality = kResampleQuality;
+    if (!setup_pipeline(&opt_, &pipeline)) {
+      return "cannot resample the input";
+    }
+    converted_ = true;
+    if (opt_.channels != 1) {
+      return "cannot downmix the input";
+    }
+    // The resampler delay, dropped.
+    skip_ = opt_.skip;
+    buffer_.resize(max_samples);
+    return std::string();
+  }
+
+  size_t Read(int16_t* pcm, size_t max_samples) override {
+    for (;;) {
+      const long n = opt_.read_samples(opt_.readdata, buffer_.data(),
+                                       static_cast<int>(max_samples));
+      if (n <= 0) {
+        return 0;
+      }
+      const long skipped = std::min<long>(skip_, n);
+      skip_ -= skipped;
+      for (long i = skipped; i < n; i++) {
+        const float x = std::round(buffer_[i] * 32768.f);
+        *pcm++ =
+            static_cast<int16_t>(std::max(-32768.f, std::min(32767.f, x)));
+      }
+      if (n > skipped) {
+        return n - skipped;
+      }
+    }
+  }
+
+ private:
+  FILE* file_;
+  oe_enc_opt opt_;
+  input_format* format_;
+  bool converted_;
+  long skip_;
+  std::vector<float> buffer_;
+};
+
+// Raw LC3 frames, decoded as by Lc3OpusTranscoder, frames failing the
+// pre-validation concealed.
+class Lc3FileSource : public PcmSource {
+ public:
+  Lc3FileSource() : file_(nullptr), decoder_(nullptr), position_(0) {}
+
+  ~Lc3FileSource() override {
+    if (file_) {
+      fclose(file_);
+    }
+  }
+
+  std::string Open(const BatchJob& job) {
+    file_ = fopen(job.input.c_str(), "rb");
+    if (!file_) {
+      return "cannot open the input";
+    }
+    decoder_mem_.resize(lc3_decoder_size(job.lc3_frame_us, job.sample_rate_hz));
+    decoder_ = lc3_setup_decoder(job.lc3_frame_us, job.input_rate_hz,
+                                 job.sample_rate_hz, decoder_mem_.data());
+    frame_.resize(job.input_frame_bytes);
+    pcm_.resize(lc3_frame_samples(job.lc3_frame_us, job.sample_rate_hz));
+    position_ = pcm_.size();
+    return std::string();
+  }
+
+  size_t Read(int16_t* pcm, size_t max_samples) override {
+    size_t read = 0;
+    while (read < max_samples) {
+      if (position_ == pcm_.size()) {
+        // A trailing partial frame is dropped.
+        if (fread(frame_.data(), 1, frame_.size(), file_) != frame_.size()) {
+          break;
+        }
+        const bool valid =
+            lc3_check_frame(decoder_, frame_.data(), frame_.size()) == 0;
+        lc3_decode(decoder_, valid ? frame_.data() : nullptr, frame_.size(),
+                   LC3_PCM_FORMAT_S16, pcm_.data(), 1);
+        position_ = 0;
+      }
+      const size_t n = std::min(max_samples - read, pcm_.size() - position_);
+      std::copy(pcm_.begin() + position_, pcm_.begin() + position_ + n,
+                pcm + read);
+      position_ += n;
+      read += n;
+    }
+    return read;
+  }
+
+ private:
+  FILE* file_;
+  std::vector<unsigned char> decoder_mem_;
+  lc3_decoder_t decoder_;
+  std::vector<unsigned char> frame_;
+  std::vector<int16_t> pcm_;
+  size_t position_;  // Of the next sample of pcm_ to read.
+};
+
+// Encoder and decoder of a codec, streamed: the samples encoded are decoded
+// as soon as the encoder outputs them.
+class Codec {
+ public:
+  virtual ~Codec() {}
+
+  // Encodes `num_samples` more samples, appending those decoded to
+  // `decoded`, the times and bytes to `result`. Returns false on error.
+  virtual bool Process(const int16_t* pcm, size_t num_samples,
+                       BatchResult* result, std::vector<int16_t>* decoded) = 0;
+
+  // Encodes the samples pending, and decodes the end of the stream.
+  virtual bool Finish(BatchResult* result, std::vector<int16_t>* decoded) = 0;
+
+  // Decoded samples preceding those of the input.
+  virtual int delay_samples() const = 0;
+};
+
+// Decoder of an OggOpus stream, as received.
+class OpusStreamDecoder {
+ public:
+  explicit OpusStreamDecoder(int sample_rate_hz)
+      : decoder_(sample_rate_hz, 1), pcm_(decoder_.MinOutputSamples()) {}
+
+  bool Decode(const unsigned char* data, size_t size, BatchResult* result,
+              std::vector<int16_t>* decoded) {
+    result->encoded_bytes += size;
+    const auto start = Clock::now();
+    int n;
+    do {
+      n = decoder_.Decode(data, size, pcm_.data(), pcm_.size());
+      decoded->insert(decoded->end(), pcm_.begin(),
+                      pcm_.begin() + std::max(n, 0));
+      size = 0;
+    } while (n > 0);
+    result->decode_ms += MillisecondsSince(start);
+    return n == 0;
+  }
+
+ private:
+  OggOpusDecoder decoder_;
+  std::vector<int16_t> pcm_;
+};
+
+class OpusCodec : public Codec {
+ public:
+  explicit OpusCodec(const BatchJob& job)
+      : encoder_(1, job.sample_rate_hz, job.bitrate_bps, job.opus_options),
+        decoder_(job.sample_rate_hz) {}
+
+  bool Process(const int16_t* pcm, size_t num_samples, BatchResult* result,
+               std::vector<int16_t>* decoded) override {
+    const auto start = Clock::now();
+    bytes_.resize(encoder_.MaxOutputBytes(num_samples));
+    const int written =
+        encoder_.Process(pcm, num_samples, bytes_.data(), bytes_.size());
+    result->encode_ms += MillisecondsSince(start);
+    return written >= 0 &&
+           decoder_.Decode(bytes_.data(), written, result, decoded);
+  }
+
+  bool Finish(BatchResult* result, std::vector<int16_t>* decoded) override {
+    const auto start = Clock::now();
+    bytes_.resize(encoder_.MaxFlushBytes());
+    const int written = encoder_.Flush(bytes_.data(), bytes_.size());
+    result->encode_ms += MillisecondsSince(start);
+    return written >= 0 &&
+           decoder_.Decode(bytes_.data(), written, result, decoded);
+  }
+
+  // The decoder applies the pre-skip.
+  int delay_samples() const override { return 0; }
+
+ private:
+  OggOpusEncoder encoder_;
+  OpusStreamDecoder decoder_;
+  std::vector<unsigned char> bytes_;
+};
+
+// LC3 encoding, each frame decoded by liblc3.
+class Lc3Codec : public Codec {
+ public:
+  explicit Lc3Codec(const BatchJob& job)
+      : frame_bytes_(Lc3FrameBytes(job)),
+        delay_(lc3_delay_samples(job.lc3_frame_us, job.sample_rate_hz)),
+        encoder_mem_(lc3_encoder_size(job.lc3_frame_us, job.sample_rate_hz)),
+        encoder_(lc3_setup_encoder(job.lc3_frame_us, job.sample_rate_hz, 0,
+                                   encoder_mem_.data())),
+        decoder_mem_(lc3_decoder_size(job.lc3_frame_us, job.sample_rate_hz)),
+        decoder_(lc3_setup_decoder(job.lc3_frame_us, job.sample_rate_hz, 0,
+                                   decoder_mem_.data())),
+        pcm_(lc3_frame_samples(job.lc3_frame_us, job.sample_rate_hz)),
+        pcm_size_(0),
+        frame_(frame_bytes_),
+        num_samples_(0),
+        num_frames_(0) {}
+
+  bool Process(const int16_t* pcm, size_t num_samples, BatchResult* result,
+               std::vector<int16_t>* decoded) override {
+    num_samples_ += num_samples;
+    while (num_samples > 0) {
+      const size_t n = std::min(num_samples, pcm_.size() - pcm_size_);
+      std::copy(pcm, pcm + n, pcm_.begin() + pcm_size_);
+      pcm_size_ += n;
+      pcm += n;
+      num_samples -= n;
+      if (pcm_size_ == pcm_.size() && !EncodeFrame(result, decoded)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // The last frame is completed with silence, and followed by frames of
+  // silence covering the delay.
+  bool Finish(BatchResult* result, std::vector<int16_t>* decoded) override {
+    while (num_frames_ * pcm_.size() < num_samples_ + delay_) {
+      std::fill(pcm_.begin() + pcm_size_, pcm_.end(), 0);
+      pcm_size_ = pcm_.size();
+      if (!EncodeFrame(result, decoded)) {
+        return false;
+      }
+    }
+    return FinishFrames(result, decoded);
+  }
+
+  int delay_samples() const override { return delay_; }
+
+ protected:
+  // Takes an encoded frame.
+  virtual bool OnFrame(const unsigned char* frame, BatchResult* result,
+                       std::vector<int16_t>* decoded) {
+    result->encoded_bytes += frame_bytes_;
+    const auto start = Clock::now();
+    const size_t size = decoded->size();
+    decoded->resize(size + pcm_.size());
+    const int ret = lc3_decode(decoder_, frame, frame_bytes_,
+                               LC3_PCM_FORMAT_S16, decoded->data() + size, 1);
+    result->decode_ms += MillisecondsSince(start);
+    return ret == 0;
+  }
+
+  // Called after the last frame.
+  virtual bool FinishFrames(BatchResult* result,
+                            std::vector<int16_t>* decoded) {
+    return true;
+  }
+
+  const int frame_bytes_;
+
+ private:
+  bool EncodeFrame(BatchResult* result, std::vector<int16_t>* decoded) {
+    const auto start = Clock::now();
+    const int ret = lc3_encode(encoder_, LC3_PCM_FORMAT_S16, pcm_.data(), 1,
+                               frame_bytes_, frame_.data());
+    result->encode_ms += MillisecondsSince(start);
+    pcm_size_ = 0;
+    num_frames_++;
+    return ret == 0 && OnFrame(frame_.data(), result, decoded);
+  }
+
+  const int delay_;
+  std::vector<unsigned char> encoder_mem_;
+  lc3_encoder_t encoder_;
+  std::vector<unsigned char> decoder_mem_;
+  lc3_decoder_t decoder_;
+
+  std::vector<int16_t> pcm_;  // Frame being filled.
+  size_t pcm_size_;
+  std::vector<unsigned char> frame_;
+  uint64_t num_samples_;  // Given to Process().
+  uint64_t num_frames_;   // Encoded.
+};
+
+// LC3 encoding, transcoded to Opus as the phone does: the Opus stream is
+// what is sent, and decoded.
+class Lc3OpusCodec : public Lc3Codec {
+ public:
+  explicit Lc3OpusCodec(const BatchJob& job)
+      : Lc3Codec(job),
+        transcoder_(job.lc3_frame_us, frame_bytes_, job.sample_rate_hz,
+                    job.bitrate_bps, job.opus_options),
+        decoder_(job.sample_rate_hz) {}
+
+ protected:
+  bool OnFrame(const unsigned char* frame, BatchResult* result,
+               std::vector<int16_t>* decoded) override {
+    const auto start = Clock::now();
+    bytes_.resize(transcoder_.MaxOutputBytes(frame_bytes_));
+    const int written = transcoder_.Transcode(frame, frame_bytes_,
+                                              bytes_.data(), bytes_.size());
+    result->encode_ms += MillisecondsSince(start);
+    return written >= 0 &&
+           decoder_.Decode(bytes_.data(), written, result, decoded);
+  }
+
+  bool FinishFrames(BatchResult* result,
+                    std::vector<int16_t>* decoded) override {
+    const auto start = Clock::now();
+    bytes_.resize(transcoder_.MaxFlushBytes());
+    const int written = transcoder_.Flush(bytes_.data(), bytes_.size());
+    result->encode_ms += MillisecondsSince(start);
+    return written >= 0 &&
+           decoder_.Decode(bytes_.data(), written, result, decoded);
+  }
+
+ private:
+  Lc3OpusTranscoder transcoder_;
+  OpusStreamDecoder decoder_;
+  std::vector<unsigned char> bytes_;
+};
+
+// 16 bit mono WAV file, written as the samples come, its lengths set on
+// Close().
+class WavWriter {
+ public:
+  WavWriter() : file_(nullptr), ok_(true), num_samples_(0), rate_(0) {}
+
+  ~WavWriter() {
+    if (file_) {
+      fclose(file_);
+    }
+  }
+
+  bool Open(const std::string& path, int sample_rate_hz) {
+    file_ = fopen(path.c_str(), "wb");
+    rate_ = sample_rate_hz;
+    return file_ && WriteHeader();
+  }
+
+  // Host order: the tool runs on little endian hosts.
+  void Write(const int16_t* pcm, size_t num_samples) {
+    if (file_ && num_samples > 0) {
+      ok_ &= fwrite(pcm, sizeof(*pcm), num_samples, file_) == num_samples;
+      num_samples_ += num_samples;
+    }
+  }
+
+  bool Close() {
+    if (!file_) {
+      return true;
+    }
+    ok_ &= fseek(file_, 0, SEEK_SET) == 0 && WriteHeader();
+    ok_ &= fclose(file_) == 0;
+    file_ = nullptr;
+    return ok_;
+  }
+
+ private:
+  bool WriteHeader() {
+    const uint32_t data_bytes =
+        static_cast<uint32_t>(std::min<uint64_t>(num_samples_ * 2, 0xffffffdb));
+    std::string h;
+    auto put = [&h](uint32_t x, int bytes) {
+      for (int i = 0; i < bytes; i++) {
+        h.push_back(static_cast<char>(x >> (8 * i)));
+      }
+    };
+    h += "RIFF";
+    put(36 + data_bytes, 4);
+    h += "WAVEfmt ";
+    put(16, 4);
+    put(1, 2);  // PCM.
+    put(1, 2);  // Mono.
+    put(rate_, 4);
+    put(rate_ * 2, 4);
+    put(2, 2);
+    put(16, 2);
+    h += "data";
+    put(data_bytes, 4);
+    return fwrite(h.data(), 1, h.size(), file_) == h.size();
+  }
+
+  FILE* file_;
+  bool ok_;
+  uint64_t num_samples_;
+  int rate_;
+};
+
+// Compares the decoded samples to the input, the codec delay dropped, and
+// passes them to the writer. The input is kept until its decoded samples
+// come: over the latency of the codec and of its container only.
+class Scorer {
+ public:
+  Scorer(int delay_samples, WavWriter* writer)
+      : skip_(delay_samples), writer_(writer), signal_(0), noise_(0) {}
+
+  void AddInput(const int16_t* pcm, size_t num_samples) {
+    input_.insert(input_.end(), pcm, pcm + num_samples);
+  }
+
+  // Decoded samples beyond the input, of the padding of the last frame,
+  // are dropped.
+  void AddDecoded(const std::vector<int16_t>& decoded) {
+    const size_t skipped = std::min<size_t>(skip_, decoded.size());
+    skip_ -= skipped;
+    const size_t n = std::min(decoded.size() - skipped, input_.size());
+    for (size_t i = 0; i < n; i++) {
+      const double x = input_[i];
+      const double e = x - decoded[skipped + i];
+      signal_ += x * x;
+      noise_ += e * e;
+    }
+    input_.erase(input_.begin(), input_.begin() + n);
+    writer_->Write(decoded.data() + skipped, n);
+  }
+
+  // Infinite when lossless.
+  double snr_db() const {
+    return noise_ > 0 ? 10 * std::log10(signal_ / noise_) : INFINITY;
+  }
+
+ private:
+  size_t skip_;
+  WavWriter* writer_;
+  std::deque<int16_t> input_;
+  double signal_;
+  double noise_;
+};
+
+// Runs `job`, filling `result`; returns its status.
+std::string Run(const BatchJob& job, const std::string& output_path,
+                BatchResult* result) {
+  std::string error = CheckJob(job);
+  if (!error.empty()) {
+    return error;
+  }
+  const size_t chunk = job.sample_rate_hz / 1000 * kChunkMs;
+  std::unique_ptr<PcmSource> source;
+  if (IsLc3Input(job)) {
+    Lc3FileSource* lc3 = new Lc3FileSource;
+    source.reset(lc3);
+    error = lc3->Open(job);
+  } else {
+    AudioFileSource* audio = new AudioFileSource;
+    source.reset(audio);
+    error = audio->Open(job, chunk);
+  }
+  if (!error.empty()) {
+    return error;
+  }
+
+  std::unique_ptr<Codec> codec;
+  switch (job.codec) {
+    case BatchJob::Codec::kOpus:
+      codec.reset(new OpusCodec(job));
+      break;
+    case BatchJob::Codec::kLc3:
+      codec.reset(new Lc3Codec(job));
+      break;
+    case BatchJob::Codec::kLc3Opus:
+      codec.reset(new Lc3OpusCodec(job));
+      break;
+  }
+
+  WavWriter writer;
+  if (!output_path.empty() && !writer.Open(output_path, job.sample_rate_hz)) {
+    return "cannot write the output";
+  }
+  Scorer scorer(codec->delay_samples(), &writer);
+  std::vector<int16_t> pcm(chunk);
+  std::vector<int16_t> decoded;
+  for (;;) {
+    const auto start = Clock::now();
+    const size_t n = source->Read(pcm.data(), pcm.size());
+    result->read_ms += MillisecondsSince(start);
+    if (n == 0) {
+      break;
+    }
+    result->num_samples += n;
+    scorer.AddInput(pcm.data(), n);
+    decoded.clear();
+    if (!codec->Process(pcm.data(), n, result, &decoded)) {
+      return "codec error";
+    }
+    scorer.AddDecoded(decoded);
+  }
+  decoded.clear();
+  if (!codec->Finish(result, &decoded)) {
+    return "codec error";
+  }
+  scorer.AddDecoded(decoded);
+  result->snr_db = scorer.snr_db();
+  if (!writer.Close()) {
+    return "cannot write the output";
+  }
+  return "ok";
+}
+
+// Quoted when needed.
+std::string CsvField(const std::string& s) {
+  if (s.find_first_of(",\"\n") == std::string::npos) {
+    return s;
+  }
+  std::string quoted = "\"";
+  for (char c : s) {
+    quoted += c;
+    if (c == '"') {
+      quoted += c;
+    }
+  }
+  return quoted + "\"";
+}
+
+}  // namespace
+
+double BatchResult::bitrate_bps(int sample_rate_hz) const {
+  return num_samples > 0
+             ? encoded_bytes * 8. * sample_rate_hz / num_samples
+             : 0;
+}
+
+bool ParseBatchManifest(FILE* manifest, const std::string& base_directory,
+                        std::vector<BatchJob>* jobs, std::string* error) {
+  std::string line;
+  int line_number = 0;
+  for (int c = 0; c != EOF;) {
+    line.clear();
+    while ((c = fgetc(manifest)) != EOF && c != '\n') {
+      line += static_cast<char>(c);
+    }
+    line_number++;
+
+    std::istringstream fields(line);
+    std::string input, codec, rate, bitrate;
+    if (!(fields >> input) || input[0] == '#') {
+      continue;
+    }
+    auto fail = [&](const std::string& reason) {
+      *error = "line " + std::to_string(line_number) + ": " + reason;
+      return false;
+    };
+    BatchJob job;
+    job.input = input[0] == '/' || base_directory.empty()
+                    ? input
+                    : base_directory + "/" + input;
+    if (!(fields >> codec >> rate >> bitrate)) {
+      return fail("expected: input codec sample_rate_hz bitrate_bps");
+    }
+    if (codec == "opus") {
+      job.codec = BatchJob::Codec::kOpus;
+    } else if (codec == "lc3") {
+      job.codec = BatchJob::Codec::kLc3;
+    } else if (codec == "lc3+opus") {
+      job.codec = BatchJob::Codec::kLc3Opus;
+    } else {
+      return fail("unknown codec " + codec);
+    }
+    if (!ParseInt(rate, &job.sample_rate_hz) ||
+        !ParseInt(bitrate, &job.bitrate_bps)) {
+      return fail("malformed samplerate or bitrate");
+    }
+    job.input_rate_hz = job.sample_rate_hz;
+
+    std::string option;
+    while (fields >> option) {
+      const size_t equal = option.find('=');
+      const std::string key = option.substr(0, equal);
+      const std::string value =
+          equal == std::string::npos ? "" : option.substr(equal + 1);
+      OggOpusEncoder::Options& opus = job.opus_options;
+      bool ok = true;
+      if (key == "application") {
+        if (value == "voip") {
+          opus.application = OPUS_APPLICATION_VOIP;
+        } else if (value == "audio") {
+          opus.application = OPUS_APPLICATION_AUDIO;
+        } else if (value == "lowdelay") {
+          opus.application = OPUS_APPLICATION_RESTRICTED_LOWDELAY;
+        } else {
+          ok = false;
+        }
+      } else if (key == "complexity") {
+        ok = ParseInt(value, &opus.complexity);
+      } else if (key == "frame_us") {
+        ok = ParseInt(value, &opus.frame_duration_us);
+      } else if (key == "lc3_frame_us") {
+        ok = ParseInt(value, &job.lc3_frame_us);
+      } else if (key == "lc3_frame_bytes") {
+        ok = ParseInt(value, &job.lc3_frame_bytes);
+      } else if (key == "input_frame_bytes") {
+        ok = ParseInt(value, &job.input_frame_bytes);
+      } else if (key == "input_rate_hz") {
+        ok = ParseInt(value, &job.input_rate_hz);
+      } else {
+        return fail("unknown option " + key);
+      }
+      if (!ok) {
+        return fail("malformed option " + option);
+      }
+    }
+    jobs->push_back(job);
+  }
+  return true;
+}
+
+BatchResult RunBatchJob(const BatchJob& job, const std::string& output_path) {
+  const auto start = Clock::now();
+  BatchResult result;
+  result.status = Run(job, output_path, &result);
+  result.total_ms = MillisecondsSince(start);
+  return result;
+}
+
+std::string BatchCsvHeader() {
+  return "index,input,codec,sample_rate_hz,target_bitrate_bps,duration_s,"
+         "encoded_bytes,bitrate_bps,snr_db,read_ms,encode_ms,decode_ms,"
+         "total_ms,status\n";
+}
+
+std::string BatchCsvRow(size_t index, const BatchJob& job,
+                        const BatchResult& result) {
+  char numbers[256];
+  snprintf(numbers, sizeof(numbers),
+           "%d,%d,%.3f,%llu,%.0f,%.2f,%.1f,%.1f,%.1f,%.1f",
+           job.sample_rate_hz, job.bitrate_bps,
+           result.duration_s(job.sample_rate_hz),
+           static_cast<unsigned long long>(result.encoded_bytes),
+           result.bitrate_bps(job.sample_rate_hz), result.snr_db,
+           result.read_ms, result.encode_ms, result.decode_ms,
+           result.total_ms);
+  return std::to_string(index) + "," + CsvField(job.input) + "," +
+         CodecName(job.codec) + "," + numbers + "," +
+         CsvField(result.status) + "\n";
+}
+
+size_t RunBatch(const std::vector<BatchJob>& jobs, int num_threads,
+                FILE* csv, const std::string& output_directory) {
+  fputs(BatchCsvHeader().c_str(), csv);
+  fflush(csv);
+
+  std::mutex mutex;
+  size_t failed = 0;
+  WorkStealingThreadPool pool(num_threads);
+  for (size_t i = 0; i < jobs.size(); i++) {
+    pool.Submit([&, i]() {
+      const std::string output_path =
+          output_directory.empty()
+              ? std::string()
+              : output_directory + "/" + std::to_string(i) + ".wav";
+      const BatchResult result = RunBatchJob(jobs[i], output_path);
+      const std::string row = BatchCsvRow(i, jobs[i], result);
+      std::lock_guard<std::mutex> lock(mutex);
+      fputs(row.c_str(), csv);
+      fflush(csv);
+      failed += result.status != "ok";
+    });
+  }
+  pool.Wait();
+  return failed;
+}
+
+}  // namespace audio_util
@@ -0,0 +1,100 @@
+#ifndef AUDIO_UTIL_BATCH_TRANSCODER_H_
+#define AUDIO_UTIL_BATCH_TRANSCODER_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "ogg_opus_encoder.h"
+
+namespace audio_util {
+
+// Transcoding of a corpus of recordings, on the host, to compare codec
+// settings: each file is encoded, decoded back, and scored against its
+// input.
+//
+// The files are WAV or AIFF, read by opus-tools' audio-in.c, downmixed to
+// mono and resampled to the codec samplerate as by opusenc, or raw LC3
+// frames, as recorded from the glasses, decoded by liblc3. Each job streams
+// its file by frames of 20 ms through the encoder and the decoder: its
+// memory does not grow with the length of the file.
+
+// A file to transcode, and the codec settings.
+struct BatchJob {
+  enum class Codec {
+    kOpus,     // OggOpusEncoder, decoded by OggOpusDecoder.
+    kLc3,      // liblc3, at `lc3_frame_bytes` per frame.
+    kLc3Opus,  // LC3 to Opus, as the phone does, by Lc3OpusTranscoder.
+  };
+
+  std::string input;
+  Codec codec = Codec::kOpus;
+  int sample_rate_hz = 16000;
+  // Of the Opus encoder, or of the LC3 encoder for kLc3.
+  int bitrate_bps = 24000;
+  OggOpusEncoder::Options opus_options;
+
+  // LC3 encoding, of kLc3 and kLc3Opus: frames of `lc3_frame_us`, 7500 or
+  // 10000, of `lc3_frame_bytes`, from the bitrate for kLc3 when 0.
+  int lc3_frame_us = 10000;
+  int lc3_frame_bytes = 0;
+
+  // Raw LC3 input: mono frames of `input_frame_bytes` lasting
+  // `lc3_frame_us`, at `input_rate_hz`, decoded at `sample_rate_hz`, which
+  // must not be lower.
+  int input_frame_bytes = 40;
+  int input_rate_hz = 16000;
+};
+
+// Outcome of a job. On error, `status` holds the reason, and the other
+// fields are those reached.
+struct BatchResult {
+  std::string status;  // "ok", or the error.
+  uint64_t num_samples = 0;    // Input samples, at the codec samplerate.
+  uint64_t encoded_bytes = 0;  // Container included.
+  double snr_db = 0;           // Of the decoded output, against the input.
+  // Time spent reading the input, in the encoder and in the decoder.
+  double read_ms = 0;
+  double encode_ms = 0;
+  double decode_ms = 0;
+  double total_ms = 0;
+
+  double duration_s(int sample_rate_hz) const {
+    return static_cast<double>(num_samples) / sample_rate_hz;
+  }
+  double bitrate_bps(int sample_rate_hz) const;
+};
+
+// Parses a manifest, a job a line:
+//
+//   input codec sample_rate_hz bitrate_bps [key=value...]
+//
+// codec is opus, lc3 or lc3+opus. The keys are complexity, frame_us and
+// application (voip, audio or lowdelay) of Opus, lc3_frame_us and
+// lc3_frame_bytes, and input_frame_bytes and input_rate_hz of the .lc3
+// inputs. Relative inputs are taken from `base_directory`. Blank lines, and
+// lines starting with #, are skipped.
+// Returns false, with the line in error in `error`, on a malformed line.
+bool ParseBatchManifest(FILE* manifest, const std::string& base_directory,
+                        std::vector<BatchJob>* jobs, std::string* error);
+
+// Runs `job`. When `output_path` is not empty, the decoded audio is written
+// there, as a 16 bit mono WAV file.
+BatchResult RunBatchJob(const BatchJob& job, const std::string& output_path);
+
+// CSV header, and row of the job `index`, newline terminated.
+std::string BatchCsvHeader();
+std::string BatchCsvRow(size_t index, const BatchJob& job,
+                        const BatchResult& result);
+
+// Runs the `jobs` on a WorkStealingThreadPool of `num_threads`, the
+// hardware concurrency when 0, writing a CSV row to `csv` as each job
+// completes, the header first. The decoded audio is written to
+// `output_directory` when not empty, as <index>.wav.
+// Returns the number of jobs failed.
+size_t RunBatch(const std::vector<BatchJob>& jobs, int num_threads,
+                FILE* csv, const std::string& output_directory);
+
+}  // namespace audio_util
+
+#endif  // AUDIO_UTIL_BATCH_TRANSCODER_H_
@@ -0,0 +1,103 @@
+#ifndef AUDIO_UTIL_ENCODER_METRICS_H_
+#define AUDIO_UTIL_ENCODER_METRICS_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace audio_util {
+
+// Distribution of a metric, in power of two buckets: bucket 0 counts the
+// zero values, bucket i the values in [2^(i-1), 2^i), the last one all the
+// values above.
+struct EncoderMetricsHistogram {
+  static constexpr int kBuckets = 20;
+
+  uint64_t buckets[kBuckets];
+  uint64_t count;
+  uint64_t sum;
+  uint64_t max;
+};
+
+// Metrics of an encoder since its creation. Only 64-bit fields, so that it
+// can be copied as is into a Java direct buffer, read as longs in native
+// order: 4 histograms of 23 longs, buckets then count, sum and max.
+struct EncoderMetricsSnapshot {
+  EncoderMetricsHistogram encode_time_us;  // CPU time per frame encoded.
+  EncoderMetricsHistogram frame_bytes;     // Encoded bytes per frame.
+  EncoderMetricsHistogram page_packets;    // Packets per Ogg page output.
+  // Input buffered in the encoder, waiting for a whole frame, after each
+  // call.
+  EncoderMetricsHistogram buffered_us;
+};
+
+// Recorder of the EncoderMetricsSnapshot of an encoder, for monitoring its
+// cost on the devices in production.
+//
+// Recording is compiled in with AUDIO_UTIL_ENCODER_METRICS defined: two
+// clock reads and a few counter increments per frame. Otherwise the
+// recorder is empty, recording compiles to nothing, and the snapshots are
+// zero.
+//
+// Not thread safe: the snapshot is to be taken on the thread encoding.
+class EncoderMetrics {
+ public:
+#ifdef AUDIO_UTIL_ENCODER_METRICS
+  static constexpr bool kEnabled = true;
+
+  EncoderMetrics() { memset(&metrics_, 0, sizeof(metrics_)); }
+
+  void BeginFrame() { frame_start_ = std::chrono::steady_clock::now(); }
+
+  void EndFrame(size_t bytes) {
+    const auto elapsed = std::chrono::steady_clock::now() - frame_start_;
+    Record(std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+               .count(),
+           &metrics_.encode_time_us);
+    Record(bytes, &metrics_.frame_bytes);
+  }
+
+  void RecordPage(int packets) { Record(packets, &metrics_.page_packets); }
+
+  void RecordBuffered(int samples, int sample_rate_hz) {
+    Record(static_cast<uint64_t>(samples) * 1000000 / sample_rate_hz,
+           &metrics_.buffered_us);
+  }
+
+  void Snapshot(EncoderMetricsSnapshot* snapshot) const {
+    *snapshot = metrics_;
+  }
+
+ private:
+  static void Record(uint64_t value, EncoderMetricsHistogram* histogram) {
+    const int bucket = value == 0 ? 0 : 64 - __builtin_clzll(value);
+    histogram->buckets[bucket < EncoderMetricsHistogram::kBuckets
+                           ? bucket
+                           : EncoderMetricsHistogram::kBuckets - 1]++;
+    histogram->count++;
+    histogram->sum += value;
+    if (value > histogram->max) {
+      histogram->max = value;
+    }
+  }
+
+  std::chrono::steady_clock::time_point frame_start_;
+  EncoderMetricsSnapshot metrics_;
+#else
+  static constexpr bool kEnabled = false;
+
+  void BeginFrame() {}
+  void EndFrame(size_t bytes) {}
+  void RecordPage(int packets) {}
+  void RecordBuffered(int samples, int sample_rate_hz) {}
+
+  void Snapshot(EncoderMetricsSnapshot* snapshot) const {
+    memset(snapshot, 0, sizeof(*snapshot));
+  }
+#endif
+};
+
+}  // namespace audio_util
+
+#endif  // AUDIO_UTIL_ENCODER_METRICS_H_
@@ -0,0 +1,189 @@
+#include "lc3_opus_transcoder.h"
+#include <jni.h>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include "../lc3_opus_transcoder.h"
+
+namespace {
+
+using audio_util::Lc3OpusTranscoder;
+using audio_util::OggOpusEncoder;
+
+Lc3OpusTranscoder* GetInstance(jlong ptr) {
+  if (ptr == 0) {
+    fprintf(stderr, "Lc3OpusTranscoder called prior to init() or after "
+                    "free()!\n");
+  }
+  return reinterpret_cast<Lc3OpusTranscoder*>(ptr);
+}
+
+std::vector<jbyte>& ThreadScratch(size_t size) {
+  static thread_local std::vector<jbyte> scratch;
+  if (scratch.size() < size) scratch.resize(size);
+  return scratch;
+}
+
+}  // namespace
+
+JNIEXPORT jlong JNICALL TRANSCODER_JNI_METHOD(init)(
+    JNIEnv* env, jclass clazz, jint lc3_frame_duration_us,
+    jint lc3_frame_bytes, jint sample_rate_hz, jint bitrate_bits_per_second,
+    jint application, jint opus_frame_duration_us, jint complexity,
+    jboolean use_dtx, jboolean use_inband_fec,
+    jint expected_packet_loss_percent, jboolean raw_packets) {
+  OggOpusEncoder::Options options;
+  options.application = application;
+  options.frame_duration_us = opus_frame_duration_us;
+  options.complexity = complexity;
+  options.use_dtx = use_dtx;
+  options.use_inband_fec = use_inband_fec;
+  options.expected_packet_loss_percent = expected_packet_loss_percent;
+  options.low_latency_mode = true;
+  options.framing = raw_packets ? OggOpusEncoder::Framing::kRawLengthPrefixed
+                                : OggOpusEncoder::Framing::kOgg;
+  std::unique_ptr<Lc3OpusTranscoder> transcoder(new Lc3OpusTranscoder(
+      lc3_frame_duration_us, lc3_frame_bytes, sample_rate_hz,
+      bitrate_bits_per_second, options));
+  if (!transcoder->ok()) {
+    fprintf(stderr, "Lc3OpusTranscoder settings rejected\n");
+    return 0;
+  }
+  return reinterpret_cast<jlong>(transcoder.release());
+}
+
+JNIEXPORT jint JNICALL TRANSCODER_JNI_METHOD(transcode)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jbyteArray lc3,
+    jint offset, jint length, jbyteArray out) {
+  Lc3OpusTranscoder* transcoder = GetInstance(instance_ptr);
+  if (!transcoder) {
+    return -1;
+  }
+  if (offset < 0 || length < 0 ||
+      static_cast<jlong>(offset) + length > env->GetArrayLength(lc3)) {
+    fprintf(stderr, "transcode frames out of bounds\n");
+    return -1;
+  }
+  const jsize out_capacity = env->GetArrayLength(out);
+
+  // Copied through a scratch, the transcode runs outside of any critical
+  // section of the arrays, not blocking the garbage collector.
+  std::vector<jbyte>& scratch = ThreadScratch(length + out_capacity);
+  jbyte* lc3_bytes = scratch.data();
+  jbyte* out_bytes = scratch.data() + length;
+  env->GetByteArrayRegion(lc3, offset, length, lc3_bytes);
+  int written = transcoder->Transcode(
+      reinterpret_cast<const unsigned char*>(lc3_bytes), length,
+      reinterpret_cast<unsigned char*>(out_bytes), out_capacity);
+  if (written > 0) {
+    env->SetByteArrayRegion(out, 0, written, out_bytes);
+  }
+  return written;
+}
+
+JNIEXPORT jint JNICALL TRANSCODER_JNI_METHOD(transcodeBuffer)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jobject lc3, jint offset,
+    jint length, jobject out) {
+  Lc3OpusTranscoder* transcoder = GetInstance(instance_ptr);
+  if (!transcoder) {
+    return -1;
+  }
+  unsigned char* lc3_bytes =
+      static_cast<unsigned char*>(env->GetDirectBufferAddress(lc3));
+  unsigned char* out_bytes =
+      static_cast<unsigned char*>(env->GetDirectBufferAddress(out));
+  if (lc3_bytes == nullptr || out_bytes == nullptr) {
+    fprintf(stderr, "transcodeBuffer requires direct ByteBuffers\n");
+    return -1;
+  }
+  if (offset < 0 || length < 0 ||
+      static_cast<jlong>(offset) + length >
+          env->GetDirectBufferCapacity(lc3)) {
+    fprintf(stderr, "transcodeBuffer frames out of bounds\n");
+    return -1;
+  }
+  return transcoder->Transcode(lc3_bytes + offset, length, out_bytes,
+                               env->GetDirectBufferCapacity(out));
+}
+
+JNIEXPORT jint JNICALL TRANSCODER_JNI_METHOD(maxOutputBytes)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jint length) {
+  Lc3OpusTranscoder* transcoder = GetInstance(instance_ptr);
+  return transcoder ? transcoder->MaxOutputBytes(length) : -1;
+}
+
+JNIEXPORT jint JNICALL TRANSCODER_JNI_METHOD(flush)(JNIEnv* env, jclass clazz,
+                                                    jlong instance_ptr,
+                                                    jbyteArray out) {
+  Lc3OpusTranscoder* transcoder = GetInstance(instance_ptr);
+  if (!transcoder) {
+    return -1;
+  }
+  const jsize out_capacity = env->GetArrayLength(out);
+  std::vector<jbyte>& scratch = ThreadScratch(out_capacity);
+  int written = transcoder->Flush(
+      reinterpret_cast<unsigned char*>(scratch.data()), out_capacity);
+  if (written > 0) {
+    env->SetByteArrayRegion(out, 0, written, scratch.data());
+  }
+  return written;
+}
+
+JNIEXPORT jint JNICALL TRANSCODER_JNI_METHOD(maxFlushBytes)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr) {
+  Lc3OpusTranscoder* transcoder = GetInstance(instance_ptr);
+  return transcoder ? transcoder->MaxFlushBytes() : -1;
+}
+
+JNIEXPORT jint JNICALL TRANSCODER_JNI_METHOD(getPacketInfo)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jlongArray info) {
+  Lc3OpusTranscoder* transcoder = GetInstance(instance_ptr);
+  if (!transcoder) {
+    return -1;
+  }
+  constexpr int kLongsPerPacket = 4;
+  const std::vector<OggOpusEncoder::PacketInfo>& packets =
+      transcoder->packets();
+  const size_t count = std::min<size_t>(
+      packets.size(), env->GetArrayLength(info) / kLongsPerPacket);
+
+  jlong* values =
+      static_cast<jlong*>(env->GetPrimitiveArrayCritical(info, nullptr));
+  if (values == nullptr) {
+    return -1;
+  }
+  for (size_t i = 0; i < count; i++) {
+    values[i * kLongsPerPacket + 0] = packets[i].offset;
+    values[i * kLongsPerPacket + 1] = packets[i].length;
+    values[i * kLongsPerPacket + 2] = packets[i].granule_position;
+    values[i * kLongsPerPacket + 3] = packets[i].timestamp_us;
+  }
+  env->ReleasePrimitiveArrayCritical(info, values, 0);
+  return packets.size();
+}
+
+JNIEXPORT void JNICALL TRANSCODER_JNI_METHOD(getStats)(JNIEnv* env,
+                                                       jclass clazz,
+                                                       jlong instance_ptr,
+                                                       jlongArray stats) {
+  Lc3OpusTranscoder* transcoder = GetInstance(instance_ptr);
+  if (!transcoder || !stats) {
+    return;
+  }
+  const Lc3OpusTranscoder::Stats& s = transcoder->stats();
+  jlong values[3] = {
+      static_cast<jlong>(s.decoded_frames),
+      static_cast<jlong>(s.invalid_frames),
+      static_cast<jlong>(s.concealed_frames),
+  };
+  jsize count = env->GetArrayLength(stats);
+  env->SetLongArrayRegion(stats, 0, count < 3 ? count : 3, values);
+}
+
+JNIEXPORT void JNICALL TRANSCODER_JNI_METHOD(free)(JNIEnv* env, jclass clazz,
+                                                   jlong instance_ptr) {
+  delete reinterpret_cast<Lc3OpusTranscoder*>(instance_ptr);
+}
@@ -0,0 +1,62 @@
+#ifndef AUDIO_UTIL_JNI_LC3_OPUS_TRANSCODER_H_
+#define AUDIO_UTIL_JNI_LC3_OPUS_TRANSCODER_H_
+
+#include <jni.h>
+
+#define TRANSCODER_JNI_METHOD(fn) \
+  Java_com_mentra_lc3Lib_Lc3OpusTranscoder_##fn  // NOLINT
+
+extern "C" {
+// Create a transcoder of a mono LC3 stream, of `lc3_frame_bytes` bytes frames
+// lasting `lc3_frame_duration_us`, into Opus, with the settings of
+// OggOpusEncoder initWithOptions(). The pointer is returned in a jlong.
+// Remember to call free with the returned value when you're done.
+JNIEXPORT jlong JNICALL TRANSCODER_JNI_METHOD(init)(
+    JNIEnv* env, jclass clazz, jint lc3_frame_duration_us,
+    jint lc3_frame_bytes, jint sample_rate_hz, jint bitrate_bits_per_second,
+    jint application, jint opus_frame_duration_us, jint complexity,
+    jboolean use_dtx, jboolean use_inband_fec,
+    jint expected_packet_loss_percent, jboolean raw_packets);
+
+// Transcodes `length` bytes of LC3 frames from `lc3`, at `offset`, into
+// `out`. Returns the number of bytes written, or -1 when `out` is smaller
+// than maxOutputBytes(length).
+JNIEXPORT jint JNICALL TRANSCODER_JNI_METHOD(transcode)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jbyteArray lc3,
+    jint offset, jint length, jbyteArray out);
+
+// Same as transcode, on direct ByteBuffers.
+JNIEXPORT jint JNICALL TRANSCODER_JNI_METHOD(transcodeBuffer)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jobject lc3, jint offset,
+    jint length, jobject out);
+
+// Upper bound of the bytes output on transcoding `length` more bytes.
+JNIEXPORT jint JNICALL TRANSCODER_JNI_METHOD(maxOutputBytes)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jint length);
+
+// Tell the transcoder that there will be no more frames. `out` must hold
+// maxFlushBytes() bytes.
+JNIEXPORT jint JNICALL TRANSCODER_JNI_METHOD(flush)(JNIEnv* env, jclass clazz,
+                                                    jlong instance_ptr,
+                                                    jbyteArray out);
+
+JNIEXPORT jint JNICALL TRANSCODER_JNI_METHOD(maxFlushBytes)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr);
+
+// Same as OggOpusEncoder getPacketInfo, for the last transcode or flush.
+JNIEXPORT jint JNICALL TRANSCODER_JNI_METHOD(getPacketInfo)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jlongArray info);
+
+// Fill `stats` with the decoded, invalid and concealed LC3 frame counts,
+// as Lc3Cpp.getDecoderStats().
+JNIEXPORT void JNICALL TRANSCODER_JNI_METHOD(getStats)(JNIEnv* env,
+                                                       jclass clazz,
+                                                       jlong instance_ptr,
+                                                       jlongArray stats);
+
+// Releases all resources.
+JNIEXPORT void JNICALL TRANSCODER_JNI_METHOD(free)(JNIEnv* env, jclass clazz,
+                                                   jlong instance_ptr);
+
+}  // extern "C"
+#endif  // AUDIO_UTIL_JNI_LC3_OPUS_TRANSCODER_H_
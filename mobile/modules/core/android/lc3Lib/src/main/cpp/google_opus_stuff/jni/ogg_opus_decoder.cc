@@ -0,0 +1,165 @@
+#include "ogg_opus_decoder.h"
+#include <jni.h>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "../ogg_opus_decoder.h"
+
+namespace {
+
+using audio_util::OggOpusDecoder;
+
+// The decoder, and the scratch the bytes given to decode are copied to, for
+// the decoding to run outside of any critical section of the array.
+struct DecoderInstance {
+  DecoderInstance(int sample_rate_hz, int num_channels)
+      : decoder(sample_rate_hz, num_channels) {}
+
+  OggOpusDecoder decoder;
+  std::vector<jbyte> scratch;
+};
+
+DecoderInstance* GetInstance(jlong ptr) {
+  if (ptr == 0) {
+    fprintf(stderr, "OggOpusDecoder called prior to init() or after "
+                    "free()!\n");
+  }
+  return reinterpret_cast<DecoderInstance*>(ptr);
+}
+
+OggOpusDecoder* GetDecoder(jlong ptr) {
+  DecoderInstance* instance = GetInstance(ptr);
+  return instance ? &instance->decoder : nullptr;
+}
+
+// PCM output in a direct ByteBuffer, null when it is not one.
+int16_t* GetPcmBuffer(JNIEnv* env, jobject pcm, int num_channels,
+                      size_t* max_samples) {
+  void* address = env->GetDirectBufferAddress(pcm);
+  if (address == nullptr) {
+    fprintf(stderr, "OggOpusDecoder requires a direct ByteBuffer output\n");
+    return nullptr;
+  }
+  *max_samples = env->GetDirectBufferCapacity(pcm) /
+                 (num_channels * static_cast<jlong>(sizeof(int16_t)));
+  return static_cast<int16_t*>(address);
+}
+
+}  // namespace
+
+JNIEXPORT jlong JNICALL DECODER_JNI_METHOD(init)(JNIEnv* env, jclass clazz,
+                                                 jint sample_rate_hz,
+                                                 jint num_channels) {
+  if (!OggOpusDecoder::IsSupported(sample_rate_hz, num_channels)) {
+    fprintf(stderr, "OggOpusDecoder settings rejected: %d Hz, %d channels\n",
+            sample_rate_hz, num_channels);
+    return 0;
+  }
+  return reinterpret_cast<jlong>(
+      new DecoderInstance(sample_rate_hz, num_channels));
+}
+
+JNIEXPORT jint JNICALL DECODER_JNI_METHOD(decode)(JNIEnv* env, jclass clazz,
+                                                  jlong instance_ptr,
+                                                  jbyteArray data,
+                                                  jint offset, jint length,
+                                                  jobject pcm) {
+  DecoderInstance* instance = GetInstance(instance_ptr);
+  if (!instance) {
+    return -1;
+  }
+  OggOpusDecoder* decoder = &instance->decoder;
+  size_t max_samples = 0;
+  int16_t* samples =
+      GetPcmBuffer(env, pcm, decoder->num_channels(), &max_samples);
+  if (samples == nullptr) {
+    return -1;
+  }
+  if (length == 0) {
+    return decoder->Decode(nullptr, 0, samples, max_samples);
+  }
+  if (offset < 0 || length < 0 ||
+      static_cast<jlong>(offset) + length > env->GetArrayLength(data)) {
+    fprintf(stderr, "decode bytes out of bounds\n");
+    return -1;
+  }
+
+  std::vector<jbyte>& scratch = instance->scratch;
+  if (scratch.size() < static_cast<size_t>(length)) {
+    scratch.resize(length);
+  }
+  env->GetByteArrayRegion(data, offset, length, scratch.data());
+  return decoder->Decode(
+      reinterpret_cast<const unsigned char*>(scratch.data()), length, samples,
+      max_samples);
+}
+
+JNIEXPORT jint JNICALL DECODER_JNI_METHOD(decodeBuffer)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jobject data, jint offset,
+    jint length, jobject pcm) {
+  OggOpusDecoder* decoder = GetDecoder(instance_ptr);
+  if (!decoder) {
+    return -1;
+  }
+  size_t max_samples = 0;
+  int16_t* samples =
+      GetPcmBuffer(env, pcm, decoder->num_channels(), &max_samples);
+  const unsigned char* bytes =
+      static_cast<const unsigned char*>(env->GetDirectBufferAddress(data));
+  if (samples == nullptr || bytes == nullptr) {
+    fprintf(stderr, "decodeBuffer requires direct ByteBuffers\n");
+    return -1;
+  }
+  if (offset < 0 || length < 0 ||
+      static_cast<jlong>(offset) + length >
+          env->GetDirectBufferCapacity(data)) {
+    fprintf(stderr, "decodeBuffer bytes out of bounds\n");
+    return -1;
+  }
+  return decoder->Decode(bytes + offset, length, samples, max_samples);
+}
+
+JNIEXPORT jboolean JNICALL DECODER_JNI_METHOD(seek)(JNIEnv* env, jclass clazz,
+                                                    jlong instance_ptr,
+                                                    jlong granule_position) {
+  OggOpusDecoder* decoder = GetDecoder(instance_ptr);
+  return decoder && decoder->Seek(granule_position);
+}
+
+JNIEXPORT jint JNICALL DECODER_JNI_METHOD(minOutputSamples)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr) {
+  OggOpusDecoder* decoder = GetDecoder(instance_ptr);
+  return decoder ? decoder->MinOutputSamples() : -1;
+}
+
+JNIEXPORT jboolean JNICALL DECODER_JNI_METHOD(isFinished)(JNIEnv* env,
+                                                          jclass clazz,
+                                                          jlong instance_ptr) {
+  OggOpusDecoder* decoder = GetDecoder(instance_ptr);
+  return decoder && decoder->finished();
+}
+
+JNIEXPORT void JNICALL DECODER_JNI_METHOD(getStats)(JNIEnv* env,
+                                                    jclass clazz,
+                                                    jlong instance_ptr,
+                                                    jlongArray stats) {
+  OggOpusDecoder* decoder = GetDecoder(instance_ptr);
+  if (!decoder || !stats) {
+    return;
+  }
+  const OggOpusDecoder::Stats& s = decoder->stats();
+  jlong values[5] = {
+      static_cast<jlong>(s.pages),
+      static_cast<jlong>(s.packets),
+      static_cast<jlong>(s.corrupted_pages),
+      static_cast<jlong>(s.lost_pages),
+      static_cast<jlong>(s.concealed_samples),
+  };
+  jsize count = env->GetArrayLength(stats);
+  env->SetLongArrayRegion(stats, 0, count < 5 ? count : 5, values);
+}
+
+JNIEXPORT void JNICALL DECODER_JNI_METHOD(free)(JNIEnv* env, jclass clazz,
+                                                jlong instance_ptr) {
+  delete reinterpret_cast<DecoderInstance*>(instance_ptr);
+}
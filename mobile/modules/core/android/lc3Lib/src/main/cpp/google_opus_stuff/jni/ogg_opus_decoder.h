@@ -0,0 +1,61 @@
+#ifndef AUDIO_UTIL_JNI_OGG_OPUS_DECODER_H_
+#define AUDIO_UTIL_JNI_OGG_OPUS_DECODER_H_
+
+#include <jni.h>
+
+#define DECODER_JNI_METHOD(fn) \
+  Java_com_mentra_lc3Lib_OggOpusDecoder_##fn  // NOLINT
+
+extern "C" {
+// Create a streaming decoder of an OggOpus stream, to `num_channels`
+// channels of 16-bit PCM at `sample_rate_hz`. The pointer is returned in a
+// jlong. Remember to call free with the returned value when you're done.
+JNIEXPORT jlong JNICALL DECODER_JNI_METHOD(init)(JNIEnv* env, jclass clazz,
+                                                 jint sample_rate_hz,
+                                                 jint num_channels);
+
+// Parses `length` more bytes of the stream from `data`, at `offset`, and
+// decodes the packets completed into the direct ByteBuffer `pcm`, which must
+// hold minOutputSamples() samples. Packets not fitting are kept: call again,
+// with a 0 `length`, until 0 is returned. Returns the number of samples per
+// channel written, or -1 when the stream is not supported.
+JNIEXPORT jint JNICALL DECODER_JNI_METHOD(decode)(JNIEnv* env, jclass clazz,
+                                                  jlong instance_ptr,
+                                                  jbyteArray data,
+                                                  jint offset, jint length,
+                                                  jobject pcm);
+
+// Same as decode, the stream bytes being read from a direct ByteBuffer.
+JNIEXPORT jint JNICALL DECODER_JNI_METHOD(decodeBuffer)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jobject data, jint offset,
+    jint length, jobject pcm);
+
+// Restarts the decoding at the page found by OggOpusIndex.seek(), whose
+// bytes are to be given next, the output starting at `granule_position`.
+// Returns false until the headers are decoded.
+JNIEXPORT jboolean JNICALL DECODER_JNI_METHOD(seek)(JNIEnv* env, jclass clazz,
+                                                    jlong instance_ptr,
+                                                    jlong granule_position);
+
+// Samples per channel of the longest packet, the smallest output accepted.
+JNIEXPORT jint JNICALL DECODER_JNI_METHOD(minOutputSamples)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr);
+
+// Whether the last page of the stream was decoded.
+JNIEXPORT jboolean JNICALL DECODER_JNI_METHOD(isFinished)(JNIEnv* env,
+                                                          jclass clazz,
+                                                          jlong instance_ptr);
+
+// Fill `stats` with the pages, packets, corrupted pages, lost pages and
+// concealed samples counts.
+JNIEXPORT void JNICALL DECODER_JNI_METHOD(getStats)(JNIEnv* env,
+                                                    jclass clazz,
+                                                    jlong instance_ptr,
+                                                    jlongArray stats);
+
+// Releases all resources.
+JNIEXPORT void JNICALL DECODER_JNI_METHOD(free)(JNIEnv* env, jclass clazz,
+                                                jlong instance_ptr);
+
+}  // extern "C"
+#endif  // AUDIO_UTIL_JNI_OGG_OPUS_DECODER_H_
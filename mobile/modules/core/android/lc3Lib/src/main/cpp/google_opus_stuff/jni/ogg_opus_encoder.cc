@@ -16,13 +16,38 @@
 
 #include "ogg_opus_encoder.h"
 #include <jni.h>
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
+#include <memory>
 #include "../ogg_opus_encoder.h"
+#include "../ogg_opus_encoder_pool.h"
 
 namespace {
 
 using audio_util::OggOpusEncoder;
+using audio_util::OggOpusEncoderPool;
+
+// Idle encoders kept for the next streams, see OggOpusEncoderPool: as many
+// as there are streams of different settings in a session.
+constexpr size_t kMaxIdleEncoders = 4;
+
+OggOpusEncoderPool& EncoderPool() {
+  static OggOpusEncoderPool* pool = new OggOpusEncoderPool(kMaxIdleEncoders);
+  return *pool;
+}
+
+// Returns 0 when the settings are rejected, as before init().
+jlong AcquireEncoder(int num_channels, int sample_rate_hz, int bitrate_bps,
+                     const OggOpusEncoder::Options& options) {
+  std::unique_ptr<OggOpusEncoder> encoder = EncoderPool().Acquire(
+      num_channels, sample_rate_hz, bitrate_bps, options, 0);
+  if (!encoder) {
+    fprintf(stderr, "OggOpusEncoder settings rejected\n");
+  }
+  return reinterpret_cast<jlong>(encoder.release());
+}
 
 OggOpusEncoder* GetInstanceOrDie(jlong ptr) {
   assert(ptr);
@@ -43,6 +68,29 @@ bool VerifyInitialized(const std::string& function_name, jlong instance_ptr) {
   return true;
 }
 
+// Whether [offset, offset + length) is a span of whole 16-bit samples within
+// `capacity` bytes.
+bool InBounds(jlong capacity, jint offset, jint length) {
+  return offset >= 0 && length >= 0 && length % 2 == 0 &&
+         static_cast<jlong>(offset) + length <= capacity;
+}
+
+bool InBounds(JNIEnv* env, jarray array, jint offset, jint length) {
+  return InBounds(env->GetArrayLength(array), offset, length);
+}
+
+// Scratch of the array variants, reused by the calls of a thread: the PCM
+// is copied out of the Java array so that no critical section spans the
+// encoding, which would hold the GC back. Only processAudioBuffer, on
+// direct buffers, encodes with no copy at all.
+std::vector<jbyte>& ThreadScratch(size_t size) {
+  static thread_local std::vector<jbyte> scratch;
+  if (scratch.size() < size) {
+    scratch.resize(size);
+  }
+  return scratch;
+}
+
 JNIEXPORT jbyteArray convertToByteArray(const std::vector<unsigned char>& data,
                                         JNIEnv* env) {
   jbyteArray byteArray = env->NewByteArray(data.size());
@@ -53,19 +101,96 @@ JNIEXPORT jbyteArray convertToByteArray(const std::vector<unsigned char>& data,
 
 }  // namespace
 
-JNIEXPORT jlong JNICALL JNI_METHOD(init)(JNIEnv* env, jobject instance,
+JNIEXPORT jlong JNICALL JNI_METHOD(init)(JNIEnv* env, jclass clazz,
                                          jint num_channels,
                                          jint bitrate_bits_per_second,
                                          jint sample_rate_hz,
                                          jboolean use_vbr) {
-  constexpr bool low_latency_mode = true;
-  return reinterpret_cast<jlong>(new OggOpusEncoder(
-      num_channels, sample_rate_hz, bitrate_bits_per_second, use_vbr,
-      low_latency_mode));
+  OggOpusEncoder::Options options;
+  options.use_vbr = use_vbr;
+  options.low_latency_mode = true;
+  return AcquireEncoder(num_channels, sample_rate_hz, bitrate_bits_per_second,
+                        options);
+}
+
+JNIEXPORT jlong JNICALL JNI_METHOD(initRawPackets)(JNIEnv* env,
+                                                   jclass clazz,
+                                                   jint num_channels,
+                                                   jint bitrate_bits_per_second,
+                                                   jint sample_rate_hz,
+                                                   jboolean use_vbr) {
+  OggOpusEncoder::Options options;
+  options.use_vbr = use_vbr;
+  options.low_latency_mode = true;
+  options.framing = OggOpusEncoder::Framing::kRawLengthPrefixed;
+  return AcquireEncoder(num_channels, sample_rate_hz, bitrate_bits_per_second,
+                        options);
+}
+
+JNIEXPORT jlong JNICALL JNI_METHOD(initWithOptions)(
+    JNIEnv* env, jclass clazz, jint num_channels,
+    jint bitrate_bits_per_second, jint sample_rate_hz, jboolean use_vbr,
+    jint application, jint frame_duration_us, jint complexity,
+    jboolean use_dtx, jboolean use_inband_fec,
+    jint expected_packet_loss_percent, jboolean raw_packets) {
+  OggOpusEncoder::Options options;
+  options.application = application;
+  options.frame_duration_us = frame_duration_us;
+  options.complexity = complexity;
+  options.use_vbr = use_vbr;
+  options.use_dtx = use_dtx;
+  options.use_inband_fec = use_inband_fec;
+  options.expected_packet_loss_percent = expected_packet_loss_percent;
+  options.low_latency_mode = true;
+  options.framing = raw_packets ? OggOpusEncoder::Framing::kRawLengthPrefixed
+                                : OggOpusEncoder::Framing::kOgg;
+  return AcquireEncoder(num_channels, sample_rate_hz, bitrate_bits_per_second,
+                        options);
+}
+
+JNIEXPORT jlong JNICALL JNI_METHOD(initMultistream)(
+    JNIEnv* env, jclass clazz, jint num_channels,
+    jint bitrate_bits_per_second, jint sample_rate_hz, jboolean use_vbr,
+    jboolean uncoupled_streams) {
+  OggOpusEncoder::Options options;
+  options.use_vbr = use_vbr;
+  options.low_latency_mode = true;
+  options.mapping_family = 1;
+  options.uncoupled_streams = uncoupled_streams;
+  return AcquireEncoder(num_channels, sample_rate_hz, bitrate_bits_per_second,
+                        options);
+}
+
+JNIEXPORT jint JNICALL JNI_METHOD(getPacketInfo)(JNIEnv* env,
+                                                 jclass clazz,
+                                                 jlong instance_ptr,
+                                                 jlongArray info) {
+  if (!VerifyInitialized("getPacketInfo", instance_ptr)) {
+    return -1;
+  }
+  constexpr int kLongsPerPacket = 4;
+  const std::vector<OggOpusEncoder::PacketInfo>& packets =
+      GetInstanceOrDie(instance_ptr)->packets();
+  const size_t count = std::min<size_t>(
+      packets.size(), env->GetArrayLength(info) / kLongsPerPacket);
+
+  jlong* values =
+      static_cast<jlong*>(env->GetPrimitiveArrayCritical(info, nullptr));
+  if (values == nullptr) {
+    return -1;
+  }
+  for (size_t i = 0; i < count; i++) {
+    values[i * kLongsPerPacket + 0] = packets[i].offset;
+    values[i * kLongsPerPacket + 1] = packets[i].length;
+    values[i * kLongsPerPacket + 2] = packets[i].granule_position;
+    values[i * kLongsPerPacket + 3] = packets[i].timestamp_us;
+  }
+  env->ReleasePrimitiveArrayCritical(info, values, 0);
+  return packets.size();
 }
 
 JNIEXPORT jbyteArray JNICALL
-JNI_METHOD(processAudioBytes)(JNIEnv* env, jobject instance, jlong instance_ptr,
+JNI_METHOD(processAudioBytes)(JNIEnv* env, jclass clazz, jlong instance_ptr,
                               jbyteArray samples, jint offset, jint length) {
   if (!VerifyInitialized("processAudioBytes", instance_ptr)) {
     return convertToByteArray(std::vector<unsigned char>(0), env);
@@ -74,23 +199,121 @@ JNI_METHOD(processAudioBytes)(JNIEnv* env, jobject instance, jlong instance_ptr,
   if (!array_length_bytes) {
     fprintf(stdout, "Found empty array\n");
   }
-  assert(array_length_bytes % 2 == 0 && "int16 formatted stream missing bytes!");
-  std::vector<int16_t> pcm(array_length_bytes / 2);
-  env->GetByteArrayRegion(samples, offset, array_length_bytes,
-                          reinterpret_cast<jbyte*>(pcm.data()));
-  if (env->ExceptionOccurred()) {
-    fprintf(stderr, "Exception occurred in java Environment object\n");
+  if (!InBounds(env, samples, offset, length)) {
+    fprintf(stderr,
+            "processAudioBytes samples out of bounds or of an odd length\n");
+    return convertToByteArray(std::vector<unsigned char>(0), env);
+  }
+
+  std::vector<jbyte>& pcm = ThreadScratch(length);
+  env->GetByteArrayRegion(samples, offset, length, pcm.data());
+  const std::vector<unsigned char>& encoded =
+      GetInstanceOrDie(instance_ptr)
+          ->Process(reinterpret_cast<const int16_t*>(pcm.data()),
+                    array_length_bytes / 2);
+
+  return convertToByteArray(encoded, env);
+}
+
+JNIEXPORT jint JNICALL
+JNI_METHOD(processAudioBytesInto)(JNIEnv* env, jclass clazz,
+                                  jlong instance_ptr, jbyteArray samples,
+                                  jint offset, jint length, jbyteArray out) {
+  if (!VerifyInitialized("processAudioBytesInto", instance_ptr)) {
+    return -1;
+  }
+  if (!InBounds(env, samples, offset, length)) {
+    fprintf(stderr,
+            "processAudioBytesInto samples out of bounds or of an odd length\n");
+    return -1;
+  }
+  const jsize out_capacity = env->GetArrayLength(out);
+
+  // PCM then encoded bytes, in the one scratch.
+  std::vector<jbyte>& scratch = ThreadScratch(length + out_capacity);
+  jbyte* pcm = scratch.data();
+  jbyte* out_bytes = scratch.data() + length;
+  env->GetByteArrayRegion(samples, offset, length, pcm);
+  int written = GetInstanceOrDie(instance_ptr)
+                    ->Process(reinterpret_cast<const int16_t*>(pcm),
+                              length / 2,
+                              reinterpret_cast<unsigned char*>(out_bytes),
+                              out_capacity);
+  if (written > 0) {
+    env->SetByteArrayRegion(out, 0, written, out_bytes);
+  }
+  return written;
+}
+
+JNIEXPORT jint JNICALL
+JNI_METHOD(processAudioBuffer)(JNIEnv* env, jclass clazz,
+                               jlong instance_ptr, jobject samples,
+                               jint offset, jint length, jobject out) {
+  if (!VerifyInitialized("processAudioBuffer", instance_ptr)) {
+    return -1;
+  }
+  jbyte* bytes = static_cast<jbyte*>(env->GetDirectBufferAddress(samples));
+  unsigned char* out_bytes =
+      static_cast<unsigned char*>(env->GetDirectBufferAddress(out));
+  if (bytes == nullptr || out_bytes == nullptr) {
+    fprintf(stderr, "processAudioBuffer requires direct ByteBuffers\n");
+    return -1;
+  }
+  if (!InBounds(env->GetDirectBufferCapacity(samples), offset, length)) {
+    fprintf(stderr,
+            "processAudioBuffer samples out of bounds or of an odd length\n");
+    return -1;
+  }
+  return GetInstanceOrDie(instance_ptr)
+      ->Process(reinterpret_cast<const int16_t*>(bytes + offset), length / 2,
+                out_bytes, env->GetDirectBufferCapacity(out));
+}
+
+JNIEXPORT jint JNICALL JNI_METHOD(maxOutputBytes)(JNIEnv* env,
+                                                  jclass clazz,
+                                                  jlong instance_ptr,
+                                                  jint length) {
+  if (!VerifyInitialized("maxOutputBytes", instance_ptr)) {
+    return -1;
   }
+  return GetInstanceOrDie(instance_ptr)->MaxOutputBytes(length / 2);
+}
 
-  return convertToByteArray(GetInstanceOrDie(instance_ptr)->Process(pcm), env);
+JNIEXPORT jint JNICALL JNI_METHOD(getMetrics)(JNIEnv* env, jclass clazz,
+                                              jlong instance_ptr,
+                                              jobject out) {
+  if (!VerifyInitialized("getMetrics", instance_ptr)) {
+    return -1;
+  }
+  void* out_bytes = env->GetDirectBufferAddress(out);
+  if (out_bytes == nullptr ||
+      env->GetDirectBufferCapacity(out) <
+          static_cast<jlong>(sizeof(audio_util::EncoderMetricsSnapshot))) {
+    return -1;
+  }
+  // Copied, the buffer address not being necessarily aligned.
+  audio_util::EncoderMetricsSnapshot snapshot;
+  GetInstanceOrDie(instance_ptr)->GetMetrics(&snapshot);
+  memcpy(out_bytes, &snapshot, sizeof(snapshot));
+  return sizeof(snapshot);
 }
 
-JNIEXPORT jbyteArray JNICALL JNI_METHOD(flush)(JNIEnv* env, jobject instance,
+JNIEXPORT jbyteArray JNICALL JNI_METHOD(flush)(JNIEnv* env, jclass clazz,
                                                jlong instance_ptr) {
   return convertToByteArray(GetInstanceOrDie(instance_ptr)->Flush(), env);
 }
 
-JNIEXPORT void JNICALL JNI_METHOD(free)(JNIEnv* env, jobject instance,
+JNIEXPORT void JNICALL JNI_METHOD(reset)(JNIEnv* env, jclass clazz,
+                                         jlong instance_ptr,
+                                         jint serial_number) {
+  if (!VerifyInitialized("reset", instance_ptr)) {
+    return;
+  }
+  GetInstanceOrDie(instance_ptr)->Reset(static_cast<uint32_t>(serial_number));
+}
+
+JNIEXPORT void JNICALL JNI_METHOD(free)(JNIEnv* env, jclass clazz,
                                         jlong instance_ptr) {
-  delete reinterpret_cast<OggOpusEncoder*>(instance_ptr);
+  EncoderPool().Release(std::unique_ptr<OggOpusEncoder>(
+      reinterpret_cast<OggOpusEncoder*>(instance_ptr)));
 }
@@ -19,34 +19,117 @@
 
 #include <jni.h>
 
-// https://stackoverflow.com/questions/25363027/jni-getmethodid-not-working-for-constructor-of-inner-class
 #define JNI_METHOD(fn) \
-  Java_com_augmentos_smartglassesmanager_speechrecognition_google_asr_asrhelpers_StreamingAudioEncoder_00024OggOpusEncoder_##fn  // NOLINT
+  Java_com_mentra_lc3Lib_OggOpusEncoder_##fn  // NOLINT
 
 extern "C" {
 // Create opus encoder instance. The pointer is returned in a
 // jlong. Remember to call destroy with the returned value when you're done.
+// An encoder of the same settings freed before is reused.
 JNIEXPORT jlong JNICALL JNI_METHOD(init)(JNIEnv* env,
-                                         jobject instance,
+                                         jclass clazz,
                                          jint num_channels,
                                          jint bitrate_bits_per_second,
                                          jint sample_rate_hz,
                                          jboolean use_vbr);
 
+// Same as init, for an encoder outputting raw length prefixed Opus packets
+// instead of Ogg pages, see getPacketInfo for their granule and timestamp.
+JNIEXPORT jlong JNICALL JNI_METHOD(initRawPackets)(JNIEnv* env,
+                                                   jclass clazz,
+                                                   jint num_channels,
+                                                   jint bitrate_bits_per_second,
+                                                   jint sample_rate_hz,
+                                                   jboolean use_vbr);
+
+// Same as init, with the encoder settings of OggOpusEncoder::Options:
+// `application` is one of the OPUS_APPLICATION_* values, `frame_duration_us`
+// one of 2500, 5000, 10000, 20000, 40000 or 60000. The encoder outputs raw
+// length prefixed packets when `raw_packets` is set, Ogg pages otherwise.
+JNIEXPORT jlong JNICALL JNI_METHOD(initWithOptions)(
+    JNIEnv* env, jclass clazz, jint num_channels,
+    jint bitrate_bits_per_second, jint sample_rate_hz, jboolean use_vbr,
+    jint application, jint frame_duration_us, jint complexity,
+    jboolean use_dtx, jboolean use_inband_fec,
+    jint expected_packet_loss_percent, jboolean raw_packets);
+
+// Same as init, for 1 to 8 interleaved channels, as of a microphone array,
+// encoded as a multistream OggOpus stream of mapping family 1 at a total of
+// `bitrate_bits_per_second`. Each channel is its own stream when
+// `uncoupled_streams` is set, otherwise channels are paired as in the
+// Vorbis channel order.
+JNIEXPORT jlong JNICALL JNI_METHOD(initMultistream)(
+    JNIEnv* env, jclass clazz, jint num_channels,
+    jint bitrate_bits_per_second, jint sample_rate_hz, jboolean use_vbr,
+    jboolean uncoupled_streams);
+
+// Describes the packets output by the last process or flush call of a raw
+// packets encoder, 4 longs per packet: offset of the length prefix, packet
+// length, granule position and timestamp in microseconds. Returns the number
+// of packets, which may exceed those `info` holds.
+JNIEXPORT jint JNICALL JNI_METHOD(getPacketInfo)(JNIEnv* env,
+                                                 jclass clazz,
+                                                 jlong instance_ptr,
+                                                 jlongArray info);
+
 // samples must be an even number of bytes, as it represents 16-bit audio data.
 JNIEXPORT jbyteArray JNICALL JNI_METHOD(processAudioBytes)(JNIEnv* env,
-                                                           jobject instance,
+                                                           jclass clazz,
                                                            jlong instance_ptr,
                                                            jbyteArray samples,
                                                            jint offset,
                                                            jint length);
 
+// Same as processAudioBytes, writing the encoded bytes into `out`.
+// Returns the number of bytes written, or -1 when `out` is smaller than
+// maxOutputBytes(length). No Java array is allocated.
+JNIEXPORT jint JNICALL JNI_METHOD(processAudioBytesInto)(JNIEnv* env,
+                                                         jclass clazz,
+                                                         jlong instance_ptr,
+                                                         jbyteArray samples,
+                                                         jint offset,
+                                                         jint length,
+                                                         jbyteArray out);
+
+// Same as processAudioBytesInto, on direct ByteBuffers. The samples are
+// read, and the encoded bytes written, in place.
+JNIEXPORT jint JNICALL JNI_METHOD(processAudioBuffer)(JNIEnv* env,
+                                                      jclass clazz,
+                                                      jlong instance_ptr,
+                                                      jobject samples,
+                                                      jint offset,
+                                                      jint length,
+                                                      jobject out);
+
+// Upper bound of the bytes output on processing `length` more bytes of
+// samples, to size the buffers given to the functions above.
+JNIEXPORT jint JNICALL JNI_METHOD(maxOutputBytes)(JNIEnv* env,
+                                                  jclass clazz,
+                                                  jlong instance_ptr,
+                                                  jint length);
+
+// Copies the encoder metrics, see audio_util::EncoderMetricsSnapshot, into
+// the direct ByteBuffer `out`: 92 longs, in native order. Returns the number
+// of bytes written, or -1 when `out` is too small. The metrics are all zero
+// unless built with AUDIO_UTIL_ENCODER_METRICS. Call from the thread
+// encoding.
+JNIEXPORT jint JNICALL JNI_METHOD(getMetrics)(JNIEnv* env, jclass clazz,
+                                              jlong instance_ptr,
+                                              jobject out);
+
 // Tell the encoder that there will be no more samples.
-JNIEXPORT jbyteArray JNICALL JNI_METHOD(flush)(JNIEnv* env, jobject instance,
+JNIEXPORT jbyteArray JNICALL JNI_METHOD(flush)(JNIEnv* env, jclass clazz,
                                                jlong instance_ptr);
 
-// Releases all resources.
-JNIEXPORT void JNICALL JNI_METHOD(free)(JNIEnv* env, jobject instance,
+// Starts a new stream, of Ogg serial number `serial_number`, on the same
+// encoder, see OggOpusEncoder::Reset. Does not allocate.
+JNIEXPORT void JNICALL JNI_METHOD(reset)(JNIEnv* env, jclass clazz,
+                                         jlong instance_ptr,
+                                         jint serial_number);
+
+// Releases the encoder, which is kept idle for the next init of the same
+// settings, see OggOpusEncoderPool.
+JNIEXPORT void JNICALL JNI_METHOD(free)(JNIEnv* env, jclass clazz,
     jlong instance_ptr);
 
 }  // extern "C"
@@ -0,0 +1,103 @@
+#include "ogg_opus_index.h"
+#include <jni.h>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "../ogg_opus_index.h"
+
+namespace {
+
+using audio_util::OggOpusIndex;
+
+OggOpusIndex* GetInstance(jlong ptr) {
+  if (ptr == 0) {
+    fprintf(stderr, "OggOpusIndex called prior to open() or after "
+                    "free()!\n");
+  }
+  return reinterpret_cast<OggOpusIndex*>(ptr);
+}
+
+std::string GetString(JNIEnv* env, jstring value) {
+  const char* chars = env->GetStringUTFChars(value, nullptr);
+  if (chars == nullptr) {
+    return std::string();
+  }
+  std::string result(chars);
+  env->ReleaseStringUTFChars(value, chars);
+  return result;
+}
+
+jboolean SetSeekPoint(JNIEnv* env, const OggOpusIndex::SeekPoint& point,
+                      jlongArray out) {
+  if (out == nullptr || env->GetArrayLength(out) < 2) {
+    return false;
+  }
+  const jlong values[2] = {
+      static_cast<jlong>(point.offset),
+      static_cast<jlong>(point.granule_position),
+  };
+  env->SetLongArrayRegion(out, 0, 2, values);
+  return true;
+}
+
+}  // namespace
+
+JNIEXPORT jlong JNICALL INDEX_JNI_METHOD(open)(JNIEnv* env, jclass clazz,
+                                               jstring path,
+                                               jstring index_path,
+                                               jlong start_time_ms) {
+  if (path == nullptr || index_path == nullptr) {
+    return 0;
+  }
+  OggOpusIndex* index = new OggOpusIndex();
+  if (!index->Open(GetString(env, path), GetString(env, index_path),
+                   start_time_ms)) {
+    delete index;
+    return 0;
+  }
+  return reinterpret_cast<jlong>(index);
+}
+
+JNIEXPORT jboolean JNICALL INDEX_JNI_METHOD(seek)(JNIEnv* env, jclass clazz,
+                                                  jlong instance_ptr,
+                                                  jlong time_ms,
+                                                  jlongArray point) {
+  OggOpusIndex* index = GetInstance(instance_ptr);
+  return index && SetSeekPoint(env, index->Seek(time_ms), point);
+}
+
+JNIEXPORT jboolean JNICALL INDEX_JNI_METHOD(seekWallTime)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jlong wall_time_ms,
+    jlongArray point) {
+  OggOpusIndex* index = GetInstance(instance_ptr);
+  return index && SetSeekPoint(env, index->SeekWallTime(wall_time_ms), point);
+}
+
+JNIEXPORT void JNICALL INDEX_JNI_METHOD(getInfo)(JNIEnv* env, jclass clazz,
+                                                 jlong instance_ptr,
+                                                 jlongArray info) {
+  OggOpusIndex* index = GetInstance(instance_ptr);
+  if (!index || !info) {
+    return;
+  }
+  const OggOpusIndex::Info& i = index->info();
+  jlong values[10] = {
+      static_cast<jlong>(i.duration_ms()),
+      static_cast<jlong>(i.bitrate_bps()),
+      static_cast<jlong>(i.channels),
+      static_cast<jlong>(i.input_sample_rate_hz),
+      static_cast<jlong>(i.pre_skip),
+      static_cast<jlong>(i.audio_offset),
+      static_cast<jlong>(i.pages),
+      static_cast<jlong>(i.corrupted_pages),
+      static_cast<jlong>(index->entries().size()),
+      static_cast<jlong>(i.start_time_ms),
+  };
+  jsize count = env->GetArrayLength(info);
+  env->SetLongArrayRegion(info, 0, count < 10 ? count : 10, values);
+}
+
+JNIEXPORT void JNICALL INDEX_JNI_METHOD(free)(JNIEnv* env, jclass clazz,
+                                              jlong instance_ptr) {
+  delete reinterpret_cast<OggOpusIndex*>(instance_ptr);
+}
@@ -0,0 +1,46 @@
+#ifndef AUDIO_UTIL_JNI_OGG_OPUS_INDEX_H_
+#define AUDIO_UTIL_JNI_OGG_OPUS_INDEX_H_
+
+#include <jni.h>
+
+#define INDEX_JNI_METHOD(fn) \
+  Java_com_mentra_lc3Lib_OggOpusIndex_##fn  // NOLINT
+
+extern "C" {
+// Open the seek index of the OggOpus recording at `path`, loaded from the
+// sidecar file at `index_path`, or built and saved there when it is missing
+// or out of date, the recording having started at `start_time_ms`, wall
+// clock ms since the epoch, 0 when unknown. The pointer is returned in a
+// jlong, 0 when the recording cannot be indexed. Remember to call free with
+// the returned value when you're done.
+JNIEXPORT jlong JNICALL INDEX_JNI_METHOD(open)(JNIEnv* env, jclass clazz,
+                                               jstring path,
+                                               jstring index_path,
+                                               jlong start_time_ms);
+
+// Fill `point` with the byte offset to read the recording from, and the
+// granule position to pass to OggOpusDecoder.seek(), to play it from
+// `time_ms` after its start. Returns false on a null instance or array.
+JNIEXPORT jboolean JNICALL INDEX_JNI_METHOD(seek)(JNIEnv* env, jclass clazz,
+                                                  jlong instance_ptr,
+                                                  jlong time_ms,
+                                                  jlongArray point);
+
+// Same as seek, from a wall clock time in ms since the epoch.
+JNIEXPORT jboolean JNICALL INDEX_JNI_METHOD(seekWallTime)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jlong wall_time_ms,
+    jlongArray point);
+
+// Fill `info` with the duration in ms, bitrate in b/s, channels, input
+// samplerate, pre-skip, byte offset of the first audio page, pages,
+// corrupted pages, pages indexed and start time of the recording.
+JNIEXPORT void JNICALL INDEX_JNI_METHOD(getInfo)(JNIEnv* env, jclass clazz,
+                                                 jlong instance_ptr,
+                                                 jlongArray info);
+
+// Releases all resources.
+JNIEXPORT void JNICALL INDEX_JNI_METHOD(free)(JNIEnv* env, jclass clazz,
+                                              jlong instance_ptr);
+
+}  // extern "C"
+#endif  // AUDIO_UTIL_JNI_OGG_OPUS_INDEX_H_
@@ -0,0 +1,140 @@
+#include "resampler.h"
+#include <jni.h>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "../resampler.h"
+
+namespace {
+
+using audio_util::Resampler;
+
+// The resampler, and the scratch the samples given to process are copied
+// through, for the resampling to run outside of any critical section of the
+// arrays.
+struct ResamplerInstance {
+  ResamplerInstance(int num_channels, int input_rate_hz, int output_rate_hz,
+                    int quality)
+      : resampler(num_channels, input_rate_hz, output_rate_hz, quality) {}
+
+  Resampler resampler;
+  std::vector<jshort> scratch;
+};
+
+ResamplerInstance* GetInstance(jlong ptr) {
+  if (ptr == 0) {
+    fprintf(stderr, "Resampler called prior to init() or after free()!\n");
+  }
+  return reinterpret_cast<ResamplerInstance*>(ptr);
+}
+
+Resampler* GetResampler(jlong ptr) {
+  ResamplerInstance* instance = GetInstance(ptr);
+  return instance ? &instance->resampler : nullptr;
+}
+
+}  // namespace
+
+JNIEXPORT jlong JNICALL RESAMPLER_JNI_METHOD(init)(JNIEnv* env, jclass clazz,
+                                                   jint num_channels,
+                                                   jint input_rate_hz,
+                                                   jint output_rate_hz,
+                                                   jint quality) {
+  if (num_channels <= 0 || input_rate_hz <= 0 || output_rate_hz <= 0 ||
+      quality < 0 || quality > 10) {
+    fprintf(stderr, "Resampler: invalid settings\n");
+    return 0;
+  }
+  return reinterpret_cast<jlong>(new ResamplerInstance(
+      num_channels, input_rate_hz, output_rate_hz, quality));
+}
+
+JNIEXPORT jint JNICALL RESAMPLER_JNI_METHOD(maxOutputSamples)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jint num_samples) {
+  Resampler* resampler = GetResampler(instance_ptr);
+  return resampler ? resampler->MaxOutputSamples(num_samples) : -1;
+}
+
+JNIEXPORT jint JNICALL RESAMPLER_JNI_METHOD(process)(JNIEnv* env,
+                                                     jclass clazz,
+                                                     jlong instance_ptr,
+                                                     jshortArray pcm,
+                                                     jint offset,
+                                                     jint num_samples,
+                                                     jshortArray out) {
+  ResamplerInstance* instance = GetInstance(instance_ptr);
+  if (!instance) {
+    return -1;
+  }
+  Resampler* resampler = &instance->resampler;
+  const jint num_channels = resampler->num_channels();
+  if (offset < 0 || num_samples < 0 ||
+      offset + static_cast<jlong>(num_samples) * num_channels >
+          env->GetArrayLength(pcm)) {
+    fprintf(stderr, "process samples out of bounds\n");
+    return -1;
+  }
+  const size_t in_length = static_cast<size_t>(num_samples) * num_channels;
+  const size_t max_samples = env->GetArrayLength(out) / num_channels;
+  const size_t out_length = max_samples * num_channels;
+
+  // Input then output samples, in the one scratch.
+  std::vector<jshort>& scratch = instance->scratch;
+  if (scratch.size() < in_length + out_length) {
+    scratch.resize(in_length + out_length);
+  }
+  jshort* samples = scratch.data();
+  jshort* out_samples = scratch.data() + in_length;
+  env->GetShortArrayRegion(pcm, offset, in_length, samples);
+  int written =
+      resampler->Process(samples, num_samples, out_samples, max_samples);
+  if (written > 0) {
+    env->SetShortArrayRegion(out, 0, written * num_channels, out_samples);
+  }
+  return written;
+}
+
+JNIEXPORT jint JNICALL RESAMPLER_JNI_METHOD(processBuffer)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jobject pcm,
+    jint num_samples, jobject out) {
+  Resampler* resampler = GetResampler(instance_ptr);
+  if (!resampler) {
+    return -1;
+  }
+  const int16_t* samples =
+      static_cast<const int16_t*>(env->GetDirectBufferAddress(pcm));
+  int16_t* out_samples =
+      static_cast<int16_t*>(env->GetDirectBufferAddress(out));
+  if (samples == nullptr || out_samples == nullptr) {
+    fprintf(stderr, "processBuffer requires direct ByteBuffers\n");
+    return -1;
+  }
+  const jlong sample_bytes =
+      resampler->num_channels() * static_cast<jlong>(sizeof(int16_t));
+  if (num_samples < 0 ||
+      num_samples * sample_bytes > env->GetDirectBufferCapacity(pcm)) {
+    fprintf(stderr, "processBuffer samples out of bounds\n");
+    return -1;
+  }
+  return resampler->Process(samples, num_samples, out_samples,
+                            env->GetDirectBufferCapacity(out) / sample_bytes);
+}
+
+JNIEXPORT void JNICALL RESAMPLER_JNI_METHOD(reset)(JNIEnv* env, jclass clazz,
+                                                   jlong instance_ptr) {
+  Resampler* resampler = GetResampler(instance_ptr);
+  if (resampler) {
+    resampler->Reset();
+  }
+}
+
+JNIEXPORT jint JNICALL RESAMPLER_JNI_METHOD(outputLatency)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr) {
+  Resampler* resampler = GetResampler(instance_ptr);
+  return resampler ? resampler->OutputLatency() : -1;
+}
+
+JNIEXPORT void JNICALL RESAMPLER_JNI_METHOD(free)(JNIEnv* env, jclass clazz,
+                                                  jlong instance_ptr) {
+  delete reinterpret_cast<ResamplerInstance*>(instance_ptr);
+}
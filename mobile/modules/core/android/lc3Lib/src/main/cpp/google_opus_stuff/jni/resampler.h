@@ -0,0 +1,54 @@
+#ifndef AUDIO_UTIL_JNI_RESAMPLER_H_
+#define AUDIO_UTIL_JNI_RESAMPLER_H_
+
+#include <jni.h>
+
+#define RESAMPLER_JNI_METHOD(fn) \
+  Java_com_mentra_lc3Lib_Resampler_##fn  // NOLINT
+
+extern "C" {
+// Create a streaming resampler of `num_channels` interleaved channels of
+// 16-bit PCM, from `input_rate_hz` to `output_rate_hz`, at `quality`, 0 to
+// 10. The pointer is returned in a jlong. Remember to call free with the
+// returned value when you're done.
+JNIEXPORT jlong JNICALL RESAMPLER_JNI_METHOD(init)(JNIEnv* env, jclass clazz,
+                                                   jint num_channels,
+                                                   jint input_rate_hz,
+                                                   jint output_rate_hz,
+                                                   jint quality);
+
+// Samples per channel the output of `num_samples` input samples per channel
+// may have: the smallest output accepted by process.
+JNIEXPORT jint JNICALL RESAMPLER_JNI_METHOD(maxOutputSamples)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jint num_samples);
+
+// Resamples `num_samples` samples per channel of `pcm`, from `offset`, into
+// `out`, from its start. Returns the number of samples per channel written,
+// or -1 when `out` is shorter than maxOutputSamples(num_samples).
+JNIEXPORT jint JNICALL RESAMPLER_JNI_METHOD(process)(JNIEnv* env,
+                                                     jclass clazz,
+                                                     jlong instance_ptr,
+                                                     jshortArray pcm,
+                                                     jint offset,
+                                                     jint num_samples,
+                                                     jshortArray out);
+
+// Same as process, from and to direct ByteBuffers of native order shorts.
+JNIEXPORT jint JNICALL RESAMPLER_JNI_METHOD(processBuffer)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr, jobject pcm,
+    jint num_samples, jobject out);
+
+// Clears the history of the filter, to start a new stream.
+JNIEXPORT void JNICALL RESAMPLER_JNI_METHOD(reset)(JNIEnv* env, jclass clazz,
+                                                   jlong instance_ptr);
+
+// Delay of the output, in output samples.
+JNIEXPORT jint JNICALL RESAMPLER_JNI_METHOD(outputLatency)(
+    JNIEnv* env, jclass clazz, jlong instance_ptr);
+
+// Releases all resources.
+JNIEXPORT void JNICALL RESAMPLER_JNI_METHOD(free)(JNIEnv* env, jclass clazz,
+                                                  jlong instance_ptr);
+
+}  // extern "C"
+#endif  // AUDIO_UTIL_JNI_RESAMPLER_H_
@@ -0,0 +1,127 @@
+#include "lc3_opus_transcoder.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace audio_util {
+namespace {
+
+// PCM the scratch buffer is first reserved for, beyond an Opus frame.
+static constexpr int kReservedPcmMilliseconds = 100;
+
+}  // namespace
+
+Lc3OpusTranscoder::Lc3OpusTranscoder(int lc3_frame_duration_us,
+                                     int lc3_frame_bytes, int sample_rate_hz,
+                                     int bitrate_bps,
+                                     const OggOpusEncoder::Options& options)
+    : lc3_frame_bytes_(lc3_frame_bytes),
+      lc3_frame_samples_(
+          lc3_frame_samples(lc3_frame_duration_us, sample_rate_hz)),
+      opus_frame_samples_(static_cast<int64_t>(sample_rate_hz) *
+                          options.frame_duration_us / 1000000),
+      decoder_mem_(lc3_decoder_size(lc3_frame_duration_us, sample_rate_hz)),
+      decoder_(lc3_setup_decoder(lc3_frame_duration_us, sample_rate_hz, 0,
+                                 decoder_mem_.data())),
+      partial_frame_(lc3_frame_bytes),
+      partial_frame_size_(0),
+      pcm_size_(0),
+      encoder_(1, sample_rate_hz, bitrate_bps, options) {
+  assert(decoder_ != nullptr);  // Unsupported duration or samplerate.
+  assert(lc3_frame_bytes >= LC3_MIN_FRAME_BYTES &&
+         lc3_frame_bytes <= LC3_MAX_FRAME_BYTES);
+  pcm_.resize(opus_frame_samples_ +
+              sample_rate_hz / 1000 * kReservedPcmMilliseconds);
+  ResetStats();
+}
+
+int Lc3OpusTranscoder::Transcode(const unsigned char* lc3, size_t size,
+                                 unsigned char* out, size_t out_capacity) {
+  if (out_capacity < MaxOutputBytes(size)) {
+    return -1;
+  }
+  const size_t pcm_needed =
+      pcm_size_ + CompletedFrames(size) * lc3_frame_samples_;
+  if (pcm_.size() < pcm_needed) {
+    pcm_.resize(pcm_needed);
+  }
+
+  // Complete the frame split by the previous call.
+  if (partial_frame_size_ > 0) {
+    size_t missing = std::min(lc3_frame_bytes_ - partial_frame_size_, size);
+    memcpy(partial_frame_.data() + partial_frame_size_, lc3, missing);
+    partial_frame_size_ += missing;
+    lc3 += missing;
+    size -= missing;
+    if (partial_frame_size_ == static_cast<size_t>(lc3_frame_bytes_)) {
+      DecodeFrame(partial_frame_.data());
+      partial_frame_size_ = 0;
+    }
+  }
+
+  for (; size >= static_cast<size_t>(lc3_frame_bytes_);
+       lc3 += lc3_frame_bytes_, size -= lc3_frame_bytes_) {
+    DecodeFrame(lc3);
+  }
+  if (size > 0) {
+    memcpy(partial_frame_.data(), lc3, size);
+    partial_frame_size_ = size;
+  }
+
+  // Encode the whole Opus frames, and keep the remainder for the next call.
+  const size_t encoded_size =
+      pcm_size_ / opus_frame_samples_ * opus_frame_samples_;
+  int written = encoder_.Process(pcm_.data(), encoded_size, out, out_capacity);
+  assert(written >= 0);  // Bounded by MaxOutputBytes(), checked on entry.
+  std::copy(pcm_.begin() + encoded_size, pcm_.begin() + pcm_size_,
+            pcm_.begin());
+  pcm_size_ -= encoded_size;
+  return written;
+}
+
+int Lc3OpusTranscoder::Flush(unsigned char* out, size_t out_capacity) {
+  if (out_capacity < MaxFlushBytes()) {
+    return -1;
+  }
+  // The remainder, shorter than an Opus frame, is buffered by the encoder,
+  // only pending Ogg pages being written.
+  int written = encoder_.Process(pcm_.data(), pcm_size_, out, out_capacity);
+  assert(written >= 0);
+  pcm_size_ = 0;
+
+  int flushed = encoder_.Flush(out + written, out_capacity - written);
+  assert(flushed >= 0);
+  return written + flushed;
+}
+
+size_t Lc3OpusTranscoder::MaxOutputBytes(size_t size) const {
+  return encoder_.MaxOutputBytes(pcm_size_ +
+                                 CompletedFrames(size) * lc3_frame_samples_);
+}
+
+size_t Lc3OpusTranscoder::MaxFlushBytes() const {
+  return encoder_.MaxOutputBytes(pcm_size_) + encoder_.MaxFlushBytes();
+}
+
+void Lc3OpusTranscoder::ResetStats() {
+  memset(&stats_, 0, sizeof(stats_));
+}
+
+void Lc3OpusTranscoder::DecodeFrame(const unsigned char* frame) {
+  bool valid = lc3_check_frame(decoder_, frame, lc3_frame_bytes_) == 0;
+  int result =
+      lc3_decode(decoder_, valid ? frame : nullptr, lc3_frame_bytes_,
+                 LC3_PCM_FORMAT_S16, pcm_.data() + pcm_size_, 1);
+  pcm_size_ += lc3_frame_samples_;
+
+  stats_.decoded_frames++;
+  stats_.invalid_frames += !valid;
+  stats_.concealed_frames += (result == 1);
+}
+
+size_t Lc3OpusTranscoder::CompletedFrames(size_t size) const {
+  return (partial_frame_size_ + size) / lc3_frame_bytes_;
+}
+
+}  // namespace audio_util
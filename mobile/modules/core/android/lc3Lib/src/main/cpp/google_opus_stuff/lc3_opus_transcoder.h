@@ -0,0 +1,96 @@
+#ifndef AUDIO_UTIL_LC3_OPUS_TRANSCODER_H_
+#define AUDIO_UTIL_LC3_OPUS_TRANSCODER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "lc3.h"
+#include "ogg_opus_encoder.h"
+
+namespace audio_util {
+
+// Converts an LC3 stream, as received from the glasses, into Opus packets
+// without going back to Java with the PCM.
+//
+// LC3 frames are decoded into a PCM scratch buffer, whose whole Opus frames
+// are given to the encoder in a single call, straight from the buffer: two
+// 10 ms LC3 frames for each 20 ms Opus frame, by default. The remainder is
+// kept at the start of the buffer for the next call. Frames failing the LC3
+// pre-validation are concealed, as by the Lc3Cpp decoder.
+class Lc3OpusTranscoder {
+ public:
+  // Frames counts, see Lc3Cpp.getDecoderStats().
+  struct Stats {
+    uint64_t decoded_frames;    // Frames given for decoding.
+    uint64_t invalid_frames;    // Frames rejected by the pre-validation.
+    uint64_t concealed_frames;  // Frames output by PLC, invalid ones included.
+  };
+
+  // The LC3 stream is mono, of `lc3_frame_bytes` bytes frames lasting
+  // `lc3_frame_duration_us` (7500 or 10000), at `sample_rate_hz`, which is
+  // also the Opus encoding samplerate.
+  Lc3OpusTranscoder(int lc3_frame_duration_us, int lc3_frame_bytes,
+                    int sample_rate_hz, int bitrate_bps,
+                    const OggOpusEncoder::Options& options);
+
+  // Whether the LC3 decoder and the Opus encoder were set up. When false,
+  // no other method may be called.
+  bool ok() const { return decoder_ != nullptr && encoder_.ok(); }
+
+  // Transcodes `size` bytes of LC3 frames, writing the Opus output into the
+  // caller provided `out` buffer. A trailing partial frame is kept, and
+  // completed by the next call.
+  // Returns the number of bytes written, or -1 when `out_capacity` is lower
+  // than MaxOutputBytes(size), nothing being transcoded then.
+  int Transcode(const unsigned char* lc3, size_t size, unsigned char* out,
+                size_t out_capacity);
+
+  // Encodes the PCM pending, and closes the stream. This should be called
+  // last, and never more than once. Returns as Transcode().
+  int Flush(unsigned char* out, size_t out_capacity);
+
+  // Upper bounds of the bytes output by Transcode() on `size` more bytes of
+  // LC3 frames, and by Flush(), in the current state.
+  size_t MaxOutputBytes(size_t size) const;
+  size_t MaxFlushBytes() const;
+
+  // Packets written by the last call to Transcode() or Flush(), offsets
+  // relative to `out`, in raw framing; always empty in Ogg framing.
+  const std::vector<OggOpusEncoder::PacketInfo>& packets() const {
+    return encoder_.packets();
+  }
+
+  const Stats& stats() const { return stats_; }
+  void ResetStats();
+
+ private:
+  // Decodes a complete LC3 frame at the end of the PCM scratch buffer.
+  void DecodeFrame(const unsigned char* frame);
+
+  // Number of LC3 frames completed by `size` more bytes.
+  size_t CompletedFrames(size_t size) const;
+
+  int lc3_frame_bytes_;
+  int lc3_frame_samples_;
+  int opus_frame_samples_;
+
+  std::vector<unsigned char> decoder_mem_;
+  lc3_decoder_t decoder_;
+
+  // Start of a frame split between two calls.
+  std::vector<unsigned char> partial_frame_;
+  size_t partial_frame_size_;
+
+  // Decoded PCM, waiting to be encoded. Its capacity follows the largest
+  // input, so that steady streaming does not reallocate it.
+  std::vector<int16_t> pcm_;
+  size_t pcm_size_;
+
+  OggOpusEncoder encoder_;
+  Stats stats_;
+};
+
+}  // namespace audio_util
+
+#endif  // AUDIO_UTIL_LC3_OPUS_TRANSCODER_H_
@@ -0,0 +1,498 @@
+#include "ogg_opus_decoder.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iterator>
+#include "ogg_page_writer.h"
+
+// Ogg Opus information comes from the standard here:
+// https://tools.ietf.org/html/rfc7845
+
+namespace audio_util {
+namespace {
+
+// Ogg page layout, see https://tools.ietf.org/html/rfc3533#section-6
+static constexpr size_t kOggPageHeaderBytes = 27;
+static constexpr size_t kOggCrcOffset = 22;
+static constexpr unsigned char kOggContinuedPacket = 0x01;
+static constexpr unsigned char kOggEndOfStream = 0x04;
+
+// Granule positions, and packet durations, are at 48 kHz.
+static constexpr int kGranuleRateHz = 48000;
+static constexpr int kMaxPacketGranules = kGranuleRateHz * 120 / 1000;
+// PLC and FEC decode multiples of 2.5 ms.
+static constexpr int kConcealmentStepGranules = kGranuleRateHz / 400;
+
+// OpusHead, see https://tools.ietf.org/html/rfc7845#section-5.1
+static constexpr size_t kOpusHeadBytes = 19;
+
+uint32_t ReadLittleEndian(const unsigned char* data, int num_bytes) {
+  uint32_t value = 0;
+  for (int i = num_bytes - 1; i >= 0; i--) {
+    value = (value << 8) | data[i];
+  }
+  return value;
+}
+
+}  // namespace
+
+OggOpusDecoder::OggOpusDecoder(int sample_rate_hz, int num_channels)
+    : sample_rate_hz_(sample_rate_hz),
+      num_channels_(num_channels),
+      granule_scale_(kGranuleRateHz / sample_rate_hz),
+      decoder_(nullptr, opus_decoder_destroy),
+      error_(false),
+      finished_(false),
+      stream_channels_(0),
+      header_packets_(0),
+      input_begin_(0),
+      has_page_(false),
+      has_serial_number_(false),
+      serial_number_(0),
+      next_sequence_number_(0),
+      has_packet_(false),
+      packet_assembled_(false),
+      packet_size_(0),
+      packet_ends_stream_(false),
+      packet_end_segment_(0),
+      packet_end_body_offset_(0),
+      packet_continues_(false),
+      granule_position_(0),
+      pre_skip_(0),
+      lost_samples_(0),
+      loss_pending_(false),
+      seek_pending_(false),
+      seek_granule_position_(0) {
+  assert(IsSupported(sample_rate_hz, num_channels));
+  memset(&page_, 0, sizeof(page_));
+  memset(&stats_, 0, sizeof(stats_));
+}
+
+bool OggOpusDecoder::IsSupported(int sample_rate_hz, int num_channels) {
+  static constexpr int kSampleRates[] = {8000, 12000, 16000, 24000, 48000};
+  return (num_channels == 1 || num_channels == 2) &&
+         std::find(std::begin(kSampleRates), std::end(kSampleRates),
+                   sample_rate_hz) != std::end(kSampleRates);
+}
+
+size_t OggOpusDecoder::MinOutputSamples() const {
+  return kMaxPacketGranules / granule_scale_;
+}
+
+int OggOpusDecoder::Decode(const unsigned char* data, size_t size,
+                           int16_t* pcm, size_t max_samples) {
+  if (error_ || max_samples < MinOutputSamples()) {
+    return -1;
+  }
+  CompactInput();
+  input_.insert(input_.end(), data, data + size);
+
+  size_t written = 0;
+  while (PeekPacket()) {
+    if (header_packets_ == 0) {
+      if (!ParseHeader(PacketData(), packet_size_)) {
+        error_ = true;
+        return -1;
+      }
+      header_packets_++;
+      ConsumePacket();
+      continue;
+    }
+    if (header_packets_ == 1) {
+      // The comment header is skipped; should it be lost, the packet is
+      // audio already.
+      header_packets_++;
+      if (packet_size_ >= 8 && memcmp(PacketData(), "OpusTags", 8) == 0) {
+        ConsumePacket();
+        continue;
+      }
+    }
+
+    int n = lost_samples_ > 0
+                ? ConcealLoss(pcm + written * num_channels_,
+                              max_samples - written)
+                : DecodePacket(pcm + written * num_channels_,
+                               max_samples - written);
+    if (n < 0) {
+      break;  // Output full.
+    }
+    written += n;
+  }
+  return written;
+}
+
+bool OggOpusDecoder::Seek(int64_t granule_position) {
+  if (error_ || header_packets_ < 2) {
+    return false;
+  }
+  input_.clear();
+  input_begin_ = 0;
+  has_page_ = false;
+  has_packet_ = false;
+  packet_.clear();
+  packet_continues_ = false;
+  finished_ = false;
+  lost_samples_ = 0;
+  loss_pending_ = false;
+  seek_pending_ = true;
+  seek_granule_position_ = granule_position;
+  opus_decoder_ctl(decoder_.get(), OPUS_RESET_STATE);
+  return true;
+}
+
+bool OggOpusDecoder::LoadPage() {
+  while (true) {
+    const unsigned char* page = input_.data() + input_begin_;
+    const size_t available = input_.size() - input_begin_;
+    if (available < 4) {
+      return false;
+    }
+
+    // Resynchronize on the capture pattern, after garbage or a corrupted
+    // page.
+    if (memcmp(page, "OggS", 4) != 0) {
+      const unsigned char* end = page + available;
+      const unsigned char* next = page + 1;
+      while ((next = static_cast<const unsigned char*>(
+                  memchr(next, 'O', end - next))) != nullptr &&
+             end - next >= 4 && memcmp(next, "OggS", 4) != 0) {
+        next++;
+      }
+      input_begin_ = next ? next - input_.data() : input_.size() - 3;
+      continue;
+    }
+
+    if (available < kOggPageHeaderBytes) {
+      return false;
+    }
+    const int num_segments = page[26];
+    const size_t header_bytes = kOggPageHeaderBytes + num_segments;
+    if (available < header_bytes) {
+      return false;
+    }
+    size_t body_bytes = 0;
+    for (int i = 0; i < num_segments; i++) {
+      body_bytes += page[kOggPageHeaderBytes + i];
+    }
+    if (available < header_bytes + body_bytes) {
+      return false;
+    }
+
+    // CRC of the page, its own field taken as zero.
+    static const unsigned char kZeroCrc[4] = {0, 0, 0, 0};
+    uint32_t crc = OggCrc32(page, kOggCrcOffset);
+    crc = OggCrc32(kZeroCrc, 4, crc);
+    crc = OggCrc32(page + kOggCrcOffset + 4,
+                   header_bytes + body_bytes - kOggCrcOffset - 4, crc);
+    if (page[4] != 0 || crc != ReadLittleEndian(page + kOggCrcOffset, 4)) {
+      stats_.corrupted_pages++;
+      input_begin_++;
+      continue;
+    }
+
+    const uint32_t serial_number = ReadLittleEndian(page + 14, 4);
+    if (has_serial_number_ && serial_number != serial_number_) {
+      input_begin_ += header_bytes + body_bytes;  // Another stream.
+      continue;
+    }
+    if (!has_serial_number_) {
+      has_serial_number_ = true;
+      serial_number_ = serial_number;
+      next_sequence_number_ = ReadLittleEndian(page + 18, 4);
+    }
+
+    page_.offset = input_begin_;
+    page_.header_bytes = header_bytes;
+    page_.body_bytes = body_bytes;
+    page_.num_segments = num_segments;
+    page_.flags = page[5];
+    page_.granule_position = static_cast<int64_t>(
+        static_cast<uint64_t>(ReadLittleEndian(page + 10, 4)) << 32 |
+        ReadLittleEndian(page + 6, 4));
+    page_.segment = 0;
+    page_.body_offset = 0;
+    has_page_ = true;
+    stats_.pages++;
+    CheckPageSequence(ReadLittleEndian(page + 18, 4));
+    return true;
+  }
+}
+
+void OggOpusDecoder::CheckPageSequence(uint32_t sequence_number) {
+  const unsigned char* lacing = input_.data() + page_.offset +
+                                kOggPageHeaderBytes;
+  if (seek_pending_) {
+    next_sequence_number_ = sequence_number;  // Not a loss.
+  }
+  if (sequence_number != next_sequence_number_) {
+    stats_.lost_pages += sequence_number - next_sequence_number_;
+    packet_.clear();
+    packet_continues_ = false;
+    loss_pending_ = header_packets_ == 2;
+  }
+  next_sequence_number_ = sequence_number + 1;
+
+  // The end of a packet whose start is lost is skipped.
+  const bool continued = page_.flags & kOggContinuedPacket;
+  if (continued && !packet_continues_) {
+    while (page_.segment < page_.num_segments) {
+      page_.body_offset += lacing[page_.segment];
+      if (lacing[page_.segment++] < 255) {
+        break;
+      }
+    }
+  } else if (!continued && packet_continues_) {
+    packet_.clear();
+    packet_continues_ = false;
+  }
+
+  // After a seek, the output starts at the granule position sought, the
+  // packets being timed from the first page ending one; those of the pages
+  // before it are skipped.
+  if (seek_pending_) {
+    if (page_.granule_position < 0) {
+      page_.segment = page_.num_segments;
+      page_.body_offset = page_.body_bytes;
+      return;
+    }
+    granule_position_ = PageStartGranulePosition();
+    pre_skip_ =
+        std::max<int64_t>(seek_granule_position_ - granule_position_, 0);
+    seek_pending_ = false;
+    return;
+  }
+
+  // The samples lost run up to the start of the first packet of the page.
+  if (!loss_pending_ || page_.granule_position < 0) {
+    return;
+  }
+  lost_samples_ +=
+      std::max<int64_t>(PageStartGranulePosition() - granule_position_, 0);
+  loss_pending_ = false;
+}
+
+int64_t OggOpusDecoder::PageStartGranulePosition() const {
+  const unsigned char* lacing = input_.data() + page_.offset +
+                                kOggPageHeaderBytes;
+  const unsigned char* body = lacing + page_.num_segments;
+  int64_t start = page_.granule_position;
+  size_t offset = page_.body_offset;
+  size_t size = 0;
+  for (int i = page_.segment; i < page_.num_segments; i++) {
+    size += lacing[i];
+    if (lacing[i] < 255) {
+      if (size > 0) {
+        int duration =
+            opus_packet_get_nb_samples(body + offset, size, kGranuleRateHz);
+        start -= std::max(duration, 0);
+      }
+      offset += size;
+      size = 0;
+    }
+  }
+  return start;
+}
+
+bool OggOpusDecoder::PeekPacket() {
+  if (has_packet_) {
+    return true;
+  }
+  while (true) {
+    if (!has_page_ && !LoadPage()) {
+      return false;
+    }
+    const unsigned char* lacing =
+        input_.data() + page_.offset + kOggPageHeaderBytes;
+    const unsigned char* body =
+        lacing + page_.num_segments + page_.body_offset;
+    int segment = page_.segment;
+    size_t size = 0;
+    bool complete = false;
+    while (segment < page_.num_segments && !complete) {
+      size += lacing[segment];
+      complete = lacing[segment++] < 255;
+    }
+
+    if (!complete) {
+      // The packet, if any, continues on the next page.
+      if (segment > page_.segment) {
+        packet_.insert(packet_.end(), body, body + size);
+        packet_continues_ = true;
+      }
+      has_page_ = false;
+      input_begin_ = page_.offset + page_.header_bytes + page_.body_bytes;
+      finished_ = page_.flags & kOggEndOfStream;
+      continue;
+    }
+
+    packet_assembled_ = packet_continues_;
+    if (packet_assembled_) {
+      packet_.insert(packet_.end(), body, body + size);
+      packet_size_ = packet_.size();
+    } else {
+      packet_size_ = size;
+    }
+    packet_end_segment_ = segment;
+    packet_end_body_offset_ = page_.body_offset + size;
+    packet_ends_stream_ = (page_.flags & kOggEndOfStream) &&
+                          segment == page_.num_segments;
+    has_packet_ = true;
+    return true;
+  }
+}
+
+void OggOpusDecoder::ConsumePacket() {
+  assert(has_packet_);
+  has_packet_ = false;
+  if (packet_assembled_) {
+    packet_.clear();
+    packet_continues_ = false;
+  }
+  page_.segment = packet_end_segment_;
+  page_.body_offset = packet_end_body_offset_;
+  if (page_.segment == page_.num_segments) {
+    has_page_ = false;
+    input_begin_ = page_.offset + page_.header_bytes + page_.body_bytes;
+    finished_ = page_.flags & kOggEndOfStream;
+  }
+}
+
+const unsigned char* OggOpusDecoder::PacketData() const {
+  if (packet_assembled_) {
+    return packet_.data();
+  }
+  return input_.data() + page_.offset + page_.header_bytes + page_.body_offset;
+}
+
+bool OggOpusDecoder::ParseHeader(const unsigned char* packet, size_t size) {
+  // Version 0.x, mapping family 0 only.
+  if (size < kOpusHeadBytes || memcmp(packet, "OpusHead", 8) != 0 ||
+      (packet[8] & 0xf0) != 0) {
+    return false;
+  }
+  const int channels = packet[9];
+  const int gain = static_cast<int16_t>(ReadLittleEndian(packet + 16, 2));
+  if (packet[18] != 0 || channels < 1 || channels > 2) {
+    return false;
+  }
+
+  int error = OPUS_OK;
+  decoder_.reset(opus_decoder_create(sample_rate_hz_, num_channels_, &error));
+  if (error != OPUS_OK) {
+    return false;
+  }
+  if (gain != 0) {
+    opus_decoder_ctl(decoder_.get(), OPUS_SET_GAIN(gain));
+  }
+  stream_channels_ = channels;
+  pre_skip_ = ReadLittleEndian(packet + 10, 2);
+  return true;
+}
+
+int OggOpusDecoder::DecodePacket(int16_t* pcm, size_t max_samples) {
+  const unsigned char* packet = PacketData();
+  const int duration =
+      packet_size_ > 0
+          ? opus_packet_get_nb_samples(packet, packet_size_, kGranuleRateHz)
+          : -1;
+  if (duration <= 0) {
+    // Not an Opus packet, its duration unknown: the granule positions of
+    // the next pages still keep the timing.
+    ConsumePacket();
+    return 0;
+  }
+  const int num_samples = duration / granule_scale_;
+  if (static_cast<size_t>(num_samples) > max_samples) {
+    return -1;
+  }
+
+  if (opus_decode(decoder_.get(), packet, packet_size_, pcm, num_samples,
+                  0) < 0) {
+    // A corrupted packet, concealed.
+    if (opus_decode(decoder_.get(), nullptr, 0, pcm, num_samples, 0) < 0) {
+      memset(pcm, 0, num_samples * num_channels_ * sizeof(int16_t));
+    }
+    stats_.concealed_samples += num_samples;
+  }
+  stats_.packets++;
+
+  // Trim the pre-skip from the start, and the end of the last packet past
+  // the final granule position.
+  const int64_t start = granule_position_;
+  int64_t end = duration;
+  granule_position_ += duration;
+  if (packet_ends_stream_ && page_.granule_position >= 0 &&
+      page_.granule_position < granule_position_) {
+    end = std::max<int64_t>(page_.granule_position - start, 0);
+  }
+  const int64_t skip = std::min(pre_skip_, end);
+  pre_skip_ -= skip;
+  ConsumePacket();
+
+  const size_t first = skip / granule_scale_;
+  const size_t last = end / granule_scale_;
+  if (last <= first) {
+    return 0;
+  }
+  if (first > 0) {
+    memmove(pcm, pcm + first * num_channels_,
+            (last - first) * num_channels_ * sizeof(int16_t));
+  }
+  return last - first;
+}
+
+int OggOpusDecoder::ConcealLoss(int16_t* pcm, size_t max_samples) {
+  // The end of the loss is recovered from the FEC of the next packet, for
+  // at most its duration, the rest by PLC.
+  const unsigned char* packet = PacketData();
+  const int duration =
+      packet_size_ > 0
+          ? opus_packet_get_nb_samples(packet, packet_size_, kGranuleRateHz)
+          : 0;
+  const int64_t fec = std::min<int64_t>(lost_samples_, std::max(duration, 0)) /
+                      kConcealmentStepGranules * kConcealmentStepGranules;
+  const int64_t plc = lost_samples_ - fec;
+
+  int64_t granules;
+  if (plc > 0) {
+    granules = std::min<int64_t>(plc, kMaxPacketGranules);
+    granules -= granules % kConcealmentStepGranules;
+    if (granules == 0) {
+      lost_samples_ -= plc;  // Below 2.5 ms, dropped.
+      return 0;
+    }
+  } else {
+    granules = fec;
+  }
+  const int num_samples = granules / granule_scale_;
+  if (static_cast<size_t>(num_samples) > max_samples) {
+    return -1;
+  }
+
+  int result = plc > 0 ? opus_decode(decoder_.get(), nullptr, 0, pcm,
+                                     num_samples, 0)
+                       : opus_decode(decoder_.get(), packet, packet_size_,
+                                     pcm, num_samples, 1);
+  if (result < 0) {
+    memset(pcm, 0, num_samples * num_channels_ * sizeof(int16_t));
+  }
+  lost_samples_ -= granules;
+  granule_position_ += granules;
+  stats_.concealed_samples += num_samples;
+  return num_samples;
+}
+
+void OggOpusDecoder::CompactInput() {
+  const size_t begin = has_page_ ? page_.offset : input_begin_;
+  if (begin == 0) {
+    return;
+  }
+  input_.erase(input_.begin(), input_.begin() + begin);
+  input_begin_ -= begin;
+  if (has_page_) {
+    page_.offset = 0;
+  }
+}
+
+}  // namespace audio_util
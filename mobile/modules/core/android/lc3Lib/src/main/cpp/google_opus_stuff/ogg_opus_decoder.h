@@ -0,0 +1,178 @@
+#ifndef AUDIO_UTIL_OGG_OPUS_DECODER_H_
+#define AUDIO_UTIL_OGG_OPUS_DECODER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "libopus/opus.h"
+
+namespace audio_util {
+
+// Streaming decoder of an OggOpus stream, as received from the network, for
+// playback with the least latency.
+//
+// The stream is given in chunks of any size: pages are parsed as soon as
+// they are complete, a page split between chunks being resumed on the next
+// call, and each packet is decoded as soon as it is complete, straight into
+// the caller provided PCM buffer. The header pre-skip, and the end trimming
+// of the last page, are applied: the output has the length of the encoded
+// audio.
+//
+// Pages failing their CRC are skipped. Lost pages, from the page sequence,
+// are concealed over the duration given by the granule positions: by the
+// in-band FEC of the next packet for its duration, when it has some, by
+// PLC before it.
+//
+// Only channel mapping family 0, mono or stereo, is supported.
+class OggOpusDecoder {
+ public:
+  struct Stats {
+    uint64_t pages;              // Pages parsed, corrupted ones excluded.
+    uint64_t packets;            // Audio packets decoded.
+    uint64_t corrupted_pages;    // Pages failing the CRC, skipped.
+    uint64_t lost_pages;         // Gaps in the page sequence.
+    uint64_t concealed_samples;  // Samples per channel output by PLC or FEC.
+  };
+
+  // Decodes to `num_channels` (1 or 2) interleaved channels, at
+  // `sample_rate_hz`, one of {8000, 12000, 16000, 24000, 48000}, whatever
+  // the channels and input samplerate of the stream.
+  OggOpusDecoder(int sample_rate_hz, int num_channels);
+
+  // Whether the constructor accepts these settings.
+  static bool IsSupported(int sample_rate_hz, int num_channels);
+
+  // Samples per channel of the longest Opus packet, 120 ms: the smallest
+  // `max_samples` accepted by Decode().
+  size_t MinOutputSamples() const;
+
+  // Parses `size` more bytes of the stream, and decodes the packets
+  // completed into `pcm`, up to `max_samples` samples per channel. Packets
+  // not fitting are kept for the next calls, which may pass no bytes: call
+  // until 0 is returned to drain the decoder.
+  // Returns the number of samples per channel written, or -1 when the
+  // stream is not a supported OggOpus stream, or `max_samples` is lower
+  // than MinOutputSamples().
+  int Decode(const unsigned char* data, size_t size, int16_t* pcm,
+             size_t max_samples);
+
+  // Restarts the decoding at another page of the stream, for the next bytes
+  // given to Decode() to be those of the file from that page on, as found
+  // by OggOpusIndex::Seek(): the input and packets pending are dropped, and
+  // the output starts at `granule_position`, the samples decoded before it
+  // being dropped. Returns false until the headers are parsed.
+  bool Seek(int64_t granule_position);
+
+  // Whether the last page of the stream was decoded.
+  bool finished() const { return finished_; }
+
+  // Channels of the output, and of the stream, 0 until its header is
+  // parsed.
+  int num_channels() const { return num_channels_; }
+  int stream_channels() const { return stream_channels_; }
+
+  const Stats& stats() const { return stats_; }
+
+ private:
+  using OpusDecoderUniquePtr =
+      std::unique_ptr<OpusDecoder, decltype(&opus_decoder_destroy)>;
+
+  // Page being read, in input_.
+  struct Page {
+    size_t offset;        // Of its header in input_.
+    size_t header_bytes;  // Segment table included.
+    size_t body_bytes;
+    int num_segments;
+    unsigned char flags;
+    int64_t granule_position;
+
+    // Next segment, and its body offset, to read.
+    int segment;
+    size_t body_offset;
+  };
+
+  // Finds the next complete page in input_, from input_begin_, skipping
+  // corrupted pages and those of other streams. Returns false when more
+  // bytes are needed.
+  bool LoadPage();
+
+  // Accounts for the pages lost before the page loaded, from its sequence
+  // number and granule position, or for the seek to it.
+  void CheckPageSequence(uint32_t sequence_number);
+
+  // Granule position of the start of the packets of the page loaded, from
+  // the next one, known from that of its end.
+  int64_t PageStartGranulePosition() const;
+
+  // Finds the next complete packet, loading pages as needed, without
+  // consuming it. Returns false when more bytes are needed.
+  bool PeekPacket();
+  void ConsumePacket();
+  const unsigned char* PacketData() const;
+
+  // Parses the OpusHead packet, and sets the Opus decoder up.
+  bool ParseHeader(const unsigned char* packet, size_t size);
+
+  // Decodes the packet peeked into `pcm`, trimmed; returns the number of
+  // samples per channel written, or -1 when it does not fit `max_samples`.
+  int DecodePacket(int16_t* pcm, size_t max_samples);
+
+  // Conceals the samples lost, as they fit `max_samples`; returns the
+  // number of samples per channel written.
+  int ConcealLoss(int16_t* pcm, size_t max_samples);
+
+  // Moves the unread input to the front of input_.
+  void CompactInput();
+
+  const int sample_rate_hz_;
+  const int num_channels_;
+  // Ratio of the 48 kHz granule positions to output samples.
+  const int granule_scale_;
+
+  OpusDecoderUniquePtr decoder_;
+  bool error_;
+  bool finished_;
+  int stream_channels_;
+  int header_packets_;  // Header packets parsed, of 2.
+
+  // Bytes received, and not read yet from input_begin_.
+  std::vector<unsigned char> input_;
+  size_t input_begin_;
+
+  bool has_page_;
+  Page page_;
+  bool has_serial_number_;
+  uint32_t serial_number_;
+  uint32_t next_sequence_number_;
+
+  // Packet peeked: in the page at its body_offset, or in packet_ when it
+  // spans pages.
+  bool has_packet_;
+  bool packet_assembled_;
+  size_t packet_size_;
+  bool packet_ends_stream_;
+  int packet_end_segment_;
+  size_t packet_end_body_offset_;
+
+  // Start of a packet continued on the next page.
+  std::vector<unsigned char> packet_;
+  bool packet_continues_;
+
+  // In 48 kHz samples: position after the last packet decoded, samples
+  // still to drop from the start, and samples lost to conceal.
+  int64_t granule_position_;
+  int64_t pre_skip_;
+  int64_t lost_samples_;
+  // Set on a gap, until a page giving its granule position is loaded.
+  bool loss_pending_;
+  // Set by Seek(), until a page giving its granule position is loaded.
+  bool seek_pending_;
+  int64_t seek_granule_position_;
+
+  Stats stats_;
+};
+
+}  // namespace audio_util
+
+#endif  // AUDIO_UTIL_OGG_OPUS_DECODER_H_
@@ -16,7 +16,10 @@
 
 #include "ogg_opus_encoder.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdio>
+#include <cstring>
 #include <endian.h>
 #include <memory>
 #include <string>
@@ -31,136 +34,457 @@
 namespace audio_util {
 namespace {
 
-static constexpr float kEncodingBufferSizeSeconds = 0.02f;
+// Largest Opus frame, and overhead of a packet of several frames, see
+// https://tools.ietf.org/html/rfc6716#section-3.2
+static constexpr int kMaxOpusFrameBytes = 1275;
+static constexpr int kOpusFrameDurationUs = 20000;
+static constexpr int kMaxOpusPacketOverheadBytes = 7;
+static constexpr int kSelfDelimitingLengthBytes = 2;
 
-std::string SerializeUint32(uint32_t value) {
-  std::string result(4, '\0');
+// Streams of the channel mapping family 1, as set up by libopus, see
+// https://tools.ietf.org/html/rfc7845#section-5.1.1.2
+struct VorbisLayout {
+  int streams;
+  int coupled_streams;
+  unsigned char mapping[8];
+};
+static constexpr VorbisLayout kVorbisLayouts[8] = {
+    {1, 0, {0}},                       // Mono.
+    {1, 1, {0, 1}},                    // Stereo.
+    {2, 1, {0, 2, 1}},                 // Linear surround.
+    {2, 2, {0, 1, 2, 3}},              // Quadraphonic.
+    {3, 2, {0, 4, 1, 2, 3}},           // 5.0 surround.
+    {4, 2, {0, 4, 1, 2, 3, 5}},        // 5.1 surround.
+    {4, 3, {0, 4, 1, 2, 3, 5, 6}},     // 6.1 surround.
+    {5, 3, {0, 6, 1, 2, 3, 4, 5, 7}},  // 7.1 surround.
+};
+
+// Duration of encoded data the output buffer is reserved for, so that
+// streaming calls don't grow it.
+static constexpr int kOutputBufferMilliseconds = 500;
+
+// Ogg page layout, see https://tools.ietf.org/html/rfc3533#section-6
+static constexpr size_t kOggPageHeaderBytes = 27;
+static constexpr size_t kOggMaxPageSegments = 255;
+static constexpr size_t kOggPageBodyThreshold = 4096;
+static constexpr uint32_t kOggSerialNumber = 0;
+
+// Granule positions, and the pre-skip, count 48 kHz samples whatever the
+// samplerate, see https://tools.ietf.org/html/rfc7845#section-4
+static constexpr int kOggGranuleRateHz = 48000;
+
+// Raw packet length prefix, see OggOpusEncoder::Framing.
+static constexpr size_t kRawPrefixMaxBytes = 2;
+static constexpr int kRawPrefixShortLimit = 0x80;
+static constexpr int kRawPrefixLongLimit = 0x8000;
+
+// Packet descriptions reserved for, per call, so that streaming calls don't
+// grow the side-channel.
+static constexpr size_t kReservedPacketInfos = 64;
+
+// Vendor string of the comment header.
+static constexpr char kVendor[] = "Google using libopus";
+
+unsigned char* SerializeUint32(uint32_t value, unsigned char* out) {
 #if __BYTE_ORDER == __BIG_ENDIAN
 #error The following line assumes that the byte order is little endian.
 #endif
-  memcpy(&result[0], &value, sizeof(value));
-  return result;
+  memcpy(out, &value, sizeof(value));
+  return out + sizeof(value);
+}
+
+OggOpusEncoder::Options MakeOptions(bool use_vbr, bool low_latency_mode,
+                                    OggOpusEncoder::Framing framing) {
+  OggOpusEncoder::Options options;
+  options.use_vbr = use_vbr;
+  options.low_latency_mode = low_latency_mode;
+  options.framing = framing;
+  return options;
 }
 
 }  // namespace
 
 OggOpusEncoder::OggOpusEncoder(int num_channels, int sample_rate_hz,
                                int bitrate_bps, bool use_vbr,
-                               bool low_latency_mode)
+                               bool low_latency_mode, Framing framing)
+    : OggOpusEncoder(num_channels, sample_rate_hz, bitrate_bps,
+                     MakeOptions(use_vbr, low_latency_mode, framing)) {}
+
+OggOpusEncoder::OggOpusEncoder(int num_channels, int sample_rate_hz,
+                               int bitrate_bps, const Options& options)
     : num_channels_(num_channels),
       sample_rate_hz_(sample_rate_hz),
-      frame_size_(kEncodingBufferSizeSeconds * sample_rate_hz_),
-      encoder_(OpusUniquePtr(
-          opus_encoder_create(sample_rate_hz_, num_channels_,
-                              OPUS_APPLICATION_AUDIO, &error_code_),
-          opus_encoder_destroy)),
+      bitrate_bps_(bitrate_bps),
+      options_(options),
+      frame_size_(static_cast<int64_t>(sample_rate_hz_) *
+                  options.frame_duration_us / 1000000),
+      num_streams_(1),
+      num_coupled_streams_(num_channels - 1),
+      encoder_(nullptr, opus_encoder_destroy),
+      ms_encoder_(nullptr, opus_multistream_encoder_destroy),
       flushed_(false),
-      low_latency_mode_(low_latency_mode),
+      header_(false),
+      low_latency_mode_(options.low_latency_mode),
+      framing_(options.framing),
+      output_(nullptr),
+      output_size_(0),
+      output_capacity_(0),
       elements_in_pcm_frame_(0),
-      pcm_frame_(num_channels_ * frame_size_) {
-  assert(num_channels <= 2);  // Only mono and stereo are supported).
+      pcm_frame_(num_channels_ * frame_size_),
+      use_libogg_(options.use_libogg),
+      page_writer_(kOggSerialNumber) {
+  assert(num_channels >= 1);
   std::vector<int> valid_sample_rates = {8000, 12000, 16000, 24000, 48000};
   assert(std::find(valid_sample_rates.begin(), valid_sample_rates.end(),
                    sample_rate_hz) != valid_sample_rates.end());
   assert(bitrate_bps >= 500);
   assert(bitrate_bps <= 512000);
+  std::vector<int> valid_frame_durations = {2500,  5000,  10000,
+                                            20000, 40000, 60000};
+  assert(std::find(valid_frame_durations.begin(), valid_frame_durations.end(),
+                   options.frame_duration_us) != valid_frame_durations.end());
+  assert(options.complexity >= 0 && options.complexity <= 10);
+  assert(options.expected_packet_loss_percent >= 0 &&
+         options.expected_packet_loss_percent <= 100);
+
+  if (num_channels_ > (options.mapping_family == 0 ? 2 : 8)) {
+    // Beyond the channel mapping: the encoder is not created, see ok().
+    error_code_ = OPUS_BAD_ARG;
+  } else if (options.mapping_family == 0) {
+    for (int i = 0; i < num_channels_; i++) {
+      stream_map_[i] = i;
+    }
+    encoder_.reset(opus_encoder_create(sample_rate_hz_, num_channels_,
+                                       options.application, &error_code_));
+  } else {
+    assert(options.mapping_family == 1);
+    const VorbisLayout& layout = kVorbisLayouts[num_channels_ - 1];
+    if (options.uncoupled_streams) {
+      num_streams_ = num_channels_;
+      num_coupled_streams_ = 0;
+      for (int i = 0; i < num_channels_; i++) {
+        stream_map_[i] = i;
+      }
+    } else {
+      num_streams_ = layout.streams;
+      num_coupled_streams_ = layout.coupled_streams;
+      memcpy(stream_map_, layout.mapping, num_channels_);
+    }
+    // The bitrate set below is the total, split by the encoder between
+    // the streams on each frame, a coupled stream getting about twice the
+    // bitrate of a mono one.
+    ms_encoder_.reset(opus_multistream_encoder_create(
+        sample_rate_hz_, num_channels_, num_streams_, num_coupled_streams_,
+        stream_map_, options.application, &error_code_));
+  }
 
-  opus_encoder_ctl(encoder_.get(), OPUS_SET_BITRATE(bitrate_bps));
-  if (!use_vbr) {
-    opus_encoder_ctl(encoder_.get(), OPUS_SET_VBR(0));
+  lookahead_ = 0;
+  if (ok()) {
+    EncoderCtl(OPUS_SET_BITRATE(bitrate_bps));
+    if (!options.use_vbr) {
+      EncoderCtl(OPUS_SET_VBR(0));
+    }
+    EncoderCtl(OPUS_SET_COMPLEXITY(options.complexity));
+    if (options.use_dtx) {
+      EncoderCtl(OPUS_SET_DTX(1));
+    }
+    if (options.use_inband_fec) {
+      EncoderCtl(OPUS_SET_INBAND_FEC(1));
+      EncoderCtl(
+          OPUS_SET_PACKET_LOSS_PERC(options.expected_packet_loss_percent));
+    }
+    EncoderCtl(OPUS_GET_LOOKAHEAD(&lookahead_));
+  } else {
+    fprintf(stderr, "OggOpusEncoder: encoder creation failed: %s\n",
+            opus_strerror(error_code_));
   }
-  constexpr int kComplexity = 4;
-  opus_encoder_ctl(encoder_.get(), OPUS_SET_COMPLEXITY(kComplexity));
 
-  // We will always pass exactly one frame at a time to the encoder.
-  opus_frame_.resize(kBytesPerSample * pcm_frame_.size());
+  // We will always pass exactly one frame at a time to the encoder, which
+  // packs frames longer than 20 ms as several Opus frames.
+  const int opus_frames_per_packet =
+      std::max(1, options.frame_duration_us / kOpusFrameDurationUs);
+  // In a multistream packet, all the streams but the last are
+  // self-delimited, their length following their TOC.
+  const int max_stream_bytes =
+      opus_frames_per_packet * kMaxOpusFrameBytes + kMaxOpusPacketOverheadBytes;
+  opus_frame_.resize(num_streams_ * max_stream_bytes +
+                     (num_streams_ - 1) * kSelfDelimitingLengthBytes);
+  ogg_bytes_.reserve(bitrate_bps_ / 8 * kOutputBufferMilliseconds / 1000 +
+                     kOggPageBodyThreshold);
 
   // Start generating Ogg packets (though they don't get sent out until the
   // first call to Encode()).
   packet_count_ = 0;
   granule_position_ = 0;
-  ogg_stream_init(&stream_, 0 /* serial number */);
-  GenerateOggPacketsForHeader();
+  decoded_samples_ = 0;
+  memset(&stream_, 0, sizeof(stream_));
+  if (use_libogg_) {
+    ogg_stream_init(&stream_, kOggSerialNumber);
+  }
+  if (framing_ == Framing::kRawLengthPrefixed) {
+    packets_.reserve(kReservedPacketInfos);
+  } else if (ok()) {
+    GenerateOggPacketsForHeader();
+  }
 }
 
 OggOpusEncoder::~OggOpusEncoder() {
-  ogg_stream_clear(&stream_);
+  if (use_libogg_) {
+    ogg_stream_clear(&stream_);
+  }
+}
+
+void OggOpusEncoder::Reset(uint32_t serial_number) {
+  // Keeps the settings, bitrate and complexity included.
+  EncoderCtl(OPUS_RESET_STATE);
+  flushed_ = false;
+  header_ = false;
+  output_ = nullptr;
+  output_size_ = 0;
+  output_capacity_ = 0;
+  elements_in_pcm_frame_ = 0;
+  pcm_frame_.assign(pcm_frame_.size(), 0);
+  packets_.clear();
+  ogg_bytes_.clear();
+
+  packet_count_ = 0;
+  granule_position_ = 0;
+  decoded_samples_ = 0;
+  if (use_libogg_) {
+    ogg_stream_reset_serialno(&stream_, serial_number);
+  } else {
+    page_writer_.Reset(serial_number);
+  }
+  if (framing_ == Framing::kOgg) {
+    GenerateOggPacketsForHeader();
+  }
 }
 
 // Encodes 16-bit PCM data in OggOpus format.
 const std::vector<unsigned char>& OggOpusEncoder::Process(
     const std::vector<int16_t>& pcm) {
+  return Process(pcm.data(), pcm.size());
+}
+
+const std::vector<unsigned char>& OggOpusEncoder::Process(
+    const int16_t* pcm, size_t num_elements) {
   assert(!flushed_);
-  assert((pcm.size() % num_channels_) == 0);
-  if (!header_) {
-    ogg_bytes_.resize(0);
-  } else {
+  BeginOutput(nullptr, 0);
+  EncodeSamples(pcm, num_elements);
+  metrics_.RecordBuffered(elements_in_pcm_frame_ / num_channels_,
+                          sample_rate_hz_);
+  return ogg_bytes_;
+}
+
+int OggOpusEncoder::Process(const int16_t* pcm, size_t num_elements,
+                            unsigned char* out, size_t out_capacity) {
+  assert(!flushed_);
+  if (out_capacity < MaxOutputBytes(num_elements)) {
+    return -1;
+  }
+  BeginOutput(out, out_capacity);
+  EncodeSamples(pcm, num_elements);
+  metrics_.RecordBuffered(elements_in_pcm_frame_ / num_channels_,
+                          sample_rate_hz_);
+  output_ = nullptr;
+  return output_size_;
+}
+
+// Returns any remaining samples from the codec.
+const std::vector<unsigned char>& OggOpusEncoder::Flush() {
+  assert(!flushed_);
+  BeginOutput(nullptr, 0);
+  EncodeTail();
+  flushed_ = true;
+  return ogg_bytes_;
+}
+
+int OggOpusEncoder::Flush(unsigned char* out, size_t out_capacity) {
+  assert(!flushed_);
+  if (out_capacity < MaxFlushBytes()) {
+    return -1;
+  }
+  BeginOutput(out, out_capacity);
+  EncodeTail();
+  flushed_ = true;
+  output_ = nullptr;
+  return output_size_;
+}
+
+void OggOpusEncoder::EncodeTail() {
+  // The decoder output lags the input by the lookahead: the samples left
+  // come out of the packets up to lookahead_ samples later, possibly past
+  // the frame holding them. Frames of silence follow until they are all
+  // decoded, the end of the last one being trimmed, see
+  // https://tools.ietf.org/html/rfc7845#section-4.5
+  const int num_frames = TailFrames();
+  for (int i = 0; i < num_frames; i++) {
+    unsigned char* opus_frame = OpusFrameBuffer();
+    int num_opus_frame_bytes = EncodeFrame(pcm_frame_.data(), opus_frame);
+    assert(num_opus_frame_bytes >= 0);
+    OutputOpusFrame(opus_frame, num_opus_frame_bytes, true,
+                    i == num_frames - 1);
+    pcm_frame_.assign(pcm_frame_.size(), 0);
+    elements_in_pcm_frame_ = 0;
+  }
+}
+
+int OggOpusEncoder::TailFrames() const {
+  const int num_samples = elements_in_pcm_frame_ / num_channels_;
+  return std::max(1, (num_samples + lookahead_ + frame_size_ - 1) /
+                         frame_size_);
+}
+
+const std::vector<unsigned char>& OggOpusEncoder::ProcessPacket(
+    const unsigned char* packet, int length) {
+  assert(!flushed_);
+  assert(static_cast<size_t>(length) <= opus_frame_.size());
+  BeginOutput(nullptr, 0);
+  unsigned char* opus_frame = OpusFrameBuffer();
+  memcpy(opus_frame, packet, length);
+  OutputOpusFrame(opus_frame, length, false, false);
+  return ogg_bytes_;
+}
+
+const std::vector<unsigned char>& OggOpusEncoder::FlushPacket(
+    const unsigned char* packet, int length, int64_t end_position) {
+  assert(!flushed_);
+  assert(end_position <= decoded_samples_ + frame_size_);
+  assert(static_cast<size_t>(length) <= opus_frame_.size());
+  BeginOutput(nullptr, 0);
+  // The granule position moves to the end of the input, the tail of the
+  // stream possibly spanning several packets.
+  granule_position_ = end_position;
+  elements_in_pcm_frame_ = 0;
+  unsigned char* opus_frame = OpusFrameBuffer();
+  memcpy(opus_frame, packet, length);
+  OutputOpusFrame(opus_frame, length, true, true);
+  flushed_ = true;
+  return ogg_bytes_;
+}
+
+size_t OggOpusEncoder::MaxOutputBytes(size_t num_elements) const {
+  const size_t frame_elements = frame_size_ * num_channels_;
+  const size_t num_packets =
+      (elements_in_pcm_frame_ + num_elements) / frame_elements;
+  return MaxOggBytes(num_packets) + (header_ ? ogg_bytes_.size() : 0);
+}
+
+size_t OggOpusEncoder::MaxFlushBytes() const {
+  // The most frames of the tail, whatever the samples buffered by then.
+  const size_t num_packets = (lookahead_ + frame_size_ - 1) / frame_size_ + 1;
+  return MaxOggBytes(num_packets) + (header_ ? ogg_bytes_.size() : 0);
+}
+
+size_t OggOpusEncoder::MaxOggBytes(size_t num_packets) const {
+  if (framing_ != Framing::kOgg) {
+    return num_packets * (kRawPrefixMaxBytes + opus_frame_.size());
+  }
+
+  // Data already in the stream, not yet written out as pages, plus the
+  // largest packets the encoder can produce.
+  const size_t pending_body_bytes =
+      use_libogg_ ? stream_.body_fill - stream_.body_returned
+                  : page_writer_.pending_body_bytes();
+  const size_t pending_segments =
+      use_libogg_ ? stream_.lacing_fill - stream_.lacing_returned
+                  : page_writer_.pending_segments();
+  const size_t body_bytes =
+      pending_body_bytes + num_packets * opus_frame_.size();
+  const size_t segments =
+      pending_segments + num_packets * (opus_frame_.size() / 255 + 1);
+
+  // A page is closed on its segment table filling up, on its body reaching
+  // the threshold, or on a flush, which happens at most once per packet.
+  const size_t pages = segments / kOggMaxPageSegments +
+                       body_bytes / kOggPageBodyThreshold + num_packets + 2;
+  return body_bytes + segments + pages * kOggPageHeaderBytes;
+}
+
+void OggOpusEncoder::BeginOutput(unsigned char* out, size_t out_capacity) {
+  output_ = out;
+  output_size_ = 0;
+  output_capacity_ = out_capacity;
+  packets_.clear();
+  if (header_) {
+    // The header pages are still held by ogg_bytes_.
     header_ = false;
+    if (!output_) {
+      return;
+    }
+    WriteOutput(ogg_bytes_.data(), ogg_bytes_.size());
   }
-  int num_samples_processed = 0;
+  ogg_bytes_.clear();
+}
+
+void OggOpusEncoder::EncodeSamples(const int16_t* pcm, size_t num_elements) {
+  assert((num_elements % num_channels_) == 0);
+  size_t num_samples_processed = 0;
 
   // Process the first block, handling any leftovers from a previous round.
   if (elements_in_pcm_frame_ > 0) {
-    int entries_to_write =
-        std::min(pcm_frame_.size() - elements_in_pcm_frame_, pcm.size());
-    std::copy(pcm.begin(), pcm.begin() + entries_to_write,
+    size_t entries_to_write =
+        std::min(pcm_frame_.size() - elements_in_pcm_frame_, num_elements);
+    std::copy(pcm, pcm + entries_to_write,
               pcm_frame_.begin() + elements_in_pcm_frame_);
     elements_in_pcm_frame_ += entries_to_write;
     if (elements_in_pcm_frame_ == pcm_frame_.size()) {
       // pcm_frame_ is full, encode it.
-      int num_opus_frame_bytes =
-          opus_encode(encoder_.get(), pcm_frame_.data(), frame_size_,
-                      opus_frame_.data(), opus_frame_.size());
+      unsigned char* opus_frame = OpusFrameBuffer();
+      int num_opus_frame_bytes = EncodeFrame(pcm_frame_.data(), opus_frame);
 
       assert(num_opus_frame_bytes >= 0);
-      GenerateOggPacketsForOpusFrame(opus_frame_.data(), num_opus_frame_bytes,
-                                     &ogg_bytes_, false);
+      OutputOpusFrame(opus_frame, num_opus_frame_bytes, false, false);
       num_samples_processed += entries_to_write;
       pcm_frame_.assign(pcm_frame_.size(), 0);
       elements_in_pcm_frame_ = 0;
     } else {
       // There's nothing to encode. We've put all of pcm data into pcm_frame_
       // for later processing.
-      ogg_bytes_.resize(0);
-      return ogg_bytes_;
+      return;
     }
   }
 
   // Process whole frames directly from pcm.
-  while (num_samples_processed + frame_size_ * num_channels_ <= pcm.size()) {
+  const size_t frame_elements = frame_size_ * num_channels_;
+  while (num_samples_processed + frame_elements <= num_elements) {
+    unsigned char* opus_frame = OpusFrameBuffer();
     int num_opus_frame_bytes =
-        opus_encode(encoder_.get(), pcm.data() + num_samples_processed,
-                    frame_size_, opus_frame_.data(), opus_frame_.size());
+        EncodeFrame(pcm + num_samples_processed, opus_frame);
 
     assert(num_opus_frame_bytes >= 0);
-    GenerateOggPacketsForOpusFrame(opus_frame_.data(), num_opus_frame_bytes,
-                                   &ogg_bytes_, false);
-    num_samples_processed += frame_size_ * num_channels_;
+    OutputOpusFrame(opus_frame, num_opus_frame_bytes, false, false);
+    num_samples_processed += frame_elements;
   }
 
-  if (low_latency_mode_) {
+  if (low_latency_mode_ && framing_ == Framing::kOgg) {
     // Force the codec to produce samples for every input buffer.
-    AppendOggStateToBuffer(&ogg_bytes_, true);
+    AppendOggStateToBuffer(true);
   }
 
   // Place any remaining samples in pcm_frame_.
-  elements_in_pcm_frame_ = pcm.size() - num_samples_processed;
-  std::copy(pcm.begin() + num_samples_processed, pcm.end(), pcm_frame_.begin());
-  return ogg_bytes_;
+  elements_in_pcm_frame_ = num_elements - num_samples_processed;
+  std::copy(pcm + num_samples_processed, pcm + num_elements,
+            pcm_frame_.begin());
 }
 
-// Returns any remaining samples from the codec.
-const std::vector<unsigned char>& OggOpusEncoder::Flush() {
-  assert(!flushed_);
-  ogg_bytes_.resize(0);
-  int num_opus_frame_bytes =
-      opus_encode(encoder_.get(), pcm_frame_.data(), frame_size_,
-                  opus_frame_.data(), opus_frame_.size());
-  assert(num_opus_frame_bytes >= 0);
-  GenerateOggPacketsForOpusFrame(opus_frame_.data(), num_opus_frame_bytes,
-                                 &ogg_bytes_, true);
-  flushed_ = true;
-  return ogg_bytes_;
+unsigned char* OggOpusEncoder::OpusFrameBuffer() {
+  if (framing_ == Framing::kOgg && !use_libogg_) {
+    return page_writer_.PacketBuffer(opus_frame_.size());
+  }
+  return opus_frame_.data();
+}
+
+int OggOpusEncoder::EncodeFrame(const opus_int16* pcm, unsigned char* out) {
+  metrics_.BeginFrame();
+  const int bytes =
+      ms_encoder_ ? opus_multistream_encode(ms_encoder_.get(), pcm,
+                                            frame_size_, out,
+                                            opus_frame_.size())
+                  : opus_encode(encoder_.get(), pcm, frame_size_, out,
+                                opus_frame_.size());
+  metrics_.EndFrame(bytes > 0 ? bytes : 0);
+  return bytes;
 }
 
 void OggOpusEncoder::GenerateOggPacketsForHeader() {
@@ -169,10 +493,13 @@ void OggOpusEncoder::GenerateOggPacketsForHeader() {
   OpusHeader header;
   header.version = 1;
   header.channels = num_channels_;
-  opus_encoder_ctl(encoder_.get(), OPUS_GET_LOOKAHEAD(&header.preskip));
+  header.preskip = lookahead_ * (kOggGranuleRateHz / sample_rate_hz_);
   header.input_sample_rate = sample_rate_hz_;
   header.gain = 0;
-  header.channel_mapping = 0;
+  header.channel_mapping = options_.mapping_family;
+  header.nb_streams = num_streams_;
+  header.nb_coupled = num_coupled_streams_;
+  memcpy(header.stream_map, stream_map_, num_channels_);
 
   // Write the ID header.
   ogg_packet id_packet;
@@ -181,14 +508,20 @@ void OggOpusEncoder::GenerateOggPacketsForHeader() {
   id_packet.granulepos = granule_position_;
   id_packet.packetno = packet_count_;
   constexpr int kHeaderSizeUpperBound = 64;
-  id_packet.packet = new unsigned char[kHeaderSizeUpperBound];
+  unsigned char id_bytes[kHeaderSizeUpperBound];
+  id_packet.packet = id_bytes;
   // opus_header_to_packet fills id_packet.packet with header data and returns
   // the number of bytes.
   id_packet.bytes =
       opus_header_to_packet(&header, id_packet.packet, kHeaderSizeUpperBound);
   // Add the ID packet into the stream.
   packet_count_++;
-  ogg_stream_packetin(&stream_, &id_packet);
+  if (use_libogg_) {
+    ogg_stream_packetin(&stream_, &id_packet);
+  } else {
+    page_writer_.AddPacket(id_packet.packet, id_packet.bytes,
+                           id_packet.granulepos, false);
+  }
 
   // Write the comment header.
   ogg_packet comment_packet;
@@ -196,73 +529,163 @@ void OggOpusEncoder::GenerateOggPacketsForHeader() {
   comment_packet.e_o_s = 0;
   comment_packet.granulepos = granule_position_;
   comment_packet.packetno = packet_count_;
-  const std::string kVendor = "Google using libopus";
-  std::string packet = "";
-  packet.append("OpusTags");
-  packet.append(SerializeUint32(kVendor.size()));
-  packet.append(kVendor);
-  packet.append(SerializeUint32(0));
-  comment_packet.packet = const_cast<unsigned char*>(
-      reinterpret_cast<const unsigned char*>(packet.c_str()));
-  comment_packet.bytes = packet.length();
+  // Built on the stack, as the ID header, so that Reset() doesn't allocate.
+  constexpr size_t kVendorBytes = sizeof(kVendor) - 1;
+  unsigned char comment_bytes[8 + 4 + kVendorBytes + 4];
+  unsigned char* packet = comment_bytes;
+  memcpy(packet, "OpusTags", 8);
+  packet = SerializeUint32(kVendorBytes, packet + 8);
+  memcpy(packet, kVendor, kVendorBytes);
+  packet = SerializeUint32(0, packet + kVendorBytes);
+  comment_packet.packet = comment_bytes;
+  comment_packet.bytes = packet - comment_bytes;
 
   // Add the comment header into the stream.
   packet_count_++;
-  ogg_stream_packetin(&stream_, &comment_packet);
+  if (use_libogg_) {
+    ogg_stream_packetin(&stream_, &comment_packet);
+  } else {
+    page_writer_.AddPacket(comment_packet.packet, comment_packet.bytes,
+                           comment_packet.granulepos, false);
+  }
   // Force a page break after the comment header.
   // According to
   // https://tools.ietf.org/html/draft-ietf-codec-oggopus-14#section-3 there is
   // a mandatory page break after the comment header.
-  AppendOggStateToBuffer(&ogg_bytes_, true);
+  AppendOggStateToBuffer(true);
   header_ = true;
+}
+
+void OggOpusEncoder::OutputOpusFrame(unsigned char* opus_frame_bytes,
+                                     int opus_bytes_length, bool flush,
+                                     bool end_of_stream) {
+  decoded_samples_ += frame_size_;
+  if (framing_ == Framing::kOgg) {
+    GenerateOggPacketsForOpusFrame(opus_frame_bytes, opus_bytes_length, flush,
+                                   end_of_stream);
+  } else {
+    WriteRawPacket(opus_frame_bytes, opus_bytes_length, flush);
+  }
+}
+
+void OggOpusEncoder::WriteRawPacket(const unsigned char* opus_frame_bytes,
+                                    int opus_bytes_length, bool flush) {
+  assert(opus_bytes_length < kRawPrefixLongLimit);
+  unsigned char prefix[kRawPrefixMaxBytes];
+  size_t prefix_length = 0;
+  if (opus_bytes_length < kRawPrefixShortLimit) {
+    prefix[prefix_length++] = opus_bytes_length;
+  } else {
+    prefix[prefix_length++] = 0x80 | (opus_bytes_length >> 8);
+    prefix[prefix_length++] = opus_bytes_length & 0xff;
+  }
+
+  PacketInfo info;
+  info.offset = output_ ? output_size_ : ogg_bytes_.size();
+  info.payload_offset = info.offset + prefix_length;
+  info.length = opus_bytes_length;
+  info.timestamp_us = granule_position_ * 1000000 / sample_rate_hz_;
+  AdvanceGranulePosition(flush);
+  info.granule_position = granule_position_;
+  packets_.push_back(info);
 
-  delete[] id_packet.packet;
+  WriteOutput(prefix, prefix_length);
+  WriteOutput(opus_frame_bytes, opus_bytes_length);
+}
+
+void OggOpusEncoder::AdvanceGranulePosition(bool flush) {
+  // If we're closing the stream, we don't assume that the last packet
+  // includes a full frame.
+  if (flush) {
+    granule_position_ += (elements_in_pcm_frame_ / num_channels_);
+  } else {
+    granule_position_ += frame_size_;
+  }
 }
 
 void OggOpusEncoder::GenerateOggPacketsForOpusFrame(
-    unsigned char* opus_frame_bytes, int opus_bytes_length,
-    std::vector<unsigned char>* ogg_bytes, bool flush) {
+    unsigned char* opus_frame_bytes, int opus_bytes_length, bool flush,
+    bool end_of_stream) {
   // Flush data from the ogg object into the outgoing stream.
-  AppendOggStateToBuffer(ogg_bytes, flush);
+  AppendOggStateToBuffer(end_of_stream);
 
   // Write the most recent buffer of Opus data into an Ogg packet.
   ogg_packet frame_packet;
   frame_packet.b_o_s = 0;
-  frame_packet.e_o_s = flush ? 1 : 0;
+  frame_packet.e_o_s = end_of_stream ? 1 : 0;
   // According to
   // https://tools.ietf.org/html/draft-ietf-codec-oggopus-14#section-4 the
   // granule position should include all samples up to the last packet completed
   // on the page, so we need to update granule_position_ before assigning it to
-  // the packet.  If we're closing the stream, we don't assume that the last
-  // packet includes a full frame.
-  if (flush) {
-    granule_position_ += (elements_in_pcm_frame_ / num_channels_);
-  } else {
-    granule_position_ += frame_size_;
+  // the packet.
+  //
+  // The granule position counts the decoded samples, the pre-skip included:
+  // that of the last packet ends the stream after the last sample input,
+  // delayed by the pre-skip, which the frames of the tail cover.
+  int64_t granule_position = decoded_samples_;
+  AdvanceGranulePosition(flush);
+  if (end_of_stream) {
+    granule_position =
+        std::min<int64_t>(granule_position, granule_position_ + lookahead_);
   }
-  frame_packet.granulepos = granule_position_;
+  frame_packet.granulepos =
+      granule_position * (kOggGranuleRateHz / sample_rate_hz_);
   frame_packet.packetno = packet_count_;
   frame_packet.packet = opus_frame_bytes;
   frame_packet.bytes = opus_bytes_length;
-  // Add the data packet into the stream.
+  // Add the data packet into the stream. The page writer already holds it,
+  // encoded in place.
   packet_count_++;
-  ogg_stream_packetin(&stream_, &frame_packet);
+  if (use_libogg_) {
+    ogg_stream_packetin(&stream_, &frame_packet);
+  } else {
+    page_writer_.CommitPacket(opus_bytes_length, frame_packet.granulepos,
+                              end_of_stream);
+  }
 
   // Try flushing again after data packet.
-  AppendOggStateToBuffer(ogg_bytes, flush);
+  AppendOggStateToBuffer(end_of_stream);
 }
 
-void OggOpusEncoder::AppendOggStateToBuffer(std::vector<unsigned char>* buffer,
-                                            bool flush_ogg_stream) {
+void OggOpusEncoder::AppendOggStateToBuffer(bool flush_ogg_stream) {
+  if (!use_libogg_) {
+    size_t page_bytes;
+    while ((page_bytes = page_writer_.NextPage(flush_ogg_stream)) != 0) {
+      metrics_.RecordPage(page_writer_.page_packets());
+      page_writer_.WritePage(ReserveOutput(page_bytes));
+    }
+    return;
+  }
   int (*write_fun)(ogg_stream_state*, ogg_page*) =
       flush_ogg_stream ? &ogg_stream_flush : &ogg_stream_pageout;
   while (write_fun(&stream_, &page_) != 0) {
-    const int initial_size = buffer->size();
-    buffer->resize(buffer->size() + page_.header_len + page_.body_len);
-    memcpy(buffer->data() + initial_size, page_.header, page_.header_len);
-    memcpy(buffer->data() + initial_size + page_.header_len, page_.body,
-           page_.body_len);
+    metrics_.RecordPage(ogg_page_packets(&page_));
+    WriteOutput(page_.header, page_.header_len);
+    WriteOutput(page_.body, page_.body_len);
+  }
+}
+
+void OggOpusEncoder::WriteOutput(const unsigned char* data, size_t size) {
+  if (!output_) {
+    ogg_bytes_.insert(ogg_bytes_.end(), data, data + size);
+    return;
+  }
+  // Bounded by MaxOutputBytes(), checked on entry.
+  assert(output_size_ + size <= output_capacity_);
+  memcpy(output_ + output_size_, data, size);
+  output_size_ += size;
+}
+
+unsigned char* OggOpusEncoder::ReserveOutput(size_t size) {
+  if (!output_) {
+    const size_t offset = ogg_bytes_.size();
+    ogg_bytes_.resize(offset + size);
+    return ogg_bytes_.data() + offset;
   }
+  assert(output_size_ + size <= output_capacity_);
+  unsigned char* data = output_ + output_size_;
+  output_size_ += size;
+  return data;
 }
 
 }  // namespace audio_util
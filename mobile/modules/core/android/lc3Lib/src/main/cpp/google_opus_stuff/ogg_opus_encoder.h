@@ -17,34 +17,112 @@
 #ifndef AUDIO_UTIL_OGG_OPUS_ENCODER_H_
 #define AUDIO_UTIL_OGG_OPUS_ENCODER_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 #include "libogg/ogg.h"
 #include "libopus/opus.h"
+#include "encoder_metrics.h"
+#include "libopus/opus_multistream.h"
+#include "ogg_page_writer.h"
 
 namespace audio_util {
 
 // This class is meant to be a dependency-light streaming encoder.
 //
-// Encoding is done internally on a block size of 20ms, which seems to be the
-// recommended size for Opus encoding.
+// Encoding is done internally on a block size of 20ms by default, which seems
+// to be the recommended size for Opus encoding, see Options.
 class OggOpusEncoder {
  public:
   // Input is int16 data.
   constexpr static int kBytesPerSample = 2;
   constexpr static int kBitsPerSample = 16;
 
-  // num_channels must be 1 or 2.
+  // Packaging of the Opus packets in the output.
+  enum class Framing {
+    // Ogg pages, with the OggOpus header: a playable stream, for recording.
+    kOgg,
+    // Raw Opus packets, each preceded by its length, for streaming links
+    // where the container overhead is not wanted. The length takes one byte
+    // below 128, otherwise two bytes, big-endian with the high bit set:
+    //   0lllllll  or  1lllllll llllllll
+    // Granule position and timestamp are not in the stream, see packets().
+    kRawLengthPrefixed,
+  };
+
+  // Encoder settings. The defaults are those of the original encoder: 20 ms
+  // frames, at complexity 4, of generic audio.
+  struct Options {
+    // One of OPUS_APPLICATION_VOIP, OPUS_APPLICATION_AUDIO or
+    // OPUS_APPLICATION_RESTRICTED_LOWDELAY.
+    int application = OPUS_APPLICATION_AUDIO;
+
+    // One of 2500, 5000, 10000, 20000, 40000 or 60000. Shorter frames lower
+    // the latency, longer frames the bitrate spent on packet overhead.
+    int frame_duration_us = 20000;
+
+    // From 0 to 10, trading CPU time for quality.
+    int complexity = 4;
+
+    bool use_vbr = true;
+
+    // Discontinuous transmission: silences are sent as 1 or 2 byte packets.
+    bool use_dtx = false;
+
+    // In-band forward error correction, sized from the loss expected.
+    bool use_inband_fec = false;
+    int expected_packet_loss_percent = 0;
+
+    bool low_latency_mode = false;
+    Framing framing = Framing::kOgg;
+
+    // Channel mapping family of the stream, see
+    // https://tools.ietf.org/html/rfc7845#section-5.1.1
+    //   0: mono or stereo, as a single Opus stream.
+    //   1: 1 to 8 channels, in the Vorbis channel order, as several Opus
+    //      streams encoded in a single pass, the bitrate being the total.
+    int mapping_family = 0;
+
+    // Family 1 only: each channel in its own stream, none being coupled.
+    // Joint stereo coding alters the phase between the channels of a pair,
+    // which the processing of a microphone array relies on.
+    bool uncoupled_streams = false;
+
+    // Ogg pages assembled by libogg, rather than by the built-in writer
+    // which avoids its copies. The output is identical: this is kept to
+    // validate the built-in writer.
+    bool use_libogg = false;
+  };
+
+  // Description of a packet written by the last call to Process() or
+  // Flush(), in kRawLengthPrefixed framing.
+  struct PacketInfo {
+    size_t offset;              // Of the length prefix, in the output.
+    size_t payload_offset;      // Of the Opus packet, past its prefix.
+    size_t length;              // Opus packet bytes, prefix excluded.
+    int64_t granule_position;   // Samples encoded, this packet included.
+    int64_t timestamp_us;       // Start of the packet, from stream start.
+  };
+
+  // num_channels must be 1 or 2, up to 8 with mapping family 1, else the
+  // encoder is not created, see ok().
   // sample rate must be one of {8000, 12000, 16000, 24000, 48000}
   // Note that low_latency_mode will increase the total number of Ogg packets,
   // but will reduce overall latency of the codec. This does not impact the
   // quality of audio compression, only how the data is packaged in the Ogg
   // container. Low latency mode is only recommended for realtime streaming
   // applications. See test for actual bitrate increases.
+  // The low_latency_mode does not apply to kRawLengthPrefixed framing, each
+  // packet being output as soon as encoded.
+  OggOpusEncoder(int num_channels, int sample_rate_hz, int bitrate_bps,
+                 bool use_vbr, bool low_latency_mode,
+                 Framing framing = Framing::kOgg);
+
+  // Same as above, with all the encoder settings.
   OggOpusEncoder(int num_channels, int sample_rate_hz, int bitrate_bps,
-                 bool use_vbr, bool low_latency_mode);
+                 const Options& options);
 
   ~OggOpusEncoder();
 
@@ -54,35 +132,172 @@ class OggOpusEncoder {
   // calling this function with new samples until they become available.
   const std::vector<unsigned char>& Process(const std::vector<int16_t>& pcm);
 
+  // Same as above, on `num_elements` interleaved samples starting at `pcm`.
+  // The returned buffer has its capacity reserved from the bitrate, and is
+  // reused from call to call.
+  const std::vector<unsigned char>& Process(const int16_t* pcm,
+                                            size_t num_elements);
+
+  // Encodes `num_elements` interleaved samples starting at `pcm`, and writes
+  // the Ogg bytes directly into the caller provided `out` buffer.
+  // Returns the number of bytes written, or -1 when `out_capacity` is lower
+  // than MaxOutputBytes(num_elements), nothing being encoded then.
+  // Once the Ogg stream buffers are warmed up, this performs no heap
+  // allocation.
+  int Process(const int16_t* pcm, size_t num_elements, unsigned char* out,
+              size_t out_capacity);
+
   // Returns any remaining samples from the codec. This should be called last,
-  // and never more than once.
+  // and never more than once. The remaining samples are encoded zero padded,
+  // followed by frames of silence as long as the encoder lookahead delays
+  // them past the frame, for the stream to be decoded to its last sample.
   const std::vector<unsigned char>& Flush();
 
+  // Same as above, writing into the caller provided `out` buffer. Returns
+  // the number of bytes written, or -1 when `out_capacity` is lower than
+  // MaxFlushBytes().
+  int Flush(unsigned char* out, size_t out_capacity);
+
+  // Output Opus packets encoded elsewhere, by an encoder of the same
+  // settings, as if their frames had been encoded by Process() and Flush():
+  // to stitch the packets of segments encoded in parallel into one stream.
+  // Each packet holds a whole frame. The last one closes the stream, whose
+  // input ended at `end_position` samples per channel.
+  const std::vector<unsigned char>& ProcessPacket(const unsigned char* packet,
+                                                  int length);
+  const std::vector<unsigned char>& FlushPacket(const unsigned char* packet,
+                                                int length,
+                                                int64_t end_position);
+
+  // Starts a new stream, of Ogg serial number `serial_number`, as a new
+  // encoder of the same settings would, whatever the state of the current
+  // one: the Opus encoder is reset (OPUS_RESET_STATE), the buffered samples
+  // and output dropped, and the header written again. The buffers are kept:
+  // once the encoder has been used, this performs no heap allocation.
+  void Reset(uint32_t serial_number);
+
+  // Upper bounds of the number of bytes output by Process() on
+  // `num_elements` samples, and by Flush(), in the current state.
+  size_t MaxOutputBytes(size_t num_elements) const;
+  size_t MaxFlushBytes() const;
+
+  // Packets written by the last call to Process() or Flush(), in
+  // kRawLengthPrefixed framing; always empty in kOgg framing.
+  const std::vector<PacketInfo>& packets() const { return packets_; }
+
+  Framing framing() const { return framing_; }
+
+  // Copies the metrics recorded since the encoder was created, all zero
+  // unless built with AUDIO_UTIL_ENCODER_METRICS, see EncoderMetrics.
+  void GetMetrics(EncoderMetricsSnapshot* snapshot) const {
+    metrics_.Snapshot(snapshot);
+  }
+
+  // Whether the Opus encoder was created. When false, as on settings libopus
+  // rejects, no other method may be called.
+  bool ok() const { return error_code_ == OPUS_OK; }
+
+  // Settings the encoder was created with.
+  int num_channels() const { return num_channels_; }
+  int sample_rate_hz() const { return sample_rate_hz_; }
+  int bitrate_bps() const { return bitrate_bps_; }
+  const Options& options() const { return options_; }
+
  private:
   using OpusUniquePtr =
       std::unique_ptr<OpusEncoder, decltype(&opus_encoder_destroy)>;
+  using OpusMSUniquePtr =
+      std::unique_ptr<OpusMSEncoder,
+                      decltype(&opus_multistream_encoder_destroy)>;
+
+  // opus_encoder_ctl(), or opus_multistream_encoder_ctl(), on the encoder
+  // in use.
+  template <typename... Args>
+  int EncoderCtl(int request, Args... args) {
+    return ms_encoder_ ? opus_multistream_encoder_ctl(ms_encoder_.get(),
+                                                      request, args...)
+                       : opus_encoder_ctl(encoder_.get(), request, args...);
+  }
+
+  // Encodes a frame of `pcm` into `out`, of opus_frame_.size() bytes.
+  // Returns the packet length, or an Opus error code.
+  int EncodeFrame(const opus_int16* pcm, unsigned char* out);
 
   std::string GetOpusErrorMessage() const;
 
   // Push the Opus header details into the ogg stream.
   void GenerateOggPacketsForHeader();
 
+  // Selects the output of the next pages, the caller provided `out` buffer
+  // or ogg_bytes_ when null, and moves any pending header into it.
+  void BeginOutput(unsigned char* out, size_t out_capacity);
+
+  // Encodes the samples, the Ogg pages being written to the current output.
+  void EncodeSamples(const int16_t* pcm, size_t num_elements);
+
+  // Buffer the next Opus frame is encoded into: in place in the page
+  // writer, when it is used, opus_frame_ otherwise.
+  unsigned char* OpusFrameBuffer();
+
+  // Encodes the samples left in pcm_frame_, then the frames of silence
+  // needed for them to be decoded, the last one closing the stream.
+  void EncodeTail();
+
+  // Number of frames EncodeTail() outputs, in the current state.
+  int TailFrames() const;
+
+  // Outputs a single Opus frame, in the configured framing. `flush` marks
+  // the frames of the tail, which hold the samples left in pcm_frame_ rather
+  // than a whole frame, `end_of_stream` the last one.
+  void OutputOpusFrame(unsigned char* opus_frame_bytes, int opus_bytes_length,
+                       bool flush, bool end_of_stream);
+
+  // Writes a single Opus frame with its length prefix.
+  void WriteRawPacket(const unsigned char* opus_frame_bytes,
+                      int opus_bytes_length, bool flush);
+
+  // Moves the granule position past the next packet.
+  void AdvanceGranulePosition(bool flush);
+
   // Push data from a single Opus frame into an Ogg stream.
   void GenerateOggPacketsForOpusFrame(unsigned char* opus_frame_bytes,
-                                     int opus_bytes_length,
-                                     std::vector<unsigned char>* ogg_bytes,
-                                     bool flush);
+                                     int opus_bytes_length, bool flush,
+                                     bool end_of_stream);
+
+  // Moves the pages ready, from the page writer or the stream_ object, into
+  // the current output.
+  void AppendOggStateToBuffer(bool flush);
 
-  // Moves data from the stream_ object into buffer.
-  void AppendOggStateToBuffer(std::vector<unsigned char>* buffer, bool flush);
+  // Appends bytes to the current output: the caller provided buffer when
+  // set, ogg_bytes_ otherwise.
+  void WriteOutput(const unsigned char* data, size_t size);
+
+  // Returns the next `size` bytes of the current output, to be written.
+  unsigned char* ReserveOutput(size_t size);
+
+  // Upper bound of the Ogg bytes for the data pending in the stream, plus
+  // `num_packets` Opus packets.
+  size_t MaxOggBytes(size_t num_packets) const;
 
   int num_channels_;
   int sample_rate_hz_;
   int bitrate_bps_;
+  Options options_;
 
-  // Number of samples in an Opus 20ms frame for a single channel.
+  // Number of samples in an Opus frame for a single channel.
   int frame_size_;
+
+  // Encoder delay, in samples per channel: the pre-skip of the stream.
+  int lookahead_;
+
+  // Opus streams, and mapping of the channels to them, as in the header.
+  int num_streams_;
+  int num_coupled_streams_;
+  unsigned char stream_map_[8];
+
+  // Single stream encoder, or multistream encoder with mapping family 1.
   OpusUniquePtr encoder_;
+  OpusMSUniquePtr ms_encoder_;
 
   // Stores the status of Opus codec initialization.
   int error_code_;
@@ -94,20 +309,37 @@ class OggOpusEncoder {
   // When true, flushing of the Ogg stream after every call to Process().
   bool low_latency_mode_;
 
+  Framing framing_;
+  std::vector<PacketInfo> packets_;
+
   // A preallocated buffer to store the temporary OGG result.
   std::vector<unsigned char> opus_frame_;
 
   std::vector<unsigned char> ogg_bytes_;
 
+  // Caller provided output of the span overloads, null when writing to
+  // ogg_bytes_.
+  unsigned char* output_;
+  size_t output_size_;
+  size_t output_capacity_;
+
   // A stored buffer for a single frame of PCM data to be processed.
   int elements_in_pcm_frame_;
   std::vector<opus_int16> pcm_frame_;
 
-  // Ogg objects.
+  // Ogg objects, of libogg when use_libogg is set.
+  bool use_libogg_;
+  OggPageWriter page_writer_;
   ogg_stream_state stream_;
   ogg_page page_;
   int packet_count_;      // Count of packets pushed to the stream.
-  int granule_position_;  // Position in the ogg stream.
+  // Position in the stream, in samples per channel at sample_rate_hz_; at
+  // 48 kHz in the Ogg pages.
+  int64_t granule_position_;
+  // Samples per channel decoded from the packets output, whole frames.
+  int64_t decoded_samples_;
+
+  EncoderMetrics metrics_;
 };
 
 }  // namespace audio_util
@@ -0,0 +1,105 @@
+#include "ogg_opus_encoder_pool.h"
+
+#include <utility>
+
+namespace audio_util {
+namespace {
+
+bool SameOptions(const OggOpusEncoder::Options& a,
+                 const OggOpusEncoder::Options& b) {
+  return a.application == b.application &&
+         a.frame_duration_us == b.frame_duration_us &&
+         a.complexity == b.complexity && a.use_vbr == b.use_vbr &&
+         a.use_dtx == b.use_dtx && a.use_inband_fec == b.use_inband_fec &&
+         a.expected_packet_loss_percent == b.expected_packet_loss_percent &&
+         a.low_latency_mode == b.low_latency_mode &&
+         a.framing == b.framing && a.mapping_family == b.mapping_family &&
+         a.uncoupled_streams == b.uncoupled_streams &&
+         a.use_libogg == b.use_libogg;
+}
+
+}  // namespace
+
+OggOpusEncoderPool::OggOpusEncoderPool(size_t max_idle_encoders)
+    : max_idle_encoders_(max_idle_encoders), stats_{0, 0, 0} {
+  // Released encoders are kept without growing the list.
+  idle_.reserve(max_idle_encoders_);
+}
+
+std::unique_ptr<OggOpusEncoder> OggOpusEncoderPool::Acquire(
+    int num_channels, int sample_rate_hz, int bitrate_bps,
+    const OggOpusEncoder::Options& options, uint32_t serial_number) {
+  std::unique_ptr<OggOpusEncoder> encoder;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // The most recently released first, its buffers being the warmest.
+    for (size_t i = idle_.size(); i-- > 0;) {
+      const OggOpusEncoder& idle = *idle_[i];
+      if (idle.num_channels() == num_channels &&
+          idle.sample_rate_hz() == sample_rate_hz &&
+          idle.bitrate_bps() == bitrate_bps &&
+          SameOptions(idle.options(), options)) {
+        encoder = std::move(idle_[i]);
+        idle_.erase(idle_.begin() + i);
+        break;
+      }
+    }
+    if (encoder) {
+      stats_.reused++;
+    }
+  }
+
+  if (encoder) {
+    encoder->Reset(serial_number);
+    return encoder;
+  }
+
+  // Created out of the lock, and counted once known to be usable.
+  encoder.reset(new OggOpusEncoder(num_channels, sample_rate_hz, bitrate_bps,
+                                   options));
+  const bool ok = encoder->ok();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ok) {
+      stats_.created++;
+    } else {
+      stats_.rejected++;
+    }
+  }
+  if (!ok) {
+    return nullptr;
+  }
+  if (serial_number != 0) {
+    encoder->Reset(serial_number);
+  }
+  return encoder;
+}
+
+void OggOpusEncoderPool::Release(std::unique_ptr<OggOpusEncoder> encoder) {
+  if (!encoder || !encoder->ok()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (idle_.size() < max_idle_encoders_) {
+    idle_.push_back(std::move(encoder));
+    return;
+  }
+  // Full: the oldest is dropped, the encoders in use now being more likely
+  // to be asked for again.
+  if (!idle_.empty()) {
+    idle_.erase(idle_.begin());
+    idle_.push_back(std::move(encoder));
+  }
+}
+
+size_t OggOpusEncoderPool::idle_encoders() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return idle_.size();
+}
+
+OggOpusEncoderPool::Stats OggOpusEncoderPool::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+}  // namespace audio_util
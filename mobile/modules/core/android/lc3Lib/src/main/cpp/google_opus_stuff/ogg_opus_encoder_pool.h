@@ -0,0 +1,59 @@
+#ifndef AUDIO_UTIL_OGG_OPUS_ENCODER_POOL_H_
+#define AUDIO_UTIL_OGG_OPUS_ENCODER_POOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "ogg_opus_encoder.h"
+
+namespace audio_util {
+
+// Pool of idle OggOpusEncoders, for streams started and stopped often, as
+// on each utterance of a voice session.
+//
+// Creating an encoder allocates the Opus state and the output buffers, and
+// sets the codec up. An encoder released to the pool is instead kept, and
+// given again to the next stream of the same channels, samplerate, bitrate
+// and options, after a Reset(): starting a stream then costs the header
+// only, without allocating.
+//
+// Thread safe.
+class OggOpusEncoderPool {
+ public:
+  struct Stats {
+    uint64_t reused;    // Streams started on an idle encoder.
+    uint64_t created;   // Streams started on a new encoder.
+    uint64_t rejected;  // Acquisitions of settings the encoder rejected.
+  };
+
+  // Keeps up to `max_idle_encoders` idle encoders, of any settings.
+  explicit OggOpusEncoderPool(size_t max_idle_encoders);
+
+  // Returns an encoder of these settings, starting a stream of Ogg serial
+  // number `serial_number`: an idle one when there is one, a new one
+  // otherwise. Returns null when the settings are rejected, see
+  // OggOpusEncoder::ok().
+  std::unique_ptr<OggOpusEncoder> Acquire(
+      int num_channels, int sample_rate_hz, int bitrate_bps,
+      const OggOpusEncoder::Options& options, uint32_t serial_number);
+
+  // Returns an encoder, in any state, to the pool. It is destroyed when the
+  // pool is full.
+  void Release(std::unique_ptr<OggOpusEncoder> encoder);
+
+  size_t idle_encoders() const;
+  Stats stats() const;
+
+ private:
+  const size_t max_idle_encoders_;
+
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<OggOpusEncoder>> idle_;
+  Stats stats_;
+};
+
+}  // namespace audio_util
+
+#endif  // AUDIO_UTIL_OGG_OPUS_ENCODER_POOL_H_
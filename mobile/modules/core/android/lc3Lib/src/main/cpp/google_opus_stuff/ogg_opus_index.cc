@@ -0,0 +1,414 @@
+#include "ogg_opus_index.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include "ogg_page_writer.h"
+
+// Ogg Opus information comes from the standard here:
+// https://tools.ietf.org/html/rfc7845
+
+namespace audio_util {
+namespace {
+
+// Ogg page layout, see https://tools.ietf.org/html/rfc3533#section-6
+static constexpr size_t kOggPageHeaderBytes = 27;
+static constexpr size_t kOggCrcOffset = 22;
+
+// Granule positions are at 48 kHz, the decoder converging within 80 ms.
+static constexpr int kGranuleRateHz = 48000;
+static constexpr int64_t kPreRollGranules = kGranuleRateHz * 80 / 1000;
+
+// OpusHead, see https://tools.ietf.org/html/rfc7845#section-5.1
+static constexpr size_t kOpusHeadBytes = 19;
+
+// Sidecar file: the fixed fields, little endian, then the entries as
+// varints of the offset delta and the zigzag coded granule delta, then the
+// CRC of all the preceding bytes.
+static constexpr unsigned char kIndexMagic[4] = {'O', 'p', 'I', 'x'};
+static constexpr uint32_t kIndexVersion = 1;
+static constexpr size_t kIndexFixedBytes = 4 + 4 + 8 + 4 + 8 + 4 + 4 + 4 +
+                                           4 + 8 + 8 + 8 + 8 + 8 + 8 + 8;
+
+uint64_t ReadLittleEndian(const unsigned char* data, int num_bytes) {
+  uint64_t value = 0;
+  for (int i = num_bytes - 1; i >= 0; i--) {
+    value = (value << 8) | data[i];
+  }
+  return value;
+}
+
+void WriteLittleEndian(uint64_t value, int num_bytes,
+                       std::vector<unsigned char>* out) {
+  for (int i = 0; i < num_bytes; i++) {
+    out->push_back(static_cast<unsigned char>(value >> (8 * i)));
+  }
+}
+
+void WriteVarint(uint64_t value, std::vector<unsigned char>* out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<unsigned char>(value | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<unsigned char>(value));
+}
+
+bool ReadVarint(const unsigned char** data, const unsigned char* end,
+                uint64_t* value) {
+  *value = 0;
+  for (int shift = 0; shift < 64 && *data < end; shift += 7) {
+    const unsigned char byte = *(*data)++;
+    *value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if (byte < 0x80) {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint64_t ZigZag(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^
+         static_cast<uint64_t>(value >> 63);
+}
+
+int64_t UnZigZag(uint64_t value) {
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+// Whether the page of `bytes` bytes at `page` has a valid CRC, its own field
+// taken as zero.
+bool PageCrcValid(const unsigned char* page, size_t bytes) {
+  static const unsigned char kZeroCrc[4] = {0, 0, 0, 0};
+  uint32_t crc = OggCrc32(page, kOggCrcOffset);
+  crc = OggCrc32(kZeroCrc, 4, crc);
+  crc = OggCrc32(page + kOggCrcOffset + 4, bytes - kOggCrcOffset - 4, crc);
+  return crc == ReadLittleEndian(page + kOggCrcOffset, 4);
+}
+
+}  // namespace
+
+int64_t OggOpusIndex::Info::duration_ms() const {
+  return std::max<int64_t>(last_granule_position - pre_skip, 0) * 1000 /
+         kGranuleRateHz;
+}
+
+double OggOpusIndex::Info::bitrate_bps() const {
+  const int64_t duration = duration_ms();
+  return duration > 0 ? audio_bytes * 8000.0 / duration : 0;
+}
+
+OggOpusIndex::OggOpusIndex()
+    : info_(), last_page_offset_(0), last_page_crc_(0) {}
+
+bool OggOpusIndex::Build(const unsigned char* data, size_t size,
+                         int64_t start_time_ms) {
+  info_ = Info();
+  info_.file_bytes = size;
+  info_.start_time_ms = start_time_ms;
+  entries_.clear();
+  last_page_offset_ = 0;
+  last_page_crc_ = 0;
+
+  bool has_serial_number = false;
+  int header_packets = 0;
+  size_t offset = 0;
+  while (size - offset >= kOggPageHeaderBytes) {
+    const unsigned char* page = data + offset;
+    if (memcmp(page, "OggS", 4) != 0) {
+      // Resynchronizes on the next capture pattern.
+      const unsigned char* end = data + size;
+      const unsigned char* next = page + 1;
+      while ((next = static_cast<const unsigned char*>(
+                  memchr(next, 'O', end - next))) != nullptr &&
+             end - next >= 4 && memcmp(next, "OggS", 4) != 0) {
+        next++;
+      }
+      if (next == nullptr || end - next < 4) {
+        break;
+      }
+      offset = next - data;
+      continue;
+    }
+
+    const int num_segments = page[26];
+    const size_t header_bytes = kOggPageHeaderBytes + num_segments;
+    if (size - offset < header_bytes) {
+      break;
+    }
+    size_t body_bytes = 0;
+    for (int i = 0; i < num_segments; i++) {
+      body_bytes += page[kOggPageHeaderBytes + i];
+    }
+    const size_t page_bytes = header_bytes + body_bytes;
+    if (size - offset < page_bytes) {
+      break;  // Truncated, as a recording being written.
+    }
+    if (page[4] != 0 || !PageCrcValid(page, page_bytes)) {
+      info_.corrupted_pages++;
+      offset++;
+      continue;
+    }
+
+    const uint32_t serial_number =
+        static_cast<uint32_t>(ReadLittleEndian(page + 14, 4));
+    if (has_serial_number && serial_number != info_.serial_number) {
+      offset += page_bytes;  // Another stream.
+      continue;
+    }
+    const unsigned char* lacing = page + kOggPageHeaderBytes;
+    const unsigned char* body = lacing + num_segments;
+    if (!has_serial_number) {
+      // The OpusHead packet, alone on the first page. Version 0.x.
+      if (body_bytes < kOpusHeadBytes || memcmp(body, "OpusHead", 8) != 0 ||
+          (body[8] & 0xf0) != 0) {
+        break;
+      }
+      has_serial_number = true;
+      info_.serial_number = serial_number;
+      info_.channels = body[9];
+      info_.pre_skip = static_cast<int>(ReadLittleEndian(body + 10, 2));
+      info_.input_sample_rate_hz =
+          static_cast<int>(ReadLittleEndian(body + 12, 4));
+    }
+    info_.pages++;
+    last_page_offset_ = offset;
+    last_page_crc_ =
+        static_cast<uint32_t>(ReadLittleEndian(page + kOggCrcOffset, 4));
+
+    if (header_packets < 2) {
+      // OpusHead and OpusTags, the audio starting on a new page.
+      for (int i = 0; i < num_segments; i++) {
+        header_packets += lacing[i] < 255;
+      }
+      if (header_packets >= 2) {
+        info_.audio_offset = offset + page_bytes;
+      }
+    } else {
+      info_.audio_bytes += page_bytes;
+      const int64_t granule_position =
+          static_cast<int64_t>(ReadLittleEndian(page + 6, 8));
+      if (granule_position >= 0) {
+        if (!entries_.empty()) {
+          info_.max_page_granules = std::max(
+              info_.max_page_granules,
+              granule_position - entries_.back().granule_position);
+        }
+        entries_.push_back({offset, granule_position});
+      }
+    }
+    offset += page_bytes;
+  }
+
+  if (header_packets < 2) {
+    entries_.clear();
+    info_ = Info();
+    return false;
+  }
+  info_.last_granule_position = entries_.empty()
+                                    ? info_.pre_skip
+                                    : entries_.back().granule_position;
+  return true;
+}
+
+bool OggOpusIndex::BuildFromFile(const std::string& path,
+                                 int64_t start_time_ms) {
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  bool built = false;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+    void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map != MAP_FAILED) {
+      madvise(map, st.st_size, MADV_SEQUENTIAL);
+      built = Build(static_cast<const unsigned char*>(map), st.st_size,
+                    start_time_ms);
+      munmap(map, st.st_size);
+    }
+  }
+  close(fd);
+  return built;
+}
+
+bool OggOpusIndex::Save(const std::string& index_path) const {
+  std::vector<unsigned char> out(kIndexMagic, kIndexMagic + 4);
+  WriteLittleEndian(kIndexVersion, 4, &out);
+  WriteLittleEndian(info_.file_bytes, 8, &out);
+  WriteLittleEndian(last_page_crc_, 4, &out);
+  WriteLittleEndian(last_page_offset_, 8, &out);
+  WriteLittleEndian(info_.serial_number, 4, &out);
+  WriteLittleEndian(info_.channels, 4, &out);
+  WriteLittleEndian(info_.input_sample_rate_hz, 4, &out);
+  WriteLittleEndian(info_.pre_skip, 4, &out);
+  WriteLittleEndian(info_.audio_offset, 8, &out);
+  WriteLittleEndian(info_.pages, 8, &out);
+  WriteLittleEndian(info_.corrupted_pages, 8, &out);
+  WriteLittleEndian(info_.audio_bytes, 8, &out);
+  WriteLittleEndian(info_.max_page_granules, 8, &out);
+  WriteLittleEndian(info_.start_time_ms, 8, &out);
+  WriteLittleEndian(entries_.size(), 8, &out);
+  uint64_t offset = info_.audio_offset;
+  int64_t granule_position = info_.pre_skip;
+  for (const Entry& entry : entries_) {
+    WriteVarint(entry.offset - offset, &out);
+    WriteVarint(ZigZag(entry.granule_position - granule_position), &out);
+    offset = entry.offset;
+    granule_position = entry.granule_position;
+  }
+  WriteLittleEndian(OggCrc32(out.data(), out.size()), 4, &out);
+
+  // Written aside then renamed, for a reader never to see a partial index.
+  const std::string temp_path = index_path + ".tmp";
+  FILE* f = fopen(temp_path.c_str(), "wb");
+  if (!f) {
+    return false;
+  }
+  const bool written = fwrite(out.data(), 1, out.size(), f) == out.size();
+  if (fclose(f) != 0 || !written ||
+      rename(temp_path.c_str(), index_path.c_str()) != 0) {
+    remove(temp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool OggOpusIndex::Load(const std::string& index_path,
+                        const std::string& path) {
+  std::vector<unsigned char> in;
+  FILE* f = fopen(index_path.c_str(), "rb");
+  if (!f) {
+    return false;
+  }
+  unsigned char buffer[4096];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+    in.insert(in.end(), buffer, buffer + n);
+  }
+  fclose(f);
+  if (in.size() < kIndexFixedBytes + 4 ||
+      memcmp(in.data(), kIndexMagic, 4) != 0 ||
+      ReadLittleEndian(&in[4], 4) != kIndexVersion ||
+      OggCrc32(in.data(), in.size() - 4) !=
+          ReadLittleEndian(&in[in.size() - 4], 4)) {
+    return false;
+  }
+
+  const unsigned char* p = in.data() + 8;
+  auto read = [&p](int num_bytes) {
+    const uint64_t value = ReadLittleEndian(p, num_bytes);
+    p += num_bytes;
+    return value;
+  };
+  Info info = Info();
+  info.file_bytes = read(8);
+  const uint32_t last_page_crc = static_cast<uint32_t>(read(4));
+  const uint64_t last_page_offset = read(8);
+  info.serial_number = static_cast<uint32_t>(read(4));
+  info.channels = static_cast<int>(read(4));
+  info.input_sample_rate_hz = static_cast<int>(read(4));
+  info.pre_skip = static_cast<int>(read(4));
+  info.audio_offset = read(8);
+  info.pages = read(8);
+  info.corrupted_pages = read(8);
+  info.audio_bytes = read(8);
+  info.max_page_granules = static_cast<int64_t>(read(8));
+  info.start_time_ms = static_cast<int64_t>(read(8));
+  const uint64_t num_entries = read(8);
+
+  // Entries of 2 bytes at least.
+  const unsigned char* end = in.data() + in.size() - 4;
+  if (num_entries > static_cast<uint64_t>(end - p) / 2) {
+    return false;
+  }
+  std::vector<Entry> entries(num_entries);
+  uint64_t offset = info.audio_offset;
+  int64_t granule_position = info.pre_skip;
+  for (Entry& entry : entries) {
+    uint64_t offset_delta, granule_delta;
+    if (!ReadVarint(&p, end, &offset_delta) ||
+        !ReadVarint(&p, end, &granule_delta)) {
+      return false;
+    }
+    offset += offset_delta;
+    granule_position += UnZigZag(granule_delta);
+    entry = {offset, granule_position};
+  }
+  if (p != end) {
+    return false;
+  }
+
+  // Still that of the recording: same size, and same last page.
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  unsigned char crc[4];
+  const bool same =
+      fstat(fd, &st) == 0 &&
+      static_cast<uint64_t>(st.st_size) == info.file_bytes &&
+      pread(fd, crc, 4, last_page_offset + kOggCrcOffset) == 4 &&
+      ReadLittleEndian(crc, 4) == last_page_crc;
+  close(fd);
+  if (!same) {
+    return false;
+  }
+
+  info.last_granule_position =
+      entries.empty() ? info.pre_skip : entries.back().granule_position;
+  info_ = info;
+  entries_.swap(entries);
+  last_page_offset_ = last_page_offset;
+  last_page_crc_ = last_page_crc;
+  return true;
+}
+
+bool OggOpusIndex::Open(const std::string& path,
+                        const std::string& index_path,
+                        int64_t start_time_ms) {
+  if (Load(index_path, path)) {
+    return true;
+  }
+  if (!BuildFromFile(path, start_time_ms)) {
+    return false;
+  }
+  Save(index_path);
+  return true;
+}
+
+OggOpusIndex::SeekPoint OggOpusIndex::Seek(int64_t time_ms) const {
+  SeekPoint point;
+  point.granule_position = std::min(
+      info_.pre_skip +
+          std::max<int64_t>(time_ms, 0) * (kGranuleRateHz / 1000),
+      std::max<int64_t>(info_.last_granule_position, info_.pre_skip));
+
+  // The last page ending before the pre-roll: the packets after it start
+  // there at the latest.
+  const int64_t from = point.granule_position - kPreRollGranules;
+  auto it = std::upper_bound(
+      entries_.begin(), entries_.end(), from,
+      [](int64_t granule_position, const Entry& entry) {
+        return granule_position < entry.granule_position;
+      });
+  point.offset = it == entries_.begin() ? info_.audio_offset
+                                        : (it - 1)->offset;
+  return point;
+}
+
+OggOpusIndex::SeekPoint OggOpusIndex::SeekWallTime(
+    int64_t wall_time_ms) const {
+  return Seek(wall_time_ms - info_.start_time_ms);
+}
+
+int64_t OggOpusIndex::TimeMs(int64_t granule_position) const {
+  return (granule_position - info_.pre_skip) * 1000 / kGranuleRateHz;
+}
+
+}  // namespace audio_util
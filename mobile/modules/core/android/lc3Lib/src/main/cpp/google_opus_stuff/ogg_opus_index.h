@@ -0,0 +1,113 @@
+#ifndef AUDIO_UTIL_OGG_OPUS_INDEX_H_
+#define AUDIO_UTIL_OGG_OPUS_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace audio_util {
+
+// Seek index of a recorded OggOpus file: the offset and granule position of
+// each of its audio pages, for the playback to start at any time of an hour
+// long recording without scanning it.
+//
+// The index is built in one pass over the memory mapped file, the pages
+// being located from their headers, their CRC checked, without decoding
+// any packet. It is kept next to the recording in a compact sidecar file,
+// the offsets and granule positions delta coded, checked on load against
+// the size of the recording and the CRC of its last page: a recording
+// rewritten or extended since is indexed again by Open().
+//
+// Seek() finds by binary search the page to decode from, 80 ms ahead of the
+// time sought for the decoder to converge, see
+// https://tools.ietf.org/html/rfc7845#section-6.1, and OggOpusDecoder::Seek()
+// drops the output up to that time.
+//
+// Only the first logical stream of the file is indexed.
+class OggOpusIndex {
+ public:
+  // An audio page: its offset in the file, and the granule position of the
+  // end of its last complete packet. Pages ending no packet are not kept.
+  struct Entry {
+    uint64_t offset;
+    int64_t granule_position;
+  };
+
+  struct Info {
+    uint64_t file_bytes;
+    uint32_t serial_number;
+    int channels;
+    int input_sample_rate_hz;  // Of the OpusHead, informational.
+    int pre_skip;              // In 48 kHz samples.
+    uint64_t audio_offset;     // Of the first page after the headers.
+    uint64_t pages;            // Of the stream, headers included.
+    uint64_t corrupted_pages;  // Failing their CRC, skipped.
+    uint64_t audio_bytes;      // Of the audio pages, headers included.
+    int64_t last_granule_position;
+    int64_t max_page_granules;  // Longest audio page, in 48 kHz samples.
+    // Wall clock time of the first sample, in ms since the epoch, as given
+    // to Build(); 0 when unknown.
+    int64_t start_time_ms;
+
+    // Of the audio, the pre-skip dropped.
+    int64_t duration_ms() const;
+    double bitrate_bps() const;
+  };
+
+  // Where to resume the decoding: feed the file from `offset` to an
+  // OggOpusDecoder whose headers are parsed, after calling its
+  // Seek(`granule_position`).
+  struct SeekPoint {
+    uint64_t offset;
+    int64_t granule_position;  // Of the time sought.
+  };
+
+  OggOpusIndex();
+
+  // Indexes the OggOpus stream of `size` bytes at `data`. Returns false
+  // when it is not one.
+  bool Build(const unsigned char* data, size_t size,
+             int64_t start_time_ms = 0);
+
+  // Indexes the file at `path`, memory mapped.
+  bool BuildFromFile(const std::string& path, int64_t start_time_ms = 0);
+
+  // Writes the index to, or reads it from, the sidecar file at
+  // `index_path`. Load() returns false when the file is not a valid index,
+  // or no longer that of the recording at `path`.
+  bool Save(const std::string& index_path) const;
+  bool Load(const std::string& index_path, const std::string& path);
+
+  // Loads the index of the recording at `path` from `index_path`, or, when
+  // it is missing or out of date, builds and saves it there, with
+  // `start_time_ms`. Returns false when the recording cannot be indexed; an
+  // index that cannot be saved is still used.
+  bool Open(const std::string& path, const std::string& index_path,
+            int64_t start_time_ms = 0);
+
+  // Where to decode from to play the recording from `time_ms` after its
+  // start, clamped to its duration. O(log n) in the pages.
+  SeekPoint Seek(int64_t time_ms) const;
+
+  // Same as Seek(), from a wall clock time, in ms since the epoch, the
+  // recording having started at the `start_time_ms` given to Build().
+  SeekPoint SeekWallTime(int64_t wall_time_ms) const;
+
+  // Time of a granule position, in ms from the start of the recording.
+  int64_t TimeMs(int64_t granule_position) const;
+
+  const Info& info() const { return info_; }
+  const std::vector<Entry>& entries() const { return entries_; }
+
+ private:
+  Info info_;
+  std::vector<Entry> entries_;
+  // Last page of the stream, to check the recording on Load().
+  uint64_t last_page_offset_;
+  uint32_t last_page_crc_;
+};
+
+}  // namespace audio_util
+
+#endif  // AUDIO_UTIL_OGG_OPUS_INDEX_H_
@@ -0,0 +1,241 @@
+#include "ogg_page_writer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace audio_util {
+namespace {
+
+// Ogg page layout, see https://tools.ietf.org/html/rfc3533#section-6
+static constexpr size_t kPageHeaderBytes = 27;
+static constexpr size_t kMaxPageSegments = 255;
+static constexpr unsigned char kContinuedPacket = 0x01;
+static constexpr unsigned char kBeginOfStream = 0x02;
+static constexpr unsigned char kEndOfStream = 0x04;
+
+// Body size past which libogg's ogg_stream_pageout() closes a page, once
+// it holds at least kMinPagePackets whole packets.
+static constexpr size_t kPageBodyThreshold = 4096;
+static constexpr int kMinPagePackets = 4;
+
+static constexpr uint32_t kCrcPolynomial = 0x04c11db7;
+
+// table[k][i]: CRC of the byte i followed by k zero bytes.
+struct CrcTables {
+  uint32_t table[8][256];
+
+  CrcTables() {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t crc = i << 24;
+      for (int bit = 0; bit < 8; bit++) {
+        crc = (crc & 0x80000000) ? (crc << 1) ^ kCrcPolynomial : crc << 1;
+      }
+      table[0][i] = crc;
+    }
+    for (int k = 1; k < 8; k++) {
+      for (int i = 0; i < 256; i++) {
+        const uint32_t crc = table[k - 1][i];
+        table[k][i] = (crc << 8) ^ table[0][crc >> 24];
+      }
+    }
+  }
+};
+
+void WriteLittleEndian(uint64_t value, int num_bytes, unsigned char* out) {
+  for (int i = 0; i < num_bytes; i++) {
+    out[i] = value & 0xff;
+    value >>= 8;
+  }
+}
+
+}  // namespace
+
+uint32_t OggCrc32(const unsigned char* data, size_t size, uint32_t crc) {
+  static const CrcTables tables;
+  const uint32_t(*t)[256] = tables.table;
+
+  for (; size >= 8; data += 8, size -= 8) {
+    crc ^= static_cast<uint32_t>(data[0]) << 24 | data[1] << 16 |
+           data[2] << 8 | data[3];
+    crc = t[7][crc >> 24] ^ t[6][(crc >> 16) & 0xff] ^
+          t[5][(crc >> 8) & 0xff] ^ t[4][crc & 0xff] ^ t[3][data[4]] ^
+          t[2][data[5]] ^ t[1][data[6]] ^ t[0][data[7]];
+  }
+  for (; size > 0; data++, size--) {
+    crc = (crc << 8) ^ t[0][(crc >> 24) ^ *data];
+  }
+  return crc;
+}
+
+OggPageWriter::OggPageWriter(uint32_t serial_number)
+    : serial_number_(serial_number),
+      page_sequence_number_(0),
+      bos_written_(false),
+      eos_(false),
+      body_begin_(0),
+      body_size_(0),
+      segment_begin_(0),
+      page_segments_(0),
+      page_body_bytes_(0),
+      page_granule_position_(0),
+      page_packets_(0) {}
+
+void OggPageWriter::Reset(uint32_t serial_number) {
+  serial_number_ = serial_number;
+  page_sequence_number_ = 0;
+  bos_written_ = false;
+  eos_ = false;
+  body_begin_ = 0;
+  body_size_ = 0;
+  segments_.clear();
+  segment_begin_ = 0;
+  page_segments_ = 0;
+  page_body_bytes_ = 0;
+  page_granule_position_ = 0;
+  page_packets_ = 0;
+}
+
+unsigned char* OggPageWriter::PacketBuffer(size_t max_bytes) {
+  // Move the pending data to the front, so that the buffers only grow
+  // with the data pending, not with the stream.
+  if (body_begin_ > 0) {
+    memmove(body_.data(), body_.data() + body_begin_,
+            body_size_ - body_begin_);
+    body_size_ -= body_begin_;
+    body_begin_ = 0;
+  }
+  if (segment_begin_ > 0) {
+    segments_.erase(segments_.begin(), segments_.begin() + segment_begin_);
+    segment_begin_ = 0;
+  }
+  if (body_.size() < body_size_ + max_bytes) {
+    body_.resize(body_size_ + max_bytes);
+  }
+  return body_.data() + body_size_;
+}
+
+void OggPageWriter::CommitPacket(size_t bytes, int64_t granule_position,
+                                 bool eos) {
+  assert(body_size_ + bytes <= body_.size());
+  assert(!eos_);
+  body_size_ += bytes;
+
+  // Lacing: 255 for each whole 255 bytes, then the remainder, possibly 0.
+  // The segments are appended at once, as multistream packets span tens
+  // of them.
+  Segment segment;
+  segment.lacing_value = 255;
+  segment.begins_packet = false;
+  segment.granule_position = granule_position;
+  const size_t first_segment = segments_.size();
+  segments_.resize(first_segment + bytes / 255 + 1, segment);
+  segments_[first_segment].begins_packet = true;
+  segments_.back().lacing_value = bytes % 255;
+  eos_ = eos;
+}
+
+void OggPageWriter::AddPacket(const unsigned char* packet, size_t bytes,
+                              int64_t granule_position, bool eos) {
+  unsigned char* buffer = PacketBuffer(bytes);
+  if (bytes > 0) {
+    memcpy(buffer, packet, bytes);
+  }
+  CommitPacket(bytes, granule_position, eos);
+}
+
+size_t OggPageWriter::NextPage(bool flush) {
+  const size_t num_segments = pending_segments();
+  if (num_segments == 0) {
+    return 0;
+  }
+  const Segment* segments = segments_.data() + segment_begin_;
+  const size_t max_segments = std::min(num_segments, kMaxPageSegments);
+
+  // ogg_stream_pageout() closes the first page, and the pages of the last
+  // packets, as soon as there is data.
+  bool close = flush || eos_ || !bos_written_;
+  size_t vals = 0;
+  size_t body_bytes = 0;
+  int64_t granule_position = -1;
+  int packets_done = 0;
+  if (!bos_written_) {
+    // The first page holds the first packet only.
+    granule_position = 0;
+    while (vals < max_segments) {
+      body_bytes += segments[vals].lacing_value;
+      if (segments[vals++].lacing_value < 255) {
+        packets_done = 1;
+        break;
+      }
+    }
+  } else {
+    bool packet_just_done = false;
+    for (; vals < max_segments; vals++) {
+      if (body_bytes > kPageBodyThreshold && packet_just_done &&
+          packets_done >= kMinPagePackets) {
+        close = true;
+        break;
+      }
+      body_bytes += segments[vals].lacing_value;
+      packet_just_done = segments[vals].lacing_value < 255;
+      if (packet_just_done) {
+        granule_position = segments[vals].granule_position;
+        packets_done++;
+      }
+    }
+    if (vals == kMaxPageSegments) {
+      close = true;
+    }
+  }
+  if (!close) {
+    return 0;
+  }
+
+  page_segments_ = vals;
+  page_body_bytes_ = body_bytes;
+  page_granule_position_ = granule_position;
+  page_packets_ = packets_done;
+  return kPageHeaderBytes + page_segments_ + page_body_bytes_;
+}
+
+void OggPageWriter::WritePage(unsigned char* out) {
+  const Segment* segments = segments_.data() + segment_begin_;
+  unsigned char flags = 0;
+  if (!segments[0].begins_packet) {
+    flags |= kContinuedPacket;
+  }
+  if (!bos_written_) {
+    flags |= kBeginOfStream;
+  }
+  if (eos_ && page_segments_ == pending_segments()) {
+    flags |= kEndOfStream;
+  }
+
+  memcpy(out, "OggS", 4);
+  out[4] = 0;  // Version.
+  out[5] = flags;
+  WriteLittleEndian(page_granule_position_, 8, out + 6);
+  WriteLittleEndian(serial_number_, 4, out + 14);
+  WriteLittleEndian(page_sequence_number_, 4, out + 18);
+  WriteLittleEndian(0, 4, out + 22);  // CRC, set once the page is written.
+  out[26] = page_segments_;
+  for (size_t i = 0; i < page_segments_; i++) {
+    out[kPageHeaderBytes + i] = segments[i].lacing_value;
+  }
+  const size_t header_bytes = kPageHeaderBytes + page_segments_;
+  if (page_body_bytes_ > 0) {
+    memcpy(out + header_bytes, body_.data() + body_begin_, page_body_bytes_);
+  }
+  WriteLittleEndian(OggCrc32(out, header_bytes + page_body_bytes_), 4,
+                    out + 22);
+
+  bos_written_ = true;
+  page_sequence_number_++;
+  segment_begin_ += page_segments_;
+  body_begin_ += page_body_bytes_;
+  page_segments_ = 0;
+  page_body_bytes_ = 0;
+}
+
+}  // namespace audio_util
@@ -0,0 +1,90 @@
+#ifndef AUDIO_UTIL_OGG_PAGE_WRITER_H_
+#define AUDIO_UTIL_OGG_PAGE_WRITER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace audio_util {
+
+// CRC32 of the Ogg pages, see https://tools.ietf.org/html/rfc3533#section-6:
+// polynomial 0x04c11db7, most significant bit first, no reflection, initial
+// value and final xor of 0. Computed 8 bytes at a time (slice-by-8).
+// `crc` is that of the preceding bytes, to compute it in several parts.
+uint32_t OggCrc32(const unsigned char* data, size_t size, uint32_t crc = 0);
+
+// Writer of the pages of a single logical Ogg stream, without libogg.
+//
+// Packets are held in a single body buffer, into which the encoder can write
+// them in place, see PacketBuffer(). Each page is then laid out directly in
+// the output: header, segment table and body, the CRC being computed over
+// the page written. The pages are cut as by libogg's ogg_stream_pageout()
+// and ogg_stream_flush(), so that the output is byte-identical to that of
+// libogg for the same packets.
+class OggPageWriter {
+ public:
+  explicit OggPageWriter(uint32_t serial_number);
+
+  // Starts a new stream of `serial_number`, dropping any pending packet.
+  // The buffers are kept, for the new stream to be written without
+  // allocating.
+  void Reset(uint32_t serial_number);
+
+  // Returns a buffer of `max_bytes` bytes, for the next packet to be written
+  // in place, then added by CommitPacket().
+  unsigned char* PacketBuffer(size_t max_bytes);
+
+  // Adds the packet written into PacketBuffer(), of `bytes` bytes,
+  // `granule_position` being that of its last sample. `eos` marks the last
+  // packet of the stream.
+  void CommitPacket(size_t bytes, int64_t granule_position, bool eos);
+
+  // Copies a packet in, as PacketBuffer() then CommitPacket().
+  void AddPacket(const unsigned char* packet, size_t bytes,
+                 int64_t granule_position, bool eos);
+
+  // Cuts the next page, and returns its size in bytes, or 0 when no page is
+  // ready: as ogg_stream_flush() when `flush`, as ogg_stream_pageout()
+  // otherwise. The page is to be written by WritePage().
+  size_t NextPage(bool flush);
+
+  // Writes the page cut by NextPage() into `out`, of the size returned.
+  void WritePage(unsigned char* out);
+
+  // Packets ending on the page cut by NextPage().
+  int page_packets() const { return page_packets_; }
+
+  // Packet data not yet written out as pages.
+  size_t pending_body_bytes() const { return body_size_ - body_begin_; }
+  size_t pending_segments() const { return segments_.size() - segment_begin_; }
+
+ private:
+  // An entry of the segment table, with the packet it belongs to.
+  struct Segment {
+    unsigned char lacing_value;
+    bool begins_packet;
+    int64_t granule_position;  // Of the packet, on its last segment.
+  };
+
+  uint32_t serial_number_;
+  uint32_t page_sequence_number_;
+  bool bos_written_;
+  bool eos_;
+
+  // Pending packets: body bytes and segments from the `*_begin_` offsets.
+  std::vector<unsigned char> body_;
+  size_t body_begin_;
+  size_t body_size_;
+  std::vector<Segment> segments_;
+  size_t segment_begin_;
+
+  // Page cut by NextPage().
+  size_t page_segments_;
+  size_t page_body_bytes_;
+  int64_t page_granule_position_;
+  int page_packets_;
+};
+
+}  // namespace audio_util
+
+#endif  // AUDIO_UTIL_OGG_PAGE_WRITER_H_
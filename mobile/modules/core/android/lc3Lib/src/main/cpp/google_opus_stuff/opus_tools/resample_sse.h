@@ -0,0 +1,31 @@
+/*
+ * Inner products of resample.c, included by it when built with _USE_SSE.
+ *
+ * In place of the SSE only kernels of Speex, those of resampler_kernels.h,
+ * for the instruction set of the CPU: SSE2, AVX2 or NEON.
+ */
+
+#ifndef AUDIO_UTIL_OPUS_TOOLS_RESAMPLE_SSE_H_
+#define AUDIO_UTIL_OPUS_TOOLS_RESAMPLE_SSE_H_
+
+#include "../resampler_kernels.h"
+
+#define OVERRIDE_INNER_PRODUCT_SINGLE
+#define inner_product_single(a, b, len) \
+  audio_util_resampler_kernels->inner_product_single(a, b, len)
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
+#define interpolate_product_single(a, b, len, oversample, frac) \
+  audio_util_resampler_kernels->interpolate_product_single(     \
+      a, b, len, oversample, frac)
+
+#define OVERRIDE_INNER_PRODUCT_DOUBLE
+#define inner_product_double(a, b, len) \
+  audio_util_resampler_kernels->inner_product_double(a, b, len)
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_DOUBLE
+#define interpolate_product_double(a, b, len, oversample, frac) \
+  audio_util_resampler_kernels->interpolate_product_double(     \
+      a, b, len, oversample, frac)
+
+#endif  /* AUDIO_UTIL_OPUS_TOOLS_RESAMPLE_SSE_H_ */
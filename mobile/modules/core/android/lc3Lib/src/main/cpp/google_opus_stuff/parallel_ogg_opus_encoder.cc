@@ -0,0 +1,120 @@
+#include "parallel_ogg_opus_encoder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <thread>
+
+namespace audio_util {
+
+ParallelOggOpusEncoder::ParallelOggOpusEncoder(
+    int num_channels, int sample_rate_hz, int bitrate_bps,
+    const OggOpusEncoder::Options& options,
+    const ParallelOptions& parallel_options)
+    : num_channels_(num_channels),
+      sample_rate_hz_(sample_rate_hz),
+      bitrate_bps_(bitrate_bps),
+      options_(options),
+      num_threads_(parallel_options.num_threads),
+      frame_size_(static_cast<int64_t>(sample_rate_hz) *
+                  options.frame_duration_us / 1000000) {
+  assert(options.framing == OggOpusEncoder::Framing::kOgg);
+  if (num_threads_ <= 0) {
+    num_threads_ = std::max(1u, std::thread::hardware_concurrency());
+  }
+  const size_t frame_duration_us = options.frame_duration_us;
+  segment_frames_ = std::max<size_t>(
+      1, parallel_options.segment_duration_ms * 1000ull / frame_duration_us);
+  overlap_frames_ =
+      (parallel_options.overlap_ms * 1000ull + frame_duration_us - 1) /
+      frame_duration_us;
+}
+
+std::vector<unsigned char> ParallelOggOpusEncoder::Encode(
+    const int16_t* pcm, size_t num_elements) const {
+  assert((num_elements % num_channels_) == 0);
+  const size_t num_frames = num_elements / (frame_size_ * num_channels_);
+  const size_t num_segments = std::max<size_t>(
+      1, (num_frames + segment_frames_ - 1) / segment_frames_);
+
+  // Encode the segments, taken in order by the threads of the pool.
+  std::vector<Segment> segments(num_segments);
+  std::atomic<size_t> next_segment(0);
+  auto worker = [&]() {
+    for (size_t i = next_segment++; i < num_segments; i = next_segment++) {
+      size_t first_frame = i * segment_frames_;
+      size_t end_frame = std::min(num_frames, first_frame + segment_frames_);
+      EncodeSegment(pcm, num_elements, first_frame, end_frame,
+                    i == num_segments - 1, &segments[i]);
+    }
+  };
+
+  const size_t num_threads = std::min<size_t>(num_threads_, num_segments);
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < num_threads; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  // Stitch the packets into a single stream, the last one closing it.
+  OggOpusEncoder stitcher(num_channels_, sample_rate_hz_, bitrate_bps_,
+                          options_);
+  const int64_t end_position = num_elements / num_channels_;
+  std::vector<unsigned char> stream;
+  for (size_t i = 0; i < num_segments; i++) {
+    const Segment& segment = segments[i];
+    const unsigned char* packet = segment.bytes.data();
+    for (size_t j = 0; j < segment.lengths.size(); j++) {
+      const int length = segment.lengths[j];
+      const bool last =
+          i == num_segments - 1 && j == segment.lengths.size() - 1;
+      const std::vector<unsigned char>& bytes =
+          last ? stitcher.FlushPacket(packet, length, end_position)
+               : stitcher.ProcessPacket(packet, length);
+      stream.insert(stream.end(), bytes.begin(), bytes.end());
+      packet += length;
+    }
+  }
+  return stream;
+}
+
+void ParallelOggOpusEncoder::EncodeSegment(const int16_t* pcm,
+                                           size_t num_elements,
+                                           size_t first_frame,
+                                           size_t end_frame, bool last,
+                                           Segment* segment) const {
+  OggOpusEncoder::Options options = options_;
+  options.framing = OggOpusEncoder::Framing::kRawLengthPrefixed;
+  OggOpusEncoder encoder(num_channels_, sample_rate_hz_, bitrate_bps_,
+                         options);
+
+  // The overlap is encoded, and its packets dropped.
+  const size_t overlap = std::min(overlap_frames_, first_frame);
+  const size_t frame_elements = frame_size_ * num_channels_;
+  const int16_t* begin = pcm + (first_frame - overlap) * frame_elements;
+  const int16_t* end =
+      last ? pcm + num_elements : pcm + end_frame * frame_elements;
+
+  size_t num_packets = 0;
+  auto append = [&](const std::vector<unsigned char>& bytes) {
+    for (const OggOpusEncoder::PacketInfo& info : encoder.packets()) {
+      if (num_packets++ < overlap) {
+        continue;
+      }
+      const unsigned char* packet = bytes.data() + info.payload_offset;
+      segment->bytes.insert(segment->bytes.end(), packet,
+                            packet + info.length);
+      segment->lengths.push_back(info.length);
+    }
+  };
+
+  append(encoder.Process(begin, end - begin));
+  if (last) {
+    append(encoder.Flush());
+  }
+}
+
+}  // namespace audio_util
@@ -0,0 +1,76 @@
+#ifndef AUDIO_UTIL_PARALLEL_OGG_OPUS_ENCODER_H_
+#define AUDIO_UTIL_PARALLEL_OGG_OPUS_ENCODER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ogg_opus_encoder.h"
+
+namespace audio_util {
+
+// Bulk encoder of whole recordings, for archival, spreading the encoding
+// over several cores.
+//
+// The PCM is split into segments of whole Opus frames, each encoded by a
+// fresh encoder on a pool of threads. A segment encoder is first given the
+// audio preceding its segment, the overlap, whose packets are dropped: its
+// state, and its lookahead, then match those of a single encoder run over
+// the whole recording. The packets are stitched in order into one Ogg
+// stream, with the header, pre-skip, granule positions and page sequence
+// of a serial encoding.
+//
+// With a single segment, the output is that of OggOpusEncoder, given the
+// whole recording to Process() then Flush().
+class ParallelOggOpusEncoder {
+ public:
+  struct ParallelOptions {
+    // Number of encoding threads, the hardware concurrency when 0.
+    int num_threads = 0;
+
+    // Duration of the segments, rounded to whole frames.
+    int segment_duration_ms = 10000;
+
+    // Audio encoded ahead of each segment, and dropped, rounded up to whole
+    // frames. It must cover the encoder lookahead.
+    int overlap_ms = 100;
+  };
+
+  // As the OggOpusEncoder constructor; the framing must be Ogg.
+  ParallelOggOpusEncoder(int num_channels, int sample_rate_hz,
+                         int bitrate_bps,
+                         const OggOpusEncoder::Options& options,
+                         const ParallelOptions& parallel_options);
+
+  // Encodes `num_elements` interleaved samples, the whole recording,
+  // into a complete OggOpus stream.
+  std::vector<unsigned char> Encode(const int16_t* pcm,
+                                    size_t num_elements) const;
+
+ private:
+  // Packets of a segment, as concatenated Opus packets and their lengths.
+  struct Segment {
+    std::vector<unsigned char> bytes;
+    std::vector<int> lengths;
+  };
+
+  // Encodes the frames [first_frame, end_frame) of `pcm` into `segment`,
+  // the last segment including the partial frame ending the recording.
+  void EncodeSegment(const int16_t* pcm, size_t num_elements,
+                     size_t first_frame, size_t end_frame, bool last,
+                     Segment* segment) const;
+
+  int num_channels_;
+  int sample_rate_hz_;
+  int bitrate_bps_;
+  OggOpusEncoder::Options options_;
+  int num_threads_;
+
+  // In samples per channel, and frames.
+  size_t frame_size_;
+  size_t segment_frames_;
+  size_t overlap_frames_;
+};
+
+}  // namespace audio_util
+
+#endif  // AUDIO_UTIL_PARALLEL_OGG_OPUS_ENCODER_H_
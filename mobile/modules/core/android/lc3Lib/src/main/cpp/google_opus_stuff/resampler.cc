@@ -0,0 +1,276 @@
+#include "resampler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include "resampler_kernels.h"
+#include "speex_resampler.h"
+
+namespace audio_util {
+namespace {
+
+// Input samples per channel resampled at once by the fixed ratio path.
+constexpr int kBlockSamples = 480;
+
+int GreatestCommonDivisor(int a, int b) {
+  while (b != 0) {
+    const int r = a % b;
+    a = b;
+    b = r;
+  }
+  return a;
+}
+
+// A cycle of the ratio kInput:kOutput takes kInput input samples for
+// kOutput outputs, the output k of the window at offset k * kInput /
+// kOutput, in phase k * kInput % kOutput.
+template <int kInput, int kOutput>
+float* ResampleCycles(const ResamplerTable& table, const float* x,
+                      size_t num_cycles, float* out) {
+  const AudioUtilResamplerKernels& kernels = *audio_util_resampler_kernels;
+  const int taps = table.taps;
+  for (size_t c = 0; c < num_cycles; c++, x += kInput, out += kOutput) {
+    if (kInput == 1) {
+      // All the phases on the same window.
+      kernels.polyphase_product_single(x, table.coefficients, taps, kOutput,
+                                       out);
+      continue;
+    }
+    for (int k = 0; k < kOutput; k++) {
+      out[k] = kernels.inner_product_single(
+          x + k * kInput / kOutput,
+          table.coefficients + (k * kInput % kOutput) * taps, taps);
+    }
+  }
+  return out;
+}
+
+template <int kInput, int kOutput>
+bool Match(const ResamplerTable& table,
+           float* (**cycles)(const ResamplerTable&, const float*, size_t,
+                             float*)) {
+  if (table.input_rate != kInput || table.output_rate != kOutput) {
+    return false;
+  }
+  *cycles = ResampleCycles<kInput, kOutput>;
+  return true;
+}
+
+// As resample.c: rounded, and saturated.
+inline void Store(float x, int16_t* out) {
+  *out = x < -32767.5f ? -32768
+                       : (x > 32766.5f ? 32767
+                                       : static_cast<int16_t>(
+                                             std::floor(.5 + x)));
+}
+
+inline void Store(float x, float* out) { *out = x; }
+
+}  // namespace
+
+Resampler::Resampler(int num_channels, int input_rate_hz, int output_rate_hz,
+                     int quality, bool use_fixed_ratio)
+    : num_channels_(num_channels),
+      input_rate_hz_(input_rate_hz),
+      output_rate_hz_(output_rate_hz),
+      quality_(quality),
+      table_(nullptr),
+      cycles_(nullptr),
+      capacity_(0),
+      buffered_(0),
+      cycle_start_(0),
+      cycle_output_(0),
+      state_(nullptr) {
+  assert(num_channels > 0 && input_rate_hz > 0 && output_rate_hz > 0);
+  assert(quality >= SPEEX_RESAMPLER_QUALITY_MIN &&
+         quality <= SPEEX_RESAMPLER_QUALITY_MAX);
+
+  const int divisor = GreatestCommonDivisor(input_rate_hz, output_rate_hz);
+  for (int i = 0; use_fixed_ratio && i < kNumResamplerTables; i++) {
+    const ResamplerTable& table = kResamplerTables[i];
+    if (table.quality == quality &&
+        table.input_rate == input_rate_hz / divisor &&
+        table.output_rate == output_rate_hz / divisor &&
+        (Match<1, 2>(table, &cycles_) || Match<1, 3>(table, &cycles_) ||
+         Match<1, 6>(table, &cycles_) || Match<2, 3>(table, &cycles_) ||
+         Match<2, 1>(table, &cycles_) || Match<3, 1>(table, &cycles_) ||
+         Match<6, 1>(table, &cycles_) || Match<3, 2>(table, &cycles_))) {
+      table_ = &table;
+      break;
+    }
+  }
+
+  if (table_) {
+    capacity_ = table_->taps + table_->input_rate + kBlockSamples;
+    buffer_.resize(num_channels * capacity_);
+    channel_out_.resize(
+        (capacity_ + table_->input_rate - 1) / table_->input_rate *
+        table_->output_rate);
+    Reset();
+    return;
+  }
+  int error = RESAMPLER_ERR_SUCCESS;
+  state_ = speex_resampler_init(num_channels, input_rate_hz, output_rate_hz,
+                                quality, &error);
+  assert(error == RESAMPLER_ERR_SUCCESS);
+}
+
+Resampler::~Resampler() {
+  if (state_) {
+    speex_resampler_destroy(state_);
+  }
+}
+
+size_t Resampler::MaxOutputSamples(size_t num_samples) const {
+  // One more for the fractional position of the filter.
+  return (static_cast<uint64_t>(num_samples) * output_rate_hz_ +
+          input_rate_hz_ - 1) /
+             input_rate_hz_ +
+         1;
+}
+
+int Resampler::Process(const int16_t* pcm, size_t num_samples, int16_t* out,
+                       size_t max_samples) {
+  if (max_samples < MaxOutputSamples(num_samples)) {
+    return -1;
+  }
+  if (table_) {
+    return ProcessFixedRatio(pcm, num_samples, out);
+  }
+  spx_uint32_t in_len = num_samples;
+  spx_uint32_t out_len = max_samples;
+  speex_resampler_process_interleaved_int(state_, pcm, &in_len, out,
+                                          &out_len);
+  assert(in_len == num_samples);
+  return out_len;
+}
+
+int Resampler::Process(const float* pcm, size_t num_samples, float* out,
+                       size_t max_samples) {
+  if (max_samples < MaxOutputSamples(num_samples)) {
+    return -1;
+  }
+  if (table_) {
+    return ProcessFixedRatio(pcm, num_samples, out);
+  }
+  spx_uint32_t in_len = num_samples;
+  spx_uint32_t out_len = max_samples;
+  speex_resampler_process_interleaved_float(state_, pcm, &in_len, out,
+                                            &out_len);
+  assert(in_len == num_samples);
+  return out_len;
+}
+
+template <typename T>
+int Resampler::ProcessFixedRatio(const T* pcm, size_t num_samples, T* out) {
+  size_t written = 0;
+  while (num_samples > 0) {
+    const size_t n = std::min<size_t>(num_samples, capacity_ - buffered_);
+    for (int c = 0; c < num_channels_; c++) {
+      float* x = &buffer_[c * capacity_ + buffered_];
+      for (size_t i = 0; i < n; i++) {
+        x[i] = pcm[i * num_channels_ + c];
+      }
+    }
+    buffered_ += n;
+    pcm += n * num_channels_;
+    num_samples -= n;
+    ResampleBuffer(out, &written);
+  }
+  return written;
+}
+
+template <typename T>
+void Resampler::ResampleBuffer(T* out, size_t* written) {
+  const ResamplerTable& table = *table_;
+  const int input_rate = table.input_rate;
+  const int output_rate = table.output_rate;
+  const int taps = table.taps;
+  // Window offset of the last output of a cycle.
+  const int last_offset = (output_rate - 1) * input_rate / output_rate;
+  const AudioUtilResamplerKernels& kernels = *audio_util_resampler_kernels;
+
+  int start = 0;
+  int k = 0;
+  size_t num_outputs = 0;
+  for (int c = 0; c < num_channels_; c++) {
+    const float* x = &buffer_[c * capacity_];
+    float* y = channel_out_.data();
+    start = cycle_start_;
+    k = cycle_output_;
+    auto available = [&]() {
+      return start + k * input_rate / output_rate + taps <= buffered_;
+    };
+    auto resample_one = [&]() {
+      *y++ = kernels.inner_product_single(
+          x + start + k * input_rate / output_rate,
+          table.coefficients + (k * input_rate % output_rate) * taps, taps);
+      if (++k == output_rate) {
+        k = 0;
+        start += input_rate;
+      }
+    };
+
+    // The end of the cycle started, the whole cycles, then the start of the
+    // next one.
+    while (k != 0 && available()) {
+      resample_one();
+    }
+    if (k == 0 && start + last_offset + taps <= buffered_) {
+      const size_t num_cycles =
+          (buffered_ - taps - last_offset - start) / input_rate + 1;
+      y = cycles_(table, x + start, num_cycles, y);
+      start += num_cycles * input_rate;
+    }
+    while (available()) {
+      resample_one();
+    }
+
+    num_outputs = y - channel_out_.data();
+    T* channel = out + *written * num_channels_ + c;
+    for (size_t i = 0; i < num_outputs; i++) {
+      Store(channel_out_[i], channel + i * num_channels_);
+    }
+  }
+  *written += num_outputs;
+
+  // Keeps the window of the next output.
+  buffered_ -= start;
+  for (int c = 0; c < num_channels_; c++) {
+    float* x = &buffer_[c * capacity_];
+    std::copy(x + start, x + start + buffered_, x);
+  }
+  cycle_start_ = 0;
+  cycle_output_ = k;
+}
+
+void Resampler::Reset() {
+  if (!table_) {
+    speex_resampler_reset_mem(state_);
+    return;
+  }
+  // The filter history is zeros.
+  std::fill(buffer_.begin(), buffer_.end(), 0.f);
+  buffered_ = table_->taps - 1;
+  cycle_start_ = 0;
+  cycle_output_ = 0;
+}
+
+int Resampler::InputLatency() const {
+  if (table_) {
+    return table_->taps / 2;
+  }
+  return speex_resampler_get_input_latency(state_);
+}
+
+int Resampler::OutputLatency() const {
+  if (table_) {
+    // As resample.c.
+    return ((table_->taps / 2) * table_->output_rate +
+            (table_->input_rate >> 1)) /
+           table_->input_rate;
+  }
+  return speex_resampler_get_output_latency(state_);
+}
+
+}  // namespace audio_util
@@ -0,0 +1,110 @@
+#ifndef AUDIO_UTIL_RESAMPLER_H_
+#define AUDIO_UTIL_RESAMPLER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "resampler_tables.h"
+
+struct SpeexResamplerState_;
+
+namespace audio_util {
+
+// Streaming samplerate converter of interleaved PCM, as the 16 kHz audio of
+// the glasses to 48 kHz for Opus, or to the rates of the ASR engines.
+//
+// The Speex resampler of opus-tools, its inner products in SIMD, see
+// resampler_kernels.h. All the memory is allocated by the constructor:
+// Process() allocates nothing, whatever the size of its input.
+//
+// The ratios between 8, 16, 24 and 48 kHz, at qualities 3 to 5, have their
+// polyphase filters precomputed, in resampler_tables.cc: they are resampled
+// by whole cycles of input and output samples, each of fixed phases and
+// window offsets, all the phases of a window at once when upsampling. The
+// filters are those of the generic resampler, for the same output, to the
+// rounding.
+//
+// The output is delayed by OutputLatency() samples: the filter is fed
+// zeros before the first input.
+//
+// Not thread safe.
+class Resampler {
+ public:
+  // `quality` from 0, fastest, to 10, best; 3 is the Speex choice for VoIP,
+  // 5 for desktop audio. From 9, the filter is summed in double precision.
+  // The fixed ratio filters are used, when there is one, unless
+  // `use_fixed_ratio` is false.
+  Resampler(int num_channels, int input_rate_hz, int output_rate_hz,
+            int quality, bool use_fixed_ratio = true);
+  ~Resampler();
+
+  Resampler(const Resampler&) = delete;
+  Resampler& operator=(const Resampler&) = delete;
+
+  // Samples per channel the output of `num_samples` input samples per
+  // channel may have: the smallest `max_samples` accepted by Process().
+  size_t MaxOutputSamples(size_t num_samples) const;
+
+  // Resamples `num_samples` interleaved samples per channel, all consumed,
+  // into `out`, which holds `max_samples` samples per channel.
+  // Returns the number of samples per channel written, or -1 when
+  // `max_samples` is lower than MaxOutputSamples(num_samples).
+  int Process(const int16_t* pcm, size_t num_samples, int16_t* out,
+              size_t max_samples);
+  int Process(const float* pcm, size_t num_samples, float* out,
+              size_t max_samples);
+
+  // Clears the history of the filter, to start a new stream.
+  void Reset();
+
+  // Delay of the output, in input, and in output samples.
+  int InputLatency() const;
+  int OutputLatency() const;
+
+  int num_channels() const { return num_channels_; }
+  int input_rate_hz() const { return input_rate_hz_; }
+  int output_rate_hz() const { return output_rate_hz_; }
+  int quality() const { return quality_; }
+  // Whether a fixed ratio filter is used.
+  bool fixed_ratio() const { return table_ != nullptr; }
+
+ private:
+  // Outputs of `num_cycles` whole cycles of the ratio of `table`, from the
+  // window at `x`. Returns the end of the output.
+  using CyclesFunction = float* (*)(const ResamplerTable& table,
+                                    const float* x, size_t num_cycles,
+                                    float* out);
+
+  template <typename T>
+  int ProcessFixedRatio(const T* pcm, size_t num_samples, T* out);
+
+  // Resamples the input buffered, into `out`, of `written` samples per
+  // channel already, and drops the input no longer needed.
+  template <typename T>
+  void ResampleBuffer(T* out, size_t* written);
+
+  const int num_channels_;
+  const int input_rate_hz_;
+  const int output_rate_hz_;
+  const int quality_;
+
+  // Fixed ratio filter, null for the generic resampler.
+  const ResamplerTable* table_;
+  CyclesFunction cycles_;
+  // Per channel, capacity_ samples: the window of the next output, from
+  // cycle_start_ with its output cycle_output_ of the cycle, then the input
+  // to resample, up to buffered_.
+  std::vector<float> buffer_;
+  int capacity_;
+  int buffered_;
+  int cycle_start_;
+  int cycle_output_;
+  // Output of a channel, of buffer_.
+  std::vector<float> channel_out_;
+
+  SpeexResamplerState_* state_;
+};
+
+}  // namespace audio_util
+
+#endif  // AUDIO_UTIL_RESAMPLER_H_
@@ -0,0 +1,624 @@
+#include "resampler_kernels.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AUDIO_UTIL_RESAMPLER_X86 1
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define AUDIO_UTIL_RESAMPLER_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace audio_util {
+namespace {
+
+// Reference kernels, as the loops of resample.c.
+
+float InnerProductSingle(const float* a, const float* b, unsigned int len) {
+  float sum = 0;
+  for (unsigned int i = 0; i < len; i++) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+double InnerProductDouble(const float* a, const float* b, unsigned int len) {
+  double accum[4] = {0, 0, 0, 0};
+  unsigned int i = 0;
+  for (; i + 4 <= len; i += 4) {
+    accum[0] += a[i] * b[i];
+    accum[1] += a[i + 1] * b[i + 1];
+    accum[2] += a[i + 2] * b[i + 2];
+    accum[3] += a[i + 3] * b[i + 3];
+  }
+  for (; i < len; i++) {
+    accum[0] += a[i] * b[i];
+  }
+  return accum[0] + accum[1] + accum[2] + accum[3];
+}
+
+float InterpolateProductSingle(const float* a, const float* b,
+                               unsigned int len, unsigned int oversample,
+                               const float* frac) {
+  float accum[4] = {0, 0, 0, 0};
+  for (unsigned int i = 0; i < len; i++) {
+    const float* phases = b + i * oversample;
+    accum[0] += a[i] * phases[0];
+    accum[1] += a[i] * phases[1];
+    accum[2] += a[i] * phases[2];
+    accum[3] += a[i] * phases[3];
+  }
+  return frac[0] * accum[0] + frac[1] * accum[1] + frac[2] * accum[2] +
+         frac[3] * accum[3];
+}
+
+double InterpolateProductDouble(const float* a, const float* b,
+                                unsigned int len, unsigned int oversample,
+                                const float* frac) {
+  double accum[4] = {0, 0, 0, 0};
+  for (unsigned int i = 0; i < len; i++) {
+    const double x = a[i];
+    const float* phases = b + i * oversample;
+    accum[0] += x * phases[0];
+    accum[1] += x * phases[1];
+    accum[2] += x * phases[2];
+    accum[3] += x * phases[3];
+  }
+  return frac[0] * accum[0] + frac[1] * accum[1] + frac[2] * accum[2] +
+         frac[3] * accum[3];
+}
+
+void PolyphaseProductSingle(const float* a, const float* b, unsigned int len,
+                            unsigned int phases, float* out) {
+  for (unsigned int p = 0; p < phases; p++) {
+    out[p] = InnerProductSingle(a, b + p * len, len);
+  }
+}
+
+const AudioUtilResamplerKernels kScalarKernels = {
+    InnerProductSingle, InnerProductDouble, InterpolateProductSingle,
+    InterpolateProductDouble, PolyphaseProductSingle};
+
+// The SIMD polyphase products are computed by pairs of phases, each window
+// load shared by the two, with two accumulators per phase; an odd phase is
+// an inner product. The accumulators are named: as arrays, indexed by a
+// loop on the phases, compilers keep them on the stack.
+
+#ifdef AUDIO_UTIL_RESAMPLER_X86
+
+// SSE2: 4 lanes, products of floats summed in float, or in double.
+
+__attribute__((target("sse2"))) inline float HorizontalSum(__m128 x) {
+  x = _mm_add_ps(x, _mm_movehl_ps(x, x));
+  x = _mm_add_ss(x, _mm_shuffle_ps(x, x, 0x55));
+  return _mm_cvtss_f32(x);
+}
+
+__attribute__((target("sse2"))) inline double HorizontalSum(__m128d x) {
+  return _mm_cvtsd_f64(_mm_add_sd(x, _mm_unpackhi_pd(x, x)));
+}
+
+__attribute__((target("sse2"))) float InnerProductSingleSse(
+    const float* a, const float* b, unsigned int len) {
+  __m128 sum0 = _mm_setzero_ps();
+  __m128 sum1 = _mm_setzero_ps();
+  unsigned int i = 0;
+  for (; i + 8 <= len; i += 8) {
+    sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(a + i),
+                                       _mm_loadu_ps(b + i)));
+    sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(a + i + 4),
+                                       _mm_loadu_ps(b + i + 4)));
+  }
+  if (i + 4 <= len) {
+    sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(a + i),
+                                       _mm_loadu_ps(b + i)));
+    i += 4;
+  }
+  float sum = HorizontalSum(_mm_add_ps(sum0, sum1));
+  for (; i < len; i++) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+__attribute__((target("sse2"))) double InnerProductDoubleSse(
+    const float* a, const float* b, unsigned int len) {
+  __m128d sum0 = _mm_setzero_pd();
+  __m128d sum1 = _mm_setzero_pd();
+  unsigned int i = 0;
+  for (; i + 4 <= len; i += 4) {
+    const __m128 product =
+        _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+    sum0 = _mm_add_pd(sum0, _mm_cvtps_pd(product));
+    sum1 = _mm_add_pd(sum1, _mm_cvtps_pd(_mm_movehl_ps(product, product)));
+  }
+  double sum = HorizontalSum(_mm_add_pd(sum0, sum1));
+  for (; i < len; i++) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+__attribute__((target("sse2"))) float InterpolateProductSingleSse(
+    const float* a, const float* b, unsigned int len,
+    unsigned int oversample, const float* frac) {
+  __m128 sum0 = _mm_setzero_ps();
+  __m128 sum1 = _mm_setzero_ps();
+  unsigned int i = 0;
+  for (; i + 2 <= len; i += 2) {
+    sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_set1_ps(a[i]),
+                                       _mm_loadu_ps(b + i * oversample)));
+    sum1 = _mm_add_ps(
+        sum1, _mm_mul_ps(_mm_set1_ps(a[i + 1]),
+                         _mm_loadu_ps(b + (i + 1) * oversample)));
+  }
+  if (i < len) {
+    sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_set1_ps(a[i]),
+                                       _mm_loadu_ps(b + i * oversample)));
+  }
+  return HorizontalSum(
+      _mm_mul_ps(_mm_add_ps(sum0, sum1), _mm_loadu_ps(frac)));
+}
+
+__attribute__((target("sse2"))) double InterpolateProductDoubleSse(
+    const float* a, const float* b, unsigned int len,
+    unsigned int oversample, const float* frac) {
+  __m128d sum_low = _mm_setzero_pd();   // Phases 0 and 1.
+  __m128d sum_high = _mm_setzero_pd();  // Phases 2 and 3.
+  for (unsigned int i = 0; i < len; i++) {
+    const __m128 product =
+        _mm_mul_ps(_mm_set1_ps(a[i]), _mm_loadu_ps(b + i * oversample));
+    sum_low = _mm_add_pd(sum_low, _mm_cvtps_pd(product));
+    sum_high =
+        _mm_add_pd(sum_high, _mm_cvtps_pd(_mm_movehl_ps(product, product)));
+  }
+  const __m128 f = _mm_loadu_ps(frac);
+  return HorizontalSum(
+      _mm_add_pd(_mm_mul_pd(sum_low, _mm_cvtps_pd(f)),
+                 _mm_mul_pd(sum_high, _mm_cvtps_pd(_mm_movehl_ps(f, f)))));
+}
+
+__attribute__((target("sse2"))) void PolyphasePairSse(const float* a,
+                                                      const float* b0,
+                                                      const float* b1,
+                                                      unsigned int len,
+                                                      float* out) {
+  __m128 sum00 = _mm_setzero_ps();
+  __m128 sum01 = _mm_setzero_ps();
+  __m128 sum10 = _mm_setzero_ps();
+  __m128 sum11 = _mm_setzero_ps();
+  unsigned int i = 0;
+  for (; i + 8 <= len; i += 8) {
+    const __m128 x0 = _mm_loadu_ps(a + i);
+    const __m128 x1 = _mm_loadu_ps(a + i + 4);
+    sum00 = _mm_add_ps(sum00, _mm_mul_ps(x0, _mm_loadu_ps(b0 + i)));
+    sum01 = _mm_add_ps(sum01, _mm_mul_ps(x1, _mm_loadu_ps(b0 + i + 4)));
+    sum10 = _mm_add_ps(sum10, _mm_mul_ps(x0, _mm_loadu_ps(b1 + i)));
+    sum11 = _mm_add_ps(sum11, _mm_mul_ps(x1, _mm_loadu_ps(b1 + i + 4)));
+  }
+  if (i + 4 <= len) {
+    const __m128 x = _mm_loadu_ps(a + i);
+    sum00 = _mm_add_ps(sum00, _mm_mul_ps(x, _mm_loadu_ps(b0 + i)));
+    sum10 = _mm_add_ps(sum10, _mm_mul_ps(x, _mm_loadu_ps(b1 + i)));
+    i += 4;
+  }
+  float total0 = HorizontalSum(_mm_add_ps(sum00, sum01));
+  float total1 = HorizontalSum(_mm_add_ps(sum10, sum11));
+  for (; i < len; i++) {
+    total0 += a[i] * b0[i];
+    total1 += a[i] * b1[i];
+  }
+  out[0] = total0;
+  out[1] = total1;
+}
+
+__attribute__((target("sse2"))) void PolyphaseProductSingleSse(
+    const float* a, const float* b, unsigned int len, unsigned int phases,
+    float* out) {
+  for (; phases >= 2; phases -= 2, b += 2 * len, out += 2) {
+    PolyphasePairSse(a, b, b + len, len, out);
+  }
+  if (phases == 1) {
+    *out = InnerProductSingleSse(a, b, len);
+  }
+}
+
+const AudioUtilResamplerKernels kSseKernels = {
+    InnerProductSingleSse, InnerProductDoubleSse,
+    InterpolateProductSingleSse, InterpolateProductDoubleSse,
+    PolyphaseProductSingleSse};
+
+// AVX2: 8 lanes, with FMA, or two taps of the interpolated filter at once.
+
+__attribute__((target("avx2,fma"))) inline __m128 HalvesSum(__m256 x) {
+  return _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+}
+
+__attribute__((target("avx2,fma"))) inline double HorizontalSum256(
+    __m256d x) {
+  const __m128d halves =
+      _mm_add_pd(_mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(halves, _mm_unpackhi_pd(halves, halves)));
+}
+
+__attribute__((target("avx2,fma"))) float InnerProductSingleAvx2(
+    const float* a, const float* b, unsigned int len) {
+  __m256 sum0 = _mm256_setzero_ps();
+  __m256 sum1 = _mm256_setzero_ps();
+  unsigned int i = 0;
+  for (; i + 16 <= len; i += 16) {
+    sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i),
+                           sum0);
+    sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8),
+                           _mm256_loadu_ps(b + i + 8), sum1);
+  }
+  if (i + 8 <= len) {
+    sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i),
+                           sum0);
+    i += 8;
+  }
+  __m128 sum = HalvesSum(_mm256_add_ps(sum0, sum1));
+  if (i + 4 <= len) {
+    sum = _mm_fmadd_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i), sum);
+    i += 4;
+  }
+  float total = HorizontalSum(sum);
+  for (; i < len; i++) {
+    total += a[i] * b[i];
+  }
+  return total;
+}
+
+__attribute__((target("avx2,fma"))) double InnerProductDoubleAvx2(
+    const float* a, const float* b, unsigned int len) {
+  __m256d sum0 = _mm256_setzero_pd();
+  __m256d sum1 = _mm256_setzero_pd();
+  unsigned int i = 0;
+  for (; i + 8 <= len; i += 8) {
+    const __m256 product =
+        _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+    sum0 = _mm256_add_pd(sum0,
+                         _mm256_cvtps_pd(_mm256_castps256_ps128(product)));
+    sum1 = _mm256_add_pd(sum1,
+                         _mm256_cvtps_pd(_mm256_extractf128_ps(product, 1)));
+  }
+  if (i + 4 <= len) {
+    sum0 = _mm256_add_pd(sum0, _mm256_cvtps_pd(_mm_mul_ps(
+                                   _mm_loadu_ps(a + i), _mm_loadu_ps(b + i))));
+    i += 4;
+  }
+  double sum = HorizontalSum256(_mm256_add_pd(sum0, sum1));
+  for (; i < len; i++) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+__attribute__((target("avx2,fma"))) float InterpolateProductSingleAvx2(
+    const float* a, const float* b, unsigned int len,
+    unsigned int oversample, const float* frac) {
+  // Low lanes for the even taps, high lanes for the odd ones.
+  __m256 sum = _mm256_setzero_ps();
+  unsigned int i = 0;
+  for (; i + 2 <= len; i += 2) {
+    const __m256 x = _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm_set1_ps(a[i])), _mm_set1_ps(a[i + 1]),
+        1);
+    const __m256 phases = _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm_loadu_ps(b + i * oversample)),
+        _mm_loadu_ps(b + (i + 1) * oversample), 1);
+    sum = _mm256_fmadd_ps(x, phases, sum);
+  }
+  __m128 phase_sums = HalvesSum(sum);
+  if (i < len) {
+    phase_sums = _mm_fmadd_ps(_mm_set1_ps(a[i]),
+                              _mm_loadu_ps(b + i * oversample), phase_sums);
+  }
+  return HorizontalSum(_mm_mul_ps(phase_sums, _mm_loadu_ps(frac)));
+}
+
+__attribute__((target("avx2,fma"))) double InterpolateProductDoubleAvx2(
+    const float* a, const float* b, unsigned int len,
+    unsigned int oversample, const float* frac) {
+  __m256d sum0 = _mm256_setzero_pd();
+  __m256d sum1 = _mm256_setzero_pd();
+  unsigned int i = 0;
+  for (; i + 2 <= len; i += 2) {
+    sum0 = _mm256_add_pd(
+        sum0, _mm256_cvtps_pd(_mm_mul_ps(_mm_set1_ps(a[i]),
+                                         _mm_loadu_ps(b + i * oversample))));
+    sum1 = _mm256_add_pd(
+        sum1,
+        _mm256_cvtps_pd(_mm_mul_ps(_mm_set1_ps(a[i + 1]),
+                                   _mm_loadu_ps(b + (i + 1) * oversample))));
+  }
+  if (i < len) {
+    sum0 = _mm256_add_pd(
+        sum0, _mm256_cvtps_pd(_mm_mul_ps(_mm_set1_ps(a[i]),
+                                         _mm_loadu_ps(b + i * oversample))));
+  }
+  return HorizontalSum256(_mm256_mul_pd(
+      _mm256_add_pd(sum0, sum1), _mm256_cvtps_pd(_mm_loadu_ps(frac))));
+}
+
+__attribute__((target("avx2,fma"))) void PolyphasePairAvx2(
+    const float* a, const float* b0, const float* b1, unsigned int len,
+    float* out) {
+  __m256 sum00 = _mm256_setzero_ps();
+  __m256 sum01 = _mm256_setzero_ps();
+  __m256 sum10 = _mm256_setzero_ps();
+  __m256 sum11 = _mm256_setzero_ps();
+  unsigned int i = 0;
+  for (; i + 16 <= len; i += 16) {
+    const __m256 x0 = _mm256_loadu_ps(a + i);
+    const __m256 x1 = _mm256_loadu_ps(a + i + 8);
+    sum00 = _mm256_fmadd_ps(x0, _mm256_loadu_ps(b0 + i), sum00);
+    sum01 = _mm256_fmadd_ps(x1, _mm256_loadu_ps(b0 + i + 8), sum01);
+    sum10 = _mm256_fmadd_ps(x0, _mm256_loadu_ps(b1 + i), sum10);
+    sum11 = _mm256_fmadd_ps(x1, _mm256_loadu_ps(b1 + i + 8), sum11);
+  }
+  if (i + 8 <= len) {
+    const __m256 x = _mm256_loadu_ps(a + i);
+    sum00 = _mm256_fmadd_ps(x, _mm256_loadu_ps(b0 + i), sum00);
+    sum10 = _mm256_fmadd_ps(x, _mm256_loadu_ps(b1 + i), sum10);
+    i += 8;
+  }
+  float total0 = HorizontalSum(HalvesSum(_mm256_add_ps(sum00, sum01)));
+  float total1 = HorizontalSum(HalvesSum(_mm256_add_ps(sum10, sum11)));
+  for (; i < len; i++) {
+    total0 += a[i] * b0[i];
+    total1 += a[i] * b1[i];
+  }
+  out[0] = total0;
+  out[1] = total1;
+}
+
+__attribute__((target("avx2,fma"))) void PolyphaseProductSingleAvx2(
+    const float* a, const float* b, unsigned int len, unsigned int phases,
+    float* out) {
+  for (; phases >= 2; phases -= 2, b += 2 * len, out += 2) {
+    PolyphasePairAvx2(a, b, b + len, len, out);
+  }
+  if (phases == 1) {
+    *out = InnerProductSingleAvx2(a, b, len);
+  }
+}
+
+const AudioUtilResamplerKernels kAvx2Kernels = {
+    InnerProductSingleAvx2, InnerProductDoubleAvx2,
+    InterpolateProductSingleAvx2, InterpolateProductDoubleAvx2,
+    PolyphaseProductSingleAvx2};
+
+#endif  // AUDIO_UTIL_RESAMPLER_X86
+
+#ifdef AUDIO_UTIL_RESAMPLER_NEON
+
+// NEON: 4 lanes. The double precision kernels need AArch64; on ARMv7 they
+// are the scalar ones.
+
+inline float HorizontalSum(float32x4_t x) {
+#ifdef __aarch64__
+  return vaddvq_f32(x);
+#else
+  const float32x2_t halves = vadd_f32(vget_low_f32(x), vget_high_f32(x));
+  return vget_lane_f32(vpadd_f32(halves, halves), 0);
+#endif
+}
+
+inline float32x4_t MultiplyAdd(float32x4_t sum, float32x4_t a,
+                               float32x4_t b) {
+#ifdef __aarch64__
+  return vfmaq_f32(sum, a, b);
+#else
+  return vmlaq_f32(sum, a, b);
+#endif
+}
+
+float InnerProductSingleNeon(const float* a, const float* b,
+                             unsigned int len) {
+  float32x4_t sum0 = vdupq_n_f32(0);
+  float32x4_t sum1 = vdupq_n_f32(0);
+  unsigned int i = 0;
+  for (; i + 8 <= len; i += 8) {
+    sum0 = MultiplyAdd(sum0, vld1q_f32(a + i), vld1q_f32(b + i));
+    sum1 = MultiplyAdd(sum1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+  }
+  if (i + 4 <= len) {
+    sum0 = MultiplyAdd(sum0, vld1q_f32(a + i), vld1q_f32(b + i));
+    i += 4;
+  }
+  float sum = HorizontalSum(vaddq_f32(sum0, sum1));
+  for (; i < len; i++) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+float InterpolateProductSingleNeon(const float* a, const float* b,
+                                   unsigned int len, unsigned int oversample,
+                                   const float* frac) {
+  float32x4_t sum0 = vdupq_n_f32(0);
+  float32x4_t sum1 = vdupq_n_f32(0);
+  unsigned int i = 0;
+  for (; i + 2 <= len; i += 2) {
+    sum0 = MultiplyAdd(sum0, vdupq_n_f32(a[i]), vld1q_f32(b + i * oversample));
+    sum1 = MultiplyAdd(sum1, vdupq_n_f32(a[i + 1]),
+                       vld1q_f32(b + (i + 1) * oversample));
+  }
+  if (i < len) {
+    sum0 = MultiplyAdd(sum0, vdupq_n_f32(a[i]), vld1q_f32(b + i * oversample));
+  }
+  return HorizontalSum(vmulq_f32(vaddq_f32(sum0, sum1), vld1q_f32(frac)));
+}
+
+#ifdef __aarch64__
+double InnerProductDoubleNeon(const float* a, const float* b,
+                              unsigned int len) {
+  float64x2_t sum0 = vdupq_n_f64(0);
+  float64x2_t sum1 = vdupq_n_f64(0);
+  unsigned int i = 0;
+  for (; i + 4 <= len; i += 4) {
+    const float32x4_t product = vmulq_f32(vld1q_f32(a + i), vld1q_f32(b + i));
+    sum0 = vaddq_f64(sum0, vcvt_f64_f32(vget_low_f32(product)));
+    sum1 = vaddq_f64(sum1, vcvt_high_f64_f32(product));
+  }
+  double sum = vaddvq_f64(vaddq_f64(sum0, sum1));
+  for (; i < len; i++) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+double InterpolateProductDoubleNeon(const float* a, const float* b,
+                                    unsigned int len, unsigned int oversample,
+                                    const float* frac) {
+  float64x2_t sum_low = vdupq_n_f64(0);   // Phases 0 and 1.
+  float64x2_t sum_high = vdupq_n_f64(0);  // Phases 2 and 3.
+  for (unsigned int i = 0; i < len; i++) {
+    const float32x4_t product =
+        vmulq_n_f32(vld1q_f32(b + i * oversample), a[i]);
+    sum_low = vaddq_f64(sum_low, vcvt_f64_f32(vget_low_f32(product)));
+    sum_high = vaddq_f64(sum_high, vcvt_high_f64_f32(product));
+  }
+  const float32x4_t f = vld1q_f32(frac);
+  return vaddvq_f64(
+      vaddq_f64(vmulq_f64(sum_low, vcvt_f64_f32(vget_low_f32(f))),
+                vmulq_f64(sum_high, vcvt_high_f64_f32(f))));
+}
+#else
+#define InnerProductDoubleNeon InnerProductDouble
+#define InterpolateProductDoubleNeon InterpolateProductDouble
+#endif
+
+void PolyphasePairNeon(const float* a, const float* b0, const float* b1,
+                       unsigned int len, float* out) {
+  float32x4_t sum00 = vdupq_n_f32(0);
+  float32x4_t sum01 = vdupq_n_f32(0);
+  float32x4_t sum10 = vdupq_n_f32(0);
+  float32x4_t sum11 = vdupq_n_f32(0);
+  unsigned int i = 0;
+  for (; i + 8 <= len; i += 8) {
+    const float32x4_t x0 = vld1q_f32(a + i);
+    const float32x4_t x1 = vld1q_f32(a + i + 4);
+    sum00 = MultiplyAdd(sum00, x0, vld1q_f32(b0 + i));
+    sum01 = MultiplyAdd(sum01, x1, vld1q_f32(b0 + i + 4));
+    sum10 = MultiplyAdd(sum10, x0, vld1q_f32(b1 + i));
+    sum11 = MultiplyAdd(sum11, x1, vld1q_f32(b1 + i + 4));
+  }
+  if (i + 4 <= len) {
+    const float32x4_t x = vld1q_f32(a + i);
+    sum00 = MultiplyAdd(sum00, x, vld1q_f32(b0 + i));
+    sum10 = MultiplyAdd(sum10, x, vld1q_f32(b1 + i));
+    i += 4;
+  }
+  float total0 = HorizontalSum(vaddq_f32(sum00, sum01));
+  float total1 = HorizontalSum(vaddq_f32(sum10, sum11));
+  for (; i < len; i++) {
+    total0 += a[i] * b0[i];
+    total1 += a[i] * b1[i];
+  }
+  out[0] = total0;
+  out[1] = total1;
+}
+
+void PolyphaseProductSingleNeon(const float* a, const float* b,
+                                unsigned int len, unsigned int phases,
+                                float* out) {
+  for (; phases >= 2; phases -= 2, b += 2 * len, out += 2) {
+    PolyphasePairNeon(a, b, b + len, len, out);
+  }
+  if (phases == 1) {
+    *out = InnerProductSingleNeon(a, b, len);
+  }
+}
+
+const AudioUtilResamplerKernels kNeonKernels = {
+    InnerProductSingleNeon, InnerProductDoubleNeon,
+    InterpolateProductSingleNeon, InterpolateProductDoubleNeon,
+    PolyphaseProductSingleNeon};
+
+#endif  // AUDIO_UTIL_RESAMPLER_NEON
+
+const AudioUtilResamplerKernels* KernelsOf(ResamplerKernels kernels) {
+  switch (kernels) {
+#ifdef AUDIO_UTIL_RESAMPLER_X86
+    case ResamplerKernels::kSse:
+      return &kSseKernels;
+    case ResamplerKernels::kAvx2:
+      return &kAvx2Kernels;
+#endif
+#ifdef AUDIO_UTIL_RESAMPLER_NEON
+    case ResamplerKernels::kNeon:
+      return &kNeonKernels;
+#endif
+    default:
+      return &kScalarKernels;
+  }
+}
+
+ResamplerKernels BestKernels() {
+  const ResamplerKernels kPreferred[] = {ResamplerKernels::kAvx2,
+                                         ResamplerKernels::kSse,
+                                         ResamplerKernels::kNeon};
+  for (ResamplerKernels kernels : kPreferred) {
+    if (ResamplerKernelsSupported(kernels)) {
+      return kernels;
+    }
+  }
+  return ResamplerKernels::kScalar;
+}
+
+ResamplerKernels active_kernels = BestKernels();
+
+}  // namespace
+
+bool ResamplerKernelsSupported(ResamplerKernels kernels) {
+  switch (kernels) {
+    case ResamplerKernels::kScalar:
+      return true;
+#ifdef AUDIO_UTIL_RESAMPLER_X86
+    case ResamplerKernels::kSse:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("sse2");
+    case ResamplerKernels::kAvx2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+#ifdef AUDIO_UTIL_RESAMPLER_NEON
+    // Part of the ABI where the compiler targets it.
+    case ResamplerKernels::kNeon:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+ResamplerKernels ActiveResamplerKernels() { return active_kernels; }
+
+bool UseResamplerKernels(ResamplerKernels kernels) {
+  if (!ResamplerKernelsSupported(kernels)) {
+    return false;
+  }
+  active_kernels = kernels;
+  audio_util_resampler_kernels = KernelsOf(kernels);
+  return true;
+}
+
+const char* ResamplerKernelsName(ResamplerKernels kernels) {
+  switch (kernels) {
+    case ResamplerKernels::kScalar:
+      return "scalar";
+    case ResamplerKernels::kSse:
+      return "sse2";
+    case ResamplerKernels::kAvx2:
+      return "avx2";
+    case ResamplerKernels::kNeon:
+      return "neon";
+  }
+  return "unknown";
+}
+
+}  // namespace audio_util
+
+const AudioUtilResamplerKernels* audio_util_resampler_kernels =
+    audio_util::KernelsOf(audio_util::ActiveResamplerKernels());
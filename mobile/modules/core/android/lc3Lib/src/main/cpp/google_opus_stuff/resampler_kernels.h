@@ -0,0 +1,78 @@
+#ifndef AUDIO_UTIL_RESAMPLER_KERNELS_H_
+#define AUDIO_UTIL_RESAMPLER_KERNELS_H_
+
+/*
+ * Inner products of the Speex resampler of opus-tools, resample.c, in SIMD.
+ *
+ * resample.c computes each output sample as the inner product of its filter,
+ * from the sinc table, and the input. Built with _USE_SSE, it includes
+ * resample_sse.h, which here calls these kernels, through the table of the
+ * instruction set of the CPU, selected at load time.
+ *
+ * Included by resample.c: C, as well as C++.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct AudioUtilResamplerKernels {
+  /* Sum of a[i] * b[i], i < len, in float, or in double. */
+  float (*inner_product_single)(const float* a, const float* b,
+                                unsigned int len);
+  double (*inner_product_double)(const float* a, const float* b,
+                                 unsigned int len);
+
+  /* Sum of a[i] * (frac[0] * b[i * oversample] + ...
+   * + frac[3] * b[i * oversample + 3]), i < len: the product with the filter
+   * interpolated between 4 phases of an oversampled sinc table. */
+  float (*interpolate_product_single)(const float* a, const float* b,
+                                      unsigned int len,
+                                      unsigned int oversample,
+                                      const float* frac);
+  double (*interpolate_product_double)(const float* a, const float* b,
+                                       unsigned int len,
+                                       unsigned int oversample,
+                                       const float* frac);
+
+  /* out[p] = sum of a[i] * b[p * len + i], i < len, for p < phases: the
+   * products of a window with all the phases of a polyphase filter, for
+   * the fixed ratio tables of resampler_tables.h. */
+  void (*polyphase_product_single)(const float* a, const float* b,
+                                   unsigned int len, unsigned int phases,
+                                   float* out);
+} AudioUtilResamplerKernels;
+
+/* Kernels of resample.c, and of the fixed ratios of the Resampler. */
+extern const AudioUtilResamplerKernels* audio_util_resampler_kernels;
+
+#ifdef __cplusplus
+}  // extern "C"
+
+namespace audio_util {
+
+// Instruction sets of the resampler kernels.
+enum class ResamplerKernels {
+  kScalar,
+  kSse,   // SSE2, x86.
+  kAvx2,  // AVX2 and FMA, x86.
+  kNeon,  // ARM.
+};
+
+// Whether the CPU runs the kernels of `kernels`.
+bool ResamplerKernelsSupported(ResamplerKernels kernels);
+
+// Kernels in use: by default the best supported, AVX2 over SSE.
+ResamplerKernels ActiveResamplerKernels();
+
+// Uses the kernels of `kernels`, for the tests and benchmarks; returns false,
+// changing nothing, when they are not supported. Not to be called while a
+// Resampler is running.
+bool UseResamplerKernels(ResamplerKernels kernels);
+
+const char* ResamplerKernelsName(ResamplerKernels kernels);
+
+}  // namespace audio_util
+#endif
+
+#endif  // AUDIO_UTIL_RESAMPLER_KERNELS_H_
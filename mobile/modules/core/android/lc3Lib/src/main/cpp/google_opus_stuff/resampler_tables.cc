@@ -0,0 +1,1480 @@
+// Generated by tools/resampler_tables_generator.cc, do not edit.
+
+#include "resampler_tables.h"
+
+namespace audio_util {
+namespace {
+
+// 1:2, quality 3: 2 phases of 48 taps.
+const float kTable1To2Quality3[] = {
+    -2.55462201e-05, 0.000100863319, -0.000259486202, 0.000532516337,
+    -0.000937428325, 0.00146290124, -0.00205293158, 0.00259332452,
+    -0.00290520536, 0.00274869404, -0.00183912949, -0.000122978759,
+    0.00341105997, -0.00822512992, 0.014644824, -0.022591114,
+    0.0318041369, -0.0418437906, 0.0521155559, -0.061921306,
+    0.0705289021, -0.0772518814, 0.0815309584, 0.916999996,
+    0.0815309584, -0.0772518814, 0.0705289021, -0.061921306,
+    0.0521155559, -0.0418437906, 0.0318041369, -0.022591114,
+    0.014644824, -0.00822512992, 0.00341105997, -0.000122978759,
+    -0.00183912949, 0.00274869404, -0.00290520536, 0.00259332452,
+    -0.00205293158, 0.00146290124, -0.000937428325, 0.000532516337,
+    -0.000259486202, 0.000100863319, -2.55462201e-05, 7.79471463e-07,
+    -5.56055857e-05, 0.000124210739, -0.00020860153, 0.000278921216,
+    -0.000280493317, 0.000132974586, 0.00026393286, -0.0010165167,
+    0.00221492327, -0.00390401552, 0.00605115714, -0.00851545297,
+    0.0110230874, -0.0131545104, 0.0143441595, -0.0138897803,
+    0.0109615317, -0.00458457274, -0.00646224432, 0.0239769984,
+    -0.0513535291, 0.0971789882, -0.193332121, 0.630190849,
+    0.630190849, -0.193332121, 0.0971789882, -0.0513535291,
+    0.0239769984, -0.00646224432, -0.00458457274, 0.0109615317,
+    -0.0138897803, 0.0143441595, -0.0131545104, 0.0110230874,
+    -0.00851545297, 0.00605115714, -0.00390401552, 0.00221492327,
+    -0.0010165167, 0.00026393286, 0.000132974586, -0.000280493317,
+    0.000278921216, -0.00020860153, 0.000124210739, -5.56055857e-05,
+};
+
+// 1:2, quality 4: 2 phases of 64 taps.
+const float kTable1To2Quality4[] = {
+    -2.30558362e-05, 5.98695151e-05, -0.000125067963, 0.000227435303,
+    -0.000374036812, 0.000568111253, -0.000806654687, 0.00107793382,
+    -0.00135919894, 0.00161496026, -0.00179612718, 0.00184036337,
+    -0.00167384103, 0.0012146451, -0.000377504883, -0.000920005084,
+    0.00275031966, -0.00516837602, 0.00820439402, -0.0118572814,
+    0.0160900448, -0.0208269935, 0.0259540305, -0.031321533,
+    0.0367504731, -0.0420410447, 0.0469835587, -0.0513706803,
+    0.0550104119, -0.0577381402, 0.0594277754, 0.939999998,
+    0.0594277754, -0.0577381402, 0.0550104119, -0.0513706803,
+    0.0469835587, -0.0420410447, 0.0367504731, -0.031321533,
+    0.0259540305, -0.0208269935, 0.0160900448, -0.0118572814,
+    0.00820439402, -0.00516837602, 0.00275031966, -0.000920005084,
+    -0.000377504883, 0.0012146451, -0.00167384103, 0.00184036337,
+    -0.00179612718, 0.00161496026, -0.00135919894, 0.00107793382,
+    -0.000806654687, 0.000568111253, -0.000374036812, 0.000227435303,
+    -0.000125067963, 5.98695151e-05, -2.30558362e-05, 5.78570825e-06,
+    -3.47103814e-05, 6.50652801e-05, -0.000100215293, 0.000132720146,
+    -0.000150253953, 0.000135141323, -6.4501146e-05, -8.87974093e-05,
+    0.000354223099, -0.000760739029, 0.00133299269, -0.00208679587,
+    0.00302409451, -0.00412797881, 0.00535796676, -0.00664613536,
+    0.00789451879, -0.00897387415, 0.00972402003, -0.00995517708,
+    0.0094498191, -0.00796315912, 0.00521939434, -0.000899386592,
+    -0.00539148971, 0.0141942464, -0.0263579581, 0.0434275717,
+    -0.068707332, 0.11088156, -0.202110976, 0.633213758,
+    0.633213758, -0.202110976, 0.11088156, -0.068707332,
+    0.0434275717, -0.0263579581, 0.0141942464, -0.00539148971,
+    -0.000899386592, 0.00521939434, -0.00796315912, 0.0094498191,
+    -0.00995517708, 0.00972402003, -0.00897387415, 0.00789451879,
+    -0.00664613536, 0.00535796676, -0.00412797881, 0.00302409451,
+    -0.00208679587, 0.00133299269, -0.000760739029, 0.000354223099,
+    -8.87974093e-05, -6.4501146e-05, 0.000135141323, -0.000150253953,
+    0.000132720146, -0.000100215293, 6.50652801e-05, -3.47103814e-05,
+};
+
+// 1:2, quality 5: 2 phases of 80 taps.
+const float kTable1To2Quality5[] = {
+    6.77687831e-06, -1.23543869e-05, 1.85235822e-05, -2.3360848e-05,
+    2.35994758e-05, -1.44313817e-05, -1.05318086e-05, 5.90686504e-05,
+    -0.000139845521, 0.000261562411, -0.000431742228, 0.000655177573,
+    -0.00093211577, 0.0012563304, -0.0016132301, 0.00197831145,
+    -0.00231586234, 0.00257872208, -0.00270878663, 0.0026386464,
+    -0.00229438581, 0.00159944769, -0.00047955598, -0.00113165763,
+    0.00328663224, -0.00601805327, 0.00933353789, -0.0132112531,
+    0.0175974835, -0.0224056095, 0.0275176652, -0.032787919,
+    0.0380488709, -0.0431189202, 0.047811579, -0.0519451313,
+    0.0553540327, -0.0578975342, 0.0594685562, 0.939999998,
+    0.0594685562, -0.0578975342, 0.0553540327, -0.0519451313,
+    0.047811579, -0.0431189202, 0.0380488709, -0.032787919,
+    0.0275176652, -0.0224056095, 0.0175974835, -0.0132112531,
+    0.00933353789, -0.00601805327, 0.00328663224, -0.00113165763,
+    -0.00047955598, 0.00159944769, -0.00229438581, 0.0026386464,
+    -0.00270878663, 0.00257872208, -0.00231586234, 0.00197831145,
+    -0.0016132301, 0.0012563304, -0.00093211577, 0.000655177573,
+    -0.000431742228, 0.000261562411, -0.000139845521, 5.90686504e-05,
+    -1.05318086e-05, -1.44313817e-05, 2.35994758e-05, -2.3360848e-05,
+    1.85235822e-05, -1.23543869e-05, 6.77687831e-06, -2.68787448e-06,
+    -1.95238158e-06, 6.40125427e-06, -1.54635927e-05, 3.1311818e-05,
+    -5.61904017e-05, 9.1948772e-05, -0.000139439639, 0.000197777146,
+    -0.000263515918, 0.0003298503, -0.000385897001, 0.000416276336,
+    -0.000401076482, 0.000316384976, -0.000135366587, -0.000169845414,
+    0.000625564135, -0.00125341816, 0.00206668652, -0.00306626013,
+    0.00423670607, -0.00554274721, 0.00692623621, -0.00830418244,
+    0.00956757553, -0.0105818501, 0.0111880936, -0.0112046795,
+    0.0104287434, -0.00863551535, 0.00557297142, -0.000947305467,
+    -0.0056117042, 0.0146239176, -0.0269227568, 0.0440446995,
+    -0.0692936778, 0.111362047, -0.202424884, 0.633321643,
+    0.633321643, -0.202424884, 0.111362047, -0.0692936778,
+    0.0440446995, -0.0269227568, 0.0146239176, -0.0056117042,
+    -0.000947305467, 0.00557297142, -0.00863551535, 0.0104287434,
+    -0.0112046795, 0.0111880936, -0.0105818501, 0.00956757553,
+    -0.00830418244, 0.00692623621, -0.00554274721, 0.00423670607,
+    -0.00306626013, 0.00206668652, -0.00125341816, 0.000625564135,
+    -0.000169845414, -0.000135366587, 0.000316384976, -0.000401076482,
+    0.000416276336, -0.000385897001, 0.0003298503, -0.000263515918,
+    0.000197777146, -0.000139439639, 9.1948772e-05, -5.61904017e-05,
+    3.1311818e-05, -1.54635927e-05, 6.40125427e-06, -1.95238158e-06,
+};
+
+// 1:3, quality 3: 3 phases of 48 taps.
+const float kTable1To3Quality3[] = {
+    -2.55462201e-05, 0.000100863319, -0.000259486202, 0.000532516337,
+    -0.000937428325, 0.00146290124, -0.00205293158, 0.00259332452,
+    -0.00290520536, 0.00274869404, -0.00183912949, -0.000122978759,
+    0.00341105997, -0.00822512992, 0.014644824, -0.022591114,
+    0.0318041369, -0.0418437906, 0.0521155559, -0.061921306,
+    0.0705289021, -0.0772518814, 0.0815309584, 0.916999996,
+    0.0815309584, -0.0772518814, 0.0705289021, -0.061921306,
+    0.0521155559, -0.0418437906, 0.0318041369, -0.022591114,
+    0.014644824, -0.00822512992, 0.00341105997, -0.000122978759,
+    -0.00183912949, 0.00274869404, -0.00290520536, 0.00259332452,
+    -0.00205293158, 0.00146290124, -0.000937428325, 0.000532516337,
+    -0.000259486202, 0.000100863319, -2.55462201e-05, 7.79471463e-07,
+    -6.31498478e-05, 0.000153345623, -0.000290291006, 0.000461163872,
+    -0.000626633875, 0.000713746296, -0.000614002289, 0.000189377781,
+    0.000712076435, -0.00223040767, 0.00445970148, -0.00740920147,
+    0.0109648611, -0.0148570389, 0.0186376702, -0.0216685403,
+    0.0231130589, -0.0219097584, 0.0166727491, -0.00536799384,
+    -0.0157278515, 0.0559369586, -0.151943341, 0.781856716,
+    0.447262406, -0.186824545, 0.112286694, -0.0721935779,
+    0.0454876423, -0.0263023041, 0.0124034761, -0.00267138681,
+    -0.00365595287, 0.00723828655, -0.00870670844, 0.00866562594,
+    -0.00766659901, 0.0061788694, -0.00456707692, 0.00308273756,
+    -0.00186969305, 0.000980703509, -0.000401484111, 7.67977981e-05,
+    6.57239507e-05, -9.69657267e-05, 7.4553529e-05, -3.77751385e-05,
+    -3.77751385e-05, 7.4553529e-05, -9.69657267e-05, 6.57239507e-05,
+    7.67977981e-05, -0.000401484111, 0.000980703509, -0.00186969305,
+    0.00308273756, -0.00456707692, 0.0061788694, -0.00766659901,
+    0.00866562594, -0.00870670844, 0.00723828655, -0.00365595287,
+    -0.00267138681, 0.0124034761, -0.0263023041, 0.0454876423,
+    -0.0721935779, 0.112286694, -0.18682453, 0.447262347,
+    0.781856775, -0.151943296, 0.0559369586, -0.0157278515,
+    -0.00536799384, 0.0166727491, -0.0219097584, 0.0231130589,
+    -0.0216685403, 0.0186376702, -0.0148570389, 0.0109648611,
+    -0.00740920147, 0.00445970148, -0.00223040767, 0.000712076435,
+    0.000189377781, -0.000614002289, 0.000713746296, -0.000626633875,
+    0.000461163872, -0.000290291006, 0.000153345623, -6.31498478e-05,
+};
+
+// 1:3, quality 4: 3 phases of 64 taps.
+const float kTable1To3Quality4[] = {
+    -2.30558362e-05, 5.98695151e-05, -0.000125067963, 0.000227435303,
+    -0.000374036812, 0.000568111253, -0.000806654687, 0.00107793382,
+    -0.00135919894, 0.00161496026, -0.00179612718, 0.00184036337,
+    -0.00167384103, 0.0012146451, -0.000377504883, -0.000920005084,
+    0.00275031966, -0.00516837602, 0.00820439402, -0.0118572814,
+    0.0160900448, -0.0208269935, 0.0259540305, -0.031321533,
+    0.0367504731, -0.0420410447, 0.0469835587, -0.0513706803,
+    0.0550104119, -0.0577381402, 0.0594277754, 0.939999998,
+    0.0594277754, -0.0577381402, 0.0550104119, -0.0513706803,
+    0.0469835587, -0.0420410447, 0.0367504731, -0.031321533,
+    0.0259540305, -0.0208269935, 0.0160900448, -0.0118572814,
+    0.00820439402, -0.00516837602, 0.00275031966, -0.000920005084,
+    -0.000377504883, 0.0012146451, -0.00167384103, 0.00184036337,
+    -0.00179612718, 0.00161496026, -0.00135919894, 0.00107793382,
+    -0.000806654687, 0.000568111253, -0.000374036812, 0.000227435303,
+    -0.000125067963, 5.98695151e-05, -2.30558362e-05, 5.78570825e-06,
+    -4.17607516e-05, 8.37052867e-05, -0.000141682176, 0.000213069899,
+    -0.00029036359, 0.000359863508, -0.000400741264, 0.000384752755,
+    -0.000276815961, 3.66889326e-05, 0.000378255005, -0.00100904761,
+    0.00189007446, -0.00304341177, 0.00447263569, -0.00615678495,
+    0.00804481376, -0.0100511117, 0.0120521672, -0.0138845397,
+    0.0153436242, -0.0161819234, 0.016104769, -0.0147581054,
+    0.0116997911, -0.00633267546, -0.00225106115, 0.0156570096,
+    -0.037291497, 0.0763205066, -0.169462666, 0.795056105,
+    0.43944189, -0.184924573, 0.116274454, -0.0814810395,
+    0.0590184554, -0.0426922478, 0.0301143657, -0.0201919004,
+    0.01235177, -0.00624680799, 0.00162928866, 0.00170633954,
+    -0.00394970551, 0.00528386328, -0.00588704413, 0.00592956878,
+    -0.00556956185, 0.00494809216, -0.00418555085, 0.00337910908,
+    -0.0026020119, 0.00190437504, -0.00131540175, 0.000846654584,
+    -0.000495894987, 0.000251177524, -9.47567969e-05, 6.47911838e-06,
+    3.34738834e-05, -4.26533879e-05, 3.51953022e-05, -2.13937801e-05,
+    -2.13937801e-05, 3.51953022e-05, -4.26533879e-05, 3.34738834e-05,
+    6.47911838e-06, -9.47567969e-05, 0.000251177524, -0.000495894987,
+    0.000846654584, -0.00131540175, 0.00190437504, -0.0026020119,
+    0.00337910908, -0.00418555085, 0.00494809216, -0.00556956185,
+    0.00592956878, -0.00588704413, 0.00528386328, -0.00394970551,
+    0.00170633954, 0.00162928866, -0.00624680799, 0.01235177,
+    -0.0201919004, 0.0301143657, -0.0426922478, 0.0590184554,
+    -0.0814810395, 0.116274454, -0.184924543, 0.4394418,
+    0.795056164, -0.169462621, 0.0763205066, -0.037291497,
+    0.0156570096, -0.00225106115, -0.00633267546, 0.0116997911,
+    -0.0147581054, 0.016104769, -0.0161819234, 0.0153436242,
+    -0.0138845397, 0.0120521672, -0.0100511117, 0.00804481376,
+    -0.00615678495, 0.00447263569, -0.00304341177, 0.00189007446,
+    -0.00100904761, 0.000378255005, 3.66889326e-05, -0.000276815961,
+    0.000384752755, -0.000400741264, 0.000359863508, -0.00029036359,
+    0.000213069899, -0.000141682176, 8.37052867e-05, -4.17607516e-05,
+};
+
+// 1:3, quality 5: 3 phases of 80 taps.
+const float kTable1To3Quality5[] = {
+    6.77687831e-06, -1.23543869e-05, 1.85235822e-05, -2.3360848e-05,
+    2.35994758e-05, -1.44313817e-05, -1.05318086e-05, 5.90686504e-05,
+    -0.000139845521, 0.000261562411, -0.000431742228, 0.000655177573,
+    -0.00093211577, 0.0012563304, -0.0016132301, 0.00197831145,
+    -0.00231586234, 0.00257872208, -0.00270878663, 0.0026386464,
+    -0.00229438581, 0.00159944769, -0.00047955598, -0.00113165763,
+    0.00328663224, -0.00601805327, 0.00933353789, -0.0132112531,
+    0.0175974835, -0.0224056095, 0.0275176652, -0.032787919,
+    0.0380488709, -0.0431189202, 0.047811579, -0.0519451313,
+    0.0553540327, -0.0578975342, 0.0594685562, 0.939999998,
+    0.0594685562, -0.0578975342, 0.0553540327, -0.0519451313,
+    0.047811579, -0.0431189202, 0.0380488709, -0.032787919,
+    0.0275176652, -0.0224056095, 0.0175974835, -0.0132112531,
+    0.00933353789, -0.00601805327, 0.00328663224, -0.00113165763,
+    -0.00047955598, 0.00159944769, -0.00229438581, 0.0026386464,
+    -0.00270878663, 0.00257872208, -0.00231586234, 0.00197831145,
+    -0.0016132301, 0.0012563304, -0.00093211577, 0.000655177573,
+    -0.000431742228, 0.000261562411, -0.000139845521, 5.90686504e-05,
+    -1.05318086e-05, -1.44313817e-05, 2.35994758e-05, -2.3360848e-05,
+    1.85235822e-05, -1.23543869e-05, 6.77687831e-06, -2.68787448e-06,
+    4.826951e-07, 1.33963943e-06, -6.96592951e-06, 1.90826395e-05,
+    -4.09903769e-05, 7.63291901e-05, -0.000128573432, 0.000200315015,
+    -0.000292353856, 0.000402645237, -0.000525173731, 0.000648900867,
+    -0.000756942958, 0.000826159201, -0.00082725985, 0.000725610764,
+    -0.000482923148, 5.98077604e-05, 0.000580954715, -0.00147034682,
+    0.00262839813, -0.00405950798, 0.00574761396, -0.007651933,
+    0.00970329437, -0.0118014654, 0.0138136465, -0.015573645,
+    0.0168812871, -0.0175005458, 0.0171545353, -0.0155118024,
+    0.0121555636, -0.00651430385, -0.00229634228, 0.0158630349,
+    -0.0375797898, 0.0766082183, -0.16967082, 0.795116007,
+    0.439575374, -0.185278997, 0.116847828, -0.0822451636,
+    0.0599217303, -0.0436650254, 0.0310752653, -0.021055771,
+    0.013037852, -0.00668636011, 0.00177176634, 0.00188899529,
+    -0.00446103932, 0.00610323343, -0.00697224867, 0.00722121354,
+    -0.00699683512, 0.00643517217, -0.00565808918, 0.00477000233,
+    -0.00385595765, 0.00298109069, -0.00219112542, 0.0015140305,
+    -0.000962344639, 0.000536154199, -0.000226361008, 1.77240745e-05,
+    0.00010825722, -0.000170943982, 0.000188672566, -0.00017750058,
+    0.000150462118, -0.00011732128, 8.47052288e-05, -5.65292648e-05,
+    3.45419867e-05, -1.89359944e-05, 8.92656044e-06, -3.24815005e-06,
+    -3.24815005e-06, 8.92656044e-06, -1.89359944e-05, 3.45419867e-05,
+    -5.65292648e-05, 8.47052288e-05, -0.00011732128, 0.000150462118,
+    -0.00017750058, 0.000188672566, -0.000170943982, 0.00010825722,
+    1.77240745e-05, -0.000226361008, 0.000536154199, -0.000962344639,
+    0.0015140305, -0.00219112542, 0.00298109069, -0.00385595765,
+    0.00477000233, -0.00565808918, 0.00643517217, -0.00699683512,
+    0.00722121354, -0.00697224867, 0.00610323343, -0.00446103932,
+    0.00188899529, 0.00177176634, -0.00668636011, 0.013037852,
+    -0.021055771, 0.0310752653, -0.0436650254, 0.0599217303,
+    -0.0822451636, 0.116847828, -0.185278967, 0.439575315,
+    0.795116007, -0.169670776, 0.0766082183, -0.0375797898,
+    0.0158630349, -0.00229634228, -0.00651430385, 0.0121555636,
+    -0.0155118024, 0.0171545353, -0.0175005458, 0.0168812871,
+    -0.015573645, 0.0138136465, -0.0118014654, 0.00970329437,
+    -0.007651933, 0.00574761396, -0.00405950798, 0.00262839813,
+    -0.00147034682, 0.000580954715, 5.98077604e-05, -0.000482923148,
+    0.000725610764, -0.00082725985, 0.000826159201, -0.000756942958,
+    0.000648900867, -0.000525173731, 0.000402645237, -0.000292353856,
+    0.000200315015, -0.000128573432, 7.63291901e-05, -4.09903769e-05,
+    1.90826395e-05, -6.96592951e-06, 1.33963943e-06, 4.826951e-07,
+};
+
+// 1:6, quality 3: 6 phases of 48 taps.
+const float kTable1To6Quality3[] = {
+    -2.55462201e-05, 0.000100863319, -0.000259486202, 0.000532516337,
+    -0.000937428325, 0.00146290124, -0.00205293158, 0.00259332452,
+    -0.00290520536, 0.00274869404, -0.00183912949, -0.000122978759,
+    0.00341105997, -0.00822512992, 0.014644824, -0.022591114,
+    0.0318041369, -0.0418437906, 0.0521155559, -0.061921306,
+    0.0705289021, -0.0772518814, 0.0815309584, 0.916999996,
+    0.0815309584, -0.0772518814, 0.0705289021, -0.061921306,
+    0.0521155559, -0.0418437906, 0.0318041369, -0.022591114,
+    0.014644824, -0.00822512992, 0.00341105997, -0.000122978759,
+    -0.00183912949, 0.00274869404, -0.00290520536, 0.00259332452,
+    -0.00205293158, 0.00146290124, -0.000937428325, 0.000532516337,
+    -0.000259486202, 0.000100863319, -2.55462201e-05, 7.79471463e-07,
+    -5.41041845e-05, 0.000148058491, -0.00031347305, 0.000559278589,
+    -0.000871736382, 0.0012021584, -0.00145723543, 0.00149524619,
+    -0.00113139616, 0.00015469089, 0.0016436266, -0.0044314824,
+    0.00829147082, -0.0131759495, 0.0188675188, -0.024949912,
+    0.0307878535, -0.0355058014, 0.0379300602, -0.0363891646,
+    0.0280152634, -0.00589235732, -0.0588550307, 0.882009447,
+    0.256649822, -0.143090576, 0.10158883, -0.0753502101,
+    0.0552256592, -0.0388061292, 0.0253742039, -0.0146919675,
+    0.00660574809, -0.000906704518, -0.00270516984, 0.00460693846,
+    -0.00521607278, 0.00494683674, -0.00417112838, 0.00319056748,
+    -0.0022223324, 0.00139883545, -0.000778879737, 0.000365528336,
+    -0.000126694227, 1.44025744e-05, 2.01424264e-05, -1.69383893e-05,
+    -6.31498478e-05, 0.000153345623, -0.000290291006, 0.000461163872,
+    -0.000626633875, 0.000713746296, -0.000614002289, 0.000189377781,
+    0.000712076435, -0.00223040767, 0.00445970148, -0.00740920147,
+    0.0109648611, -0.0148570389, 0.0186376702, -0.0216685403,
+    0.0231130589, -0.0219097584, 0.0166727491, -0.00536799384,
+    -0.0157278515, 0.0559369586, -0.151943341, 0.781856716,
+    0.447262406, -0.186824545, 0.112286694, -0.0721935779,
+    0.0454876423, -0.0263023041, 0.0124034761, -0.00267138681,
+    -0.00365595287, 0.00723828655, -0.00870670844, 0.00866562594,
+    -0.00766659901, 0.0061788694, -0.00456707692, 0.00308273756,
+    -0.00186969305, 0.000980703509, -0.000401484111, 7.67977981e-05,
+    6.57239507e-05, -9.69657267e-05, 7.4553529e-05, -3.77751385e-05,
+    -5.56055857e-05, 0.000124210739, -0.00020860153, 0.000278921216,
+    -0.000280493317, 0.000132974586, 0.00026393286, -0.0010165167,
+    0.00221492327, -0.00390401552, 0.00605115714, -0.00851545297,
+    0.0110230874, -0.0131545104, 0.0143441595, -0.0138897803,
+    0.0109615317, -0.00458457274, -0.00646224432, 0.0239769984,
+    -0.0513535291, 0.0971789882, -0.193332121, 0.630190849,
+    0.630190849, -0.193332121, 0.0971789882, -0.0513535291,
+    0.0239769984, -0.00646224432, -0.00458457274, 0.0109615317,
+    -0.0138897803, 0.0143441595, -0.0131545104, 0.0110230874,
+    -0.00851545297, 0.00605115714, -0.00390401552, 0.00221492327,
+    -0.0010165167, 0.00026393286, 0.000132974586, -0.000280493317,
+    0.000278921216, -0.00020860153, 0.000124210739, -5.56055857e-05,
+    -3.77751385e-05, 7.4553529e-05, -9.69657267e-05, 6.57239507e-05,
+    7.67977981e-05, -0.000401484111, 0.000980703509, -0.00186969305,
+    0.00308273756, -0.00456707692, 0.0061788694, -0.00766659901,
+    0.00866562594, -0.00870670844, 0.00723828655, -0.00365595287,
+    -0.00267138681, 0.0124034761, -0.0263023041, 0.0454876423,
+    -0.0721935779, 0.112286694, -0.18682453, 0.447262347,
+    0.781856775, -0.151943296, 0.0559369586, -0.0157278515,
+    -0.00536799384, 0.0166727491, -0.0219097584, 0.0231130589,
+    -0.0216685403, 0.0186376702, -0.0148570389, 0.0109648611,
+    -0.00740920147, 0.00445970148, -0.00223040767, 0.000712076435,
+    0.000189377781, -0.000614002289, 0.000713746296, -0.000626633875,
+    0.000461163872, -0.000290291006, 0.000153345623, -6.31498478e-05,
+    -1.69383893e-05, 2.01424264e-05, 1.44025744e-05, -0.000126694227,
+    0.000365528336, -0.000778879737, 0.00139883545, -0.0022223324,
+    0.00319056748, -0.00417112838, 0.00494683674, -0.00521607278,
+    0.00460693846, -0.00270516984, -0.000906704518, 0.00660574809,
+    -0.0146919675, 0.0253742039, -0.0388061292, 0.0552256592,
+    -0.0753502101, 0.10158883, -0.143090621, 0.256649822,
+    0.882009447, -0.0588551201, -0.00589235732, 0.0280152634,
+    -0.0363891646, 0.0379300602, -0.0355058014, 0.0307878535,
+    -0.024949912, 0.0188675188, -0.0131759495, 0.00829147082,
+    -0.0044314824, 0.0016436266, 0.00015469089, -0.00113139616,
+    0.00149524619, -0.00145723543, 0.0012021584, -0.000871736382,
+    0.000559278589, -0.00031347305, 0.000148058491, -5.41041845e-05,
+};
+
+// 1:6, quality 4: 6 phases of 64 taps.
+const float kTable1To6Quality4[] = {
+    -2.30558362e-05, 5.98695151e-05, -0.000125067963, 0.000227435303,
+    -0.000374036812, 0.000568111253, -0.000806654687, 0.00107793382,
+    -0.00135919894, 0.00161496026, -0.00179612718, 0.00184036337,
+    -0.00167384103, 0.0012146451, -0.000377504883, -0.000920005084,
+    0.00275031966, -0.00516837602, 0.00820439402, -0.0118572814,
+    0.0160900448, -0.0208269935, 0.0259540305, -0.031321533,
+    0.0367504731, -0.0420410447, 0.0469835587, -0.0513706803,
+    0.0550104119, -0.0577381402, 0.0594277754, 0.939999998,
+    0.0594277754, -0.0577381402, 0.0550104119, -0.0513706803,
+    0.0469835587, -0.0420410447, 0.0367504731, -0.031321533,
+    0.0259540305, -0.0208269935, 0.0160900448, -0.0118572814,
+    0.00820439402, -0.00516837602, 0.00275031966, -0.000920005084,
+    -0.000377504883, 0.0012146451, -0.00167384103, 0.00184036337,
+    -0.00179612718, 0.00161496026, -0.00135919894, 0.00107793382,
+    -0.000806654687, 0.000568111253, -0.000374036812, 0.000227435303,
+    -0.000125067963, 5.98695151e-05, -2.30558362e-05, 5.78570825e-06,
+    -3.85026069e-05, 8.33021259e-05, -0.000152783847, 0.000250158395,
+    -0.000374868308, 0.000520677655, -0.000673815259, 0.000811440754,
+    -0.000900722574, 0.000898854807, -0.000754177105, 0.000408648542,
+    0.000198238064, -0.00112440577, 0.00241892808, -0.00411515497,
+    0.0062235482, -0.00872480497, 0.0115639707, -0.0146453632,
+    0.0178290475, -0.0209279172, 0.0237045214, -0.0258643925,
+    0.0270400345, -0.0267513525, 0.0243078675, -0.018552551,
+    0.00709639909, 0.0165982097, -0.0811843798, 0.902412355,
+    0.239773139, -0.130993128, 0.0950422212, -0.0745732263,
+    0.059882924, -0.0480757616, 0.038072411, -0.0294328276,
+    0.0219726209, -0.0156102711, 0.0102980323, -0.00598880416,
+    0.002621477, -0.000115832023, -0.00162656559, 0.00271768146,
+    -0.00327699282, 0.00342456065, -0.0032746275, 0.00293022371,
+    -0.0024791765, 0.00199186918, -0.00152051088, 0.00109993538,
+    -0.000749539759, 0.00047602097, -0.000276518491, 0.000141812838,
+    -5.92440811e-05, 1.51718323e-05, 3.18203365e-06, -6.54451969e-06,
+    -4.17607516e-05, 8.37052867e-05, -0.000141682176, 0.000213069899,
+    -0.00029036359, 0.000359863508, -0.000400741264, 0.000384752755,
+    -0.000276815961, 3.66889326e-05, 0.000378255005, -0.00100904761,
+    0.00189007446, -0.00304341177, 0.00447263569, -0.00615678495,
+    0.00804481376, -0.0100511117, 0.0120521672, -0.0138845397,
+    0.0153436242, -0.0161819234, 0.016104769, -0.0147581054,
+    0.0116997911, -0.00633267546, -0.00225106115, 0.0156570096,
+    -0.037291497, 0.0763205066, -0.169462666, 0.795056105,
+    0.43944189, -0.184924573, 0.116274454, -0.0814810395,
+    0.0590184554, -0.0426922478, 0.0301143657, -0.0201919004,
+    0.01235177, -0.00624680799, 0.00162928866, 0.00170633954,
+    -0.00394970551, 0.00528386328, -0.00588704413, 0.00592956878,
+    -0.00556956185, 0.00494809216, -0.00418555085, 0.00337910908,
+    -0.0026020119, 0.00190437504, -0.00131540175, 0.000846654584,
+    -0.000495894987, 0.000251177524, -9.47567969e-05, 6.47911838e-06,
+    3.34738834e-05, -4.26533879e-05, 3.51953022e-05, -2.13937801e-05,
+    -3.47103814e-05, 6.50652801e-05, -0.000100215293, 0.000132720146,
+    -0.000150253953, 0.000135141323, -6.4501146e-05, -8.87974093e-05,
+    0.000354223099, -0.000760739029, 0.00133299269, -0.00208679587,
+    0.00302409451, -0.00412797881, 0.00535796676, -0.00664613536,
+    0.00789451879, -0.00897387415, 0.00972402003, -0.00995517708,
+    0.0094498191, -0.00796315912, 0.00521939434, -0.000899386592,
+    -0.00539148971, 0.0141942464, -0.0263579581, 0.0434275717,
+    -0.068707332, 0.11088156, -0.202110976, 0.633213758,
+    0.633213758, -0.202110976, 0.11088156, -0.068707332,
+    0.0434275717, -0.0263579581, 0.0141942464, -0.00539148971,
+    -0.000899386592, 0.00521939434, -0.00796315912, 0.0094498191,
+    -0.00995517708, 0.00972402003, -0.00897387415, 0.00789451879,
+    -0.00664613536, 0.00535796676, -0.00412797881, 0.00302409451,
+    -0.00208679587, 0.00133299269, -0.000760739029, 0.000354223099,
+    -8.87974093e-05, -6.4501146e-05, 0.000135141323, -0.000150253953,
+    0.000132720146, -0.000100215293, 6.50652801e-05, -3.47103814e-05,
+    -2.13937801e-05, 3.51953022e-05, -4.26533879e-05, 3.34738834e-05,
+    6.47911838e-06, -9.47567969e-05, 0.000251177524, -0.000495894987,
+    0.000846654584, -0.00131540175, 0.00190437504, -0.0026020119,
+    0.00337910908, -0.00418555085, 0.00494809216, -0.00556956185,
+    0.00592956878, -0.00588704413, 0.00528386328, -0.00394970551,
+    0.00170633954, 0.00162928866, -0.00624680799, 0.01235177,
+    -0.0201919004, 0.0301143657, -0.0426922478, 0.0590184554,
+    -0.0814810395, 0.116274454, -0.184924543, 0.4394418,
+    0.795056164, -0.169462621, 0.0763205066, -0.037291497,
+    0.0156570096, -0.00225106115, -0.00633267546, 0.0116997911,
+    -0.0147581054, 0.016104769, -0.0161819234, 0.0153436242,
+    -0.0138845397, 0.0120521672, -0.0100511117, 0.00804481376,
+    -0.00615678495, 0.00447263569, -0.00304341177, 0.00189007446,
+    -0.00100904761, 0.000378255005, 3.66889326e-05, -0.000276815961,
+    0.000384752755, -0.000400741264, 0.000359863508, -0.00029036359,
+    0.000213069899, -0.000141682176, 8.37052867e-05, -4.17607516e-05,
+    -6.54451969e-06, 3.18203365e-06, 1.51718323e-05, -5.92440811e-05,
+    0.000141812838, -0.000276518491, 0.00047602097, -0.000749539759,
+    0.00109993538, -0.00152051088, 0.00199186918, -0.0024791765,
+    0.00293022371, -0.0032746275, 0.00342456065, -0.00327699282,
+    0.00271768146, -0.00162656559, -0.000115832023, 0.002621477,
+    -0.00598880416, 0.0102980323, -0.0156102711, 0.0219726209,
+    -0.0294328276, 0.038072411, -0.0480757616, 0.059882924,
+    -0.0745732263, 0.0950422212, -0.130993187, 0.239773139,
+    0.902412355, -0.0811844692, 0.0165982097, 0.00709639909,
+    -0.018552551, 0.0243078675, -0.0267513525, 0.0270400345,
+    -0.0258643925, 0.0237045214, -0.0209279172, 0.0178290475,
+    -0.0146453632, 0.0115639707, -0.00872480497, 0.0062235482,
+    -0.00411515497, 0.00241892808, -0.00112440577, 0.000198238064,
+    0.000408648542, -0.000754177105, 0.000898854807, -0.000900722574,
+    0.000811440754, -0.000673815259, 0.000520677655, -0.000374868308,
+    0.000250158395, -0.000152783847, 8.33021259e-05, -3.85026069e-05,
+};
+
+// 1:6, quality 5: 6 phases of 80 taps.
+const float kTable1To6Quality5[] = {
+    6.77687831e-06, -1.23543869e-05, 1.85235822e-05, -2.3360848e-05,
+    2.35994758e-05, -1.44313817e-05, -1.05318086e-05, 5.90686504e-05,
+    -0.000139845521, 0.000261562411, -0.000431742228, 0.000655177573,
+    -0.00093211577, 0.0012563304, -0.0016132301, 0.00197831145,
+    -0.00231586234, 0.00257872208, -0.00270878663, 0.0026386464,
+    -0.00229438581, 0.00159944769, -0.00047955598, -0.00113165763,
+    0.00328663224, -0.00601805327, 0.00933353789, -0.0132112531,
+    0.0175974835, -0.0224056095, 0.0275176652, -0.032787919,
+    0.0380488709, -0.0431189202, 0.047811579, -0.0519451313,
+    0.0553540327, -0.0578975342, 0.0594685562, 0.939999998,
+    0.0594685562, -0.0578975342, 0.0553540327, -0.0519451313,
+    0.047811579, -0.0431189202, 0.0380488709, -0.032787919,
+    0.0275176652, -0.0224056095, 0.0175974835, -0.0132112531,
+    0.00933353789, -0.00601805327, 0.00328663224, -0.00113165763,
+    -0.00047955598, 0.00159944769, -0.00229438581, 0.0026386464,
+    -0.00270878663, 0.00257872208, -0.00231586234, 0.00197831145,
+    -0.0016132301, 0.0012563304, -0.00093211577, 0.000655177573,
+    -0.000431742228, 0.000261562411, -0.000139845521, 5.90686504e-05,
+    -1.05318086e-05, -1.44313817e-05, 2.35994758e-05, -2.3360848e-05,
+    1.85235822e-05, -1.23543869e-05, 6.77687831e-06, -2.68787448e-06,
+    3.65211099e-06, -5.42671251e-06, 5.23695553e-06, -4.68506244e-07,
+    -1.25794768e-05, 3.86335523e-05, -8.31880971e-05, 0.000151981643,
+    -0.00025019038, 0.000381360238, -0.000546090305, 0.000740571297,
+    -0.000955118041, 0.00117286085, -0.00136880856, 0.00150937482,
+    -0.00155271252, 0.00145001977, -0.00114770117, 0.00059061998,
+    0.000273677782, -0.00149009458, 0.00309044169, -0.00508787157,
+    0.00747145899, -0.0102011971, 0.0132042421, -0.0163717568,
+    0.0195569359, -0.0225730389, 0.0251904391, -0.0271295793,
+    0.0280436948, -0.027477311, 0.0247660074, -0.0187779553,
+    0.00714584906, 0.0166520774, -0.0812606364, 0.902429044,
+    0.239887193, -0.131296903, 0.0955714956, -0.0753384009,
+    0.0608675554, -0.0492386706, 0.0393514372, -0.030750636,
+    0.0232441146, -0.0167505778, 0.0112303356, -0.00665103039,
+    0.00297144032, -0.000134328264, -0.00193497655, 0.0033260975,
+    -0.00413954165, 0.00448127417, -0.00445724791, 0.00416835677,
+    -0.00370594789, 0.00314882142, -0.00256126164, 0.00199233857,
+    -0.00147633615, 0.00103396876, -0.000674455659, 0.000397913944,
+    -0.000197815287, 6.34144162e-05, 1.81060459e-05, -5.98932202e-05,
+    7.41249532e-05, -7.11734538e-05, 5.91847675e-05, -4.40195981e-05,
+    2.94450329e-05, -1.74857196e-05, 8.8558354e-06, -3.39506937e-06,
+    4.826951e-07, 1.33963943e-06, -6.96592951e-06, 1.90826395e-05,
+    -4.09903769e-05, 7.63291901e-05, -0.000128573432, 0.000200315015,
+    -0.000292353856, 0.000402645237, -0.000525173731, 0.000648900867,
+    -0.000756942958, 0.000826159201, -0.00082725985, 0.000725610764,
+    -0.000482923148, 5.98077604e-05, 0.000580954715, -0.00147034682,
+    0.00262839813, -0.00405950798, 0.00574761396, -0.007651933,
+    0.00970329437, -0.0118014654, 0.0138136465, -0.015573645,
+    0.0168812871, -0.0175005458, 0.0171545353, -0.0155118024,
+    0.0121555636, -0.00651430385, -0.00229634228, 0.0158630349,
+    -0.0375797898, 0.0766082183, -0.16967082, 0.795116007,
+    0.439575374, -0.185278997, 0.116847828, -0.0822451636,
+    0.0599217303, -0.0436650254, 0.0310752653, -0.021055771,
+    0.013037852, -0.00668636011, 0.00177176634, 0.00188899529,
+    -0.00446103932, 0.00610323343, -0.00697224867, 0.00722121354,
+    -0.00699683512, 0.00643517217, -0.00565808918, 0.00477000233,
+    -0.00385595765, 0.00298109069, -0.00219112542, 0.0015140305,
+    -0.000962344639, 0.000536154199, -0.000226361008, 1.77240745e-05,
+    0.00010825722, -0.000170943982, 0.000188672566, -0.00017750058,
+    0.000150462118, -0.00011732128, 8.47052288e-05, -5.65292648e-05,
+    3.45419867e-05, -1.89359944e-05, 8.92656044e-06, -3.24815005e-06,
+    -1.95238158e-06, 6.40125427e-06, -1.54635927e-05, 3.1311818e-05,
+    -5.61904017e-05, 9.1948772e-05, -0.000139439639, 0.000197777146,
+    -0.000263515918, 0.0003298503, -0.000385897001, 0.000416276336,
+    -0.000401076482, 0.000316384976, -0.000135366587, -0.000169845414,
+    0.000625564135, -0.00125341816, 0.00206668652, -0.00306626013,
+    0.00423670607, -0.00554274721, 0.00692623621, -0.00830418244,
+    0.00956757553, -0.0105818501, 0.0111880936, -0.0112046795,
+    0.0104287434, -0.00863551535, 0.00557297142, -0.000947305467,
+    -0.0056117042, 0.0146239176, -0.0269227568, 0.0440446995,
+    -0.0692936778, 0.111362047, -0.202424884, 0.633321643,
+    0.633321643, -0.202424884, 0.111362047, -0.0692936778,
+    0.0440446995, -0.0269227568, 0.0146239176, -0.0056117042,
+    -0.000947305467, 0.00557297142, -0.00863551535, 0.0104287434,
+    -0.0112046795, 0.0111880936, -0.0105818501, 0.00956757553,
+    -0.00830418244, 0.00692623621, -0.00554274721, 0.00423670607,
+    -0.00306626013, 0.00206668652, -0.00125341816, 0.000625564135,
+    -0.000169845414, -0.000135366587, 0.000316384976, -0.000401076482,
+    0.000416276336, -0.000385897001, 0.0003298503, -0.000263515918,
+    0.000197777146, -0.000139439639, 9.1948772e-05, -5.61904017e-05,
+    3.1311818e-05, -1.54635927e-05, 6.40125427e-06, -1.95238158e-06,
+    -3.24815005e-06, 8.92656044e-06, -1.89359944e-05, 3.45419867e-05,
+    -5.65292648e-05, 8.47052288e-05, -0.00011732128, 0.000150462118,
+    -0.00017750058, 0.000188672566, -0.000170943982, 0.00010825722,
+    1.77240745e-05, -0.000226361008, 0.000536154199, -0.000962344639,
+    0.0015140305, -0.00219112542, 0.00298109069, -0.00385595765,
+    0.00477000233, -0.00565808918, 0.00643517217, -0.00699683512,
+    0.00722121354, -0.00697224867, 0.00610323343, -0.00446103932,
+    0.00188899529, 0.00177176634, -0.00668636011, 0.013037852,
+    -0.021055771, 0.0310752653, -0.0436650254, 0.0599217303,
+    -0.0822451636, 0.116847828, -0.185278967, 0.439575315,
+    0.795116007, -0.169670776, 0.0766082183, -0.0375797898,
+    0.0158630349, -0.00229634228, -0.00651430385, 0.0121555636,
+    -0.0155118024, 0.0171545353, -0.0175005458, 0.0168812871,
+    -0.015573645, 0.0138136465, -0.0118014654, 0.00970329437,
+    -0.007651933, 0.00574761396, -0.00405950798, 0.00262839813,
+    -0.00147034682, 0.000580954715, 5.98077604e-05, -0.000482923148,
+    0.000725610764, -0.00082725985, 0.000826159201, -0.000756942958,
+    0.000648900867, -0.000525173731, 0.000402645237, -0.000292353856,
+    0.000200315015, -0.000128573432, 7.63291901e-05, -4.09903769e-05,
+    1.90826395e-05, -6.96592951e-06, 1.33963943e-06, 4.826951e-07,
+    -3.39506937e-06, 8.8558354e-06, -1.74857196e-05, 2.94450329e-05,
+    -4.40195981e-05, 5.91847675e-05, -7.11734538e-05, 7.41249532e-05,
+    -5.98932202e-05, 1.81060459e-05, 6.34144162e-05, -0.000197815287,
+    0.000397913944, -0.000674455659, 0.00103396876, -0.00147633615,
+    0.00199233857, -0.00256126164, 0.00314882142, -0.00370594789,
+    0.00416835677, -0.00445724791, 0.00448127417, -0.00413954165,
+    0.0033260975, -0.00193497655, -0.000134328264, 0.00297144032,
+    -0.00665103039, 0.0112303356, -0.0167505778, 0.0232441146,
+    -0.030750636, 0.0393514372, -0.0492386706, 0.0608675554,
+    -0.0753384009, 0.0955714956, -0.131296962, 0.239887193,
+    0.902429044, -0.0812607259, 0.0166520774, 0.00714584906,
+    -0.0187779553, 0.0247660074, -0.027477311, 0.0280436948,
+    -0.0271295793, 0.0251904391, -0.0225730389, 0.0195569359,
+    -0.0163717568, 0.0132042421, -0.0102011971, 0.00747145899,
+    -0.00508787157, 0.00309044169, -0.00149009458, 0.000273677782,
+    0.00059061998, -0.00114770117, 0.00145001977, -0.00155271252,
+    0.00150937482, -0.00136880856, 0.00117286085, -0.000955118041,
+    0.000740571297, -0.000546090305, 0.000381360238, -0.00025019038,
+    0.000151981643, -8.31880971e-05, 3.86335523e-05, -1.25794768e-05,
+    -4.68506244e-07, 5.23695553e-06, -5.42671251e-06, 3.65211099e-06,
+};
+
+// 2:3, quality 3: 3 phases of 48 taps.
+const float kTable2To3Quality3[] = {
+    -2.55462201e-05, 0.000100863319, -0.000259486202, 0.000532516337,
+    -0.000937428325, 0.00146290124, -0.00205293158, 0.00259332452,
+    -0.00290520536, 0.00274869404, -0.00183912949, -0.000122978759,
+    0.00341105997, -0.00822512992, 0.014644824, -0.022591114,
+    0.0318041369, -0.0418437906, 0.0521155559, -0.061921306,
+    0.0705289021, -0.0772518814, 0.0815309584, 0.916999996,
+    0.0815309584, -0.0772518814, 0.0705289021, -0.061921306,
+    0.0521155559, -0.0418437906, 0.0318041369, -0.022591114,
+    0.014644824, -0.00822512992, 0.00341105997, -0.000122978759,
+    -0.00183912949, 0.00274869404, -0.00290520536, 0.00259332452,
+    -0.00205293158, 0.00146290124, -0.000937428325, 0.000532516337,
+    -0.000259486202, 0.000100863319, -2.55462201e-05, 7.79471463e-07,
+    -6.31498478e-05, 0.000153345623, -0.000290291006, 0.000461163872,
+    -0.000626633875, 0.000713746296, -0.000614002289, 0.000189377781,
+    0.000712076435, -0.00223040767, 0.00445970148, -0.00740920147,
+    0.0109648611, -0.0148570389, 0.0186376702, -0.0216685403,
+    0.0231130589, -0.0219097584, 0.0166727491, -0.00536799384,
+    -0.0157278515, 0.0559369586, -0.151943341, 0.781856716,
+    0.447262406, -0.186824545, 0.112286694, -0.0721935779,
+    0.0454876423, -0.0263023041, 0.0124034761, -0.00267138681,
+    -0.00365595287, 0.00723828655, -0.00870670844, 0.00866562594,
+    -0.00766659901, 0.0061788694, -0.00456707692, 0.00308273756,
+    -0.00186969305, 0.000980703509, -0.000401484111, 7.67977981e-05,
+    6.57239507e-05, -9.69657267e-05, 7.4553529e-05, -3.77751385e-05,
+    -3.77751385e-05, 7.4553529e-05, -9.69657267e-05, 6.57239507e-05,
+    7.67977981e-05, -0.000401484111, 0.000980703509, -0.00186969305,
+    0.00308273756, -0.00456707692, 0.0061788694, -0.00766659901,
+    0.00866562594, -0.00870670844, 0.00723828655, -0.00365595287,
+    -0.00267138681, 0.0124034761, -0.0263023041, 0.0454876423,
+    -0.0721935779, 0.112286694, -0.18682453, 0.447262347,
+    0.781856775, -0.151943296, 0.0559369586, -0.0157278515,
+    -0.00536799384, 0.0166727491, -0.0219097584, 0.0231130589,
+    -0.0216685403, 0.0186376702, -0.0148570389, 0.0109648611,
+    -0.00740920147, 0.00445970148, -0.00223040767, 0.000712076435,
+    0.000189377781, -0.000614002289, 0.000713746296, -0.000626633875,
+    0.000461163872, -0.000290291006, 0.000153345623, -6.31498478e-05,
+};
+
+// 2:3, quality 4: 3 phases of 64 taps.
+const float kTable2To3Quality4[] = {
+    -2.30558362e-05, 5.98695151e-05, -0.000125067963, 0.000227435303,
+    -0.000374036812, 0.000568111253, -0.000806654687, 0.00107793382,
+    -0.00135919894, 0.00161496026, -0.00179612718, 0.00184036337,
+    -0.00167384103, 0.0012146451, -0.000377504883, -0.000920005084,
+    0.00275031966, -0.00516837602, 0.00820439402, -0.0118572814,
+    0.0160900448, -0.0208269935, 0.0259540305, -0.031321533,
+    0.0367504731, -0.0420410447, 0.0469835587, -0.0513706803,
+    0.0550104119, -0.0577381402, 0.0594277754, 0.939999998,
+    0.0594277754, -0.0577381402, 0.0550104119, -0.0513706803,
+    0.0469835587, -0.0420410447, 0.0367504731, -0.031321533,
+    0.0259540305, -0.0208269935, 0.0160900448, -0.0118572814,
+    0.00820439402, -0.00516837602, 0.00275031966, -0.000920005084,
+    -0.000377504883, 0.0012146451, -0.00167384103, 0.00184036337,
+    -0.00179612718, 0.00161496026, -0.00135919894, 0.00107793382,
+    -0.000806654687, 0.000568111253, -0.000374036812, 0.000227435303,
+    -0.000125067963, 5.98695151e-05, -2.30558362e-05, 5.78570825e-06,
+    -4.17607516e-05, 8.37052867e-05, -0.000141682176, 0.000213069899,
+    -0.00029036359, 0.000359863508, -0.000400741264, 0.000384752755,
+    -0.000276815961, 3.66889326e-05, 0.000378255005, -0.00100904761,
+    0.00189007446, -0.00304341177, 0.00447263569, -0.00615678495,
+    0.00804481376, -0.0100511117, 0.0120521672, -0.0138845397,
+    0.0153436242, -0.0161819234, 0.016104769, -0.0147581054,
+    0.0116997911, -0.00633267546, -0.00225106115, 0.0156570096,
+    -0.037291497, 0.0763205066, -0.169462666, 0.795056105,
+    0.43944189, -0.184924573, 0.116274454, -0.0814810395,
+    0.0590184554, -0.0426922478, 0.0301143657, -0.0201919004,
+    0.01235177, -0.00624680799, 0.00162928866, 0.00170633954,
+    -0.00394970551, 0.00528386328, -0.00588704413, 0.00592956878,
+    -0.00556956185, 0.00494809216, -0.00418555085, 0.00337910908,
+    -0.0026020119, 0.00190437504, -0.00131540175, 0.000846654584,
+    -0.000495894987, 0.000251177524, -9.47567969e-05, 6.47911838e-06,
+    3.34738834e-05, -4.26533879e-05, 3.51953022e-05, -2.13937801e-05,
+    -2.13937801e-05, 3.51953022e-05, -4.26533879e-05, 3.34738834e-05,
+    6.47911838e-06, -9.47567969e-05, 0.000251177524, -0.000495894987,
+    0.000846654584, -0.00131540175, 0.00190437504, -0.0026020119,
+    0.00337910908, -0.00418555085, 0.00494809216, -0.00556956185,
+    0.00592956878, -0.00588704413, 0.00528386328, -0.00394970551,
+    0.00170633954, 0.00162928866, -0.00624680799, 0.01235177,
+    -0.0201919004, 0.0301143657, -0.0426922478, 0.0590184554,
+    -0.0814810395, 0.116274454, -0.184924543, 0.4394418,
+    0.795056164, -0.169462621, 0.0763205066, -0.037291497,
+    0.0156570096, -0.00225106115, -0.00633267546, 0.0116997911,
+    -0.0147581054, 0.016104769, -0.0161819234, 0.0153436242,
+    -0.0138845397, 0.0120521672, -0.0100511117, 0.00804481376,
+    -0.00615678495, 0.00447263569, -0.00304341177, 0.00189007446,
+    -0.00100904761, 0.000378255005, 3.66889326e-05, -0.000276815961,
+    0.000384752755, -0.000400741264, 0.000359863508, -0.00029036359,
+    0.000213069899, -0.000141682176, 8.37052867e-05, -4.17607516e-05,
+};
+
+// 2:3, quality 5: 3 phases of 80 taps.
+const float kTable2To3Quality5[] = {
+    6.77687831e-06, -1.23543869e-05, 1.85235822e-05, -2.3360848e-05,
+    2.35994758e-05, -1.44313817e-05, -1.05318086e-05, 5.90686504e-05,
+    -0.000139845521, 0.000261562411, -0.000431742228, 0.000655177573,
+    -0.00093211577, 0.0012563304, -0.0016132301, 0.00197831145,
+    -0.00231586234, 0.00257872208, -0.00270878663, 0.0026386464,
+    -0.00229438581, 0.00159944769, -0.00047955598, -0.00113165763,
+    0.00328663224, -0.00601805327, 0.00933353789, -0.0132112531,
+    0.0175974835, -0.0224056095, 0.0275176652, -0.032787919,
+    0.0380488709, -0.0431189202, 0.047811579, -0.0519451313,
+    0.0553540327, -0.0578975342, 0.0594685562, 0.939999998,
+    0.0594685562, -0.0578975342, 0.0553540327, -0.0519451313,
+    0.047811579, -0.0431189202, 0.0380488709, -0.032787919,
+    0.0275176652, -0.0224056095, 0.0175974835, -0.0132112531,
+    0.00933353789, -0.00601805327, 0.00328663224, -0.00113165763,
+    -0.00047955598, 0.00159944769, -0.00229438581, 0.0026386464,
+    -0.00270878663, 0.00257872208, -0.00231586234, 0.00197831145,
+    -0.0016132301, 0.0012563304, -0.00093211577, 0.000655177573,
+    -0.000431742228, 0.000261562411, -0.000139845521, 5.90686504e-05,
+    -1.05318086e-05, -1.44313817e-05, 2.35994758e-05, -2.3360848e-05,
+    1.85235822e-05, -1.23543869e-05, 6.77687831e-06, -2.68787448e-06,
+    4.826951e-07, 1.33963943e-06, -6.96592951e-06, 1.90826395e-05,
+    -4.09903769e-05, 7.63291901e-05, -0.000128573432, 0.000200315015,
+    -0.000292353856, 0.000402645237, -0.000525173731, 0.000648900867,
+    -0.000756942958, 0.000826159201, -0.00082725985, 0.000725610764,
+    -0.000482923148, 5.98077604e-05, 0.000580954715, -0.00147034682,
+    0.00262839813, -0.00405950798, 0.00574761396, -0.007651933,
+    0.00970329437, -0.0118014654, 0.0138136465, -0.015573645,
+    0.0168812871, -0.0175005458, 0.0171545353, -0.0155118024,
+    0.0121555636, -0.00651430385, -0.00229634228, 0.0158630349,
+    -0.0375797898, 0.0766082183, -0.16967082, 0.795116007,
+    0.439575374, -0.185278997, 0.116847828, -0.0822451636,
+    0.0599217303, -0.0436650254, 0.0310752653, -0.021055771,
+    0.013037852, -0.00668636011, 0.00177176634, 0.00188899529,
+    -0.00446103932, 0.00610323343, -0.00697224867, 0.00722121354,
+    -0.00699683512, 0.00643517217, -0.00565808918, 0.00477000233,
+    -0.00385595765, 0.00298109069, -0.00219112542, 0.0015140305,
+    -0.000962344639, 0.000536154199, -0.000226361008, 1.77240745e-05,
+    0.00010825722, -0.000170943982, 0.000188672566, -0.00017750058,
+    0.000150462118, -0.00011732128, 8.47052288e-05, -5.65292648e-05,
+    3.45419867e-05, -1.89359944e-05, 8.92656044e-06, -3.24815005e-06,
+    -3.24815005e-06, 8.92656044e-06, -1.89359944e-05, 3.45419867e-05,
+    -5.65292648e-05, 8.47052288e-05, -0.00011732128, 0.000150462118,
+    -0.00017750058, 0.000188672566, -0.000170943982, 0.00010825722,
+    1.77240745e-05, -0.000226361008, 0.000536154199, -0.000962344639,
+    0.0015140305, -0.00219112542, 0.00298109069, -0.00385595765,
+    0.00477000233, -0.00565808918, 0.00643517217, -0.00699683512,
+    0.00722121354, -0.00697224867, 0.00610323343, -0.00446103932,
+    0.00188899529, 0.00177176634, -0.00668636011, 0.013037852,
+    -0.021055771, 0.0310752653, -0.0436650254, 0.0599217303,
+    -0.0822451636, 0.116847828, -0.185278967, 0.439575315,
+    0.795116007, -0.169670776, 0.0766082183, -0.0375797898,
+    0.0158630349, -0.00229634228, -0.00651430385, 0.0121555636,
+    -0.0155118024, 0.0171545353, -0.0175005458, 0.0168812871,
+    -0.015573645, 0.0138136465, -0.0118014654, 0.00970329437,
+    -0.007651933, 0.00574761396, -0.00405950798, 0.00262839813,
+    -0.00147034682, 0.000580954715, 5.98077604e-05, -0.000482923148,
+    0.000725610764, -0.00082725985, 0.000826159201, -0.000756942958,
+    0.000648900867, -0.000525173731, 0.000402645237, -0.000292353856,
+    0.000200315015, -0.000128573432, 7.63291901e-05, -4.09903769e-05,
+    1.90826395e-05, -6.96592951e-06, 1.33963943e-06, 4.826951e-07,
+};
+
+// 2:1, quality 3: 1 phases of 96 taps.
+const float kTable2To1Quality3[] = {
+    -2.86833688e-06, 4.36885566e-05, 2.84283851e-05, -8.02420618e-05,
+    -9.23651678e-05, 0.000107822867, 0.000209197213, -9.38924495e-05,
+    -0.000381285092, -7.58175565e-06, 0.000587681367, 0.00024781542,
+    -0.000774446409, -0.000667721091, 0.000850755197, 0.00127670355,
+    -0.000694756804, -0.00202966086, 0.000171792781, 0.00280810613,
+    0.000834504084, -0.00341177895, -0.00238197716, 0.00356732169,
+    0.00442651054, -0.00295660947, -0.0067845555, 0.0012638442,
+    0.00910992641, 0.00176386687, -0.0108905593, -0.00625347393,
+    0.011465013, 0.0121530201, -0.0100458609, -0.0192015432,
+    0.00571770314, 0.0269319899, 0.00267276727, -0.0347113758,
+    -0.0169737116, 0.0418145023, 0.0414904244, -0.0475207157,
+    -0.0920217782, 0.0512190536, 0.313479841, 0.44749999,
+    0.313479841, 0.0512190536, -0.0920217782, -0.0475207157,
+    0.0414904244, 0.0418145023, -0.0169737116, -0.0347113758,
+    0.00267276727, 0.0269319899, 0.00571770314, -0.0192015432,
+    -0.0100458609, 0.0121530201, 0.011465013, -0.00625347393,
+    -0.0108905593, 0.00176386687, 0.00910992641, 0.0012638442,
+    -0.0067845555, -0.00295660947, 0.00442651054, 0.00356732169,
+    -0.00238197716, -0.00341177895, 0.000834504084, 0.00280810613,
+    0.000171792781, -0.00202966086, -0.000694756804, 0.00127670355,
+    0.000850755197, -0.000667721091, -0.000774446409, 0.00024781542,
+    0.000587681367, -7.58175565e-06, -0.000381285092, -9.38924495e-05,
+    0.000209197213, 0.000107822867, -9.23651678e-05, -8.02420618e-05,
+    2.84283851e-05, 4.36885566e-05, -2.86833688e-06, -1.54792415e-05,
+};
+
+// 2:1, quality 4: 1 phases of 128 taps.
+const float kTable2To1Quality4[] = {
+    -6.66232609e-07, 2.67281921e-05, 1.06017469e-05, -4.6739231e-05,
+    -3.39137805e-05, 6.79476652e-05, 7.6197437e-05, -8.32159567e-05,
+    -0.000141770986, 8.16196698e-05, 0.000231822298, -4.88236292e-05,
+    -0.000342332991, -3.16442165e-05, 0.000462119642, 0.000176097252,
+    -0.00057140307, -0.000397451135, 0.000641351042, 0.000701257435,
+    -0.000635026605, -0.00108143664, 0.000510021986, 0.0015163183,
+    -0.000222911141, -0.00196561869, -0.000264680799, 0.00236913841,
+    0.000978657161, -0.00264770864, -0.00192452024, 0.00270684925,
+    0.00307971379, -0.00244319695, -0.00438710628, 0.0017534697,
+    0.00575069524, -0.000545239483, -0.00703394646, -0.00125139812,
+    0.00806116406, 0.00367252086, -0.00862128008, -0.00671096705,
+    0.00847258605, 0.0103101032, -0.00734553905, -0.0143617196,
+    0.00493747974, 0.0187088829, -0.000888338254, -0.0231540762,
+    -0.00528995646, 0.0274718795, 0.014398789, -0.0314254351,
+    -0.0280800313, 0.0347851142, 0.0506248772, -0.0373475589,
+    -0.0980255082, 0.0389531367, 0.315572798, 0.460500002,
+    0.315572798, 0.0389531367, -0.0980255082, -0.0373475589,
+    0.0506248772, 0.0347851142, -0.0280800313, -0.0314254351,
+    0.014398789, 0.0274718795, -0.00528995646, -0.0231540762,
+    -0.000888338254, 0.0187088829, 0.00493747974, -0.0143617196,
+    -0.00734553905, 0.0103101032, 0.00847258605, -0.00671096705,
+    -0.00862128008, 0.00367252086, 0.00806116406, -0.00125139812,
+    -0.00703394646, -0.000545239483, 0.00575069524, 0.0017534697,
+    -0.00438710628, -0.00244319695, 0.00307971379, 0.00270684925,
+    -0.00192452024, -0.00264770864, 0.000978657161, 0.00236913841,
+    -0.000264680799, -0.00196561869, -0.000222911141, 0.0015163183,
+    0.000510021986, -0.00108143664, -0.000635026605, 0.000701257435,
+    0.000641351042, -0.000397451135, -0.00057140307, 0.000176097252,
+    0.000462119642, -3.16442165e-05, -0.000342332991, -4.88236292e-05,
+    0.000231822298, 8.16196698e-05, -0.000141770986, -8.32159567e-05,
+    7.6197437e-05, 6.79476652e-05, -3.39137805e-05, -4.6739231e-05,
+    1.06017469e-05, 2.67281921e-05, -6.66232609e-07, -1.15874109e-05,
+};
+
+// 2:1, quality 5: 1 phases of 160 taps.
+const float kTable2To1Quality5[] = {
+    2.37882773e-06, -5.087212e-07, -5.69400436e-06, -9.04753335e-07,
+    1.06322859e-05, 5.09318352e-06, -1.67841845e-05, -1.37538918e-05,
+    2.28995159e-05, 2.8643266e-05, -2.66014085e-05, -5.11306316e-05,
+    2.42460792e-05, 8.16067259e-05, -1.09866824e-05, -0.000118750395,
+    -1.88595732e-05, 0.000158804716, 7.10951499e-05, -0.000194976135,
+    -0.000150538894, 0.00021714106, 0.000259607448, -0.000211994382,
+    -0.000396680494, 0.000163856748, 0.000554501079, -5.61799061e-05,
+    -0.000718760479, -0.000126180486, 0.000867328839, 0.000394110917,
+    -0.000970328227, -0.000750879233, 0.000991339795, 0.00118878053,
+    -0.000889935473, -0.00168606581, 0.000625485904, 0.00220480235,
+    -0.000162247336, -0.00269004144, -0.000524633506, 0.00307060382,
+    0.00144288898, -0.00326215383, -0.00257692789, 0.00317218481,
+    0.00388262654, -0.00270701363, -0.00528370356, 0.00178022799,
+    0.0066700587, -0.00032190184, -0.00789848156, -0.00171212247,
+    0.00879543368, 0.00433212984, -0.00916111097, -0.00750843482,
+    0.00877341907, 0.0111681689, -0.00738856615, -0.0151956622,
+    0.00473288447, 0.0194367673, -0.000474657601, -0.0237068515,
+    -0.00584975723, 0.0278022382, 0.0150250643, -0.03151384,
+    -0.0286860336, 0.0346428491, 0.0511280484, -0.0370154604,
+    -0.0983573273, 0.0384964384, 0.315688014, 0.460999995,
+    0.315688014, 0.0384964384, -0.0983573273, -0.0370154604,
+    0.0511280484, 0.0346428491, -0.0286860336, -0.03151384,
+    0.0150250643, 0.0278022382, -0.00584975723, -0.0237068515,
+    -0.000474657601, 0.0194367673, 0.00473288447, -0.0151956622,
+    -0.00738856615, 0.0111681689, 0.00877341907, -0.00750843482,
+    -0.00916111097, 0.00433212984, 0.00879543368, -0.00171212247,
+    -0.00789848156, -0.00032190184, 0.0066700587, 0.00178022799,
+    -0.00528370356, -0.00270701363, 0.00388262654, 0.00317218481,
+    -0.00257692789, -0.00326215383, 0.00144288898, 0.00307060382,
+    -0.000524633506, -0.00269004144, -0.000162247336, 0.00220480235,
+    0.000625485904, -0.00168606581, -0.000889935473, 0.00118878053,
+    0.000991339795, -0.000750879233, -0.000970328227, 0.000394110917,
+    0.000867328839, -0.000126180486, -0.000718760479, -5.61799061e-05,
+    0.000554501079, 0.000163856748, -0.000396680494, -0.000211994382,
+    0.000259607448, 0.00021714106, -0.000150538894, -0.000194976135,
+    7.10951499e-05, 0.000158804716, -1.88595732e-05, -0.000118750395,
+    -1.09866824e-05, 8.16067259e-05, 2.42460792e-05, -5.11306316e-05,
+    -2.66014085e-05, 2.8643266e-05, 2.28995159e-05, -1.37538918e-05,
+    -1.67841845e-05, 5.09318352e-06, 1.06322859e-05, -9.04753335e-07,
+    -5.69400436e-06, -5.087212e-07, 2.37882773e-06, 5.20191236e-07,
+};
+
+// 3:1, quality 3: 1 phases of 144 taps.
+const float kTable3To1Quality3[] = {
+    -8.45361592e-06, 7.95949381e-06, 2.9125702e-05, 3.11894873e-05,
+    -1.87697253e-06, -5.34947067e-05, -7.57999587e-05, -2.85183851e-05,
+    7.18824886e-05, 0.000143839905, 9.99910335e-05, -6.25949688e-05,
+    -0.000225776559, -0.000226149263, -5.05450362e-06, 0.000295843754,
+    0.000408999942, 0.00016520753, -0.000309750409, -0.000629377668,
+    -0.000445145735, 0.000207561345, 0.000838951091, 0.000851135701,
+    7.65371442e-05, -0.000957018579, -0.00135310716, -0.000597488368,
+    0.000875348516, 0.00187207072, 0.00137721829, -0.000473016786,
+    -0.00227452256, -0.00238100463, -0.000358990976, 0.00237821438,
+    0.00349739217, 0.00168566965, -0.00197107298, -0.00452720048,
+    -0.00349365384, 0.00084256276, 0.00518602738, 0.0056605204,
+    0.00117589114, -0.00512126926, -0.00793393236, -0.00416898262,
+    0.00394028425, 0.009923134, 0.00810201373, -0.00123985333,
+    -0.0110988524, -0.0128010279, -0.00338387024, 0.0107832914,
+    0.0179546587, 0.0103877066, -0.00807662588, -0.0231409147,
+    -0.0205106307, 0.00154943496, 0.0278763343, 0.035605222,
+    0.0120239211, -0.0316804759, -0.0625009462, -0.0448940992,
+    0.0341460332, 0.151434064, 0.256349027, 0.298333317,
+    0.256349027, 0.151434064, 0.0341460332, -0.0448940992,
+    -0.0625009462, -0.0316804759, 0.0120239211, 0.035605222,
+    0.0278763343, 0.00154943496, -0.0205106307, -0.0231409147,
+    -0.00807662588, 0.0103877066, 0.0179546587, 0.0107832914,
+    -0.00338387024, -0.0128010279, -0.0110988524, -0.00123985333,
+    0.00810201373, 0.009923134, 0.00394028425, -0.00416898262,
+    -0.00793393236, -0.00512126926, 0.00117589114, 0.0056605204,
+    0.00518602738, 0.00084256276, -0.00349365384, -0.00452720048,
+    -0.00197107298, 0.00168566965, 0.00349739217, 0.00237821438,
+    -0.000358990976, -0.00238100463, -0.00227452256, -0.000473016786,
+    0.00137721829, 0.00187207072, 0.000875348516, -0.000597488368,
+    -0.00135310716, -0.000957018579, 7.65371442e-05, 0.000851135701,
+    0.000838951091, 0.000207561345, -0.000445145735, -0.000629377668,
+    -0.000309750409, 0.00016520753, 0.000408999942, 0.000295843754,
+    -5.05450362e-06, -0.000226149263, -0.000225776559, -6.25949688e-05,
+    9.99910335e-05, 0.000143839905, 7.18824886e-05, -2.85183851e-05,
+    -7.57999587e-05, -5.34947067e-05, -1.87697253e-06, 3.11894873e-05,
+    2.9125702e-05, 7.95949381e-06, -8.45361592e-06, -1.03194943e-05,
+};
+
+// 3:1, quality 4: 1 phases of 192 taps.
+const float kTable3To1Quality4[] = {
+    -5.28037299e-06, 6.07103266e-06, 1.78187947e-05, 1.57091854e-05,
+    -5.49113702e-06, -3.11594886e-05, -3.46432134e-05, -2.43741897e-06,
+    4.52982313e-05, 6.37608755e-05, 2.28603512e-05, -5.54773069e-05,
+    -0.000102949722, -6.12709409e-05, 5.44131144e-05, 0.000149229556,
+    0.000122368205, -3.2547945e-05, -0.00019578544, -0.000208538622,
+    -2.10977505e-05, 0.000231344413, 0.000318103732, 0.000117398165,
+    -0.00024015535, -0.000443591474, -0.000264967442, 0.000202788244,
+    0.000570340024, 0.000467504986, -9.79076285e-05, -0.000675785996,
+    -0.000720960088, -9.49783644e-05, 0.00072977948, 0.00101087894,
+    0.00039186186, -0.000696190342, -0.00131041254, -0.000800031063,
+    0.000535902625, 0.00157942309, 0.00131369906, -0.00021123125,
+    -0.00176513626, -0.00191007229, -0.000308576768, 0.00180456624,
+    0.00254633487, 0.00104117044, -0.00162879797, -0.00315823383,
+    -0.00198476668, 0.0011689798, 0.00366054219, 0.00311250705,
+    -0.000363480154, -0.00394959422, -0.00436791684, -0.000834265433,
+    0.00390765257, 0.00566215767, 0.0024483474, -0.00340854982,
+    -0.00687294314, -0.00447397819, 0.0023232277, 0.00784477871,
+    0.00687341765, -0.000523343624, -0.00838888437, -0.00957447942,
+    -0.00212035934, 0.00827933569, 0.0124725895, 0.00575128431,
+    -0.00723807281, -0.0154360514, -0.0105645582, 0.00489091594,
+    0.018314587, 0.0169028025, -0.000646117202, -0.0209502913,
+    -0.0255150124, -0.00666681537, 0.0231900774, 0.0383968763,
+    0.0201122724, -0.0248983726, -0.0626380518, -0.0519109182,
+    0.0259687603, 0.148814261, 0.261463106, 0.307000011,
+    0.261463106, 0.148814261, 0.0259687603, -0.0519109182,
+    -0.0626380518, -0.0248983726, 0.0201122724, 0.0383968763,
+    0.0231900774, -0.00666681537, -0.0255150124, -0.0209502913,
+    -0.000646117202, 0.0169028025, 0.018314587, 0.00489091594,
+    -0.0105645582, -0.0154360514, -0.00723807281, 0.00575128431,
+    0.0124725895, 0.00827933569, -0.00212035934, -0.00957447942,
+    -0.00838888437, -0.000523343624, 0.00687341765, 0.00784477871,
+    0.0023232277, -0.00447397819, -0.00687294314, -0.00340854982,
+    0.0024483474, 0.00566215767, 0.00390765257, -0.000834265433,
+    -0.00436791684, -0.00394959422, -0.000363480154, 0.00311250705,
+    0.00366054219, 0.0011689798, -0.00198476668, -0.00315823383,
+    -0.00162879797, 0.00104117044, 0.00254633487, 0.00180456624,
+    -0.000308576768, -0.00191007229, -0.00176513626, -0.00021123125,
+    0.00131369906, 0.00157942309, 0.000535902625, -0.000800031063,
+    -0.00131041254, -0.000696190342, 0.00039186186, 0.00101087894,
+    0.00072977948, -9.49783644e-05, -0.000720960088, -0.000675785996,
+    -9.79076285e-05, 0.000467504986, 0.000570340024, 0.000202788244,
+    -0.000264967442, -0.000443591474, -0.00024015535, 0.000117398165,
+    0.000318103732, 0.000231344413, -2.10977505e-05, -0.000208538622,
+    -0.00019578544, -3.2547945e-05, 0.000122368205, 0.000149229556,
+    5.44131144e-05, -6.12709409e-05, -0.000102949722, -5.54773069e-05,
+    2.28603512e-05, 6.37608755e-05, 4.52982313e-05, -2.43741897e-06,
+    -3.46432134e-05, -3.11594886e-05, -5.49113702e-06, 1.57091854e-05,
+    1.78187947e-05, 6.07103266e-06, -5.28037299e-06, -7.72494059e-06,
+};
+
+// 3:1, quality 5: 1 phases of 240 taps.
+const float kTable3To1Quality5[] = {
+    1.34571167e-06, 1.42342833e-06, -3.39147448e-07, -2.9884518e-06,
+    -3.76497428e-06, -6.03168871e-07, 4.96403391e-06, 7.78977392e-06,
+    3.39545568e-06, -6.60748265e-06, -1.37297066e-05, -9.16910267e-06,
+    6.70254212e-06, 2.1351163e-05, 1.90955088e-05, -3.43046099e-06,
+    -2.96876351e-05, -3.40870865e-05, -5.56254327e-06, 3.67769608e-05,
+    5.44044087e-05, 2.2933631e-05, -3.94966919e-05, -7.91669372e-05,
+    -5.12215556e-05, 3.35628756e-05, 0.000105869804, 9.22335676e-05,
+    -1.37619863e-05, -0.000129984532, -0.000146268067, -2.55209015e-05,
+    0.000144760706, 0.000211269216, 8.94612022e-05, -0.000141330893,
+    -0.000282023946, -0.000181647862, 0.000109237822, 0.000349548587,
+    0.000302747183, -3.74558185e-05, -0.000400848337, -0.000449078914,
+    -8.41203218e-05, 0.00041921917, 0.000611318508, 0.000262736925,
+    -0.000385226245, -0.000773576961, -0.000500586117, 0.000278399122,
+    0.000913087279, 0.00079251657, -7.96678214e-05, -0.00100073032,
+    -0.00112404383, -0.000225618263, 0.00100252801, 0.00146986672,
+    0.000644228363, -0.00088218454, -0.00179336092, -0.00117164745,
+    0.000604753208, 0.00204707333, 0.00178890757, -0.000140975972,
+    -0.00217476906, -0.00246024807, -0.000527726428, 0.00211479631,
+    0.00313185342, 0.00140431593, -0.00180468499, -0.0037321155,
+    -0.00247147121, 0.00118683069, 0.00417341711, 0.00368785975,
+    -0.000214615837, -0.00435542315, -0.00498564355, -0.00114139833,
+    0.00416944595, 0.00626938837, 0.00288806856, -0.00350332074,
+    -0.00741618825, -0.00500560552, 0.00224549952, 0.00827633403,
+    0.00744542992, -0.000286562048, -0.00867285393, -0.0101304352,
+    -0.00248486968, 0.00839639548, 0.0129578421, 0.00619760435,
+    -0.00718825683, -0.015804572, -0.0110375537, 0.0046939943,
+    0.0185348373, 0.0173448604, -0.000339482009, -0.0210092384,
+    -0.0258732773, -0.00703270501, 0.0230952539, 0.0386298336,
+    0.0204802323, -0.0246769916, -0.0627209693, -0.0522242971,
+    0.0256643128, 0.148742467, 0.261672527, 0.30733332,
+    0.261672527, 0.148742467, 0.0256643128, -0.0522242971,
+    -0.0627209693, -0.0246769916, 0.0204802323, 0.0386298336,
+    0.0230952539, -0.00703270501, -0.0258732773, -0.0210092384,
+    -0.000339482009, 0.0173448604, 0.0185348373, 0.0046939943,
+    -0.0110375537, -0.015804572, -0.00718825683, 0.00619760435,
+    0.0129578421, 0.00839639548, -0.00248486968, -0.0101304352,
+    -0.00867285393, -0.000286562048, 0.00744542992, 0.00827633403,
+    0.00224549952, -0.00500560552, -0.00741618825, -0.00350332074,
+    0.00288806856, 0.00626938837, 0.00416944595, -0.00114139833,
+    -0.00498564355, -0.00435542315, -0.000214615837, 0.00368785975,
+    0.00417341711, 0.00118683069, -0.00247147121, -0.0037321155,
+    -0.00180468499, 0.00140431593, 0.00313185342, 0.00211479631,
+    -0.000527726428, -0.00246024807, -0.00217476906, -0.000140975972,
+    0.00178890757, 0.00204707333, 0.000604753208, -0.00117164745,
+    -0.00179336092, -0.00088218454, 0.000644228363, 0.00146986672,
+    0.00100252801, -0.000225618263, -0.00112404383, -0.00100073032,
+    -7.96678214e-05, 0.00079251657, 0.000913087279, 0.000278399122,
+    -0.000500586117, -0.000773576961, -0.000385226245, 0.000262736925,
+    0.000611318508, 0.00041921917, -8.41203218e-05, -0.000449078914,
+    -0.000400848337, -3.74558185e-05, 0.000302747183, 0.000349548587,
+    0.000109237822, -0.000181647862, -0.000282023946, -0.000141330893,
+    8.94612022e-05, 0.000211269216, 0.000144760706, -2.55209015e-05,
+    -0.000146268067, -0.000129984532, -1.37619863e-05, 9.22335676e-05,
+    0.000105869804, 3.35628756e-05, -5.12215556e-05, -7.91669372e-05,
+    -3.94966919e-05, 2.2933631e-05, 5.44044087e-05, 3.67769608e-05,
+    -5.56254327e-06, -3.40870865e-05, -2.96876351e-05, -3.43046099e-06,
+    1.90955088e-05, 2.1351163e-05, 6.70254212e-06, -9.16910267e-06,
+    -1.37297066e-05, -6.60748265e-06, 3.39545568e-06, 7.78977392e-06,
+    4.96403391e-06, -6.03168871e-07, -3.76497428e-06, -2.9884518e-06,
+    -3.39147448e-07, 1.42342833e-06, 1.34571167e-06, 3.46804683e-07,
+};
+
+// 6:1, quality 3: 1 phases of 288 taps.
+const float kTable6To1Quality3[] = {
+    -5.53779319e-06, -4.22680796e-06, -9.56112217e-07, 3.97974691e-06,
+    9.64320498e-06, 1.4562851e-05, 1.70390122e-05, 1.55947437e-05,
+    9.47612807e-06, -9.38486266e-07, -1.39600224e-05, -2.67473533e-05,
+    -3.58262696e-05, -3.78999794e-05, -3.07881965e-05, -1.42591925e-05,
+    9.49575224e-06, 3.59412443e-05, 5.89159681e-05, 7.19199525e-05,
+    6.97323994e-05, 4.99955167e-05, 1.43440184e-05, -3.12974844e-05,
+    -7.74569853e-05, -0.00011288828, -0.000127095031, -0.000113074631,
+    -6.96144634e-05, -2.52725181e-06, 7.56934969e-05, 0.000147921877,
+    0.000195893779, 0.000204499971, 0.000165928417, 8.26037649e-05,
+    -3.19549617e-05, -0.000154875204, -0.000258148793, -0.000314688834,
+    -0.000304948393, -0.000222572868, -7.76134475e-05, 0.000103780672,
+    0.000283586036, 0.000419475546, 0.000474311615, 0.00042556785,
+    0.000272378442, 3.82685721e-05, -0.000231585582, -0.00047850929,
+    -0.000642580213, -0.00067655358, -0.000558315834, -0.000298744184,
+    5.72666831e-05, 0.000437674258, 0.000757253205, 0.000936035358,
+    0.000918429752, 0.000688609143, 0.000278168009, -0.000236508393,
+    -0.000747506041, -0.00113726128, -0.00130477245, -0.00119050231,
+    -0.000793988875, -0.000179495488, 0.000532766338, 0.00118910719,
+    0.00163465156, 0.00174869609, 0.00147550355, 0.000842834823,
+    -3.70154194e-05, -0.000985536491, -0.00179297826, -0.00226360024,
+    -0.00226151641, -0.00174682692, -0.000792782463, 0.00042128138,
+    0.00164192438, 0.00259301369, 0.00303664198, 0.0028302602,
+    0.0019669258, 0.000587945571, -0.00103701942, -0.00256063463,
+    -0.00363018829, -0.00396696618, -0.00343524572, -0.00208449131,
+    -0.000153100249, 0.00197014213, 0.00382167078, 0.004961567,
+    0.0050745476, 0.00405100686, 0.00202832092, -0.000619926665,
+    -0.00334862829, -0.00554942619, -0.00668194424, -0.00640051393,
+    -0.00464780163, -0.00169193512, 0.00190590101, 0.00539164571,
+    0.00796985626, 0.00897732936, 0.00804242678, 0.00519385329,
+    0.000890907075, -0.00403831294, -0.0085451249, -0.0115704574,
+    -0.0122769838, -0.0102553153, -0.00565790385, 0.000774717482,
+    0.00781072257, 0.0139381671, 0.0176573619, 0.017802611,
+    0.0138301412, 0.00601196056, -0.00451113004, -0.015840238,
+    -0.0255853683, -0.0312504731, -0.0306739248, -0.0224470496,
+    -0.00623388123, 0.0170730166, 0.0453958884, 0.075717032,
+    0.104493275, 0.128174514, 0.143740416, 0.149166659,
+    0.143740416, 0.128174514, 0.104493275, 0.075717032,
+    0.0453958884, 0.0170730166, -0.00623388123, -0.0224470496,
+    -0.0306739248, -0.0312504731, -0.0255853683, -0.015840238,
+    -0.00451113004, 0.00601196056, 0.0138301412, 0.017802611,
+    0.0176573619, 0.0139381671, 0.00781072257, 0.000774717482,
+    -0.00565790385, -0.0102553153, -0.0122769838, -0.0115704574,
+    -0.0085451249, -0.00403831294, 0.000890907075, 0.00519385329,
+    0.00804242678, 0.00897732936, 0.00796985626, 0.00539164571,
+    0.00190590101, -0.00169193512, -0.00464780163, -0.00640051393,
+    -0.00668194424, -0.00554942619, -0.00334862829, -0.000619926665,
+    0.00202832092, 0.00405100686, 0.0050745476, 0.004961567,
+    0.00382167078, 0.00197014213, -0.000153100249, -0.00208449131,
+    -0.00343524572, -0.00396696618, -0.00363018829, -0.00256063463,
+    -0.00103701942, 0.000587945571, 0.0019669258, 0.0028302602,
+    0.00303664198, 0.00259301369, 0.00164192438, 0.00042128138,
+    -0.000792782463, -0.00174682692, -0.00226151641, -0.00226360024,
+    -0.00179297826, -0.000985536491, -3.70154194e-05, 0.000842834823,
+    0.00147550355, 0.00174869609, 0.00163465156, 0.00118910719,
+    0.000532766338, -0.000179495488, -0.000793988875, -0.00119050231,
+    -0.00130477245, -0.00113726128, -0.000747506041, -0.000236508393,
+    0.000278168009, 0.000688609143, 0.000918429752, 0.000936035358,
+    0.000757253205, 0.000437674258, 5.72666831e-05, -0.000298744184,
+    -0.000558315834, -0.00067655358, -0.000642580213, -0.00047850929,
+    -0.000231585582, 3.82685721e-05, 0.000272378442, 0.00042556785,
+    0.000474311615, 0.000419475546, 0.000283586036, 0.000103780672,
+    -7.76134475e-05, -0.000222572868, -0.000304948393, -0.000314688834,
+    -0.000258148793, -0.000154875204, -3.19549617e-05, 8.26037649e-05,
+    0.000165928417, 0.000204499971, 0.000195893779, 0.000147921877,
+    7.56934969e-05, -2.52725181e-06, -6.96144634e-05, -0.000113074631,
+    -0.000127095031, -0.00011288828, -7.74569853e-05, -3.12974844e-05,
+    1.43440184e-05, 4.99955167e-05, 6.97323994e-05, 7.19199525e-05,
+    5.89159681e-05, 3.59412443e-05, 9.49575224e-06, -1.42591925e-05,
+    -3.07881965e-05, -3.78999794e-05, -3.58262696e-05, -2.67473533e-05,
+    -1.39600224e-05, -9.38486266e-07, 9.47612807e-06, 1.55947437e-05,
+    1.70390122e-05, 1.4562851e-05, 9.64320498e-06, 3.97974691e-06,
+    -9.56112217e-07, -4.22680796e-06, -5.53779319e-06, -5.15974716e-06,
+};
+
+// 6:1, quality 4: 1 phases of 384 taps.
+const float kTable6To1Quality4[] = {
+    -3.8493522e-06, -2.64018649e-06, -2.22114338e-07, 3.03551633e-06,
+    6.39960945e-06, 8.90939737e-06, 9.61266142e-06, 7.8545927e-06,
+    3.53398787e-06, -2.74556851e-06, -9.69835946e-06, -1.55797443e-05,
+    -1.85812696e-05, -1.73216067e-05, -1.13045935e-05, -1.21870949e-06,
+    1.10367309e-05, 2.26491156e-05, 3.0487292e-05, 3.18804377e-05,
+    2.53991475e-05, 1.14301756e-05, -7.63973185e-06, -2.77386534e-05,
+    -4.39121068e-05, -5.14748608e-05, -4.72571628e-05, -3.06354705e-05,
+    -4.04783304e-06, 2.72065572e-05, 5.59332366e-05, 7.4614778e-05,
+    7.72742351e-05, 6.11841024e-05, 2.79666037e-05, -1.62739725e-05,
+    -6.19340499e-05, -9.78927201e-05, -0.000114111004, -0.000104269311,
+    -6.77717326e-05, -1.05488753e-05, 5.56813065e-05, 0.000115672206,
+    0.000154039881, 0.000159051866, 0.000125916864, 5.86990827e-05,
+    -2.97547977e-05, -0.000120077675, -0.000190467123, -0.000221795737,
+    -0.000202566982, -0.000132483721, -2.36096857e-05, 0.000101394122,
+    0.000213783685, 0.000285170012, 0.000294479425, 0.000233752493,
+    0.000111280729, -4.89538143e-05, -0.00021167555, -0.000337892998,
+    -0.000394019327, -0.000360480044, -0.000237657572, -4.74891822e-05,
+    0.000170007334, 0.00036488974, 0.000488527527, 0.000505439471,
+    0.000402923382, 0.00019593093, -7.43002238e-05, -0.000348095171,
+    -0.000560232322, -0.00065520627, -0.000601303414, -0.000400015531,
+    -8.82269378e-05, 0.000267951313, 0.000586865819, 0.000789711543,
+    0.000819621899, 0.00065684953, 0.000326219073, -0.000105615625,
+    -0.000543105474, -0.000882568129, -0.00103639346, -0.000955036143,
+    -0.000641509483, -0.000154288384, 0.000402808771, 0.000902283122,
+    0.00122169941, 0.00127316744, 0.00102657126, 0.000520585221,
+    -0.000141985089, -0.000814398983, -0.00133800635, -0.00157911691,
+    -0.00146237086, -0.000992383342, -0.000257779931, 0.000584489899,
+    0.00134200708, 0.0018302711, 0.00191689841, 0.00155625353,
+    0.000805663178, -0.000181740077, -0.0011873662, -0.00197479711,
+    -0.00234464835, -0.00218395842, -0.00149818766, -0.000417132716,
+    0.000828152697, 0.00195382629, 0.00268705469, 0.00283107883,
+    0.00231626164, 0.0012241737, -0.000222569433, -0.00170427491,
+    -0.00287375483, -0.00343647157, -0.00322310603, -0.00223698909,
+    -0.000663716521, 0.00116161385, 0.00282419519, 0.00392238935,
+    0.00416297326, 0.00343670882, 0.00185522914, -0.000261671812,
+    -0.00244850689, -0.00419444218, -0.00506052468, -0.00478723971,
+    -0.00336666801, -0.00106017967, 0.00164582662, 0.00413966784,
+    0.0058197584, 0.00623629475, 0.00520660682, 0.00287564215,
+    -0.000296102284, -0.0036190364, -0.00632015243, -0.00771802571,
+    -0.00738852099, -0.0052822791, -0.0017633189, 0.00244545797,
+    0.00640394678, 0.00915729348, 0.00995698385, 0.00845140126,
+    0.00479961047, -0.000323058601, -0.00583750708, -0.0104751457,
+    -0.0130536705, -0.0127575062, -0.00936001074, -0.00333340769,
+    0.00418786891, 0.0115950387, 0.0171166956, 0.0191984382,
+    0.0168749597, 0.0100561362, -0.000340243161, -0.0124491863,
+    -0.0237165503, -0.0313190259, -0.0326751694, -0.0259554591,
+    -0.010493624, 0.0129843801, 0.0423664562, 0.0744071305,
+    0.105190933, 0.130731553, 0.147604153, 0.153500006,
+    0.147604153, 0.130731553, 0.105190933, 0.0744071305,
+    0.0423664562, 0.0129843801, -0.010493624, -0.0259554591,
+    -0.0326751694, -0.0313190259, -0.0237165503, -0.0124491863,
+    -0.000340243161, 0.0100561362, 0.0168749597, 0.0191984382,
+    0.0171166956, 0.0115950387, 0.00418786891, -0.00333340769,
+    -0.00936001074, -0.0127575062, -0.0130536705, -0.0104751457,
+    -0.00583750708, -0.000323058601, 0.00479961047, 0.00845140126,
+    0.00995698385, 0.00915729348, 0.00640394678, 0.00244545797,
+    -0.0017633189, -0.0052822791, -0.00738852099, -0.00771802571,
+    -0.00632015243, -0.0036190364, -0.000296102284, 0.00287564215,
+    0.00520660682, 0.00623629475, 0.0058197584, 0.00413966784,
+    0.00164582662, -0.00106017967, -0.00336666801, -0.00478723971,
+    -0.00506052468, -0.00419444218, -0.00244850689, -0.000261671812,
+    0.00185522914, 0.00343670882, 0.00416297326, 0.00392238935,
+    0.00282419519, 0.00116161385, -0.000663716521, -0.00223698909,
+    -0.00322310603, -0.00343647157, -0.00287375483, -0.00170427491,
+    -0.000222569433, 0.0012241737, 0.00231626164, 0.00283107883,
+    0.00268705469, 0.00195382629, 0.000828152697, -0.000417132716,
+    -0.00149818766, -0.00218395842, -0.00234464835, -0.00197479711,
+    -0.0011873662, -0.000181740077, 0.000805663178, 0.00155625353,
+    0.00191689841, 0.0018302711, 0.00134200708, 0.000584489899,
+    -0.000257779931, -0.000992383342, -0.00146237086, -0.00157911691,
+    -0.00133800635, -0.000814398983, -0.000141985089, 0.000520585221,
+    0.00102657126, 0.00127316744, 0.00122169941, 0.000902283122,
+    0.000402808771, -0.000154288384, -0.000641509483, -0.000955036143,
+    -0.00103639346, -0.000882568129, -0.000543105474, -0.000105615625,
+    0.000326219073, 0.00065684953, 0.000819621899, 0.000789711543,
+    0.000586865819, 0.000267951313, -8.82269378e-05, -0.000400015531,
+    -0.000601303414, -0.00065520627, -0.000560232322, -0.000348095171,
+    -7.43002238e-05, 0.00019593093, 0.000402923382, 0.000505439471,
+    0.000488527527, 0.00036488974, 0.000170007334, -4.74891822e-05,
+    -0.000237657572, -0.000360480044, -0.000394019327, -0.000337892998,
+    -0.00021167555, -4.89538143e-05, 0.000111280729, 0.000233752493,
+    0.000294479425, 0.000285170012, 0.000213783685, 0.000101394122,
+    -2.36096857e-05, -0.000132483721, -0.000202566982, -0.000221795737,
+    -0.000190467123, -0.000120077675, -2.97547977e-05, 5.86990827e-05,
+    0.000125916864, 0.000159051866, 0.000154039881, 0.000115672206,
+    5.56813065e-05, -1.05488753e-05, -6.77717326e-05, -0.000104269311,
+    -0.000114111004, -9.78927201e-05, -6.19340499e-05, -1.62739725e-05,
+    2.79666037e-05, 6.11841024e-05, 7.72742351e-05, 7.4614778e-05,
+    5.59332366e-05, 2.72065572e-05, -4.04783304e-06, -3.06354705e-05,
+    -4.72571628e-05, -5.14748608e-05, -4.39121068e-05, -2.77386534e-05,
+    -7.63973185e-06, 1.14301756e-05, 2.53991475e-05, 3.18804377e-05,
+    3.0487292e-05, 2.26491156e-05, 1.10367309e-05, -1.21870949e-06,
+    -1.13045935e-05, -1.73216067e-05, -1.85812696e-05, -1.55797443e-05,
+    -9.69835946e-06, -2.74556851e-06, 3.53398787e-06, 7.8545927e-06,
+    9.61266142e-06, 8.90939737e-06, 6.39960945e-06, 3.03551633e-06,
+    -2.22114338e-07, -2.64018649e-06, -3.8493522e-06, -3.86247029e-06,
+};
+
+// 6:1, quality 5: 1 phases of 480 taps.
+const float kTable6To1Quality5[] = {
+    4.3561198e-07, 6.72855833e-07, 7.92942501e-07, 7.11714165e-07,
+    3.84067761e-07, -1.69573724e-07, -8.51266464e-07, -1.4942259e-06,
+    -1.8980013e-06, -1.88248714e-06, -1.3434128e-06, -3.01584436e-07,
+    1.074132e-06, 2.48201695e-06, 3.54410599e-06, 3.89488696e-06,
+    3.29096679e-06, 1.69772784e-06, -6.58850013e-07, -3.30374132e-06,
+    -5.59472801e-06, -6.86485328e-06, -6.59579928e-06, -4.58455133e-06,
+    -1.05084928e-06, 3.35127106e-06, 7.63317166e-06, 1.06755815e-05,
+    1.15004677e-05, 9.54775442e-06, 4.88432806e-06, -1.7152305e-06,
+    -8.86721409e-06, -1.48438176e-05, -1.7966815e-05, -1.70435433e-05,
+    -1.17393911e-05, -2.78127163e-06, 8.0820264e-06, 1.83884804e-05,
+    2.54909737e-05, 2.72022044e-05, 2.24044452e-05, 1.14668155e-05,
+    -3.66242625e-06, -1.97483459e-05, -3.29246795e-05, -3.95834686e-05,
+    -3.73072326e-05, -2.56107778e-05, -6.28652424e-06, 1.67814378e-05,
+    3.83433653e-05, 5.29349018e-05, 5.62052301e-05, 4.61167838e-05,
+    2.36980304e-05, -6.88099317e-06, -3.90065725e-05, -6.49922658e-05,
+    -7.78617032e-05, -7.31340333e-05, -5.01796312e-05, -1.27604508e-05,
+    3.1453259e-05, 7.23803532e-05, 9.97574898e-05, 0.000105634608,
+    8.65353868e-05, 4.47306011e-05, -1.17763948e-05, -7.06654464e-05,
+    -0.000117904819, -0.000141011973, -0.000132226822, -9.08239308e-05,
+    -2.39074252e-05, 5.46189112e-05, 0.000126828774, 0.000174774294,
+    0.000184833465, 0.000151373592, 7.87885583e-05, -1.87279093e-05,
+    -0.000119795535, -0.000200424169, -0.000239586821, -0.000224539457,
+    -0.000154555237, -4.20601609e-05, 8.93302422e-05, 0.000209609585,
+    0.000289110118, 0.000305659254, 0.000250490819, 0.000131368462,
+    -2.80292497e-05, -0.000192613123, -0.000323442713, -0.000386788481,
+    -0.000362595281, -0.000250293058, -7.03313344e-05, 0.000139199561,
+    0.000330446579, 0.000456543639, 0.000482885167, 0.000396258285,
+    0.000209490958, -3.98339107e-05, -0.000296645158, -0.00050036516,
+    -0.000598979183, -0.000562021916, -0.000389268767, -0.000112809132,
+    0.000208495287, 0.000501264003, 0.000694143993, 0.000734933361,
+    0.00060423027, 0.000322114181, -5.4082444e-05, -0.00044109227,
+    -0.000747852784, -0.00089668046, -0.000842555251, -0.000585823727,
+    -0.000174877816, 0.000302376604, 0.000736983086, 0.00102353666,
+    0.00108536624, 0.000894453784, 0.000480962975, -7.04879858e-05,
+    -0.000637645309, -0.00108738453, -0.00130659563, -0.00123012403,
+    -0.00085897278, -0.000263863214, 0.000427501567, 0.00105739816,
+    0.00147364568, 0.00156592671, 0.00129420881, 0.000702157966,
+    -8.84914407e-05, -0.000902342494, -0.00154876232, -0.00186605775,
+    -0.00176123437, -0.0012357356, -0.000390290195, 0.000593415345,
+    0.00149114383, 0.00208670855, 0.00222335267, 0.00184392987,
+    0.00100978324, -0.000107307918, -0.00125960505, -0.00217771158,
+    -0.00263282727, -0.00249282178, -0.00175852701, -0.000570699165,
+    0.000815558305, 0.00208472298, 0.00293181115, 0.00313469418,
+    0.00261080009, 0.00144403428, -0.00012593712, -0.00175166037,
+    -0.00305370358, -0.00370809413, -0.00352544896, -0.00250280276,
+    -0.000834475621, 0.00112274976, 0.00292447302, 0.00413816702,
+    0.00444535725, 0.00372271496, 0.00208192877, -0.000143281024,
+    -0.00246285531, -0.00433642697, -0.00529710855, -0.00506521761,
+    -0.00362471165, -0.00124243484, 0.00157763693, 0.00419819774,
+    0.00598985841, 0.00647892104, 0.00546786003, 0.00309880218,
+    -0.000158229988, -0.00359412841, -0.0064109182, -0.00790228602,
+    -0.00762468483, -0.00551877683, -0.00194990635, 0.00234699715,
+    0.0064120749, 0.00926741865, 0.0101431329, 0.00867243018,
+    0.00500834035, -0.000169741004, -0.00576983532, -0.0105046192,
+    -0.0131713916, -0.0129366387, -0.00956200343, -0.0035163525,
+    0.00406061392, 0.0115476269, 0.0171564519, 0.0193149168,
+    0.0170426741, 0.0102401162, -0.000177007969, -0.0123384958,
+    -0.0236790553, -0.0313604847, -0.0327857733, -0.0261121485,
+    -0.0106648672, 0.0128321564, 0.0422625802, 0.0743712336,
+    0.10522934, 0.130836263, 0.147754505, 0.15366666,
+    0.147754505, 0.130836263, 0.10522934, 0.0743712336,
+    0.0422625802, 0.0128321564, -0.0106648672, -0.0261121485,
+    -0.0327857733, -0.0313604847, -0.0236790553, -0.0123384958,
+    -0.000177007969, 0.0102401162, 0.0170426741, 0.0193149168,
+    0.0171564519, 0.0115476269, 0.00406061392, -0.0035163525,
+    -0.00956200343, -0.0129366387, -0.0131713916, -0.0105046192,
+    -0.00576983532, -0.000169741004, 0.00500834035, 0.00867243018,
+    0.0101431329, 0.00926741865, 0.0064120749, 0.00234699715,
+    -0.00194990635, -0.00551877683, -0.00762468483, -0.00790228602,
+    -0.0064109182, -0.00359412841, -0.000158229988, 0.00309880218,
+    0.00546786003, 0.00647892104, 0.00598985841, 0.00419819774,
+    0.00157763693, -0.00124243484, -0.00362471165, -0.00506521761,
+    -0.00529710855, -0.00433642697, -0.00246285531, -0.000143281024,
+    0.00208192877, 0.00372271496, 0.00444535725, 0.00413816702,
+    0.00292447302, 0.00112274976, -0.000834475621, -0.00250280276,
+    -0.00352544896, -0.00370809413, -0.00305370358, -0.00175166037,
+    -0.00012593712, 0.00144403428, 0.00261080009, 0.00313469418,
+    0.00293181115, 0.00208472298, 0.000815558305, -0.000570699165,
+    -0.00175852701, -0.00249282178, -0.00263282727, -0.00217771158,
+    -0.00125960505, -0.000107307918, 0.00100978324, 0.00184392987,
+    0.00222335267, 0.00208670855, 0.00149114383, 0.000593415345,
+    -0.000390290195, -0.0012357356, -0.00176123437, -0.00186605775,
+    -0.00154876232, -0.000902342494, -8.84914407e-05, 0.000702157966,
+    0.00129420881, 0.00156592671, 0.00147364568, 0.00105739816,
+    0.000427501567, -0.000263863214, -0.00085897278, -0.00123012403,
+    -0.00130659563, -0.00108738453, -0.000637645309, -7.04879858e-05,
+    0.000480962975, 0.000894453784, 0.00108536624, 0.00102353666,
+    0.000736983086, 0.000302376604, -0.000174877816, -0.000585823727,
+    -0.000842555251, -0.00089668046, -0.000747852784, -0.00044109227,
+    -5.4082444e-05, 0.000322114181, 0.00060423027, 0.000734933361,
+    0.000694143993, 0.000501264003, 0.000208495287, -0.000112809132,
+    -0.000389268767, -0.000562021916, -0.000598979183, -0.00050036516,
+    -0.000296645158, -3.98339107e-05, 0.000209490958, 0.000396258285,
+    0.000482885167, 0.000456543639, 0.000330446579, 0.000139199561,
+    -7.03313344e-05, -0.000250293058, -0.000362595281, -0.000386788481,
+    -0.000323442713, -0.000192613123, -2.80292497e-05, 0.000131368462,
+    0.000250490819, 0.000305659254, 0.000289110118, 0.000209609585,
+    8.93302422e-05, -4.20601609e-05, -0.000154555237, -0.000224539457,
+    -0.000239586821, -0.000200424169, -0.000119795535, -1.87279093e-05,
+    7.87885583e-05, 0.000151373592, 0.000184833465, 0.000174774294,
+    0.000126828774, 5.46189112e-05, -2.39074252e-05, -9.08239308e-05,
+    -0.000132226822, -0.000141011973, -0.000117904819, -7.06654464e-05,
+    -1.17763948e-05, 4.47306011e-05, 8.65353868e-05, 0.000105634608,
+    9.97574898e-05, 7.23803532e-05, 3.1453259e-05, -1.27604508e-05,
+    -5.01796312e-05, -7.31340333e-05, -7.78617032e-05, -6.49922658e-05,
+    -3.90065725e-05, -6.88099317e-06, 2.36980304e-05, 4.61167838e-05,
+    5.62052301e-05, 5.29349018e-05, 3.83433653e-05, 1.67814378e-05,
+    -6.28652424e-06, -2.56107778e-05, -3.73072326e-05, -3.95834686e-05,
+    -3.29246795e-05, -1.97483459e-05, -3.66242625e-06, 1.14668155e-05,
+    2.24044452e-05, 2.72022044e-05, 2.54909737e-05, 1.83884804e-05,
+    8.0820264e-06, -2.78127163e-06, -1.17393911e-05, -1.70435433e-05,
+    -1.7966815e-05, -1.48438176e-05, -8.86721409e-06, -1.7152305e-06,
+    4.88432806e-06, 9.54775442e-06, 1.15004677e-05, 1.06755815e-05,
+    7.63317166e-06, 3.35127106e-06, -1.05084928e-06, -4.58455133e-06,
+    -6.59579928e-06, -6.86485328e-06, -5.59472801e-06, -3.30374132e-06,
+    -6.58850013e-07, 1.69772784e-06, 3.29096679e-06, 3.89488696e-06,
+    3.54410599e-06, 2.48201695e-06, 1.074132e-06, -3.01584436e-07,
+    -1.3434128e-06, -1.88248714e-06, -1.8980013e-06, -1.4942259e-06,
+    -8.51266464e-07, -1.69573724e-07, 3.84067761e-07, 7.11714165e-07,
+    7.92942501e-07, 6.72855833e-07, 4.3561198e-07, 1.73402341e-07,
+};
+
+// 3:2, quality 3: 2 phases of 72 taps.
+const float kTable3To2Quality3[] = {
+    1.59189876e-05, 6.23789747e-05, -0.000106989413, -5.70367702e-05,
+    0.00028767981, -0.000125189938, -0.000452298525, 0.000591687509,
+    0.00033041506, -0.00125875534, 0.000415122689, 0.0017022714,
+    -0.00191403716, -0.00119497674, 0.00374414143, -0.000946033571,
+    -0.00476200925, 0.00475642877, 0.00337133929, -0.00905440096,
+    0.00168512552, 0.0113210408, -0.0102425385, -0.00833796524,
+    0.019846268, -0.00247970666, -0.0256020557, 0.0215665828,
+    0.0207754131, -0.0462818295, 0.00309886993, 0.071210444,
+    -0.0633609518, -0.0897881985, 0.302868128, 0.596666634,
+    0.302868128, -0.0897881985, -0.0633609518, 0.071210444,
+    0.00309886993, -0.0462818295, 0.0207754131, 0.0215665828,
+    -0.0256020557, -0.00247970666, 0.019846268, -0.00833796524,
+    -0.0102425385, 0.0113210408, 0.00168512552, -0.00905440096,
+    0.00337133929, 0.00475642877, -0.00476200925, -0.000946033571,
+    0.00374414143, -0.00119497674, -0.00191403716, 0.0017022714,
+    0.000415122689, -0.00125875534, 0.00033041506, 0.000591687509,
+    -0.000452298525, -0.000125189938, 0.00028767981, -5.70367702e-05,
+    -0.000106989413, 6.23789747e-05, 1.59189876e-05, -2.06389886e-05,
+    -1.69072318e-05, 5.8251404e-05, -3.75394507e-06, -0.000151599917,
+    0.000143764977, 0.000199982067, -0.000451553118, -1.01090072e-05,
+    0.000817999884, -0.000619500817, -0.000890291471, 0.00167790218,
+    0.000153074288, -0.00270621432, 0.00175069703, 0.00275443657,
+    -0.00454904512, -0.000717981951, 0.00699478434, -0.00394214597,
+    -0.00698730769, 0.0103720548, 0.00235178228, -0.0158678647,
+    0.0078805685, 0.0162040275, -0.0221977048, -0.00676774047,
+    0.0359093174, -0.0161532518, -0.0410212614, 0.0557526685,
+    0.0240478422, -0.125001892, 0.0682920665, 0.512698054,
+    0.512698054, 0.0682920665, -0.125001892, 0.0240478422,
+    0.0557526685, -0.0410212614, -0.0161532518, 0.0359093174,
+    -0.00676774047, -0.0221977048, 0.0162040275, 0.0078805685,
+    -0.0158678647, 0.00235178228, 0.0103720548, -0.00698730769,
+    -0.00394214597, 0.00699478434, -0.000717981951, -0.00454904512,
+    0.00275443657, 0.00175069703, -0.00270621432, 0.000153074288,
+    0.00167790218, -0.000890291471, -0.000619500817, 0.000817999884,
+    -1.01090072e-05, -0.000451553118, 0.000199982067, 0.000143764977,
+    -0.000151599917, -3.75394507e-06, 5.8251404e-05, -1.69072318e-05,
+};
+
+// 3:2, quality 4: 2 phases of 96 taps.
+const float kTable3To2Quality4[] = {
+    1.21420653e-05, 3.14183708e-05, -6.23189771e-05, -4.87483794e-06,
+    0.000127521751, -0.000110954614, -0.000122541882, 0.000298459112,
+    -6.509589e-05, -0.000417077244, 0.000462688826, 0.000234796331,
+    -0.000887182949, 0.000405576488, 0.000935009972, -0.00135157199,
+    -0.000189956729, 0.00202175789, -0.00139238068, -0.00160006213,
+    0.00315884617, -0.000422462501, -0.00382014457, 0.00360913249,
+    0.00208234088, -0.00631646765, 0.0023379596, 0.00622501411,
+    -0.00789918844, -0.00166853087, 0.0113243153, -0.00681709964,
+    -0.00894795638, 0.0156895574, -0.00104668725, -0.0191489588,
+    0.0165586714, 0.0115025686, -0.0308721028, 0.00978183188,
+    0.033805605, -0.0419005826, -0.0133336307, 0.0767937526,
+    -0.0497967452, -0.103821836, 0.297628522, 0.614000022,
+    0.297628522, -0.103821836, -0.0497967452, 0.0767937526,
+    -0.0133336307, -0.0419005826, 0.033805605, 0.00978183188,
+    -0.0308721028, 0.0115025686, 0.0165586714, -0.0191489588,
+    -0.00104668725, 0.0156895574, -0.00894795638, -0.00681709964,
+    0.0113243153, -0.00166853087, -0.00789918844, 0.00622501411,
+    0.0023379596, -0.00631646765, 0.00208234088, 0.00360913249,
+    -0.00382014457, -0.000422462501, 0.00315884617, -0.00160006213,
+    -0.00139238068, 0.00202175789, -0.000189956729, -0.00135157199,
+    0.000935009972, 0.000405576488, -0.000887182949, 0.000234796331,
+    0.000462688826, -0.000417077244, -6.509589e-05, 0.000298459112,
+    -0.000122541882, -0.000110954614, 0.000127521751, -4.87483794e-06,
+    -6.23189771e-05, 3.14183708e-05, 1.21420653e-05, -1.54498812e-05,
+    -1.0560746e-05, 3.56375895e-05, -1.0982274e-05, -6.92864269e-05,
+    9.05964625e-05, 4.57207025e-05, -0.000205899443, 0.000108826229,
+    0.00024473641, -0.00039157088, -4.2195501e-05, 0.000636207464,
+    -0.0004803107, -0.000529934885, 0.00114068005, -0.000195815257,
+    -0.00144192018, 0.00145955896, 0.000783723721, -0.00262082508,
+    0.00107180525, 0.00262739812, -0.00353027252, -0.000617153535,
+    0.00509266974, -0.00325759593, -0.00396953337, 0.00732108438,
+    -0.000726960308, -0.00873583369, 0.00781530514, 0.00489669479,
+    -0.0137458863, 0.0046464554, 0.0137468353, -0.0167777687,
+    -0.00424071867, 0.024945179, -0.0144761456, -0.0211291164,
+    0.0366291739, -0.0012922344, -0.0510300249, 0.0463801548,
+    0.0402245447, -0.125276104, 0.0519375205, 0.522926211,
+    0.522926211, 0.0519375205, -0.125276104, 0.0402245447,
+    0.0463801548, -0.0510300249, -0.0012922344, 0.0366291739,
+    -0.0211291164, -0.0144761456, 0.024945179, -0.00424071867,
+    -0.0167777687, 0.0137468353, 0.0046464554, -0.0137458863,
+    0.00489669479, 0.00781530514, -0.00873583369, -0.000726960308,
+    0.00732108438, -0.00396953337, -0.00325759593, 0.00509266974,
+    -0.000617153535, -0.00353027252, 0.00262739812, 0.00107180525,
+    -0.00262082508, 0.000783723721, 0.00145955896, -0.00144192018,
+    -0.000195815257, 0.00114068005, -0.000529934885, -0.0004803107,
+    0.000636207464, -4.2195501e-05, -0.00039157088, 0.00024473641,
+    0.000108826229, -0.000205899443, 4.57207025e-05, 9.05964625e-05,
+    -6.92864269e-05, -1.0982274e-05, 3.56375895e-05, -1.0560746e-05,
+};
+
+// 3:2, quality 5: 2 phases of 120 taps.
+const float kTable3To2Quality5[] = {
+    2.84685666e-06, -5.97690359e-06, -1.20633774e-06, 1.55795478e-05,
+    -1.32149653e-05, -1.83382053e-05, 4.2702326e-05, -6.86092199e-06,
+    -6.81741731e-05, 7.35539215e-05, 4.58672621e-05, -0.000158333874,
+    6.71257512e-05, 0.000184467135, -0.000259969063, -5.10418031e-05,
+    0.000422538433, -0.000282661786, -0.000363295723, 0.000699097174,
+    -7.49116371e-05, -0.000898157828, 0.00083843834, 0.00052547385,
+    -0.00154715392, 0.000556798244, 0.00158503314, -0.00200146064,
+    -0.000451236527, 0.00293973344, -0.00176436908, -0.00234329491,
+    0.00409414666, -0.000281951943, -0.00492049614, 0.00422959263,
+    0.00280863186, -0.00746423099, 0.00237366138, 0.00737571949,
+    -0.0087108463, -0.00228279666, 0.0125387767, -0.00700664148,
+    -0.010011211, 0.0165526681, -0.000573124096, -0.0202608705,
+    0.016792791, 0.0123952087, -0.0316091441, 0.0093879886,
+    0.0346897207, -0.0420184769, -0.01406541, 0.0772596672,
+    -0.0493539833, -0.104448594, 0.297484934, 0.614666641,
+    0.297484934, -0.104448594, -0.0493539833, 0.0772596672,
+    -0.01406541, -0.0420184769, 0.0346897207, 0.0093879886,
+    -0.0316091441, 0.0123952087, 0.016792791, -0.0202608705,
+    -0.000573124096, 0.0165526681, -0.010011211, -0.00700664148,
+    0.0125387767, -0.00228279666, -0.0087108463, 0.00737571949,
+    0.00237366138, -0.00746423099, 0.00280863186, 0.00422959263,
+    -0.00492049614, -0.000281951943, 0.00409414666, -0.00234329491,
+    -0.00176436908, 0.00293973344, -0.000451236527, -0.00200146064,
+    0.00158503314, 0.000556798244, -0.00154715392, 0.00052547385,
+    0.00083843834, -0.000898157828, -7.49116371e-05, 0.000699097174,
+    -0.000363295723, -0.000282661786, 0.000422538433, -5.10418031e-05,
+    -0.000259969063, 0.000184467135, 6.71257512e-05, -0.000158333874,
+    4.58672621e-05, 7.35539215e-05, -6.81741731e-05, -6.86092199e-06,
+    4.2702326e-05, -1.83382053e-05, -1.32149653e-05, 1.55795478e-05,
+    -1.20633774e-06, -5.97690359e-06, 2.84685666e-06, 6.93609365e-07,
+    2.69142333e-06, -6.78294896e-07, -7.52994856e-06, 9.92806781e-06,
+    6.79091136e-06, -2.74594131e-05, 1.34050842e-05, 3.81910177e-05,
+    -5.93752702e-05, -1.11250865e-05, 0.000108808817, -7.89933838e-05,
+    -0.000102443111, 0.000211739607, -2.75239727e-05, -0.000292536133,
+    0.000289521413, 0.000178922404, -0.000564047892, 0.000218475645,
+    0.000605494366, -0.000801696675, -0.000168240644, 0.00122263702,
+    -0.000770452491, -0.00100117223, 0.00182617456, -0.000159335643,
+    -0.00224808767, 0.00200505601, 0.00128845673, -0.00358672184,
+    0.00120950642, 0.00357781514, -0.00434953813, -0.00105545286,
+    0.00626370683, -0.00360936997, -0.00494294241, 0.00834683422,
+    -0.000429231673, -0.0099712871, 0.0083388919, 0.00577613711,
+    -0.0148323765, 0.00449099904, 0.0148908598, -0.0173457079,
+    -0.00496973936, 0.0259156842, -0.0143765137, -0.0220751073,
+    0.0370696746, -0.000678964017, -0.0517465547, 0.0461905077,
+    0.0409604646, -0.125441939, 0.0513286255, 0.523345053,
+    0.523345053, 0.0513286255, -0.125441939, 0.0409604646,
+    0.0461905077, -0.0517465547, -0.000678964017, 0.0370696746,
+    -0.0220751073, -0.0143765137, 0.0259156842, -0.00496973936,
+    -0.0173457079, 0.0148908598, 0.00449099904, -0.0148323765,
+    0.00577613711, 0.0083388919, -0.0099712871, -0.000429231673,
+    0.00834683422, -0.00494294241, -0.00360936997, 0.00626370683,
+    -0.00105545286, -0.00434953813, 0.00357781514, 0.00120950642,
+    -0.00358672184, 0.00128845673, 0.00200505601, -0.00224808767,
+    -0.000159335643, 0.00182617456, -0.00100117223, -0.000770452491,
+    0.00122263702, -0.000168240644, -0.000801696675, 0.000605494366,
+    0.000218475645, -0.000564047892, 0.000178922404, 0.000289521413,
+    -0.000292536133, -2.75239727e-05, 0.000211739607, -0.000102443111,
+    -7.89933838e-05, 0.000108808817, -1.11250865e-05, -5.93752702e-05,
+    3.81910177e-05, 1.34050842e-05, -2.74594131e-05, 6.79091136e-06,
+    9.92806781e-06, -7.52994856e-06, -6.78294896e-07, 2.69142333e-06,
+};
+
+}  // namespace
+
+const ResamplerTable kResamplerTables[] = {
+    {1, 2, 3, 48, kTable1To2Quality3},
+    {1, 2, 4, 64, kTable1To2Quality4},
+    {1, 2, 5, 80, kTable1To2Quality5},
+    {1, 3, 3, 48, kTable1To3Quality3},
+    {1, 3, 4, 64, kTable1To3Quality4},
+    {1, 3, 5, 80, kTable1To3Quality5},
+    {1, 6, 3, 48, kTable1To6Quality3},
+    {1, 6, 4, 64, kTable1To6Quality4},
+    {1, 6, 5, 80, kTable1To6Quality5},
+    {2, 3, 3, 48, kTable2To3Quality3},
+    {2, 3, 4, 64, kTable2To3Quality4},
+    {2, 3, 5, 80, kTable2To3Quality5},
+    {2, 1, 3, 96, kTable2To1Quality3},
+    {2, 1, 4, 128, kTable2To1Quality4},
+    {2, 1, 5, 160, kTable2To1Quality5},
+    {3, 1, 3, 144, kTable3To1Quality3},
+    {3, 1, 4, 192, kTable3To1Quality4},
+    {3, 1, 5, 240, kTable3To1Quality5},
+    {6, 1, 3, 288, kTable6To1Quality3},
+    {6, 1, 4, 384, kTable6To1Quality4},
+    {6, 1, 5, 480, kTable6To1Quality5},
+    {3, 2, 3, 72, kTable3To2Quality3},
+    {3, 2, 4, 96, kTable3To2Quality4},
+    {3, 2, 5, 120, kTable3To2Quality5},
+};
+
+const int kNumResamplerTables =
+    sizeof(kResamplerTables) / sizeof(kResamplerTables[0]);
+
+}  // namespace audio_util
@@ -0,0 +1,26 @@
+#ifndef AUDIO_UTIL_RESAMPLER_TABLES_H_
+#define AUDIO_UTIL_RESAMPLER_TABLES_H_
+
+namespace audio_util {
+
+// Polyphase filter of a fixed resampling ratio, as the Speex resampler
+// computes it at runtime, for the ratios between 8, 16, 24 and 48 kHz.
+//
+// An output at phase p is the inner product of the `taps` coefficients
+// from coefficients[p * taps] with the input window; the phase of the
+// output k is (k * input_rate) % output_rate.
+struct ResamplerTable {
+  int input_rate;   // Reduced ratio, 2:3 for 16 to 24 kHz.
+  int output_rate;  // Also the number of phases.
+  int quality;
+  int taps;
+  const float* coefficients;
+};
+
+// Generated by tools/resampler_tables_generator.cc, in resampler_tables.cc.
+extern const ResamplerTable kResamplerTables[];
+extern const int kNumResamplerTables;
+
+}  // namespace audio_util
+
+#endif  // AUDIO_UTIL_RESAMPLER_TABLES_H_
@@ -0,0 +1,223 @@
+/*
+ * Host tests of the WAV and AIFF readers of opus-tools' audio-in.c
+ *
+ * - Regular files are memory mapped, their chunks found in place, and
+ *   read as through stdio: the same rate, channels, length and floats, for
+ *   8, 16 and 24 bit PCM and float WAV, extensible WAV with its channel
+ *   order, big and little endian AIFF, and whatever the read size
+ * - The samples convert exactly, full scale included
+ * - The length of the data chunk is followed, unless implausible, as the
+ *   0xffffffff of stream writers, or --ignorelength: then the file is read
+ *   to its end
+ * - Pipes, and nommap, are read through stdio
+ */
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include <ogg/ogg.h>
+
+#include "opusenc.h"
+}
+
+#include "../tools/pcm_file_writer.h"
+#include "test_util.h"
+
+using audio_util::PcmFileFormat;
+
+namespace {
+
+struct Decoded {
+  bool opened = false;
+  bool mapped = false;
+  long rate = 0;
+  int channels = 0;
+  opus_int64 total_samples_per_channel = 0;
+  std::vector<float> samples;
+};
+
+Decoded Read(FILE* in, bool nommap, bool ignorelength, int chunk) {
+  Decoded decoded;
+  oe_enc_opt opt = {};
+  opt.nommap = nommap;
+  opt.ignorelength = ignorelength;
+  input_format* format = open_audio_file(in, &opt);
+  if (!format) {
+    return decoded;
+  }
+  decoded.opened = true;
+  decoded.mapped = opt.read_samples == wav_map_read;
+  decoded.rate = opt.rate;
+  decoded.channels = opt.channels;
+  decoded.total_samples_per_channel = opt.total_samples_per_channel;
+  std::vector<float> buffer(chunk * opt.channels);
+  long n;
+  while ((n = opt.read_samples(opt.readdata, buffer.data(), chunk)) > 0) {
+    decoded.samples.insert(decoded.samples.end(), buffer.begin(),
+                           buffer.begin() + n * opt.channels);
+  }
+  format->close_func(opt.readdata);
+  return decoded;
+}
+
+Decoded ReadFile(const std::string& path, bool nommap,
+                 bool ignorelength = false, int chunk = 960) {
+  FILE* in = fopen(path.c_str(), "rb");
+  if (!in) {
+    return Decoded();
+  }
+  Decoded decoded = Read(in, nommap, ignorelength, chunk);
+  fclose(in);
+  return decoded;
+}
+
+std::string TempPath(const char* name) {
+  const char* dir = getenv("TMPDIR");
+  return std::string(dir ? dir : "/tmp") + "/audio_in_test_" +
+         std::to_string(getpid()) + "_" + name;
+}
+
+// Pseudo random samples in [-1, 1), with the extremes.
+std::vector<float> Samples(int num_frames, int num_channels) {
+  std::vector<float> samples(num_frames * num_channels);
+  unsigned seed = 7;
+  for (float& x : samples) {
+    seed = seed * 1103515245u + 12345u;
+    x = static_cast<int>(seed >> 8 & 0xffff) / 32768.f - 1;
+  }
+  samples[0] = -1;
+  samples[1] = 0.99999f;
+  return samples;
+}
+
+void TestFormats() {
+  const PcmFileFormat kFormats[] = {
+      {PcmFileFormat::kWav, 16, 2, 48000},
+      {PcmFileFormat::kWav, 16, 1, 16000},
+      {PcmFileFormat::kWav, 24, 2, 44100},
+      {PcmFileFormat::kWav, 32, 2, 48000},
+      {PcmFileFormat::kWav, 8, 1, 8000},
+      {PcmFileFormat::kWavExtensible, 16, 6, 48000},
+      {PcmFileFormat::kWavExtensible, 24, 8, 48000},
+      {PcmFileFormat::kAiff, 16, 2, 44100},
+      {PcmFileFormat::kAiff, 16, 3, 22050},
+      {PcmFileFormat::kAifcSowt, 16, 2, 48000},
+  };
+  const int kNumFrames = 10007;  // Not a multiple of the vectors.
+  for (const PcmFileFormat& format : kFormats) {
+    const std::string path = TempPath("formats");
+    const std::vector<float> samples =
+        Samples(kNumFrames, format.num_channels);
+    CHECK(audio_util::WritePcmFile(path, format, samples), "write %s",
+          path.c_str());
+    const Decoded ref = ReadFile(path, true);
+    CHECK(ref.opened && !ref.mapped, "stdio open, %d bits, %d channels",
+          format.bits, format.num_channels);
+    CHECK(ref.rate == format.sample_rate_hz &&
+              ref.channels == format.num_channels &&
+              ref.samples.size() == samples.size(),
+          "stdio format, %d bits, %d channels: %ld Hz, %d channels, "
+          "%zu samples",
+          format.bits, format.num_channels, ref.rate, ref.channels,
+          ref.samples.size());
+
+    for (int chunk : {1, 7, 960, 100000}) {
+      const Decoded mapped = ReadFile(path, false, false, chunk);
+      CHECK(mapped.opened && mapped.mapped, "mapped open, %d bits",
+            format.bits);
+      CHECK(mapped.rate == ref.rate && mapped.channels == ref.channels &&
+                mapped.total_samples_per_channel ==
+                    ref.total_samples_per_channel &&
+                mapped.samples == ref.samples,
+            "mapped %d bits, %d channels, by %d: other samples",
+            format.bits, format.num_channels, chunk);
+    }
+
+    // Full scale, and exact conversions of the files in file order.
+    if (format.num_channels <= 2 && format.bits >= 16) {
+      CHECK(ref.samples[0] == -1, "%d bits: %g for -1", format.bits,
+            ref.samples[0]);
+      const float scale = format.bits == 32 ? 1 : 1 << (format.bits - 1);
+      bool exact = true;
+      for (size_t i = 0; i < samples.size(); i++) {
+        const float q =
+            format.bits == 32
+                ? samples[i]
+                : std::max(-scale, std::min(scale - 1,
+                                            std::round(samples[i] * scale))) /
+                      scale;
+        exact &= ref.samples[i] == q;
+      }
+      CHECK(exact, "%d bits: inexact samples", format.bits);
+    }
+    remove(path.c_str());
+  }
+}
+
+void TestLengths() {
+  const PcmFileFormat format = {PcmFileFormat::kWav, 16, 2, 48000};
+  const std::vector<float> samples = Samples(4800, 2);
+  const std::string path = TempPath("lengths");
+
+  // Stream writers' length.
+  CHECK(audio_util::WritePcmFile(path, format, samples, 0xffffffff),
+        "write %s", path.c_str());
+  for (bool nommap : {true, false}) {
+    const Decoded decoded = ReadFile(path, nommap);
+    CHECK(decoded.opened && decoded.samples.size() == samples.size() &&
+              decoded.total_samples_per_channel == 4800,
+          "stream length, nommap %d: %zu samples, total %lld", nommap,
+          decoded.samples.size(),
+          static_cast<long long>(decoded.total_samples_per_channel));
+  }
+
+  // A short data chunk is followed, unless --ignorelength, which reads to
+  // the end.
+  CHECK(audio_util::WritePcmFile(path, format, samples, 400), "write %s",
+        path.c_str());
+  for (bool nommap : {true, false}) {
+    const Decoded declared = ReadFile(path, nommap);
+    const Decoded ignored = ReadFile(path, nommap, true);
+    CHECK(declared.samples.size() == 200 &&
+              ignored.samples.size() == samples.size() &&
+              ignored.total_samples_per_channel == 0,
+          "ignorelength, nommap %d: %zu and %zu samples", nommap,
+          declared.samples.size(), ignored.samples.size());
+  }
+  remove(path.c_str());
+}
+
+void TestPipe() {
+  const PcmFileFormat format = {PcmFileFormat::kWav, 16, 2, 48000};
+  const std::vector<float> samples = Samples(4800, 2);
+  const std::string path = TempPath("pipe");
+  CHECK(audio_util::WritePcmFile(path, format, samples), "write %s",
+        path.c_str());
+  const Decoded ref = ReadFile(path, false);
+  FILE* in = popen(("cat " + path).c_str(), "r");
+  CHECK(in != nullptr, "popen");
+  if (in) {
+    const Decoded piped = Read(in, false, false, 960);
+    CHECK(piped.opened && !piped.mapped && piped.samples == ref.samples,
+          "pipe: %zu samples", piped.samples.size());
+    pclose(in);
+  }
+  remove(path.c_str());
+}
+
+}  // namespace
+
+int main() {
+  TestFormats();
+  TestLengths();
+  TestPipe();
+
+  return audio_util::test::Report("audio_in");
+}
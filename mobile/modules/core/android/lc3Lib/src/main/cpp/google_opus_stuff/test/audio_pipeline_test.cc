@@ -0,0 +1,269 @@
+/*
+ * Host tests of the fused conversion of opus-tools' audio-in.c,
+ * setup_pipeline, against the chained readers it replaces
+ *
+ * - Downmixed, resampled, or both, the samples, rate, channels, skip and
+ *   length are those of setup_downmix and setup_resample, whatever the read
+ *   size
+ * - The scale is applied, folded in the downmix or not
+ * - The padding extends the input by opt->extraout samples, extrapolated
+ *   as closely as by setup_padder, and the input samples are counted
+ * - An unsupported downmix keeps the channels, as setup_downmix
+ * - Without a downmix, the chained readers are set up and cleared in its
+ *   place
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+extern "C" {
+#include <ogg/ogg.h>
+
+#include "opusenc.h"
+}
+
+#include "test_util.h"
+
+namespace {
+
+// Interleaved samples, read as from a file.
+struct Memory {
+  const float* samples;
+  size_t num_frames;
+  int channels;
+  size_t position;
+};
+
+long ReadMemory(void* data, float* buffer, int samples) {
+  Memory* m = static_cast<Memory*>(data);
+  const size_t n =
+      std::min<size_t>(samples, m->num_frames - m->position);
+  std::copy(m->samples + m->position * m->channels,
+            m->samples + (m->position + n) * m->channels, buffer);
+  m->position += n;
+  return n;
+}
+
+// Tones, a different one per channel.
+std::vector<float> Tones(size_t num_frames, int channels, int rate) {
+  std::vector<float> samples(num_frames * channels);
+  for (size_t i = 0; i < num_frames; i++) {
+    for (int c = 0; c < channels; c++) {
+      samples[i * channels + c] = static_cast<float>(
+          .3 * std::sin(2 * M_PI * (300 + 170 * c) * i / rate) +
+          .1 * std::sin(2 * M_PI * 2300 * i / rate + c));
+    }
+  }
+  return samples;
+}
+
+struct Converted {
+  long rate = 0;
+  int channels = 0;
+  int skip = 0;
+  opus_int64 total_samples_per_channel = 0;
+  ogg_int64_t original_samples = 0;
+  std::vector<float> samples;
+};
+
+struct Conversion {
+  int in_channels;
+  long in_rate;
+  float scale;
+  int channels;  // 0 to keep them.
+  long rate;     // 0 to keep it.
+  int extraout;  // Padding, none when 0.
+};
+
+// Converts `input` by the fused pipeline, or by the chained readers in the
+// order of opusenc: scaler, downmix, padder, resampler.
+Converted Convert(const std::vector<float>& input, const Conversion& c,
+                  bool fused, int chunk) {
+  Memory memory = {input.data(), input.size() / c.in_channels, c.in_channels,
+                   0};
+  oe_enc_opt opt = {};
+  opt.read_samples = ReadMemory;
+  opt.readdata = &memory;
+  opt.channels = c.in_channels;
+  opt.rate = c.in_rate;
+  opt.total_samples_per_channel = memory.num_frames;
+  Converted converted;
+  bool downmixed = false;
+  if (fused) {
+    oe_pipeline_opt pipeline = {};
+    pipeline.scale = c.scale;
+    pipeline.channels = c.channels;
+    pipeline.rate = c.rate;
+    pipeline.quality = 5;
+    pipeline.original_samples =
+        c.extraout ? &converted.original_samples : nullptr;
+    pipeline.pad = c.extraout != 0;
+    CHECK(setup_pipeline(&opt, &pipeline), "setup_pipeline");
+  } else {
+    if (c.scale != 1) {
+      setup_scaler(&opt, c.scale);
+    }
+    if (c.channels > 0 && c.channels < c.in_channels) {
+      downmixed = setup_downmix(&opt, c.channels) != 0;
+    }
+    if (c.extraout) {
+      setup_padder(&opt, &converted.original_samples);
+    }
+    if (c.rate > 0 && c.rate != c.in_rate) {
+      setup_resample(&opt, 5, c.rate);
+    }
+  }
+  opt.extraout = c.extraout;
+
+  converted.rate = opt.rate;
+  converted.channels = opt.channels;
+  converted.skip = opt.skip;
+  converted.total_samples_per_channel = opt.total_samples_per_channel;
+  std::vector<float> buffer(chunk * opt.channels);
+  long n;
+  while ((n = opt.read_samples(opt.readdata, buffer.data(), chunk)) > 0) {
+    converted.samples.insert(converted.samples.end(), buffer.begin(),
+                             buffer.begin() + n * opt.channels);
+    if (n < chunk) {
+      break;
+    }
+  }
+
+  if (fused) {
+    clear_pipeline(&opt);
+  } else {
+    if (c.rate > 0 && c.rate != c.in_rate) {
+      clear_resample(&opt);
+    }
+    if (c.extraout) {
+      clear_padder(&opt);
+    }
+    if (downmixed) {
+      clear_downmix(&opt);
+    }
+    if (c.scale != 1) {
+      clear_scaler(&opt);
+    }
+  }
+  CHECK(opt.readdata == &memory && opt.channels == c.in_channels,
+        "readers not cleared");
+  return converted;
+}
+
+float MaxDifference(const std::vector<float>& a, const std::vector<float>& b,
+                    size_t n) {
+  float max = 0;
+  for (size_t i = 0; i < n; i++) {
+    max = std::max(max, std::fabs(a[i] - b[i]));
+  }
+  return max;
+}
+
+void TestConversions() {
+  const Conversion kConversions[] = {
+      {2, 48000, 1, 1, 16000, 0},  // The glasses audio to LC3 or Opus.
+      {2, 48000, 1, 1, 0, 0},
+      {2, 44100, 1, 0, 48000, 0},
+      {6, 48000, 1, 2, 24000, 0},
+      {10, 16000, 1, 1, 0, 0},
+      {10, 16000, 1, 2, 0, 0},  // Not supported, kept.
+      {1, 16000, .5f, 0, 0, 0},
+      {2, 48000, .25f, 1, 16000, 0},
+  };
+  for (const Conversion& c : kConversions) {
+    const std::vector<float> input = Tones(48000 + 77, c.in_channels,
+                                           c.in_rate);
+    const Converted chained = Convert(input, c, false, 960);
+    CHECK(!chained.samples.empty(), "empty");
+    for (int chunk : {1, 7, 320, 960, 5000}) {
+      const Converted fused = Convert(input, c, true, chunk);
+      CHECK(fused.rate == chained.rate && fused.channels == chained.channels &&
+                fused.skip == chained.skip &&
+                fused.total_samples_per_channel ==
+                    chained.total_samples_per_channel &&
+                fused.samples.size() == chained.samples.size(),
+            "%d ch %ld Hz to %d ch %ld Hz, by %d: %ld Hz, %d ch, skip %d, "
+            "%zu samples, for %ld Hz, %d ch, skip %d, %zu samples",
+            c.in_channels, c.in_rate, c.channels, c.rate, chunk, fused.rate,
+            fused.channels, fused.skip, fused.samples.size(), chained.rate,
+            chained.channels, chained.skip, chained.samples.size());
+      // The scale folded in the downmix rounds otherwise.
+      const float tolerance = c.scale != 1 && c.channels ? 1e-6f : 0;
+      const float difference =
+          MaxDifference(fused.samples, chained.samples,
+                        std::min(fused.samples.size(),
+                                 chained.samples.size()));
+      CHECK(difference <= tolerance,
+            "%d ch %ld Hz to %d ch %ld Hz, by %d: samples differ by %g",
+            c.in_channels, c.in_rate, c.channels, c.rate, chunk, difference);
+    }
+  }
+}
+
+void TestPadding() {
+  // Downmixed tones, their continuation extrapolated from the first 20000
+  // samples.
+  const int kExtra = 312;
+  const std::vector<float> tones = Tones(20000 + kExtra, 2, 48000);
+  const Conversion downmix = {2, 48000, 1, 1, 0, 0};
+  const std::vector<float> tone = Convert(tones, downmix, false, 960).samples;
+  const std::vector<float> input(tones.begin(), tones.begin() + 2 * 20000);
+  const Conversion c = {2, 48000, 1, 1, 0, kExtra};
+  const Converted fused = Convert(input, c, true, 960);
+  const Converted chained = Convert(input, c, false, 960);
+  CHECK(fused.original_samples == 20000 &&
+            chained.original_samples == 20000,
+        "%lld and %lld input samples",
+        static_cast<long long>(fused.original_samples),
+        static_cast<long long>(chained.original_samples));
+  CHECK(fused.samples.size() == tone.size() &&
+            chained.samples.size() == tone.size(),
+        "%zu and %zu samples padded, of %zu", fused.samples.size(),
+        chained.samples.size(), tone.size());
+  CHECK(MaxDifference(fused.samples, tone, 20000) == 0, "input altered");
+  // Extrapolated from other blocks than by setup_padder, as closely.
+  if (fused.samples.size() == tone.size() &&
+      chained.samples.size() == tone.size()) {
+    double fused_error = 0;
+    double chained_error = 0;
+    double onset_error = 0;
+    double onset_energy = 0;
+    for (size_t i = 20000; i < tone.size(); i++) {
+      const double e = fused.samples[i] - tone[i];
+      const double f = chained.samples[i] - tone[i];
+      fused_error += e * e;
+      chained_error += f * f;
+      if (i < 20000 + 16) {
+        onset_error += e * e;
+        onset_energy += tone[i] * tone[i];
+      }
+    }
+    CHECK(fused_error < chained_error * 1.25,
+          "extrapolation error %g, %g by setup_padder", fused_error,
+          chained_error);
+    CHECK(onset_error < onset_energy * .1,
+          "extrapolation error %g of %g at the end of the input",
+          onset_error, onset_energy);
+  }
+
+  // Resampled after the padding, as by opusenc.
+  const Conversion r = {2, 48000, 1, 1, 16000, 300};
+  const Converted fused_resampled = Convert(Tones(20000, 2, 48000), r, true,
+                                            320);
+  const Converted chained_resampled = Convert(Tones(20000, 2, 48000), r,
+                                              false, 320);
+  CHECK(fused_resampled.samples.size() == chained_resampled.samples.size(),
+        "%zu and %zu samples resampled", fused_resampled.samples.size(),
+        chained_resampled.samples.size());
+}
+
+}  // namespace
+
+int main() {
+  TestConversions();
+  TestPadding();
+
+  return audio_util::test::Report("audio_pipeline");
+}
@@ -0,0 +1,291 @@
+/*
+ * Host tests of the batch transcoder
+ *
+ * - Manifests parse, relative inputs taken from their directory, and their
+ *   errors are reported by line
+ * - WAV inputs, stereo at 48 kHz, are transcoded at the codec samplerate,
+ *   the decoded output aligned with the input: the LC3 SNR rises with the
+ *   bitrate, and the WAV written has the length of the input
+ * - Raw LC3 inputs are transcoded
+ * - Errors are reported in the status of their job, the others running
+ * - A batch writes a CSV row per job
+ */
+
+#include <unistd.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include <ogg/ogg.h>
+
+#include "opusenc.h"
+}
+
+#include "../batch_transcoder.h"
+#include "../tools/pcm_file_writer.h"
+#include "lc3.h"
+#include "test_util.h"
+
+using audio_util::BatchJob;
+using audio_util::BatchResult;
+using audio_util::PcmFileFormat;
+
+namespace {
+
+std::string TempPath(const char* name) {
+  const char* dir = getenv("TMPDIR");
+  return std::string(dir ? dir : "/tmp") + "/batch_transcoder_test_" +
+         std::to_string(getpid()) + "_" + name;
+}
+
+// Two tones, `seconds` long, at `sample_rate_hz`, on `num_channels`.
+std::vector<float> Tones(int seconds, int sample_rate_hz, int num_channels) {
+  std::vector<float> samples;
+  for (int i = 0; i < seconds * sample_rate_hz; i++) {
+    const float x = .2f * std::sin(2 * M_PI * 440 * i / sample_rate_hz) +
+                    .1f * std::sin(2 * M_PI * 1300 * i / sample_rate_hz);
+    for (int c = 0; c < num_channels; c++) {
+      samples.push_back(x);
+    }
+  }
+  return samples;
+}
+
+std::vector<BatchJob> Parse(const std::string& text, bool* ok,
+                            std::string* error) {
+  FILE* f = tmpfile();
+  fputs(text.c_str(), f);
+  rewind(f);
+  std::vector<BatchJob> jobs;
+  *ok = audio_util::ParseBatchManifest(f, "/corpus", &jobs, error);
+  fclose(f);
+  return jobs;
+}
+
+void TestManifest() {
+  bool ok;
+  std::string error;
+  std::vector<BatchJob> jobs =
+      Parse("# corpus\n"
+            "\n"
+            "a.wav opus 16000 24000 complexity=9 application=voip\n"
+            "/data/b.wav lc3 16000 32000 lc3_frame_us=7500\n"
+            "  c.lc3 lc3+opus 24000 32000 input_rate_hz=16000 "
+            "input_frame_bytes=60 frame_us=10000",
+            &ok, &error);
+  CHECK(ok && jobs.size() == 3, "%zu jobs, %s", jobs.size(), error.c_str());
+  if (jobs.size() == 3) {
+    CHECK(jobs[0].input == "/corpus/a.wav" &&
+              jobs[0].codec == BatchJob::Codec::kOpus &&
+              jobs[0].bitrate_bps == 24000 &&
+              jobs[0].opus_options.complexity == 9 &&
+              jobs[0].opus_options.application == OPUS_APPLICATION_VOIP,
+          "first job");
+    CHECK(jobs[1].input == "/data/b.wav" &&
+              jobs[1].codec == BatchJob::Codec::kLc3 &&
+              jobs[1].lc3_frame_us == 7500 && jobs[1].input_rate_hz == 16000,
+          "second job");
+    CHECK(jobs[2].codec == BatchJob::Codec::kLc3Opus &&
+              jobs[2].sample_rate_hz == 24000 &&
+              jobs[2].input_rate_hz == 16000 &&
+              jobs[2].input_frame_bytes == 60 &&
+              jobs[2].opus_options.frame_duration_us == 10000,
+          "third job");
+  }
+
+  const struct {
+    const char* text;
+    const char* error;
+  } kErrors[] = {
+      {"a.wav opus 16000\n", "line 1: expected"},
+      {"\na.wav mp3 16000 24000\n", "line 2: unknown codec"},
+      {"a.wav opus 16k 24000\n", "line 1: malformed samplerate"},
+      {"a.wav opus 16000 24000 vbr=1\n", "line 1: unknown option"},
+      {"a.wav opus 16000 24000 complexity=x\n", "line 1: malformed option"},
+  };
+  for (const auto& e : kErrors) {
+    Parse(e.text, &ok, &error);
+    CHECK(!ok && error.compare(0, strlen(e.error), e.error) == 0,
+          "%s: error %s", e.text, error.c_str());
+  }
+}
+
+// Samples of a 16 bit mono WAV file, as read by audio-in.c.
+std::vector<float> ReadWav(const std::string& path, long* rate) {
+  std::vector<float> samples;
+  FILE* in = fopen(path.c_str(), "rb");
+  if (!in) {
+    return samples;
+  }
+  oe_enc_opt opt = {};
+  input_format* format = open_audio_file(in, &opt);
+  if (format) {
+    *rate = opt.rate;
+    std::vector<float> buffer(960 * opt.channels);
+    long n;
+    while ((n = opt.read_samples(opt.readdata, buffer.data(), 960)) > 0) {
+      samples.insert(samples.end(), buffer.begin(),
+                     buffer.begin() + n * opt.channels);
+    }
+    format->close_func(opt.readdata);
+  }
+  fclose(in);
+  return samples;
+}
+
+void TestWavInput() {
+  const std::string input = TempPath("input.wav");
+  CHECK(audio_util::WritePcmFile(input, {PcmFileFormat::kWav, 16, 2, 48000},
+                                 Tones(2, 48000, 2)),
+        "write %s", input.c_str());
+
+  // LC3, from 32 to 96 kb/s.
+  double last_snr = 0;
+  for (int bitrate : {32000, 64000, 96000}) {
+    BatchJob job;
+    job.input = input;
+    job.codec = BatchJob::Codec::kLc3;
+    job.sample_rate_hz = 16000;
+    job.bitrate_bps = bitrate;
+    const BatchResult result = audio_util::RunBatchJob(job, "");
+    CHECK(result.status == "ok", "lc3 %d: %s", bitrate,
+          result.status.c_str());
+    // Less the delay of the resampler.
+    CHECK(result.num_samples > 31500 && result.num_samples <= 32000,
+          "lc3 %d: %llu samples", bitrate,
+          static_cast<unsigned long long>(result.num_samples));
+    CHECK(std::fabs(result.bitrate_bps(16000) - bitrate) < bitrate * .02,
+          "lc3 %d: %.0f b/s", bitrate, result.bitrate_bps(16000));
+    CHECK(result.snr_db > 10 && result.snr_db > last_snr,
+          "lc3 %d: SNR of %.1f dB, after %.1f dB", bitrate, result.snr_db,
+          last_snr);
+    last_snr = result.snr_db;
+  }
+
+  // Opus, and LC3 to Opus, the decoded audio written.
+  for (BatchJob::Codec codec :
+       {BatchJob::Codec::kOpus, BatchJob::Codec::kLc3Opus}) {
+    BatchJob job;
+    job.input = input;
+    job.codec = codec;
+    job.sample_rate_hz = 16000;
+    job.bitrate_bps = 24000;
+    const std::string output = TempPath("output.wav");
+    const BatchResult result = audio_util::RunBatchJob(job, output);
+    CHECK(result.status == "ok" && result.encoded_bytes > 0,
+          "codec %d: %s, %llu bytes", static_cast<int>(codec),
+          result.status.c_str(),
+          static_cast<unsigned long long>(result.encoded_bytes));
+    long rate = 0;
+    const std::vector<float> decoded = ReadWav(output, &rate);
+    CHECK(rate == 16000 && decoded.size() == result.num_samples,
+          "codec %d: %ld Hz, %zu samples written of %llu",
+          static_cast<int>(codec), rate, decoded.size(),
+          static_cast<unsigned long long>(result.num_samples));
+    remove(output.c_str());
+  }
+  remove(input.c_str());
+}
+
+void TestLc3Input() {
+  // 1 s at 16 kHz, of 10 ms frames of 40 bytes, as from the glasses.
+  const std::string input = TempPath("input.lc3");
+  std::vector<unsigned char> mem(lc3_encoder_size(10000, 16000));
+  lc3_encoder_t encoder = lc3_setup_encoder(10000, 16000, 0, mem.data());
+  const std::vector<float> tones = Tones(1, 16000, 1);
+  FILE* f = fopen(input.c_str(), "wb");
+  for (size_t i = 0; i < tones.size(); i += 160) {
+    int16_t pcm[160];
+    unsigned char frame[40];
+    for (int j = 0; j < 160; j++) {
+      pcm[j] = static_cast<int16_t>(tones[i + j] * 32767);
+    }
+    lc3_encode(encoder, LC3_PCM_FORMAT_S16, pcm, 1, sizeof(frame), frame);
+    fwrite(frame, 1, sizeof(frame), f);
+  }
+  fclose(f);
+
+  // Upsampled by the LC3 decoder.
+  BatchJob job;
+  job.input = input;
+  job.codec = BatchJob::Codec::kLc3Opus;
+  job.sample_rate_hz = 48000;
+  job.bitrate_bps = 32000;
+  job.input_rate_hz = 16000;
+  const BatchResult result = audio_util::RunBatchJob(job, "");
+  CHECK(result.status == "ok" && result.num_samples == 48000,
+        "lc3 input: %s, %llu samples", result.status.c_str(),
+        static_cast<unsigned long long>(result.num_samples));
+
+  // Not downsampled.
+  job.sample_rate_hz = 8000;
+  CHECK(audio_util::RunBatchJob(job, "").status != "ok",
+        "lc3 input downsampled");
+  remove(input.c_str());
+}
+
+void TestBatch() {
+  const std::string input = TempPath("batch.wav");
+  CHECK(audio_util::WritePcmFile(input, {PcmFileFormat::kWav, 16, 1, 16000},
+                                 Tones(1, 16000, 1)),
+        "write %s", input.c_str());
+  std::vector<BatchJob> jobs(6);
+  for (size_t i = 0; i < jobs.size(); i++) {
+    jobs[i].input = input;
+    jobs[i].codec = i % 2 ? BatchJob::Codec::kLc3 : BatchJob::Codec::kOpus;
+    jobs[i].bitrate_bps = 16000 + 8000 * i;
+  }
+  jobs[3].input = TempPath("missing.wav");
+  jobs[4].sample_rate_hz = 44100;  // Not an Opus samplerate.
+
+  FILE* csv = tmpfile();
+  const size_t failed = audio_util::RunBatch(jobs, 3, csv, "");
+  CHECK(failed == 2, "%zu failed", failed);
+  rewind(csv);
+  std::vector<std::string> rows;
+  std::string row;
+  for (int c; (c = fgetc(csv)) != EOF;) {
+    if (c == '\n') {
+      rows.push_back(row);
+      row.clear();
+    } else {
+      row += static_cast<char>(c);
+    }
+  }
+  fclose(csv);
+  CHECK(rows.size() == 7 && rows[0] + "\n" == audio_util::BatchCsvHeader(),
+        "%zu rows", rows.size());
+  int ok_rows = 0;
+  for (size_t i = 1; i < rows.size(); i++) {
+    ok_rows += rows[i].size() > 3 &&
+               rows[i].compare(rows[i].size() - 3, 3, ",ok") == 0;
+  }
+  CHECK(ok_rows == 4, "%d rows ok", ok_rows);
+  remove(input.c_str());
+
+  // Quoted.
+  BatchJob job;
+  job.input = "a,\"b\".wav";
+  BatchResult result;
+  result.status = "cannot open the input";
+  const std::string quoted = audio_util::BatchCsvRow(7, job, result);
+  const std::string prefix = "7,\"a,\"\"b\"\".wav\",";
+  CHECK(quoted.compare(0, prefix.size(), prefix) == 0, "row %s",
+        quoted.c_str());
+}
+
+}  // namespace
+
+int main() {
+  TestManifest();
+  TestWavInput();
+  TestLc3Input();
+  TestBatch();
+
+  return audio_util::test::Report("batch_transcoder");
+}
@@ -0,0 +1,139 @@
+/*
+ * Host tests of the OggOpusEncoder metrics
+ *
+ * - Frames, bytes, packets per page and buffered input are all accounted
+ *   for, with either page writer
+ * - All zero when built without AUDIO_UTIL_ENCODER_METRICS
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "../encoder_metrics.h"
+#include "../ogg_opus_encoder.h"
+#include "test_util.h"
+
+using audio_util::EncoderMetricsHistogram;
+using audio_util::EncoderMetricsSnapshot;
+using audio_util::OggOpusEncoder;
+using audio_util::test::GenerateTwoTones;
+
+namespace {
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kBitrateBps = 24000;
+constexpr int kChunkElements = kSampleRateHz / 100;  // 10 ms
+constexpr int kNumChunks = 100;
+constexpr int kNumFrames = kNumChunks / 2;  // Of 20 ms.
+
+uint64_t BucketsTotal(const EncoderMetricsHistogram& histogram) {
+  uint64_t total = 0;
+  for (int i = 0; i < EncoderMetricsHistogram::kBuckets; i++) {
+    total += histogram.buckets[i];
+  }
+  return total;
+}
+
+void TestRawMetrics() {
+  std::vector<int16_t> pcm =
+      GenerateTwoTones(kNumChunks * kChunkElements, kSampleRateHz);
+  OggOpusEncoder::Options options;
+  options.framing = OggOpusEncoder::Framing::kRawLengthPrefixed;
+  OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, options);
+  std::vector<unsigned char> out(1 << 16);
+
+  uint64_t packet_bytes = 0;
+  uint64_t max_packet_bytes = 0;
+  for (int i = 0; i < kNumChunks; i++) {
+    CHECK(encoder.Process(pcm.data() + i * kChunkElements, kChunkElements,
+                          out.data(), out.size()) >= 0,
+          "caller buffer rejected");
+    for (const OggOpusEncoder::PacketInfo& info : encoder.packets()) {
+      packet_bytes += info.length;
+      max_packet_bytes = std::max<uint64_t>(max_packet_bytes, info.length);
+    }
+  }
+
+  EncoderMetricsSnapshot metrics;
+  encoder.GetMetrics(&metrics);
+  if (!audio_util::EncoderMetrics::kEnabled) {
+    const EncoderMetricsSnapshot zero = {};
+    CHECK(memcmp(&metrics, &zero, sizeof(metrics)) == 0,
+          "metrics recorded, while disabled");
+    return;
+  }
+
+  CHECK(metrics.encode_time_us.count == kNumFrames &&
+            BucketsTotal(metrics.encode_time_us) == kNumFrames,
+        "%llu frames timed",
+        static_cast<unsigned long long>(metrics.encode_time_us.count));
+  CHECK(metrics.frame_bytes.count == kNumFrames &&
+            metrics.frame_bytes.sum == packet_bytes &&
+            metrics.frame_bytes.max == max_packet_bytes,
+        "frame bytes: %llu frames, %llu bytes, of %llu",
+        static_cast<unsigned long long>(metrics.frame_bytes.count),
+        static_cast<unsigned long long>(metrics.frame_bytes.sum),
+        static_cast<unsigned long long>(packet_bytes));
+  // 10 ms buffered after every other call, in bucket [8192, 16384).
+  CHECK(metrics.buffered_us.count == kNumChunks &&
+            metrics.buffered_us.buckets[0] == kNumChunks / 2 &&
+            metrics.buffered_us.buckets[14] == kNumChunks / 2 &&
+            metrics.buffered_us.max == 10000,
+        "bad buffered input");
+  CHECK(metrics.page_packets.count == 0, "pages in raw framing");
+}
+
+void TestPageMetrics() {
+  if (!audio_util::EncoderMetrics::kEnabled) {
+    return;
+  }
+  std::vector<int16_t> pcm =
+      GenerateTwoTones(kNumChunks * kChunkElements, kSampleRateHz);
+
+  for (int use_libogg = 0; use_libogg <= 1; use_libogg++) {
+    for (int low_latency = 0; low_latency <= 1; low_latency++) {
+      OggOpusEncoder::Options options;
+      options.low_latency_mode = low_latency;
+      options.use_libogg = use_libogg;
+      OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, options);
+      uint64_t pages = 0;
+      auto count_pages = [&](const std::vector<unsigned char>& bytes) {
+        for (size_t offset = 0; offset < bytes.size(); pages++) {
+          size_t size = 27 + bytes[offset + 26];
+          for (int i = 0; i < bytes[offset + 26]; i++) {
+            size += bytes[offset + 27 + i];
+          }
+          offset += size;
+        }
+      };
+      for (int i = 0; i < kNumChunks; i++) {
+        count_pages(
+            encoder.Process(pcm.data() + i * kChunkElements, kChunkElements));
+      }
+      count_pages(encoder.Flush());
+
+      // Both header packets, and every frame, the flushed one included.
+      EncoderMetricsSnapshot metrics;
+      encoder.GetMetrics(&metrics);
+      CHECK(metrics.page_packets.count == pages &&
+                metrics.page_packets.sum == 2 + kNumFrames + 1,
+            "libogg %d, low latency %d: %llu pages of %llu, %llu packets",
+            use_libogg, low_latency,
+            static_cast<unsigned long long>(metrics.page_packets.count),
+            static_cast<unsigned long long>(pages),
+            static_cast<unsigned long long>(metrics.page_packets.sum));
+    }
+  }
+}
+
+}  // namespace
+
+int main() {
+  TestRawMetrics();
+  TestPageMetrics();
+
+  return audio_util::test::Report("encoder_metrics");
+}
@@ -0,0 +1,138 @@
+/*
+ * Host tests of the Lc3OpusTranscoder
+ *
+ * - The output matches decoding, then encoding, the LC3 stream separately,
+ *   whatever the split of the LC3 bytes between calls
+ * - Frame counts, and concealment of the frames failing validation
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "../lc3_opus_transcoder.h"
+#include "test_util.h"
+
+using audio_util::Lc3OpusTranscoder;
+using audio_util::OggOpusEncoder;
+using audio_util::test::GenerateTwoTones;
+
+namespace {
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kBitrateBps = 24000;
+constexpr int kLc3FrameUs = 10000;
+constexpr int kLc3FrameBytes = 40;
+constexpr int kNumFrames = 101;
+
+OggOpusEncoder::Options RawOptions() {
+  OggOpusEncoder::Options options;
+  options.application = OPUS_APPLICATION_VOIP;
+  options.framing = OggOpusEncoder::Framing::kRawLengthPrefixed;
+  return options;
+}
+
+// LC3 stream of a two tones signal.
+std::vector<unsigned char> EncodeLc3() {
+  const int ns = lc3_frame_samples(kLc3FrameUs, kSampleRateHz);
+  std::vector<unsigned char> mem(lc3_encoder_size(kLc3FrameUs, kSampleRateHz));
+  lc3_encoder_t encoder =
+      lc3_setup_encoder(kLc3FrameUs, kSampleRateHz, 0, mem.data());
+
+  std::vector<unsigned char> lc3(kNumFrames * kLc3FrameBytes);
+  std::vector<int16_t> pcm = GenerateTwoTones(kNumFrames * ns, kSampleRateHz);
+  for (int i = 0; i < kNumFrames; i++) {
+    lc3_encode(encoder, LC3_PCM_FORMAT_S16, &pcm[i * ns], 1, kLc3FrameBytes,
+               lc3.data() + i * kLc3FrameBytes);
+  }
+  return lc3;
+}
+
+// Reference output: LC3 decoded frame by frame, then encoded.
+std::vector<unsigned char> Reference(const std::vector<unsigned char>& lc3) {
+  const int ns = lc3_frame_samples(kLc3FrameUs, kSampleRateHz);
+  std::vector<unsigned char> mem(lc3_decoder_size(kLc3FrameUs, kSampleRateHz));
+  lc3_decoder_t decoder =
+      lc3_setup_decoder(kLc3FrameUs, kSampleRateHz, 0, mem.data());
+  OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, RawOptions());
+
+  std::vector<unsigned char> stream;
+  std::vector<int16_t> pcm(ns);
+  for (size_t i = 0; i < lc3.size(); i += kLc3FrameBytes) {
+    bool valid = lc3_check_frame(decoder, &lc3[i], kLc3FrameBytes) == 0;
+    lc3_decode(decoder, valid ? &lc3[i] : nullptr, kLc3FrameBytes,
+               LC3_PCM_FORMAT_S16, pcm.data(), 1);
+    const std::vector<unsigned char>& bytes = encoder.Process(pcm);
+    stream.insert(stream.end(), bytes.begin(), bytes.end());
+  }
+  const std::vector<unsigned char>& bytes = encoder.Flush();
+  stream.insert(stream.end(), bytes.begin(), bytes.end());
+  return stream;
+}
+
+std::vector<unsigned char> Transcode(const std::vector<unsigned char>& lc3,
+                                     size_t chunk,
+                                     Lc3OpusTranscoder::Stats* stats) {
+  Lc3OpusTranscoder transcoder(kLc3FrameUs, kLc3FrameBytes, kSampleRateHz,
+                               kBitrateBps, RawOptions());
+  std::vector<unsigned char> stream;
+  std::vector<unsigned char> out(1 << 16);
+
+  for (size_t i = 0; i < lc3.size(); i += chunk) {
+    size_t size = std::min(chunk, lc3.size() - i);
+    int n = transcoder.Transcode(&lc3[i], size, out.data(), out.size());
+    CHECK(n >= 0, "caller buffer rejected");
+    stream.insert(stream.end(), out.begin(), out.begin() + n);
+  }
+  int n = transcoder.Flush(out.data(), out.size());
+  CHECK(n > 0, "flush failed");
+  stream.insert(stream.end(), out.begin(), out.begin() + n);
+
+  *stats = transcoder.stats();
+  return stream;
+}
+
+void TestTranscode() {
+  std::vector<unsigned char> lc3 = EncodeLc3();
+  std::vector<unsigned char> ref = Reference(lc3);
+
+  for (size_t chunk : {40, 80, 17, 400, 4040}) {
+    Lc3OpusTranscoder::Stats stats;
+    CHECK(Transcode(lc3, chunk, &stats) == ref,
+          "chunks of %zu bytes: stream differs", chunk);
+    CHECK(stats.decoded_frames == kNumFrames && stats.invalid_frames == 0 &&
+              stats.concealed_frames == 0,
+          "chunks of %zu bytes: bad frame counts", chunk);
+  }
+}
+
+void TestInvalidFrames() {
+  std::vector<unsigned char> lc3 = EncodeLc3();
+
+  // Frames with a bandwidth above the samplerate, rejected by validation.
+  for (int i = 10; i < 20; i++) {
+    memset(&lc3[i * kLc3FrameBytes], 0xff, kLc3FrameBytes);
+  }
+  std::vector<unsigned char> ref = Reference(lc3);
+
+  Lc3OpusTranscoder::Stats stats;
+  CHECK(Transcode(lc3, kLc3FrameBytes, &stats) == ref, "stream differs");
+  CHECK(stats.decoded_frames == kNumFrames, "%llu frames decoded",
+        static_cast<unsigned long long>(stats.decoded_frames));
+  CHECK(stats.invalid_frames > 0 &&
+            stats.concealed_frames >= stats.invalid_frames,
+        "%llu invalid, %llu concealed frames",
+        static_cast<unsigned long long>(stats.invalid_frames),
+        static_cast<unsigned long long>(stats.concealed_frames));
+}
+
+}  // namespace
+
+int main() {
+  TestTranscode();
+  TestInvalidFrames();
+
+  return audio_util::test::Report("lc3_opus_transcoder");
+}
@@ -0,0 +1,208 @@
+/*
+ * Host tests of the OggOpusDecoder
+ *
+ * - The output has the length of the encoded audio, pre-skip and end
+ *   trimmed, whatever the split of the stream between calls, and the size
+ *   of the output buffer
+ * - A flushed stream decodes to as many samples as input, whatever the
+ *   samples left for Flush() and the frame duration: the encoder lookahead
+ *   delays the last ones past the frame holding them
+ * - Lost and corrupted pages are concealed, keeping the length
+ * - Streams other than OggOpus are rejected
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "../ogg_opus_decoder.h"
+#include "../ogg_opus_encoder.h"
+#include "../ogg_page_writer.h"
+#include "test_util.h"
+
+using audio_util::OggOpusDecoder;
+using audio_util::OggOpusEncoder;
+using audio_util::test::GenerateTwoTones;
+
+namespace {
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kBitrateBps = 24000;
+constexpr int kChunkElements = kSampleRateHz / 100;  // 10 ms
+// 5 s, ending on a third of a 20 ms frame.
+constexpr int kNumElements = 5 * kSampleRateHz + kSampleRateHz / 150;
+
+// Pages of a stream of a two tones signal, encoded by chunks of 10 ms.
+std::vector<std::vector<unsigned char>> EncodePages(bool low_latency_mode) {
+  OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, true,
+                         low_latency_mode);
+  std::vector<int16_t> pcm = GenerateTwoTones(kNumElements, kSampleRateHz);
+  std::vector<unsigned char> stream;
+  for (int i = 0; i < kNumElements; i += kChunkElements) {
+    const std::vector<unsigned char>& bytes =
+        encoder.Process(&pcm[i], std::min(kChunkElements, kNumElements - i));
+    stream.insert(stream.end(), bytes.begin(), bytes.end());
+  }
+  const std::vector<unsigned char>& bytes = encoder.Flush();
+  stream.insert(stream.end(), bytes.begin(), bytes.end());
+
+  // Split the pages.
+  std::vector<std::vector<unsigned char>> pages;
+  for (size_t offset = 0; offset < stream.size();) {
+    size_t size = 27 + stream[offset + 26];
+    for (int i = 0; i < stream[offset + 26]; i++) {
+      size += stream[offset + 27 + i];
+    }
+    pages.emplace_back(&stream[offset], &stream[offset] + size);
+    offset += size;
+  }
+  return pages;
+}
+
+std::vector<unsigned char> Join(
+    const std::vector<std::vector<unsigned char>>& pages) {
+  std::vector<unsigned char> stream;
+  for (const std::vector<unsigned char>& page : pages) {
+    stream.insert(stream.end(), page.begin(), page.end());
+  }
+  return stream;
+}
+
+// Decodes `stream` given by chunks of `chunk` bytes, into an output buffer
+// of `max_samples`, draining the decoder after each chunk.
+std::vector<int16_t> Decode(const std::vector<unsigned char>& stream,
+                            size_t chunk, size_t max_samples,
+                            OggOpusDecoder::Stats* stats = nullptr,
+                            int sample_rate_hz = kSampleRateHz) {
+  OggOpusDecoder decoder(sample_rate_hz, 1);
+  std::vector<int16_t> pcm;
+  std::vector<int16_t> out(max_samples);
+
+  for (size_t i = 0; i < stream.size(); i += chunk) {
+    const size_t size = std::min(chunk, stream.size() - i);
+    int n = decoder.Decode(&stream[i], size, out.data(), out.size());
+    while (n > 0) {
+      pcm.insert(pcm.end(), out.begin(), out.begin() + n);
+      n = decoder.Decode(nullptr, 0, out.data(), out.size());
+    }
+    CHECK(n == 0, "decoding failed");
+  }
+  CHECK(decoder.finished(), "stream not finished");
+  if (stats) {
+    *stats = decoder.stats();
+  }
+  return pcm;
+}
+
+void TestDecode() {
+  for (int low_latency = 0; low_latency <= 1; low_latency++) {
+    std::vector<unsigned char> stream = Join(EncodePages(low_latency));
+    std::vector<int16_t> ref = Decode(stream, stream.size(), 1 << 16);
+    CHECK(ref.size() == kNumElements, "low latency %d: %zu samples decoded",
+          low_latency, ref.size());
+
+    OggOpusDecoder decoder(kSampleRateHz, 1);
+    const size_t min_samples = decoder.MinOutputSamples();
+    for (size_t chunk : {1, 7, 100, 4096}) {
+      CHECK(Decode(stream, chunk, 1 << 16) == ref,
+            "low latency %d, chunks of %zu bytes: output differs",
+            low_latency, chunk);
+      CHECK(Decode(stream, chunk, min_samples) == ref,
+            "low latency %d, chunks of %zu bytes, %zu samples output: "
+            "output differs",
+            low_latency, chunk, min_samples);
+    }
+    CHECK(decoder.Decode(stream.data(), 0, nullptr, min_samples - 1) == -1,
+          "undersized output accepted");
+
+    // At another samplerate.
+    CHECK(Decode(stream, 100, 1 << 16, nullptr, 48000).size() ==
+              kNumElements * 3,
+          "low latency %d: bad length at 48 kHz", low_latency);
+  }
+}
+
+void TestFlushedLength() {
+  for (int frame_duration_us : {2500, 10000, 20000}) {
+    const int frame_size = kSampleRateHz / 1000 * frame_duration_us / 1000;
+    for (int remaining : {0, 1, frame_size / 2, frame_size - 1}) {
+      const int num_elements = 3 * frame_size + remaining;
+      std::vector<int16_t> pcm =
+          GenerateTwoTones(num_elements, kSampleRateHz);
+      for (int caller_buffer = 0; caller_buffer <= 1; caller_buffer++) {
+        OggOpusEncoder::Options options;
+        options.frame_duration_us = frame_duration_us;
+        OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, options);
+        std::vector<unsigned char> stream = encoder.Process(pcm);
+        if (caller_buffer) {
+          std::vector<unsigned char> out(encoder.MaxFlushBytes());
+          const int n = encoder.Flush(out.data(), out.size());
+          CHECK(n > 0, "%d us frames: flush failed", frame_duration_us);
+          stream.insert(stream.end(), out.begin(), out.begin() + n);
+        } else {
+          const std::vector<unsigned char>& bytes = encoder.Flush();
+          stream.insert(stream.end(), bytes.begin(), bytes.end());
+        }
+
+        const size_t num_samples =
+            Decode(stream, stream.size(), 1 << 16).size();
+        CHECK(num_samples == static_cast<size_t>(num_elements),
+              "%d us frames, %d samples flushed: %zu of %d decoded",
+              frame_duration_us, remaining, num_samples, num_elements);
+      }
+    }
+  }
+}
+
+void TestLostPages() {
+  std::vector<std::vector<unsigned char>> pages = EncodePages(true);
+  const size_t num_pages = pages.size();
+
+  // A page dropped, and another corrupted.
+  pages.erase(pages.begin() + num_pages / 3);
+  pages[num_pages / 2][pages[num_pages / 2].size() - 1] ^= 0x55;
+  std::vector<unsigned char> stream = Join(pages);
+
+  OggOpusDecoder::Stats stats;
+  std::vector<int16_t> pcm = Decode(stream, 100, 1 << 16, &stats);
+  CHECK(pcm.size() == kNumElements, "%zu samples decoded", pcm.size());
+  CHECK(stats.lost_pages == 2 && stats.corrupted_pages == 1,
+        "%llu lost, %llu corrupted pages",
+        static_cast<unsigned long long>(stats.lost_pages),
+        static_cast<unsigned long long>(stats.corrupted_pages));
+  CHECK(stats.concealed_samples > 0, "nothing concealed");
+}
+
+void TestGarbage() {
+  // Bytes before the first page are skipped.
+  std::vector<unsigned char> stream = Join(EncodePages(false));
+  stream.insert(stream.begin(), {'O', 'g', 'g', 0, 1, 2, 3});
+  CHECK(Decode(stream, 50, 1 << 16).size() == kNumElements,
+        "stream after garbage not decoded");
+
+  // An Ogg stream, of another codec.
+  audio_util::OggPageWriter writer(0);
+  const unsigned char packet[] = "OggVorbis";
+  writer.AddPacket(packet, sizeof(packet), 0, false);
+  std::vector<unsigned char> page(writer.NextPage(true));
+  writer.WritePage(page.data());
+
+  OggOpusDecoder decoder(kSampleRateHz, 1);
+  std::vector<int16_t> out(decoder.MinOutputSamples());
+  CHECK(decoder.Decode(page.data(), page.size(), out.data(), out.size()) ==
+            -1,
+        "not an OggOpus stream, accepted");
+}
+
+}  // namespace
+
+int main() {
+  TestDecode();
+  TestFlushedLength();
+  TestLostPages();
+  TestGarbage();
+
+  return audio_util::test::Report("ogg_opus_decoder");
+}
@@ -0,0 +1,128 @@
+/*
+ * Host tests of the OggOpusEncoderPool
+ *
+ * - Released encoders are reused for the same settings only
+ * - A reused encoder outputs the stream of a new one
+ * - The number of idle encoders is bounded
+ * - Settings libopus rejects, or beyond the channel mapping, give no encoder
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "../ogg_opus_encoder_pool.h"
+#include "test_util.h"
+
+using audio_util::OggOpusEncoder;
+using audio_util::OggOpusEncoderPool;
+using audio_util::test::GenerateTwoTones;
+
+namespace {
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kBitrateBps = 24000;
+constexpr int kNumElements = kSampleRateHz;
+
+std::vector<unsigned char> Encode(OggOpusEncoder* encoder) {
+  std::vector<int16_t> pcm = GenerateTwoTones(kNumElements, kSampleRateHz);
+  std::vector<unsigned char> stream = encoder->Process(pcm);
+  const std::vector<unsigned char>& bytes = encoder->Flush();
+  stream.insert(stream.end(), bytes.begin(), bytes.end());
+  return stream;
+}
+
+void TestReuse() {
+  OggOpusEncoderPool pool(4);
+  OggOpusEncoder::Options options;
+
+  std::unique_ptr<OggOpusEncoder> first =
+      pool.Acquire(1, kSampleRateHz, kBitrateBps, options, 7);
+  std::vector<unsigned char> ref = Encode(first.get());
+  OggOpusEncoder* first_ptr = first.get();
+  pool.Release(std::move(first));
+  CHECK(pool.idle_encoders() == 1, "%zu idle encoders", pool.idle_encoders());
+
+  // Other settings: a new encoder.
+  OggOpusEncoder::Options raw_options;
+  raw_options.framing = OggOpusEncoder::Framing::kRawLengthPrefixed;
+  std::unique_ptr<OggOpusEncoder> other_bitrate =
+      pool.Acquire(1, kSampleRateHz, 2 * kBitrateBps, options, 7);
+  std::unique_ptr<OggOpusEncoder> other_options =
+      pool.Acquire(1, kSampleRateHz, kBitrateBps, raw_options, 7);
+  CHECK(other_bitrate.get() != first_ptr && other_options.get() != first_ptr,
+        "encoder reused for other settings");
+
+  // Same settings: the idle encoder, starting a new stream.
+  std::unique_ptr<OggOpusEncoder> second =
+      pool.Acquire(1, kSampleRateHz, kBitrateBps, options, 7);
+  CHECK(second.get() == first_ptr, "idle encoder not reused");
+  CHECK(Encode(second.get()) == ref, "reused encoder: stream differs");
+
+  OggOpusEncoderPool::Stats stats = pool.stats();
+  CHECK(stats.reused == 1 && stats.created == 3 && stats.rejected == 0,
+        "%llu reused, %llu created, %llu rejected",
+        static_cast<unsigned long long>(stats.reused),
+        static_cast<unsigned long long>(stats.created),
+        static_cast<unsigned long long>(stats.rejected));
+}
+
+void TestCapacity() {
+  OggOpusEncoderPool pool(2);
+  OggOpusEncoder::Options options;
+
+  std::vector<std::unique_ptr<OggOpusEncoder>> encoders;
+  for (int i = 0; i < 3; i++) {
+    encoders.push_back(
+        pool.Acquire(1, kSampleRateHz, kBitrateBps, options, 0));
+  }
+  OggOpusEncoder* last = encoders.back().get();
+  for (std::unique_ptr<OggOpusEncoder>& encoder : encoders) {
+    pool.Release(std::move(encoder));
+  }
+  CHECK(pool.idle_encoders() == 2, "%zu idle encoders", pool.idle_encoders());
+  CHECK(pool.Acquire(1, kSampleRateHz, kBitrateBps, options, 0).get() == last,
+        "last released encoder not reused first");
+}
+
+void TestRejected() {
+  OggOpusEncoderPool pool(2);
+
+  for (int mapping_family = 0; mapping_family <= 1; mapping_family++) {
+    OggOpusEncoder::Options options;
+    options.mapping_family = mapping_family;
+    const int num_channels = mapping_family ? 9 : 3;
+    CHECK(!OggOpusEncoder(num_channels, kSampleRateHz, kBitrateBps, options)
+               .ok(),
+          "family %d, %d channels: encoder created", mapping_family,
+          num_channels);
+    CHECK(!pool.Acquire(num_channels, kSampleRateHz, kBitrateBps, options, 0),
+          "family %d, %d channels: encoder acquired", mapping_family,
+          num_channels);
+
+    options.application = 0;
+    CHECK(!pool.Acquire(1, kSampleRateHz, kBitrateBps, options, 0),
+          "family %d, bad application: encoder acquired", mapping_family);
+    pool.Release(std::unique_ptr<OggOpusEncoder>(
+        new OggOpusEncoder(1, kSampleRateHz, kBitrateBps, options)));
+  }
+  CHECK(pool.idle_encoders() == 0, "failed encoder kept idle");
+
+  // Rejected encoders are not counted as created.
+  OggOpusEncoderPool::Stats stats = pool.stats();
+  CHECK(stats.created == 0 && stats.rejected == 4,
+        "%llu created, %llu rejected",
+        static_cast<unsigned long long>(stats.created),
+        static_cast<unsigned long long>(stats.rejected));
+}
+
+}  // namespace
+
+int main() {
+  TestReuse();
+  TestCapacity();
+  TestRejected();
+
+  return audio_util::test::Report("ogg_opus_encoder_pool");
+}
@@ -0,0 +1,438 @@
+/*
+ * Host tests of the OggOpusEncoder
+ *
+ * - The vector, span and caller buffer paths produce the same stream
+ * - Undersized caller buffers are rejected, without encoding
+ * - Once warmed up, the span and caller buffer paths do not allocate
+ * - Raw packet framing, and its side-channel
+ * - Frame durations other than 20 ms, and DTX
+ * - A reset encoder outputs the stream of a new one, without allocating
+ * - Multistream encoding: family 1 header, packets of every stream
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "../ogg_opus_encoder.h"
+#include "test_util.h"
+
+using audio_util::OggOpusEncoder;
+using audio_util::test::GenerateTwoTones;
+
+namespace {
+
+// Heap allocations, counted while `counting` is set.
+bool counting = false;
+long allocations = 0;
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kBitrateBps = 24000;
+constexpr int kChunkElements = kSampleRateHz / 100;  // 10 ms
+constexpr int kNumChunks = 1000;
+
+// Encodes `pcm` by chunks of `chunk` elements through the given path:
+// 0 vector, 1 span, 2 caller buffer.
+std::vector<unsigned char> Encode(const std::vector<int16_t>& pcm, int chunk,
+                                  int path, bool low_latency_mode) {
+  OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, true,
+                         low_latency_mode);
+  std::vector<unsigned char> stream;
+  std::vector<unsigned char> out(1 << 16);
+
+  for (size_t i = 0; i + chunk <= pcm.size(); i += chunk) {
+    if (path == 0) {
+      std::vector<int16_t> v(pcm.begin() + i, pcm.begin() + i + chunk);
+      const std::vector<unsigned char>& bytes = encoder.Process(v);
+      stream.insert(stream.end(), bytes.begin(), bytes.end());
+    } else if (path == 1) {
+      const std::vector<unsigned char>& bytes =
+          encoder.Process(pcm.data() + i, chunk);
+      stream.insert(stream.end(), bytes.begin(), bytes.end());
+    } else {
+      int n = encoder.Process(pcm.data() + i, chunk, out.data(), out.size());
+      CHECK(n >= 0, "caller buffer rejected");
+      stream.insert(stream.end(), out.begin(), out.begin() + n);
+    }
+  }
+
+  if (path == 2) {
+    int n = encoder.Flush(out.data(), out.size());
+    CHECK(n > 0, "flush failed");
+    stream.insert(stream.end(), out.begin(), out.begin() + n);
+  } else {
+    const std::vector<unsigned char>& bytes = encoder.Flush();
+    stream.insert(stream.end(), bytes.begin(), bytes.end());
+  }
+  return stream;
+}
+
+void TestPaths() {
+  std::vector<int16_t> pcm =
+      GenerateTwoTones(kNumChunks * kChunkElements, kSampleRateHz);
+
+  for (int low_latency = 0; low_latency <= 1; low_latency++) {
+    for (int chunk : {kChunkElements, 3 * kChunkElements + 7}) {
+      std::vector<unsigned char> ref = Encode(pcm, chunk, 0, low_latency);
+      CHECK(ref.size() > 4 && memcmp(ref.data(), "OggS", 4) == 0,
+            "stream does not start with an Ogg page");
+
+      for (int path = 1; path <= 2; path++) {
+        CHECK(Encode(pcm, chunk, path, low_latency) == ref,
+              "path %d, chunk %d, low latency %d: stream differs", path,
+              chunk, low_latency);
+      }
+    }
+  }
+}
+
+void TestUndersizedBuffer() {
+  OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, true, true);
+  std::vector<int16_t> pcm =
+      GenerateTwoTones(2 * kChunkElements, kSampleRateHz);
+  std::vector<unsigned char> out(encoder.MaxOutputBytes(pcm.size()));
+
+  CHECK(encoder.Process(pcm.data(), pcm.size(), out.data(), out.size() - 1) ==
+            -1,
+        "undersized buffer accepted");
+
+  int n = encoder.Process(pcm.data(), pcm.size(), out.data(), out.size());
+  CHECK(n > 0 && memcmp(out.data(), "OggS", 4) == 0,
+        "header lost after a rejected call");
+}
+
+void TestRawFraming() {
+  std::vector<int16_t> pcm =
+      GenerateTwoTones(kNumChunks * kChunkElements, kSampleRateHz);
+  const int frame_size = kSampleRateHz / 50;
+
+  OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, true, false,
+                         OggOpusEncoder::Framing::kRawLengthPrefixed);
+  std::vector<unsigned char> out(1 << 16);
+  int64_t num_packets = 0;
+
+  for (int i = 0; i < kNumChunks; i++) {
+    int n = encoder.Process(pcm.data() + i * kChunkElements, kChunkElements,
+                            out.data(), out.size());
+    CHECK(n >= 0, "caller buffer rejected");
+
+    // Packets are output as soon as encoded, every other 10 ms chunk.
+    const std::vector<OggOpusEncoder::PacketInfo>& packets =
+        encoder.packets();
+    CHECK(packets.size() == static_cast<size_t>(i % 2),
+          "chunk %d: %zu packets", i, packets.size());
+
+    size_t offset = 0;
+    for (const OggOpusEncoder::PacketInfo& info : packets) {
+      size_t length = out[offset];
+      size_t prefix = 1;
+      if (length & 0x80) {
+        length = ((length & 0x7f) << 8) | out[offset + 1];
+        prefix = 2;
+      }
+      CHECK(info.offset == offset && info.payload_offset == offset + prefix &&
+                info.length == length,
+            "packet %lld: bad framing", static_cast<long long>(num_packets));
+      CHECK(info.granule_position == (num_packets + 1) * frame_size &&
+                info.timestamp_us == num_packets * 20000,
+            "packet %lld: bad side-channel",
+            static_cast<long long>(num_packets));
+      offset += prefix + length;
+      num_packets++;
+    }
+    CHECK(offset == static_cast<size_t>(n), "chunk %d: %d bytes, %zu framed",
+          i, n, offset);
+  }
+
+  int n = encoder.Flush(out.data(), out.size());
+  CHECK(n > 0 && encoder.packets().size() == 1, "flush failed");
+}
+
+// Encodes `pcm` by chunks of 10 ms, in raw framing, and returns the length
+// of each packet, checking their granule positions.
+std::vector<size_t> EncodeRaw(const std::vector<int16_t>& pcm,
+                              const OggOpusEncoder::Options& options) {
+  OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, options);
+  const int64_t frame_size =
+      static_cast<int64_t>(kSampleRateHz) * options.frame_duration_us /
+      1000000;
+  std::vector<unsigned char> out(1 << 16);
+  std::vector<size_t> lengths;
+
+  for (size_t i = 0; i + kChunkElements <= pcm.size(); i += kChunkElements) {
+    int n = encoder.Process(pcm.data() + i, kChunkElements, out.data(),
+                            out.size());
+    CHECK(n >= 0, "caller buffer rejected");
+    for (const OggOpusEncoder::PacketInfo& info : encoder.packets()) {
+      lengths.push_back(info.length);
+      CHECK(info.granule_position ==
+                static_cast<int64_t>(lengths.size()) * frame_size,
+            "%d us frames, packet %zu: bad granule position",
+            options.frame_duration_us, lengths.size());
+    }
+  }
+  return lengths;
+}
+
+void TestFrameDurations() {
+  std::vector<int16_t> pcm = GenerateTwoTones(kSampleRateHz, kSampleRateHz);
+
+  for (int frame_duration_us : {2500, 5000, 10000, 20000, 40000, 60000}) {
+    OggOpusEncoder::Options options;
+    options.application = OPUS_APPLICATION_VOIP;
+    options.frame_duration_us = frame_duration_us;
+    options.framing = OggOpusEncoder::Framing::kRawLengthPrefixed;
+
+    std::vector<size_t> lengths = EncodeRaw(pcm, options);
+    CHECK(lengths.size() == 1000000u / frame_duration_us,
+          "%d us frames: %zu packets in 1 s", frame_duration_us,
+          lengths.size());
+  }
+}
+
+void TestDtx() {
+  // Silence is sent as packets of 1 or 2 bytes, once detected.
+  std::vector<int16_t> pcm(kSampleRateHz, 0);
+  OggOpusEncoder::Options options;
+  options.application = OPUS_APPLICATION_VOIP;
+  options.use_dtx = true;
+  options.framing = OggOpusEncoder::Framing::kRawLengthPrefixed;
+
+  std::vector<size_t> lengths = EncodeRaw(pcm, options);
+  size_t num_dtx = 0;
+  for (size_t i = lengths.size() / 2; i < lengths.size(); i++) {
+    num_dtx += lengths[i] <= 2;
+  }
+  CHECK(num_dtx > lengths.size() / 4, "DTX: %zu packets of %zu", num_dtx,
+        lengths.size() - lengths.size() / 2);
+}
+
+void TestAllocations() {
+  std::vector<int16_t> pcm =
+      GenerateTwoTones(kNumChunks * kChunkElements, kSampleRateHz);
+
+  for (int low_latency = 0; low_latency <= 1; low_latency++) {
+    OggOpusEncoder span_encoder(1, kSampleRateHz, kBitrateBps, true,
+                                low_latency);
+    OggOpusEncoder buffer_encoder(1, kSampleRateHz, kBitrateBps, true,
+                                  low_latency);
+    OggOpusEncoder raw_encoder(1, kSampleRateHz, kBitrateBps, true,
+                               low_latency,
+                               OggOpusEncoder::Framing::kRawLengthPrefixed);
+    std::vector<unsigned char> out(1 << 16);
+
+    // Warm up the Ogg stream buffers, over a few pages, then encode with
+    // counting on.
+    const int kWarmupChunks = 300;
+    for (int pass = 0; pass < 2; pass++) {
+      int begin = pass ? kWarmupChunks : 0;
+      int end = pass ? kNumChunks : kWarmupChunks;
+      allocations = 0;
+      counting = pass == 1;
+
+      for (int i = begin; i < end; i++) {
+        const int16_t* chunk = pcm.data() + i * kChunkElements;
+        span_encoder.Process(chunk, kChunkElements);
+        CHECK(buffer_encoder.MaxOutputBytes(kChunkElements) <= out.size(),
+              "output bound grows: %zu bytes",
+              buffer_encoder.MaxOutputBytes(kChunkElements));
+        CHECK(buffer_encoder.Process(chunk, kChunkElements, out.data(),
+                                     out.size()) >= 0,
+              "caller buffer rejected");
+        CHECK(raw_encoder.Process(chunk, kChunkElements, out.data(),
+                                  out.size()) >= 0,
+              "caller buffer rejected");
+      }
+
+      counting = false;
+    }
+
+    CHECK(allocations == 0, "low latency %d: %ld allocations", low_latency,
+          allocations);
+  }
+}
+
+void TestReset() {
+  std::vector<int16_t> pcm =
+      GenerateTwoTones(kNumChunks * kChunkElements, kSampleRateHz);
+  const int kChunks = 200;
+
+  for (int use_libogg = 0; use_libogg <= 1; use_libogg++) {
+    for (OggOpusEncoder::Framing framing :
+         {OggOpusEncoder::Framing::kOgg,
+          OggOpusEncoder::Framing::kRawLengthPrefixed}) {
+      OggOpusEncoder::Options options;
+      options.low_latency_mode = true;
+      options.framing = framing;
+      options.use_libogg = use_libogg;
+
+      auto encode = [&](OggOpusEncoder* encoder, int first_chunk,
+                        bool flush) -> std::vector<unsigned char> {
+        std::vector<unsigned char> stream;
+        for (int i = first_chunk; i < first_chunk + kChunks; i++) {
+          const std::vector<unsigned char>& bytes =
+              encoder->Process(pcm.data() + i * kChunkElements,
+                               kChunkElements - i % 3);
+          stream.insert(stream.end(), bytes.begin(), bytes.end());
+        }
+        if (flush) {
+          const std::vector<unsigned char>& bytes = encoder->Flush();
+          stream.insert(stream.end(), bytes.begin(), bytes.end());
+        }
+        return stream;
+      };
+
+      OggOpusEncoder fresh(1, kSampleRateHz, kBitrateBps, options);
+      fresh.Reset(1234);
+      std::vector<unsigned char> ref = encode(&fresh, 0, true);
+
+      // Reset after a flushed stream, then in the middle of one, with
+      // samples buffered and pages pending.
+      OggOpusEncoder reused(1, kSampleRateHz, kBitrateBps, options);
+      for (int flush = 1; flush >= 0; flush--) {
+        reused.Reset(0);
+        encode(&reused, kChunks, flush);
+        allocations = 0;
+        counting = true;
+        reused.Reset(1234);
+        counting = false;
+        CHECK(allocations == 0, "libogg %d, framing %d: %ld allocations",
+              use_libogg, static_cast<int>(framing), allocations);
+        CHECK(encode(&reused, 0, true) == ref,
+              "libogg %d, framing %d, flush %d: stream differs", use_libogg,
+              static_cast<int>(framing), flush);
+      }
+
+      if (framing == OggOpusEncoder::Framing::kOgg) {
+        // Serial number, of the first page.
+        CHECK(ref.size() > 18 && ref[14] == (1234 & 0xff) &&
+                  ref[15] == (1234 >> 8) && ref[16] == 0 && ref[17] == 0,
+              "libogg %d: bad serial number", use_libogg);
+      }
+    }
+  }
+}
+
+void TestMultistream() {
+  const int kChannels = 6;
+  std::vector<int16_t> mono = GenerateTwoTones(kSampleRateHz, kSampleRateHz);
+  std::vector<int16_t> pcm(mono.size() * kChannels);
+  for (size_t i = 0; i < mono.size(); i++) {
+    for (int c = 0; c < kChannels; c++) {
+      pcm[i * kChannels + c] = mono[i] / (c + 1);
+    }
+  }
+
+  for (int uncoupled = 0; uncoupled <= 1; uncoupled++) {
+    OggOpusEncoder::Options options;
+    options.mapping_family = 1;
+    options.uncoupled_streams = uncoupled;
+    options.frame_duration_us = 60000;
+
+    // Ogg: the header, and the pages of packets of tens of segments, as
+    // with libogg.
+    std::vector<unsigned char> streams[2];
+    for (int use_libogg = 0; use_libogg <= 1; use_libogg++) {
+      options.use_libogg = use_libogg;
+      OggOpusEncoder encoder(kChannels, kSampleRateHz, 512000, options);
+      std::vector<unsigned char> out(encoder.MaxOutputBytes(pcm.size()));
+      int n = encoder.Process(pcm.data(), pcm.size(), out.data(), out.size());
+      CHECK(n > 0, "uncoupled %d: caller buffer rejected", uncoupled);
+      streams[use_libogg].assign(out.begin(), out.begin() + n);
+      out.resize(encoder.MaxFlushBytes());
+      n = encoder.Flush(out.data(), out.size());
+      CHECK(n > 0, "uncoupled %d: flush failed", uncoupled);
+      streams[use_libogg].insert(streams[use_libogg].end(), out.begin(),
+                                 out.begin() + n);
+    }
+    CHECK(streams[0] == streams[1], "uncoupled %d: pages differ from libogg",
+          uncoupled);
+
+    // OpusHead, in the first page: family, streams, coupled streams, and
+    // the 5.1 mapping.
+    const unsigned char kMapping51[] = {0, 4, 1, 2, 3, 5};
+    const unsigned char* head = &streams[0][28];
+    CHECK(memcmp(head, "OpusHead", 8) == 0 && head[9] == kChannels &&
+              head[18] == 1,
+          "uncoupled %d: bad header", uncoupled);
+    if (uncoupled) {
+      CHECK(head[19] == kChannels && head[20] == 0,
+            "%d streams, %d coupled", head[19], head[20]);
+      for (int c = 0; c < kChannels; c++) {
+        CHECK(head[21 + c] == c, "channel %d in stream %d", c, head[21 + c]);
+      }
+    } else {
+      CHECK(head[19] == 4 && head[20] == 2 &&
+                memcmp(head + 21, kMapping51, kChannels) == 0,
+            "%d streams, %d coupled: bad 5.1 mapping", head[19], head[20]);
+    }
+  }
+
+  // Raw framing, at 8 channels.
+  OggOpusEncoder::Options options;
+  options.mapping_family = 1;
+  options.framing = OggOpusEncoder::Framing::kRawLengthPrefixed;
+  OggOpusEncoder encoder(8, kSampleRateHz, 256000, options);
+  std::vector<int16_t> pcm8(kSampleRateHz / 50 * 8, 1000);
+  std::vector<unsigned char> out(encoder.MaxOutputBytes(pcm8.size()));
+  int n = encoder.Process(pcm8.data(), pcm8.size(), out.data(), out.size());
+  CHECK(encoder.packets().size() == 1 &&
+            n == static_cast<int>(encoder.packets()[0].length + 2),
+        "8 channels: bad raw packet");
+}
+
+}  // namespace
+
+// Allocation counting, of C++ and C allocations. With glibc, the C++
+// allocations are counted through malloc.
+
+void* operator new(size_t size) {
+#ifndef __GLIBC__
+  if (counting) allocations++;
+#endif
+  void* p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+#ifdef __GLIBC__
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* p, size_t size);
+
+void* malloc(size_t size) {
+  if (counting) allocations++;
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+  if (counting) allocations++;
+  return __libc_calloc(count, size);
+}
+
+void* realloc(void* p, size_t size) {
+  if (counting) allocations++;
+  return __libc_realloc(p, size);
+}
+}  // extern "C"
+#endif
+
+int main() {
+  TestPaths();
+  TestUndersizedBuffer();
+  TestRawFraming();
+  TestFrameDurations();
+  TestDtx();
+  TestAllocations();
+  TestReset();
+  TestMultistream();
+
+  return audio_util::test::Report("ogg_opus_encoder");
+}
@@ -0,0 +1,303 @@
+/*
+ * Host tests of the OggOpusIndex
+ *
+ * - All the audio pages are indexed, with the header information, and the
+ *   duration of the stream
+ * - Seek() finds the last page ending before the pre-roll of the time
+ *   sought, and the OggOpusDecoder seeking there outputs the audio from
+ *   that time on, as decoded from the start
+ * - The sidecar index is loaded as saved, and rejected once the recording
+ *   or the index changed, Open() indexing the recording again
+ * - Corrupted and truncated pages are skipped, other streams rejected
+ */
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../ogg_opus_decoder.h"
+#include "../ogg_opus_encoder.h"
+#include "../ogg_opus_index.h"
+#include "test_util.h"
+
+using audio_util::OggOpusDecoder;
+using audio_util::OggOpusEncoder;
+using audio_util::OggOpusIndex;
+using audio_util::test::GenerateTwoTones;
+
+namespace {
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kBitrateBps = 24000;
+constexpr int kSeconds = 20;
+constexpr int kNumElements = kSeconds * kSampleRateHz;
+constexpr int kPreRollGranules = 3840;
+
+std::string TempPath(const char* name) {
+  const char* dir = getenv("TMPDIR");
+  return std::string(dir ? dir : "/tmp") + "/ogg_opus_index_test_" +
+         std::to_string(getpid()) + "_" + name;
+}
+
+// A stream of two tones, encoded by chunks of 10 ms.
+std::vector<unsigned char> Encode() {
+  OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, true, false);
+  std::vector<int16_t> pcm = GenerateTwoTones(kNumElements, kSampleRateHz);
+  std::vector<unsigned char> stream;
+  const int chunk = kSampleRateHz / 100;
+  for (int i = 0; i < kNumElements; i += chunk) {
+    const std::vector<unsigned char>& bytes = encoder.Process(&pcm[i], chunk);
+    stream.insert(stream.end(), bytes.begin(), bytes.end());
+  }
+  const std::vector<unsigned char>& bytes = encoder.Flush();
+  stream.insert(stream.end(), bytes.begin(), bytes.end());
+  return stream;
+}
+
+// Offsets and granule positions of the pages of `stream`, by a plain scan.
+std::vector<OggOpusIndex::Entry> ScanPages(
+    const std::vector<unsigned char>& stream) {
+  std::vector<OggOpusIndex::Entry> pages;
+  for (size_t offset = 0; offset < stream.size();) {
+    const unsigned char* page = &stream[offset];
+    int64_t granule_position = 0;
+    for (int i = 7; i >= 0; i--) {
+      granule_position = granule_position << 8 | page[6 + i];
+    }
+    pages.push_back({offset, granule_position});
+    size_t size = 27 + page[26];
+    for (int i = 0; i < page[26]; i++) {
+      size += page[27 + i];
+    }
+    offset += size;
+  }
+  return pages;
+}
+
+// Decodes `size` bytes of `data` into `pcm`, draining the decoder.
+void Decode(OggOpusDecoder* decoder, const unsigned char* data, size_t size,
+            std::vector<int16_t>* pcm) {
+  std::vector<int16_t> out(decoder->MinOutputSamples());
+  int n = decoder->Decode(data, size, out.data(), out.size());
+  while (n > 0) {
+    pcm->insert(pcm->end(), out.begin(), out.begin() + n);
+    n = decoder->Decode(nullptr, 0, out.data(), out.size());
+  }
+  CHECK(n == 0, "decoding failed");
+}
+
+void TestBuild() {
+  const std::vector<unsigned char> stream = Encode();
+  OggOpusIndex index;
+  CHECK(index.Build(stream.data(), stream.size()), "not indexed");
+  const OggOpusIndex::Info& info = index.info();
+  const std::vector<OggOpusIndex::Entry> pages = ScanPages(stream);
+  // Head and tags on the first two pages.
+  CHECK(info.pages == pages.size() && info.audio_offset == pages[2].offset &&
+            info.corrupted_pages == 0,
+        "%llu pages, audio from %llu",
+        static_cast<unsigned long long>(info.pages),
+        static_cast<unsigned long long>(info.audio_offset));
+  CHECK(index.entries().size() == pages.size() - 2,
+        "%zu entries of %zu pages", index.entries().size(), pages.size());
+  for (size_t i = 0; i < index.entries().size() && i + 2 < pages.size();
+       i++) {
+    CHECK(index.entries()[i].offset == pages[i + 2].offset &&
+              index.entries()[i].granule_position ==
+                  pages[i + 2].granule_position,
+          "entry %zu", i);
+  }
+  CHECK(info.channels == 1 && info.input_sample_rate_hz == kSampleRateHz &&
+            info.pre_skip > 0,
+        "%d channels at %d Hz, pre-skip %d", info.channels,
+        info.input_sample_rate_hz, info.pre_skip);
+  CHECK(info.duration_ms() == kSeconds * 1000, "%lld ms",
+        static_cast<long long>(info.duration_ms()));
+  CHECK(std::fabs(info.bitrate_bps() - kBitrateBps) < kBitrateBps,
+        "%.0f b/s", info.bitrate_bps());
+  CHECK(info.max_page_granules > 0, "pages of %lld samples",
+        static_cast<long long>(info.max_page_granules));
+
+  // Not OggOpus.
+  std::vector<unsigned char> other(stream);
+  memcpy(&other[28], "OpusHear", 8);
+  CHECK(!index.Build(other.data(), other.size()), "other stream indexed");
+  CHECK(!index.Build(nullptr, 0), "empty stream indexed");
+}
+
+void TestSeek() {
+  const std::vector<unsigned char> stream = Encode();
+  OggOpusIndex index;
+  index.Build(stream.data(), stream.size(), 1700000000000);
+  const std::vector<OggOpusIndex::Entry>& entries = index.entries();
+  const int pre_skip = index.info().pre_skip;
+
+  OggOpusDecoder reference_decoder(kSampleRateHz, 1);
+  std::vector<int16_t> reference;
+  Decode(&reference_decoder, stream.data(), stream.size(), &reference);
+
+  for (int64_t time_ms : {0, 10, 75, 81, 1000, 4321, 12345, 19990, 20000,
+                          25000}) {
+    const OggOpusIndex::SeekPoint point = index.Seek(time_ms);
+    const int64_t clamped = std::min<int64_t>(time_ms, kSeconds * 1000);
+    CHECK(point.granule_position == pre_skip + clamped * 48,
+          "%lld ms: granule position %lld", static_cast<long long>(time_ms),
+          static_cast<long long>(point.granule_position));
+    const int64_t from = point.granule_position - kPreRollGranules;
+    size_t i = 0;
+    while (i < entries.size() && entries[i].offset != point.offset) {
+      i++;
+    }
+    if (point.offset == index.info().audio_offset) {
+      CHECK(entries[0].granule_position > from ||
+                (i == 0 && entries[0].granule_position <= from &&
+                 entries.size() > 1 && entries[1].granule_position > from),
+            "%lld ms: first page", static_cast<long long>(time_ms));
+    } else {
+      CHECK(i < entries.size() && entries[i].granule_position <= from &&
+                (i + 1 == entries.size() ||
+                 entries[i + 1].granule_position > from),
+            "%lld ms: page %zu", static_cast<long long>(time_ms), i);
+    }
+    CHECK(index.SeekWallTime(1700000000000 + time_ms).offset == point.offset,
+          "%lld ms: wall time", static_cast<long long>(time_ms));
+
+    // Decoded from the seek point, after the headers.
+    OggOpusDecoder decoder(kSampleRateHz, 1);
+    std::vector<int16_t> pcm;
+    CHECK(!decoder.Seek(point.granule_position), "seek before the headers");
+    Decode(&decoder, stream.data(), index.info().audio_offset, &pcm);
+    CHECK(pcm.empty() && decoder.Seek(point.granule_position),
+          "%lld ms: not seeking", static_cast<long long>(time_ms));
+    Decode(&decoder, stream.data() + point.offset,
+           stream.size() - point.offset, &pcm);
+    const size_t skipped = clamped * kSampleRateHz / 1000;
+    CHECK(pcm.size() == reference.size() - skipped,
+          "%lld ms: %zu samples, of %zu", static_cast<long long>(time_ms),
+          pcm.size(), reference.size() - skipped);
+    CHECK(decoder.stats().lost_pages == 0, "%lld ms: pages lost",
+          static_cast<long long>(time_ms));
+    // The decoder state converged over the pre-roll.
+    double signal = 0;
+    double noise = 0;
+    for (size_t j = 0; j < pcm.size() && skipped + j < reference.size();
+         j++) {
+      const double x = reference[skipped + j];
+      signal += x * x;
+      noise += (x - pcm[j]) * (x - pcm[j]);
+    }
+    CHECK(noise <= signal * .01, "%lld ms: SNR of %.1f dB",
+          static_cast<long long>(time_ms),
+          10 * std::log10(signal / std::max(noise, 1e-9)));
+  }
+}
+
+void TestSidecar() {
+  const std::vector<unsigned char> stream = Encode();
+  const std::string path = TempPath("recording.opus");
+  const std::string index_path = TempPath("recording.opus.idx");
+  FILE* f = fopen(path.c_str(), "wb");
+  fwrite(stream.data(), 1, stream.size(), f);
+  fclose(f);
+
+  OggOpusIndex index;
+  CHECK(index.Open(path, index_path, 42), "not opened");
+  FILE* saved = fopen(index_path.c_str(), "rb");
+  CHECK(saved != nullptr, "index not saved");
+  if (saved) {
+    fseek(saved, 0, SEEK_END);
+    const long bytes = ftell(saved);
+    fclose(saved);
+    // Varints of the deltas, a few bytes a page.
+    CHECK(bytes < 100 + 8 * static_cast<long>(index.entries().size()),
+          "index of %ld bytes, for %zu pages", bytes,
+          index.entries().size());
+  }
+
+  OggOpusIndex loaded;
+  CHECK(loaded.Load(index_path, path), "not loaded");
+  CHECK(loaded.entries().size() == index.entries().size() &&
+            loaded.info().start_time_ms == 42 &&
+            loaded.info().pre_skip == index.info().pre_skip &&
+            loaded.info().audio_offset == index.info().audio_offset &&
+            loaded.info().pages == index.info().pages &&
+            loaded.info().duration_ms() == index.info().duration_ms(),
+        "other index loaded");
+  for (size_t i = 0; i < loaded.entries().size() &&
+                     i < index.entries().size();
+       i++) {
+    CHECK(loaded.entries()[i].offset == index.entries()[i].offset &&
+              loaded.entries()[i].granule_position ==
+                  index.entries()[i].granule_position,
+          "entry %zu", i);
+  }
+
+  // The index corrupted.
+  std::vector<unsigned char> bytes;
+  f = fopen(index_path.c_str(), "rb");
+  for (int c; (c = fgetc(f)) != EOF;) {
+    bytes.push_back(static_cast<unsigned char>(c));
+  }
+  fclose(f);
+  bytes[bytes.size() / 2] ^= 1;
+  f = fopen(index_path.c_str(), "wb");
+  fwrite(bytes.data(), 1, bytes.size(), f);
+  fclose(f);
+  CHECK(!loaded.Load(index_path, path), "corrupted index loaded");
+  CHECK(loaded.entries().size() == index.entries().size(),
+        "index changed by a failed load");
+
+  // The recording extended, by a page being written: indexed again.
+  CHECK(index.Open(path, index_path), "not opened");
+  const size_t num_entries = index.entries().size();
+  f = fopen(path.c_str(), "ab");
+  fwrite(stream.data() + index.info().audio_offset, 1, 100, f);
+  fclose(f);
+  CHECK(!loaded.Load(index_path, path), "index of another size loaded");
+  CHECK(index.Open(path, index_path) &&
+            index.info().file_bytes == stream.size() + 100 &&
+            index.entries().size() == num_entries,
+        "%zu entries after the extension", index.entries().size());
+  CHECK(loaded.Load(index_path, path), "index of the extension not saved");
+
+  CHECK(!index.Open(TempPath("missing.opus"), index_path),
+        "missing recording opened");
+  remove(path.c_str());
+  remove(index_path.c_str());
+}
+
+void TestDamage() {
+  const std::vector<unsigned char> stream = Encode();
+  OggOpusIndex reference;
+  reference.Build(stream.data(), stream.size());
+  const std::vector<OggOpusIndex::Entry>& entries = reference.entries();
+
+  // A page corrupted, and the last one truncated.
+  std::vector<unsigned char> damaged(stream.begin(), stream.end() - 10);
+  damaged[entries[5].offset + 40] ^= 0x55;
+  OggOpusIndex index;
+  CHECK(index.Build(damaged.data(), damaged.size()), "not indexed");
+  CHECK(index.info().corrupted_pages == 1 &&
+            index.entries().size() == entries.size() - 2 &&
+            index.entries()[5].offset == entries[6].offset,
+        "%llu corrupted pages, %zu entries",
+        static_cast<unsigned long long>(index.info().corrupted_pages),
+        index.entries().size());
+}
+
+}  // namespace
+
+int main() {
+  TestBuild();
+  TestSeek();
+  TestSidecar();
+  TestDamage();
+
+  return audio_util::test::Report("ogg_opus_index");
+}
@@ -0,0 +1,166 @@
+/*
+ * Host tests of the OggPageWriter
+ *
+ * - The slice-by-8 CRC matches a bitwise computation
+ * - Pages match those of libogg, for the same packets: packets spanning
+ *   several segments and pages, full segment tables, flushes
+ * - The OggOpusEncoder output is the same with either page writer
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "../ogg_opus_encoder.h"
+#include "../ogg_page_writer.h"
+#include "test_util.h"
+
+using audio_util::OggOpusEncoder;
+using audio_util::OggPageWriter;
+
+namespace {
+
+constexpr int kSampleRateHz = 16000;
+
+uint32_t BitwiseCrc32(const unsigned char* data, size_t size) {
+  uint32_t crc = 0;
+  for (size_t i = 0; i < size; i++) {
+    crc ^= static_cast<uint32_t>(data[i]) << 24;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04c11db7 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+void TestCrc() {
+  std::vector<unsigned char> data(1000);
+  srand(1);
+  for (unsigned char& byte : data) {
+    byte = rand();
+  }
+  for (size_t offset : {0, 1, 3, 7}) {
+    for (size_t size : {0, 1, 7, 8, 9, 63, 500, 993}) {
+      CHECK(audio_util::OggCrc32(&data[offset], size) ==
+                BitwiseCrc32(&data[offset], size),
+            "offset %zu, size %zu: bad CRC", offset, size);
+    }
+  }
+}
+
+// Writes the packets of the given sizes, with both writers, flushing after
+// each `flush_every` packets, and the last one closing the stream.
+void CompareWriters(const std::vector<size_t>& sizes, size_t flush_every) {
+  ogg_stream_state stream;
+  ogg_stream_init(&stream, 0);
+  OggPageWriter writer(0);
+  std::vector<unsigned char> ref, out;
+
+  auto pages = [&](bool flush) {
+    ogg_page page;
+    while ((flush ? ogg_stream_flush : ogg_stream_pageout)(&stream, &page)) {
+      ref.insert(ref.end(), page.header, page.header + page.header_len);
+      ref.insert(ref.end(), page.body, page.body + page.body_len);
+    }
+    size_t page_bytes;
+    while ((page_bytes = writer.NextPage(flush)) != 0) {
+      out.resize(out.size() + page_bytes);
+      writer.WritePage(&out[out.size() - page_bytes]);
+    }
+  };
+
+  std::vector<unsigned char> packet;
+  for (size_t i = 0; i < sizes.size(); i++) {
+    packet.resize(sizes[i]);
+    for (size_t j = 0; j < packet.size(); j++) {
+      packet[j] = i + j;
+    }
+    ogg_packet op;
+    op.packet = packet.data();
+    op.bytes = packet.size();
+    op.b_o_s = i == 0;
+    op.e_o_s = i == sizes.size() - 1;
+    op.granulepos = i * 320;
+    op.packetno = i;
+    ogg_stream_packetin(&stream, &op);
+    writer.AddPacket(packet.data(), packet.size(), op.granulepos, op.e_o_s);
+    pages(flush_every > 0 && (i + 1) % flush_every == 0);
+  }
+  pages(true);
+  ogg_stream_clear(&stream);
+
+  CHECK(out == ref, "%zu packets, flush every %zu: pages differ",
+        sizes.size(), flush_every);
+}
+
+void TestPages() {
+  // Small packets, filling the segment tables.
+  CompareWriters(std::vector<size_t>(1000, 9), 0);
+  // Packets of 1 to 3 segments, filling the 4096 bytes bodies.
+  std::vector<size_t> sizes;
+  for (int i = 0; i < 500; i++) {
+    sizes.push_back((i * 37) % 700);
+  }
+  CompareWriters(sizes, 0);
+  CompareWriters(sizes, 3);
+  // Multistream packets, of tens of segments.
+  std::vector<size_t> large_sizes;
+  for (int i = 0; i < 300; i++) {
+    large_sizes.push_back(500 + (i * 1021) % 19000);
+  }
+  CompareWriters(large_sizes, 0);
+  CompareWriters(large_sizes, 2);
+  // Packets of exactly 255 bytes, and spanning pages.
+  CompareWriters({19, 255, 510, 255 * 300, 0, 7, 255 * 255 + 3}, 0);
+  CompareWriters({19, 255, 510, 255 * 300, 0, 7, 255 * 255 + 3}, 1);
+}
+
+std::vector<unsigned char> Encode(OggOpusEncoder::Options options,
+                                  int bitrate_bps, bool use_libogg) {
+  options.use_libogg = use_libogg;
+  OggOpusEncoder encoder(1, kSampleRateHz, bitrate_bps, options);
+
+  std::vector<int16_t> pcm(kSampleRateHz / 100);
+  std::vector<unsigned char> stream;
+  for (int i = 0; i < 1000; i++) {
+    for (size_t j = 0; j < pcm.size(); j++) {
+      pcm[j] = (rand() % 16000) - 8000;
+    }
+    const std::vector<unsigned char>& bytes =
+        encoder.Process(pcm.data(), pcm.size() - i % 3);
+    stream.insert(stream.end(), bytes.begin(), bytes.end());
+  }
+  const std::vector<unsigned char>& bytes = encoder.Flush();
+  stream.insert(stream.end(), bytes.begin(), bytes.end());
+  return stream;
+}
+
+void TestEncoder() {
+  for (int low_latency = 0; low_latency <= 1; low_latency++) {
+    for (int frame_duration_us : {2500, 20000, 60000}) {
+      for (int bitrate_bps : {16000, 256000}) {
+        OggOpusEncoder::Options options;
+        options.frame_duration_us = frame_duration_us;
+        options.low_latency_mode = low_latency;
+
+        srand(frame_duration_us);
+        std::vector<unsigned char> ref = Encode(options, bitrate_bps, true);
+        srand(frame_duration_us);
+        CHECK(Encode(options, bitrate_bps, false) == ref,
+              "%d us frames, %d bps, low latency %d: stream differs",
+              frame_duration_us, bitrate_bps, low_latency);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+int main() {
+  TestCrc();
+  TestPages();
+  TestEncoder();
+
+  return audio_util::test::Report("ogg_page_writer");
+}
@@ -0,0 +1,126 @@
+/*
+ * Host tests of the ParallelOggOpusEncoder
+ *
+ * - A single segment gives the output of the serial encoder
+ * - Segments are stitched in one stream: page sequence, flags, granule
+ *   positions, and packet count
+ * - The output does not depend on the number of threads
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "../parallel_ogg_opus_encoder.h"
+#include "test_util.h"
+
+using audio_util::OggOpusEncoder;
+using audio_util::ParallelOggOpusEncoder;
+using audio_util::test::GenerateTwoTones;
+
+namespace {
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kBitrateBps = 24000;
+constexpr int kFrameSize = kSampleRateHz / 50;
+
+// 10.5 s of a two tones signal, ending on a partial frame.
+std::vector<int16_t> Generate() {
+  return GenerateTwoTones(kSampleRateHz * 21 / 2 + kFrameSize / 3,
+                          kSampleRateHz);
+}
+
+std::vector<unsigned char> EncodeParallel(const std::vector<int16_t>& pcm,
+                                          int num_threads,
+                                          int segment_duration_ms) {
+  ParallelOggOpusEncoder::ParallelOptions parallel_options;
+  parallel_options.num_threads = num_threads;
+  parallel_options.segment_duration_ms = segment_duration_ms;
+  ParallelOggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps,
+                                 OggOpusEncoder::Options(), parallel_options);
+  return encoder.Encode(pcm.data(), pcm.size());
+}
+
+void TestSingleSegment() {
+  std::vector<int16_t> pcm = Generate();
+
+  OggOpusEncoder serial(1, kSampleRateHz, kBitrateBps, true, false);
+  std::vector<unsigned char> ref = serial.Process(pcm);
+  const std::vector<unsigned char>& flushed = serial.Flush();
+  ref.insert(ref.end(), flushed.begin(), flushed.end());
+
+  CHECK(EncodeParallel(pcm, 4, 60000) == ref, "differs from serial");
+}
+
+void TestStitching() {
+  std::vector<int16_t> pcm = Generate();
+  std::vector<unsigned char> stream = EncodeParallel(pcm, 4, 1000);
+
+  // Walk the pages: 2 header packets, then one packet per frame.
+  size_t offset = 0;
+  uint32_t sequence = 0;
+  int64_t granule = 0;
+  uint16_t pre_skip = 0;
+  size_t num_packets = 0;
+  bool eos = false;
+  while (offset + 27 <= stream.size()) {
+    const unsigned char* page = &stream[offset];
+    if (memcmp(page, "OggS", 4) != 0) {
+      CHECK(false, "no page at %zu", offset);
+      return;
+    }
+    uint32_t page_sequence;
+    int64_t page_granule;
+    memcpy(&page_sequence, page + 18, 4);
+    memcpy(&page_granule, page + 6, 8);
+    CHECK(page_sequence == sequence, "page %u out of sequence", sequence);
+    CHECK((page[5] & 2) == (sequence == 0 ? 2 : 0), "page %u: bad BOS",
+          sequence);
+    CHECK(!eos, "page after EOS");
+    eos = page[5] & 4;
+    if (sequence == 0) {
+      memcpy(&pre_skip, page + 28 + 10, 2);  // Of the OpusHead packet.
+    }
+
+    size_t body = 0;
+    for (int i = 0; i < page[26]; i++) {
+      body += page[27 + i];
+      num_packets += page[27 + i] < 255;
+    }
+    if (page_granule >= 0) {
+      CHECK(page_granule >= granule, "page %u: granule going back", sequence);
+      granule = page_granule;
+    }
+    offset += 27 + page[26] + body;
+    sequence++;
+  }
+
+  const size_t num_frames = pcm.size() / kFrameSize;
+  CHECK(offset == stream.size() && eos, "stream not closed");
+  CHECK(num_packets == 2 + num_frames + 1, "%zu packets for %zu frames",
+        num_packets, num_frames);
+  // At 48 kHz, ending past the pre-skip, which the last frame covers.
+  CHECK(granule == static_cast<int64_t>(pcm.size()) * 3 + pre_skip,
+        "final granule %lld", static_cast<long long>(granule));
+}
+
+void TestThreads() {
+  std::vector<int16_t> pcm = Generate();
+  std::vector<unsigned char> ref = EncodeParallel(pcm, 1, 1000);
+
+  for (int num_threads : {2, 3, 8}) {
+    CHECK(EncodeParallel(pcm, num_threads, 1000) == ref,
+          "%d threads: stream differs", num_threads);
+  }
+}
+
+}  // namespace
+
+int main() {
+  TestSingleSegment();
+  TestStitching();
+  TestThreads();
+
+  return audio_util::test::Report("parallel_ogg_opus_encoder");
+}
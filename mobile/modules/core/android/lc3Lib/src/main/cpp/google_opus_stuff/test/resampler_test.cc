@@ -0,0 +1,261 @@
+/*
+ * Host tests of the Resampler
+ *
+ * - The output has the length of the input, at the output rate, whatever
+ *   the split of the input between calls
+ * - A tone keeps its frequency and level
+ * - The SIMD kernels supported by the CPU match the scalar ones, at all
+ *   qualities, with the direct and the interpolated filters
+ * - Reset() starts a new stream
+ * - The fixed ratio filters, between 8, 16, 24 and 48 kHz, output as the
+ *   generic resampler: exactly with the scalar kernels, to the rounding
+ *   with the SIMD ones
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../resampler.h"
+#include "../resampler_kernels.h"
+#include "test_util.h"
+
+using audio_util::Resampler;
+using audio_util::ResamplerKernels;
+
+namespace {
+
+std::vector<int16_t> Tone(double frequency_hz, int sample_rate_hz,
+                          int num_samples, int num_channels = 1) {
+  std::vector<int16_t> pcm(num_samples * num_channels);
+  for (int i = 0; i < num_samples; i++) {
+    const double x = 10000 * std::sin(2 * M_PI * frequency_hz * i /
+                                      sample_rate_hz);
+    for (int c = 0; c < num_channels; c++) {
+      pcm[i * num_channels + c] = static_cast<int16_t>(c & 1 ? -x : x);
+    }
+  }
+  return pcm;
+}
+
+// Resamples `pcm` given by chunks of `chunk` samples per channel.
+std::vector<int16_t> Resample(Resampler* resampler,
+                              const std::vector<int16_t>& pcm, size_t chunk) {
+  const int num_channels = resampler->num_channels();
+  const size_t num_samples = pcm.size() / num_channels;
+  std::vector<int16_t> out;
+  std::vector<int16_t> buffer(resampler->MaxOutputSamples(chunk) *
+                              num_channels);
+  for (size_t i = 0; i < num_samples; i += chunk) {
+    const size_t n = std::min(chunk, num_samples - i);
+    const int written = resampler->Process(&pcm[i * num_channels], n,
+                                           buffer.data(),
+                                           buffer.size() / num_channels);
+    CHECK(written >= 0, "resampling failed");
+    out.insert(out.end(), buffer.begin(),
+               buffer.begin() + std::max(written, 0) * num_channels);
+  }
+  return out;
+}
+
+std::vector<int16_t> Resample(int input_rate_hz, int output_rate_hz,
+                              int quality, const std::vector<int16_t>& pcm,
+                              size_t chunk, int num_channels = 1,
+                              bool use_fixed_ratio = true) {
+  Resampler resampler(num_channels, input_rate_hz, output_rate_hz, quality,
+                      use_fixed_ratio);
+  return Resample(&resampler, pcm, chunk);
+}
+
+void TestLength() {
+  const std::vector<int16_t> pcm = Tone(440, 16000, 16000);
+  for (int output_rate_hz : {8000, 24000, 44100, 48000}) {
+    const std::vector<int16_t> ref =
+        Resample(16000, output_rate_hz, 4, pcm, pcm.size());
+    const long expected = 16000L * output_rate_hz / 16000;
+    CHECK(std::labs(static_cast<long>(ref.size()) - expected) <= 1,
+          "16000 Hz to %d Hz: %zu samples output", output_rate_hz,
+          ref.size());
+    for (size_t chunk : {1, 7, 160, 1000}) {
+      CHECK(Resample(16000, output_rate_hz, 4, pcm, chunk) == ref,
+            "16000 Hz to %d Hz, chunks of %zu: output differs",
+            output_rate_hz, chunk);
+    }
+  }
+
+  Resampler resampler(1, 16000, 48000, 4);
+  int16_t out[4];
+  CHECK(resampler.Process(pcm.data(), 160, out, 4) == -1,
+        "undersized output accepted");
+}
+
+void TestTone() {
+  const int kInputRateHz = 16000;
+  const int kOutputRateHz = 48000;
+  const double kFrequencyHz = 1000;
+  const std::vector<int16_t> pcm = Tone(kFrequencyHz, kInputRateHz, 16000, 2);
+
+  for (int quality : {0, 3, 5, 10}) {
+    Resampler resampler(2, kInputRateHz, kOutputRateHz, quality);
+    const std::vector<int16_t> out = Resample(&resampler, pcm, 160);
+    const int latency = resampler.OutputLatency();
+
+    // Error to the tone, at the best lag around the latency, in the steady
+    // state.
+    double best_snr_db = -100;
+    for (int lag = latency - 2; lag <= latency + 2; lag++) {
+      double signal = 0;
+      double noise = 0;
+      for (size_t i = 2 * kOutputRateHz / 10; i < out.size() / 2; i++) {
+        const double ref = 10000 * std::sin(2 * M_PI * kFrequencyHz *
+                                            (static_cast<int>(i) - lag) /
+                                            kOutputRateHz);
+        signal += ref * ref;
+        noise += (out[2 * i] - ref) * (out[2 * i] - ref);
+      }
+      best_snr_db = std::max(best_snr_db, 10 * std::log10(signal / noise));
+    }
+    CHECK(best_snr_db > 50, "quality %d: SNR %.1f dB", quality, best_snr_db);
+
+    // The channels are resampled alike.
+    int max_diff = 0;
+    for (size_t i = 0; i < out.size(); i += 2) {
+      max_diff = std::max(max_diff, std::abs(out[i] + out[i + 1]));
+    }
+    CHECK(max_diff <= 1, "quality %d: channels differ by %d", quality,
+          max_diff);
+  }
+}
+
+void TestKernels() {
+  const std::vector<int16_t> pcm = Tone(1234, 44100, 22050);
+  std::vector<float> pcm_float(pcm.begin(), pcm.end());
+  const ResamplerKernels best = audio_util::ActiveResamplerKernels();
+
+  for (ResamplerKernels kernels :
+       {ResamplerKernels::kSse, ResamplerKernels::kAvx2,
+        ResamplerKernels::kNeon}) {
+    if (!audio_util::ResamplerKernelsSupported(kernels)) {
+      continue;
+    }
+    // 44.1 to 48 kHz interpolates the filter, 48 to 16 kHz does not.
+    for (int output_rate_hz : {48000, 16000}) {
+      const int input_rate_hz = output_rate_hz == 48000 ? 44100 : 48000;
+      for (int quality = 0; quality <= 10; quality++) {
+        Resampler scalar_resampler(1, input_rate_hz, output_rate_hz,
+                                   quality);
+        Resampler simd_resampler(1, input_rate_hz, output_rate_hz, quality);
+        const size_t max_samples =
+            scalar_resampler.MaxOutputSamples(pcm.size());
+        std::vector<int16_t> scalar(max_samples);
+        std::vector<int16_t> simd(max_samples);
+        std::vector<float> scalar_float(max_samples);
+        std::vector<float> simd_float(max_samples);
+
+        audio_util::UseResamplerKernels(ResamplerKernels::kScalar);
+        int n = scalar_resampler.Process(pcm.data(), pcm.size(),
+                                         scalar.data(), max_samples);
+        scalar_resampler.Reset();
+        scalar_resampler.Process(pcm_float.data(), pcm.size(),
+                                 scalar_float.data(), max_samples);
+        audio_util::UseResamplerKernels(kernels);
+        int simd_n = simd_resampler.Process(pcm.data(), pcm.size(),
+                                            simd.data(), max_samples);
+        simd_resampler.Reset();
+        simd_resampler.Process(pcm_float.data(), pcm.size(),
+                               simd_float.data(), max_samples);
+
+        int max_diff = 0;
+        float max_float_diff = 0;
+        for (int i = 0; i < n; i++) {
+          max_diff = std::max(max_diff, std::abs(scalar[i] - simd[i]));
+          max_float_diff = std::max(
+              max_float_diff, std::fabs(scalar_float[i] - simd_float[i]));
+        }
+        CHECK(n == simd_n && max_diff <= 1 && max_float_diff < 0.05f,
+              "%s, %d to %d Hz, quality %d: %d samples for %d, off by %d, "
+              "%g in float",
+              audio_util::ResamplerKernelsName(kernels), input_rate_hz,
+              output_rate_hz, quality, simd_n, n, max_diff, max_float_diff);
+      }
+    }
+  }
+  audio_util::UseResamplerKernels(best);
+}
+
+void TestReset() {
+  const std::vector<int16_t> first = Tone(300, 16000, 5000);
+  const std::vector<int16_t> second = Tone(700, 16000, 5000);
+  const std::vector<int16_t> ref = Resample(16000, 44100, 5, second, 160);
+
+  Resampler resampler(1, 16000, 44100, 5);
+  Resample(&resampler, first, 160);
+  resampler.Reset();
+  CHECK(Resample(&resampler, second, 160) == ref,
+        "reset resampler output differs");
+}
+
+void TestFixedRatio() {
+  const ResamplerKernels best = audio_util::ActiveResamplerKernels();
+  const int kRates[] = {8000, 16000, 24000, 48000};
+  for (int input_rate_hz : kRates) {
+    for (int output_rate_hz : kRates) {
+      if (input_rate_hz == output_rate_hz) {
+        continue;
+      }
+      const std::vector<int16_t> pcm = Tone(700, input_rate_hz, 4000, 2);
+      for (int quality = 3; quality <= 5; quality++) {
+        Resampler fixed(2, input_rate_hz, output_rate_hz, quality);
+        CHECK(fixed.fixed_ratio(), "%d to %d Hz, quality %d: no table",
+              input_rate_hz, output_rate_hz, quality);
+        Resampler generic(2, input_rate_hz, output_rate_hz, quality, false);
+        CHECK(fixed.OutputLatency() == generic.OutputLatency(),
+              "%d to %d Hz, quality %d: latency differs", input_rate_hz,
+              output_rate_hz, quality);
+
+        for (ResamplerKernels kernels : {ResamplerKernels::kScalar, best}) {
+          audio_util::UseResamplerKernels(kernels);
+          const std::vector<int16_t> ref = Resample(
+              input_rate_hz, output_rate_hz, quality, pcm, 160, 2, false);
+          for (size_t chunk : {1, 160, 4000}) {
+            const std::vector<int16_t> out = Resample(
+                input_rate_hz, output_rate_hz, quality, pcm, chunk, 2);
+            int max_diff = out.size() == ref.size() ? 0 : 1 << 16;
+            for (size_t i = 0; i < out.size() && i < ref.size(); i++) {
+              max_diff = std::max(max_diff, std::abs(out[i] - ref[i]));
+            }
+            CHECK(max_diff <= (kernels == ResamplerKernels::kScalar ? 0 : 1),
+                  "%s, %d to %d Hz, quality %d, chunks of %zu: %zu samples "
+                  "for %zu, off by %d",
+                  audio_util::ResamplerKernelsName(kernels), input_rate_hz,
+                  output_rate_hz, quality, chunk, out.size(), ref.size(),
+                  max_diff);
+          }
+        }
+      }
+    }
+  }
+  audio_util::UseResamplerKernels(best);
+
+  // Other qualities, and ratios, are resampled by the generic resampler.
+  CHECK(!Resampler(1, 16000, 48000, 10).fixed_ratio() &&
+            !Resampler(1, 16000, 44100, 4).fixed_ratio(),
+        "fixed ratio filter without a table");
+}
+
+}  // namespace
+
+int main() {
+  printf("resampler kernels: %s\n",
+         audio_util::ResamplerKernelsName(
+             audio_util::ActiveResamplerKernels()));
+  TestLength();
+  TestTone();
+  TestKernels();
+  TestReset();
+  TestFixedRatio();
+
+  return audio_util::test::Report("resampler");
+}
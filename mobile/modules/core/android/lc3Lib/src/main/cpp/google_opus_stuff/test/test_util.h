@@ -0,0 +1,54 @@
+/*
+ * Checks and test signals shared by the host tests
+ */
+
+#ifndef AUDIO_UTIL_TEST_TEST_UTIL_H_
+#define AUDIO_UTIL_TEST_TEST_UTIL_H_
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace audio_util {
+namespace test {
+
+// Failed checks of the test binary.
+inline int& Failures() {
+  static int failures = 0;
+  return failures;
+}
+
+// Prints the outcome of the test binary, and returns its exit status.
+inline int Report(const char* name) {
+  printf("%s: %s\n", name, Failures() ? "FAILED" : "OK");
+  return Failures() ? 1 : 0;
+}
+
+// Two tones, 440 Hz and 1250 Hz, about -12 dBFS.
+inline std::vector<int16_t> GenerateTwoTones(int num_elements,
+                                             int sample_rate_hz) {
+  std::vector<int16_t> pcm(num_elements);
+  for (int i = 0; i < num_elements; i++) {
+    pcm[i] = static_cast<int16_t>(
+        6000 * std::sin(2 * M_PI * 440 * i / sample_rate_hz) +
+        3000 * std::sin(2 * M_PI * 1250 * i / sample_rate_hz));
+  }
+  return pcm;
+}
+
+}  // namespace test
+}  // namespace audio_util
+
+// Checks `cond`, printing the message of a failure and carrying on.
+#define CHECK(cond, ...)                                 \
+  do {                                                   \
+    if (!(cond)) {                                       \
+      fprintf(stderr, "%s:%d: ", __FILE__, __LINE__);    \
+      fprintf(stderr, __VA_ARGS__);                      \
+      fputc('\n', stderr);                               \
+      ::audio_util::test::Failures()++;                  \
+    }                                                    \
+  } while (0)
+
+#endif  // AUDIO_UTIL_TEST_TEST_UTIL_H_
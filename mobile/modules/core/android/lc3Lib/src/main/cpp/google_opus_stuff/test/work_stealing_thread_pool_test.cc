@@ -0,0 +1,104 @@
+/*
+ * Host tests of the WorkStealingThreadPool
+ *
+ * - All the tasks run once, those submitted by tasks included, and Wait()
+ *   returns once they have
+ * - The tasks queued on a busy worker are stolen by the idle ones
+ * - The pool is reusable after Wait(), and its destruction waits for the
+ *   tasks
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include "../work_stealing_thread_pool.h"
+#include "test_util.h"
+
+using audio_util::WorkStealingThreadPool;
+
+namespace {
+
+void TestTasks() {
+  WorkStealingThreadPool pool(4);
+  CHECK(pool.num_threads() == 4, "%d threads", pool.num_threads());
+  std::atomic<int> count(0);
+  for (int i = 0; i < 1000; i++) {
+    pool.Submit([&count]() { count++; });
+  }
+  pool.Wait();
+  CHECK(count == 1000, "%d tasks run", count.load());
+  CHECK(pool.stats().executed == 1000, "%llu executed",
+        static_cast<unsigned long long>(pool.stats().executed));
+
+  // Reused.
+  for (int i = 0; i < 10; i++) {
+    pool.Submit([&count]() { count++; });
+  }
+  pool.Wait();
+  CHECK(count == 1010, "%d tasks run after reuse", count.load());
+}
+
+// Binary tree of tasks, each submitting its children.
+void Spawn(WorkStealingThreadPool* pool, int depth, std::atomic<int>* count) {
+  (*count)++;
+  if (depth > 0) {
+    pool->Submit([=]() { Spawn(pool, depth - 1, count); });
+    pool->Submit([=]() { Spawn(pool, depth - 1, count); });
+  }
+}
+
+void TestNestedTasks() {
+  WorkStealingThreadPool pool(3);
+  std::atomic<int> count(0);
+  pool.Submit([&]() { Spawn(&pool, 10, &count); });
+  pool.Wait();
+  CHECK(count == (1 << 11) - 1, "%d nested tasks run", count.load());
+}
+
+void TestStealing() {
+  WorkStealingThreadPool pool(4);
+  std::atomic<int> count(0);
+  // All queued on the worker of the first task, which is busy with the
+  // last one.
+  pool.Submit([&]() {
+    for (int i = 0; i < 64; i++) {
+      pool.Submit([&count]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        count++;
+      });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  });
+  pool.Wait();
+  const WorkStealingThreadPool::Stats stats = pool.stats();
+  CHECK(count == 64, "%d tasks run", count.load());
+  CHECK(stats.stolen > 0 && stats.stolen <= 64, "%llu tasks stolen",
+        static_cast<unsigned long long>(stats.stolen));
+}
+
+void TestDestruction() {
+  std::atomic<int> count(0);
+  {
+    WorkStealingThreadPool pool(2);
+    for (int i = 0; i < 8; i++) {
+      pool.Submit([&count]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        count++;
+      });
+    }
+  }
+  CHECK(count == 8, "%d tasks run before the destruction", count.load());
+}
+
+}  // namespace
+
+int main() {
+  TestTasks();
+  TestNestedTasks();
+  TestStealing();
+  TestDestruction();
+
+  return audio_util::test::Report("work_stealing_thread_pool");
+}
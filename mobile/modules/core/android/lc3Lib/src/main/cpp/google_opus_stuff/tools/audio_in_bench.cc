@@ -0,0 +1,155 @@
+/*
+ * Speed of the WAV and AIFF readers of opus-tools' audio-in.c, memory
+ * mapped against stdio
+ *
+ * A corpus of `megabytes` of files of 64 MB, 48 kHz stereo, 16, 24 bit and
+ * float WAV, and AIFF, is written to `directory`, then read by each reader
+ * through read_samples, by frames of 20 ms as opusenc, in this order: the
+ * corpus is in the page cache when it fits in memory, so the conversion
+ * and the copies are measured, not the disk. The floats read are checked
+ * to be the same. The corpus is removed at the end.
+ *
+ *   audio_in_bench [megabytes] [directory]
+ */
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include <ogg/ogg.h>
+
+#include "opusenc.h"
+}
+
+#include "bench_signal.h"
+#include "pcm_file_writer.h"
+
+using audio_util::PcmFileFormat;
+
+namespace {
+
+constexpr int kSampleRateHz = 48000;
+constexpr int kChannels = 2;
+constexpr int kFileMegabytes = 64;
+
+struct Result {
+  double seconds = 0;
+  double checksum = 0;
+  bool mapped = false;
+};
+
+// Reads all the `paths`, by frames of 20 ms.
+Result ReadAll(const std::vector<std::string>& paths, bool nommap) {
+  Result result;
+  std::vector<float> buffer(kSampleRateHz / 50 * kChannels);
+  auto start = std::chrono::steady_clock::now();
+  for (const std::string& path : paths) {
+    FILE* in = fopen(path.c_str(), "rb");
+    if (!in) {
+      fprintf(stderr, "cannot open %s\n", path.c_str());
+      exit(1);
+    }
+    oe_enc_opt opt = {};
+    opt.nommap = nommap;
+    input_format* format = open_audio_file(in, &opt);
+    if (!format) {
+      fprintf(stderr, "cannot read %s\n", path.c_str());
+      exit(1);
+    }
+    result.mapped = opt.read_samples == wav_map_read;
+    long n;
+    while ((n = opt.read_samples(opt.readdata, buffer.data(),
+                                 kSampleRateHz / 50)) > 0) {
+      result.checksum += buffer[0] + buffer[n * kChannels - 1];
+    }
+    format->close_func(opt.readdata);
+    fclose(in);
+  }
+  result.seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const int megabytes = argc > 1 ? atoi(argv[1]) : 4096;
+  const char* tmpdir = getenv("TMPDIR");
+  const std::string directory =
+      argc > 2 ? argv[2] : std::string(tmpdir ? tmpdir : "/tmp");
+
+  const struct {
+    const char* name;
+    PcmFileFormat format;
+  } kFormats[] = {
+      {"wav s16", {PcmFileFormat::kWav, 16, kChannels, kSampleRateHz}},
+      {"wav s24", {PcmFileFormat::kWav, 24, kChannels, kSampleRateHz}},
+      {"wav f32", {PcmFileFormat::kWav, 32, kChannels, kSampleRateHz}},
+      {"aiff s16", {PcmFileFormat::kAiff, 16, kChannels, kSampleRateHz}},
+  };
+  const int num_formats = sizeof(kFormats) / sizeof(kFormats[0]);
+  const int files_per_format =
+      std::max(1, megabytes / kFileMegabytes / num_formats);
+
+  // Speech like, a second repeated: the content does not change the speed.
+  const std::vector<int16_t> pcm =
+      audio_util::GenerateSpeechLikeSignal(kSampleRateHz * kChannels,
+                                           kSampleRateHz);
+  std::vector<float> second(pcm.size());
+  for (size_t i = 0; i < pcm.size(); i++) {
+    second[i] = pcm[i] / 32768.f;
+  }
+
+  printf("%d files of %d MB per format, in %s, by frames of 20 ms\n",
+         files_per_format, kFileMegabytes, directory.c_str());
+  printf("%-10s %8s %10s %10s %10s\n", "format", "MB", "stdio MB/s",
+         "mmap MB/s", "speedup");
+  bool ok = true;
+  for (const auto& f : kFormats) {
+    const size_t frames = (static_cast<size_t>(kFileMegabytes) << 20) /
+                          (kChannels * f.format.bits / 8);
+    std::vector<float> samples;
+    samples.reserve(frames * kChannels);
+    while (samples.size() < frames * kChannels) {
+      samples.insert(samples.end(), second.begin(),
+                     second.begin() + std::min(second.size(),
+                                               frames * kChannels -
+                                                   samples.size()));
+    }
+    std::vector<std::string> paths;
+    for (int i = 0; i < files_per_format; i++) {
+      paths.push_back(directory + "/audio_in_bench_" +
+                      std::to_string(getpid()) + "_" +
+                      std::to_string(i) + (f.format.container ==
+                                                   PcmFileFormat::kAiff
+                                               ? ".aiff"
+                                               : ".wav"));
+      if (!audio_util::WritePcmFile(paths.back(), f.format, samples)) {
+        fprintf(stderr, "cannot write %s\n", paths.back().c_str());
+        return 1;
+      }
+    }
+
+    const Result stdio = ReadAll(paths, true);
+    const Result mapped = ReadAll(paths, false);
+    const double total_megabytes = files_per_format * kFileMegabytes;
+    printf("%-10s %8.0f %10.0f %10.0f %9.2fx\n", f.name, total_megabytes,
+           total_megabytes / stdio.seconds, total_megabytes / mapped.seconds,
+           stdio.seconds / mapped.seconds);
+    if (!mapped.mapped || mapped.checksum != stdio.checksum) {
+      fprintf(stderr, "%s: not mapped, or other samples\n", f.name);
+      ok = false;
+    }
+    for (const std::string& path : paths) {
+      remove(path.c_str());
+    }
+  }
+  return ok ? 0 : 1;
+}
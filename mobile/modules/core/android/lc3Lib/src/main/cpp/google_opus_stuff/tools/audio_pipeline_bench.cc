@@ -0,0 +1,209 @@
+/*
+ * Speed of the conversion of opus-tools' audio-in.c between the reader of
+ * the input file and the encoder, fused by setup_pipeline against the
+ * chained readers of opusenc: scaler, downmix, padder and resampler
+ *
+ * `seconds` of speech like audio, in memory, are converted as by opusenc,
+ * read by frames of 20 ms at the output rate, best of 3 runs. The samples
+ * converted are checked to be the same. Besides the time per second of
+ * audio, the intermediate buffers each way allocates are reported: the
+ * chained readers copy each sample through all of them, where the fused
+ * one converts a block in place, in cache, and resamples it into the
+ * buffer of the caller. Without a downmix, setup_pipeline chains the
+ * readers as well, and both ways should take the same time.
+ *
+ *   audio_pipeline_bench [seconds]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+extern "C" {
+#include <ogg/ogg.h>
+
+#include "opusenc.h"
+}
+
+#include "bench_signal.h"
+
+namespace {
+
+// Interleaved samples, read as from a file.
+struct Memory {
+  const float* samples;
+  size_t num_frames;
+  int channels;
+  size_t position;
+};
+
+long ReadMemory(void* data, float* buffer, int samples) {
+  Memory* m = static_cast<Memory*>(data);
+  const size_t n =
+      std::min<size_t>(samples, m->num_frames - m->position);
+  std::copy(m->samples + m->position * m->channels,
+            m->samples + (m->position + n) * m->channels, buffer);
+  m->position += n;
+  return n;
+}
+
+struct Conversion {
+  const char* name;
+  int in_channels;
+  long in_rate;
+  float scale;
+  int channels;
+  long rate;
+};
+
+struct Result {
+  double seconds = 0;
+  std::vector<float> samples;
+};
+
+// Converts `input` as opusenc, best of 3 runs, the samples of the last kept.
+Result Convert(const std::vector<float>& input, const Conversion& c,
+               bool fused) {
+  Result result;
+  for (int run = 0; run < 3; run++) {
+    Memory memory = {input.data(), input.size() / c.in_channels,
+                     c.in_channels, 0};
+    oe_enc_opt opt = {};
+    opt.read_samples = ReadMemory;
+    opt.readdata = &memory;
+    opt.channels = c.in_channels;
+    opt.rate = c.in_rate;
+    opt.total_samples_per_channel = memory.num_frames;
+    ogg_int64_t original_samples = 0;
+    std::vector<float> samples;
+    samples.reserve(input.size() * c.rate / c.in_rate + 4096);
+
+    auto start = std::chrono::steady_clock::now();
+    bool downmixed = false;
+    if (fused) {
+      oe_pipeline_opt pipeline = {};
+      pipeline.scale = c.scale;
+      pipeline.channels = c.channels;
+      pipeline.rate = c.rate;
+      pipeline.quality = 5;
+      pipeline.original_samples = &original_samples;
+      pipeline.pad = 1;
+      if (!setup_pipeline(&opt, &pipeline)) {
+        exit(1);
+      }
+    } else {
+      if (c.scale != 1) {
+        setup_scaler(&opt, c.scale);
+      }
+      if (c.channels < c.in_channels) {
+        downmixed = setup_downmix(&opt, c.channels) != 0;
+      }
+      setup_padder(&opt, &original_samples);
+      if (c.rate != c.in_rate) {
+        setup_resample(&opt, 5, c.rate);
+      }
+    }
+    // The padding of opusenc, at the output rate.
+    opt.extraout = static_cast<int>(opt.skip + c.rate / 400 + c.rate / 250);
+    const int frame = static_cast<int>(c.rate / 50);
+    std::vector<float> buffer(frame * opt.channels);
+    long n;
+    while ((n = opt.read_samples(opt.readdata, buffer.data(), frame)) > 0) {
+      samples.insert(samples.end(), buffer.begin(),
+                     buffer.begin() + n * opt.channels);
+    }
+    if (fused) {
+      clear_pipeline(&opt);
+    } else {
+      if (c.rate != c.in_rate) {
+        clear_resample(&opt);
+      }
+      clear_padder(&opt);
+      if (downmixed) {
+        clear_downmix(&opt);
+      }
+      if (c.scale != 1) {
+        clear_scaler(&opt);
+      }
+    }
+    const double seconds = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+    if (run == 0 || seconds < result.seconds) {
+      result.seconds = seconds;
+    }
+    result.samples.swap(samples);
+  }
+  return result;
+}
+
+// Bytes of the intermediate buffers, from the block sizes of audio-in.c:
+// 4096 frames before the downmix, 2048 before the resampler, and the two
+// blocks of 1024 frames of the pipeline.
+long ChainedBufferBytes(const Conversion& c) {
+  long bytes = 0;
+  if (c.channels < c.in_channels) {
+    bytes += 4096L * c.in_channels * sizeof(float);
+  }
+  if (c.rate != c.in_rate) {
+    bytes += 2048L * c.channels * sizeof(float);
+  }
+  return bytes;
+}
+
+// Without a downmix, setup_pipeline sets up the chained readers.
+long FusedBufferBytes(const Conversion& c) {
+  if (c.channels >= c.in_channels) {
+    return ChainedBufferBytes(c);
+  }
+  return 2 * 1024L * c.in_channels * sizeof(float);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const int seconds = argc > 1 ? atoi(argv[1]) : 60;
+
+  const Conversion kConversions[] = {
+      {"48k stereo to 16k mono", 2, 48000, 1, 1, 16000},
+      {"48k stereo to 48k mono", 2, 48000, 1, 1, 48000},
+      {"44.1k stereo to 48k", 2, 44100, 1, 2, 48000},
+      {"48k 5.1 to 48k stereo", 6, 48000, 1, 2, 48000},
+      {"48k stereo scaled", 2, 48000, .5f, 2, 48000},
+  };
+
+  printf("%d s of audio, by frames of 20 ms\n", seconds);
+  printf("%-24s %12s %12s %8s %12s %12s\n", "conversion", "chained us/s",
+         "fused us/s", "speedup", "chained KB", "fused KB");
+  bool ok = true;
+  for (const Conversion& c : kConversions) {
+    const std::vector<int16_t> pcm = audio_util::GenerateSpeechLikeSignal(
+        static_cast<int>(c.in_rate) * seconds * c.in_channels,
+        static_cast<int>(c.in_rate));
+    std::vector<float> input(pcm.size());
+    for (size_t i = 0; i < pcm.size(); i++) {
+      input[i] = pcm[i] / 32768.f;
+    }
+
+    const Result chained = Convert(input, c, false);
+    const Result fused = Convert(input, c, true);
+    printf("%-24s %12.0f %12.0f %7.2fx %12.1f %12.1f\n", c.name,
+           chained.seconds * 1e6 / seconds, fused.seconds * 1e6 / seconds,
+           chained.seconds / fused.seconds, ChainedBufferBytes(c) / 1024.,
+           FusedBufferBytes(c) / 1024.);
+    // The scale folded in the downmix rounds otherwise, and the padding is
+    // extrapolated from other blocks.
+    bool same = fused.samples.size() == chained.samples.size();
+    const size_t padded = c.rate / 100 * c.channels * 4;
+    for (size_t i = 0; same && i + padded < fused.samples.size(); i++) {
+      same = std::abs(fused.samples[i] - chained.samples[i]) <= 1e-6f;
+    }
+    if (!same) {
+      fprintf(stderr, "%s: other samples\n", c.name);
+      ok = false;
+    }
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+/*
+ * Transcodes a corpus of recordings, as listed by a manifest, on all the
+ * cores, and writes a CSV of the timing, bitrate and SNR of each file, see
+ * batch_transcoder.h for the manifest
+ *
+ *   batch_transcode [-j threads] [-o csv] [-d output_directory] manifest
+ *
+ * The CSV goes to the standard output by default, its rows in the order the
+ * jobs complete, by their index in the manifest. With -d, the decoded audio
+ * of each job is written there, as <index>.wav. Inputs are relative to the
+ * directory of the manifest. Exits with 1 when a job failed.
+ */
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "../batch_transcoder.h"
+
+namespace {
+
+void Usage() {
+  fprintf(stderr,
+          "usage: batch_transcode [-j threads] [-o csv] "
+          "[-d output_directory] manifest\n");
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int num_threads = 0;
+  const char* csv_path = nullptr;
+  std::string output_directory;
+  int opt;
+  while ((opt = getopt(argc, argv, "j:o:d:")) != -1) {
+    switch (opt) {
+      case 'j':
+        num_threads = atoi(optarg);
+        break;
+      case 'o':
+        csv_path = optarg;
+        break;
+      case 'd':
+        output_directory = optarg;
+        break;
+      default:
+        Usage();
+        return 2;
+    }
+  }
+  if (optind != argc - 1) {
+    Usage();
+    return 2;
+  }
+
+  const std::string manifest_path = argv[optind];
+  FILE* manifest = fopen(manifest_path.c_str(), "r");
+  if (!manifest) {
+    fprintf(stderr, "cannot open %s\n", manifest_path.c_str());
+    return 2;
+  }
+  const size_t slash = manifest_path.rfind('/');
+  const std::string base_directory =
+      slash == std::string::npos ? "" : manifest_path.substr(0, slash);
+  std::vector<audio_util::BatchJob> jobs;
+  std::string error;
+  const bool parsed =
+      audio_util::ParseBatchManifest(manifest, base_directory, &jobs, &error);
+  fclose(manifest);
+  if (!parsed) {
+    fprintf(stderr, "%s: %s\n", manifest_path.c_str(), error.c_str());
+    return 2;
+  }
+
+  FILE* csv = csv_path ? fopen(csv_path, "w") : stdout;
+  if (!csv) {
+    fprintf(stderr, "cannot write %s\n", csv_path);
+    return 2;
+  }
+  const auto start = std::chrono::steady_clock::now();
+  const size_t failed =
+      audio_util::RunBatch(jobs, num_threads, csv, output_directory);
+  const double seconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+  if (csv != stdout && fclose(csv) != 0) {
+    fprintf(stderr, "cannot write %s\n", csv_path);
+    return 2;
+  }
+  fprintf(stderr, "%zu jobs, %zu failed, in %.1f s\n", jobs.size(), failed,
+          seconds);
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,36 @@
+/*
+ * Test signal of the Opus benchmarks
+ */
+
+#ifndef AUDIO_UTIL_TOOLS_BENCH_SIGNAL_H_
+#define AUDIO_UTIL_TOOLS_BENCH_SIGNAL_H_
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace audio_util {
+
+// Voiced segments of a 150 Hz harmonic series, amplitude modulated at the
+// syllable rate, separated by silences.
+inline std::vector<int16_t> GenerateSpeechLikeSignal(int num_elements,
+                                                      int sample_rate_hz) {
+  std::vector<int16_t> pcm(num_elements);
+  unsigned seed = 1;
+  for (int i = 0; i < num_elements; i++) {
+    double t = static_cast<double>(i) / sample_rate_hz;
+    double envelope = std::fmod(t, 1.5) < 1.0 ? std::sin(M_PI * 4 * t) : 0;
+    double x = 0;
+    for (int h = 1; h <= 8; h++) {
+      x += std::sin(2 * M_PI * 150 * h * t) / h;
+    }
+    seed = seed * 1103515245u + 12345u;
+    double noise = static_cast<int>((seed >> 16) & 0xff) - 128;
+    pcm[i] = static_cast<int16_t>(4000 * envelope * envelope * x + noise);
+  }
+  return pcm;
+}
+
+}  // namespace audio_util
+
+#endif  // AUDIO_UTIL_TOOLS_BENCH_SIGNAL_H_
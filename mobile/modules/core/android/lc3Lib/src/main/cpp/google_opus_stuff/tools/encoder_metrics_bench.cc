@@ -0,0 +1,115 @@
+/*
+ * Cost of the OggOpusEncoder metrics
+ *
+ * A speech like signal is encoded, by chunks of 10 ms, and the metrics
+ * recorded are printed. The overhead is the time the recording of the
+ * metrics of a frame takes, measured apart, over the encoding time of a
+ * frame: it should stay under 1%.
+ *
+ *   encoder_metrics_bench [seconds]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../encoder_metrics.h"
+#include "../ogg_opus_encoder.h"
+#include "bench_signal.h"
+
+using audio_util::EncoderMetrics;
+using audio_util::EncoderMetricsHistogram;
+using audio_util::EncoderMetricsSnapshot;
+using audio_util::OggOpusEncoder;
+
+namespace {
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kBitrateBps = 24000;
+constexpr int kChunkElements = kSampleRateHz / 100;
+
+// Upper bound of the bucket holding the `p` quantile, or the maximum.
+uint64_t Quantile(const EncoderMetricsHistogram& histogram, double p) {
+  uint64_t seen = 0;
+  for (int i = 0; i < EncoderMetricsHistogram::kBuckets; i++) {
+    seen += histogram.buckets[i];
+    if (seen >= p * histogram.count) {
+      return i == 0 ? 0 : std::min<uint64_t>(histogram.max, (1ull << i) - 1);
+    }
+  }
+  return histogram.max;
+}
+
+double Mean(const EncoderMetricsHistogram& histogram) {
+  return histogram.count ? static_cast<double>(histogram.sum) /
+                               histogram.count
+                         : 0;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const int duration_s = argc > 1 ? atoi(argv[1]) : 30;
+  std::vector<int16_t> pcm = audio_util::GenerateSpeechLikeSignal(
+      duration_s * kSampleRateHz, kSampleRateHz);
+
+  OggOpusEncoder::Options options;
+  options.low_latency_mode = true;
+  OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, options);
+  std::vector<unsigned char> out(1 << 16);
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i + kChunkElements <= pcm.size(); i += kChunkElements) {
+    encoder.Process(pcm.data() + i, kChunkElements, out.data(), out.size());
+  }
+  const double seconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+
+  printf("%d s at %d Hz, %d bps, chunks of 10 ms\n", duration_s,
+         kSampleRateHz, kBitrateBps);
+  if (!EncoderMetrics::kEnabled) {
+    printf("metrics compiled out, see AUDIO_UTIL_ENCODER_METRICS\n");
+    return 0;
+  }
+
+  EncoderMetricsSnapshot metrics;
+  encoder.GetMetrics(&metrics);
+  printf("%-16s %8s %10s %10s %10s %10s\n", "metric", "count", "mean",
+         "p50 <=", "p99 <=", "max");
+  const struct {
+    const char* name;
+    const EncoderMetricsHistogram& histogram;
+  } rows[] = {{"encode us", metrics.encode_time_us},
+              {"frame bytes", metrics.frame_bytes},
+              {"page packets", metrics.page_packets},
+              {"buffered us", metrics.buffered_us}};
+  for (const auto& row : rows) {
+    printf("%-16s %8llu %10.1f %10llu %10llu %10llu\n", row.name,
+           static_cast<unsigned long long>(row.histogram.count),
+           Mean(row.histogram),
+           static_cast<unsigned long long>(Quantile(row.histogram, 0.5)),
+           static_cast<unsigned long long>(Quantile(row.histogram, 0.99)),
+           static_cast<unsigned long long>(row.histogram.max));
+  }
+
+  // Recording of a frame, and of the input buffered by the calls making it.
+  const int kIterations = 1000000;
+  EncoderMetrics recorder;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kIterations; i++) {
+    recorder.BeginFrame();
+    recorder.EndFrame(i & 0xff);
+    recorder.RecordBuffered(i & 0x1ff, kSampleRateHz);
+    recorder.RecordBuffered(0, kSampleRateHz);
+  }
+  const double record_seconds = std::chrono::duration<double>(
+                                    std::chrono::steady_clock::now() - start)
+                                    .count();
+  const double frame_us = seconds * 1e6 / metrics.encode_time_us.count;
+  const double record_us = record_seconds * 1e6 / kIterations;
+  printf("encoding %.2f us/frame, recording %.3f us/frame: %.2f%% overhead\n",
+         frame_us, record_us, 100 * record_us / frame_us);
+  return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * Session start latency of the OggOpusEncoder
+ *
+ * Short streams, as of a voice session, are started one after the other:
+ * on a new encoder, on one of an OggOpusEncoderPool, and on the same
+ * encoder Reset(). For each, the median and 99th percentile time to start a
+ * stream, header included, and of the whole session of 1 s of audio.
+ *
+ *   encoder_session_bench [sessions]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "../ogg_opus_encoder.h"
+#include "../ogg_opus_encoder_pool.h"
+#include "bench_signal.h"
+
+using audio_util::OggOpusEncoder;
+using audio_util::OggOpusEncoderPool;
+
+namespace {
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kBitrateBps = 24000;
+constexpr int kChunkElements = kSampleRateHz / 100;
+
+enum class Mode { kNew, kPool, kReset };
+
+struct Result {
+  std::vector<double> start_us;
+  std::vector<double> session_us;
+};
+
+double Percentile(std::vector<double> values, double p) {
+  std::sort(values.begin(), values.end());
+  return values[std::min(values.size() - 1,
+                         static_cast<size_t>(p * values.size()))];
+}
+
+Result Run(Mode mode, const std::vector<int16_t>& pcm, int sessions) {
+  OggOpusEncoder::Options options;
+  options.low_latency_mode = true;
+  OggOpusEncoderPool pool(1);
+  OggOpusEncoder reused(1, kSampleRateHz, kBitrateBps, options);
+  std::vector<unsigned char> out(1 << 16);
+  Result result;
+  size_t bytes = 0;
+
+  for (int i = 0; i < sessions; i++) {
+    auto start = std::chrono::steady_clock::now();
+    std::unique_ptr<OggOpusEncoder> owned;
+    OggOpusEncoder* encoder = &reused;
+    if (mode == Mode::kNew) {
+      owned.reset(
+          new OggOpusEncoder(1, kSampleRateHz, kBitrateBps, options));
+      encoder = owned.get();
+    } else if (mode == Mode::kPool) {
+      owned = pool.Acquire(1, kSampleRateHz, kBitrateBps, options, i);
+      encoder = owned.get();
+    } else {
+      encoder->Reset(i);
+    }
+    auto started = std::chrono::steady_clock::now();
+
+    for (size_t j = 0; j + kChunkElements <= pcm.size();
+         j += kChunkElements) {
+      bytes += encoder->Process(pcm.data() + j, kChunkElements, out.data(),
+                                out.size());
+    }
+    bytes += encoder->Flush(out.data(), out.size());
+    if (mode == Mode::kPool) {
+      pool.Release(std::move(owned));
+    }
+    owned.reset();
+    auto end = std::chrono::steady_clock::now();
+
+    result.start_us.push_back(
+        std::chrono::duration<double, std::micro>(started - start).count());
+    result.session_us.push_back(
+        std::chrono::duration<double, std::micro>(end - start).count());
+  }
+  if (bytes == 0) {
+    fprintf(stderr, "Nothing encoded\n");
+    exit(1);
+  }
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const int sessions = argc > 1 ? atoi(argv[1]) : 10000;
+  std::vector<int16_t> pcm =
+      audio_util::GenerateSpeechLikeSignal(kSampleRateHz, kSampleRateHz);
+
+  printf("%d sessions of 1 s at %d Hz, %d bps, chunks of 10 ms\n", sessions,
+         kSampleRateHz, kBitrateBps);
+  printf("%-8s %14s %14s %16s\n", "start", "p50 start us", "p99 start us",
+         "p50 session us");
+  const struct {
+    Mode mode;
+    const char* name;
+  } modes[] = {{Mode::kNew, "new"}, {Mode::kPool, "pool"},
+               {Mode::kReset, "reset"}};
+  for (const auto& mode : modes) {
+    Result result = Run(mode.mode, pcm, sessions);
+    printf("%-8s %14.2f %14.2f %16.1f\n", mode.name,
+           Percentile(result.start_us, 0.5), Percentile(result.start_us, 0.99),
+           Percentile(result.session_us, 0.5));
+  }
+  return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * CPU time of relaying an LC3 stream as Opus
+ *
+ * Compares the Lc3OpusTranscoder, to the path through Java it replaces:
+ * LC3 decoded to a new byte array (Lc3Cpp.decodeLC3), copied to a vector of
+ * samples and encoded (processAudioBytes), the result being copied to a new
+ * byte array. The arrays are emulated by heap buffers.
+ *
+ *   lc3_opus_transcode_bench [seconds]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "../lc3_opus_transcoder.h"
+#include "bench_signal.h"
+
+using audio_util::Lc3OpusTranscoder;
+using audio_util::OggOpusEncoder;
+
+namespace {
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kBitrateBps = 24000;
+constexpr int kLc3FrameUs = 10000;
+constexpr int kLc3FrameBytes = 40;
+
+OggOpusEncoder::Options Options() {
+  OggOpusEncoder::Options options;
+  options.application = OPUS_APPLICATION_VOIP;
+  options.low_latency_mode = true;
+  options.framing = OggOpusEncoder::Framing::kRawLengthPrefixed;
+  return options;
+}
+
+std::vector<unsigned char> EncodeLc3(const std::vector<int16_t>& pcm) {
+  const int ns = lc3_frame_samples(kLc3FrameUs, kSampleRateHz);
+  std::vector<unsigned char> mem(lc3_encoder_size(kLc3FrameUs, kSampleRateHz));
+  lc3_encoder_t encoder =
+      lc3_setup_encoder(kLc3FrameUs, kSampleRateHz, 0, mem.data());
+
+  const size_t num_frames = pcm.size() / ns;
+  std::vector<unsigned char> lc3(num_frames * kLc3FrameBytes);
+  for (size_t i = 0; i < num_frames; i++) {
+    lc3_encode(encoder, LC3_PCM_FORMAT_S16, pcm.data() + i * ns, 1,
+               kLc3FrameBytes, lc3.data() + i * kLc3FrameBytes);
+  }
+  return lc3;
+}
+
+// Path through Java, one LC3 frame per call.
+size_t RunThroughJava(const std::vector<unsigned char>& lc3) {
+  const int ns = lc3_frame_samples(kLc3FrameUs, kSampleRateHz);
+  std::vector<unsigned char> mem(lc3_decoder_size(kLc3FrameUs, kSampleRateHz));
+  lc3_decoder_t decoder =
+      lc3_setup_decoder(kLc3FrameUs, kSampleRateHz, 0, mem.data());
+  OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, Options());
+  size_t bytes = 0;
+
+  for (size_t i = 0; i < lc3.size(); i += kLc3FrameBytes) {
+    // decodeLC3: native buffer, then copy to the Java array.
+    unsigned char* decoded = static_cast<unsigned char*>(malloc(ns * 2));
+    bool valid = lc3_check_frame(decoder, &lc3[i], kLc3FrameBytes) == 0;
+    lc3_decode(decoder, valid ? &lc3[i] : nullptr, kLc3FrameBytes,
+               LC3_PCM_FORMAT_S16, decoded, 1);
+    std::vector<unsigned char> java_pcm(decoded, decoded + ns * 2);
+    free(decoded);
+
+    // processAudioBytes: copy to samples, encode, copy to the Java array.
+    std::vector<int16_t> pcm(ns);
+    memcpy(pcm.data(), java_pcm.data(), ns * 2);
+    const std::vector<unsigned char>& encoded = encoder.Process(pcm);
+    std::vector<unsigned char> java_opus(encoded);
+    bytes += java_opus.size();
+  }
+  return bytes;
+}
+
+// Transcoder, one LC3 frame per call, into a reused buffer.
+size_t RunTranscoder(const std::vector<unsigned char>& lc3) {
+  Lc3OpusTranscoder transcoder(kLc3FrameUs, kLc3FrameBytes, kSampleRateHz,
+                               kBitrateBps, Options());
+  std::vector<unsigned char> out(1 << 16);
+  size_t bytes = 0;
+
+  for (size_t i = 0; i < lc3.size(); i += kLc3FrameBytes) {
+    int n = transcoder.Transcode(&lc3[i], kLc3FrameBytes, out.data(),
+                                 out.size());
+    if (n < 0) {
+      fprintf(stderr, "Output buffer too small\n");
+      exit(1);
+    }
+    bytes += n;
+  }
+  return bytes;
+}
+
+template <typename Run>
+double Time(Run run, const std::vector<unsigned char>& lc3, size_t* bytes) {
+  auto start = std::chrono::steady_clock::now();
+  *bytes = run(lc3);
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const int duration_s = argc > 1 ? atoi(argv[1]) : 30;
+  std::vector<unsigned char> lc3 =
+      EncodeLc3(audio_util::GenerateSpeechLikeSignal(
+          duration_s * kSampleRateHz, kSampleRateHz));
+
+  size_t java_bytes = 0, transcoder_bytes = 0;
+  double java_s = Time(RunThroughJava, lc3, &java_bytes);
+  double transcoder_s = Time(RunTranscoder, lc3, &transcoder_bytes);
+
+  printf("%d s of LC3 at %d Hz, %d bytes frames, to Opus at %d bps\n",
+         duration_s, kSampleRateHz, kLc3FrameBytes, kBitrateBps);
+  printf("%-18s %10s %12s %10s\n", "path", "bytes", "cpu us/s", "realtime");
+  printf("%-18s %10zu %12.1f %9.0fx\n", "through java", java_bytes,
+         java_s * 1e6 / duration_s, duration_s / java_s);
+  printf("%-18s %10zu %12.1f %9.0fx\n", "transcoder", transcoder_bytes,
+         transcoder_s * 1e6 / duration_s, duration_s / transcoder_s);
+
+  if (java_bytes != transcoder_bytes) {
+    fprintf(stderr, "Outputs differ\n");
+    return 1;
+  }
+  return 0;
+}
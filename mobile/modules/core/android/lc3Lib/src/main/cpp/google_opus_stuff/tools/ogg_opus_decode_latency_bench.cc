@@ -0,0 +1,111 @@
+/*
+ * Latency of the OggOpusDecoder, from the first byte to the first PCM
+ *
+ * A speech like signal is encoded, by chunks of 10 ms, in buffered and low
+ * latency Ogg framing, then given to the decoder by network reads of
+ * several sizes. For each, the bytes read, and the CPU time spent, until
+ * the first PCM is output, and the CPU time of the whole stream.
+ *
+ *   ogg_opus_decode_latency_bench [seconds]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../ogg_opus_decoder.h"
+#include "../ogg_opus_encoder.h"
+#include "bench_signal.h"
+
+using audio_util::OggOpusDecoder;
+using audio_util::OggOpusEncoder;
+
+namespace {
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kBitrateBps = 24000;
+constexpr int kChunkElements = kSampleRateHz / 100;
+
+std::vector<unsigned char> Encode(const std::vector<int16_t>& pcm,
+                                  bool low_latency_mode) {
+  OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, true,
+                         low_latency_mode);
+  std::vector<unsigned char> stream;
+  for (size_t i = 0; i + kChunkElements <= pcm.size(); i += kChunkElements) {
+    const std::vector<unsigned char>& bytes =
+        encoder.Process(pcm.data() + i, kChunkElements);
+    stream.insert(stream.end(), bytes.begin(), bytes.end());
+  }
+  const std::vector<unsigned char>& bytes = encoder.Flush();
+  stream.insert(stream.end(), bytes.begin(), bytes.end());
+  return stream;
+}
+
+struct Result {
+  size_t first_pcm_bytes;  // Read when the first PCM is output.
+  double first_pcm_seconds;
+  double seconds;
+  size_t samples;
+};
+
+Result Run(const std::vector<unsigned char>& stream, size_t read_bytes) {
+  OggOpusDecoder decoder(kSampleRateHz, 1);
+  std::vector<int16_t> pcm(decoder.MinOutputSamples());
+  Result result = {0, 0, 0, 0};
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < stream.size(); i += read_bytes) {
+    const size_t size = std::min(read_bytes, stream.size() - i);
+    int n = decoder.Decode(&stream[i], size, pcm.data(), pcm.size());
+    if (n > 0 && result.samples == 0) {
+      result.first_pcm_bytes = i + size;
+      result.first_pcm_seconds = std::chrono::duration<double>(
+                                     std::chrono::steady_clock::now() - start)
+                                     .count();
+    }
+    while (n > 0) {
+      result.samples += n;
+      n = decoder.Decode(nullptr, 0, pcm.data(), pcm.size());
+    }
+    if (n < 0) {
+      fprintf(stderr, "Decoding failed\n");
+      exit(1);
+    }
+  }
+  result.seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const int duration_s = argc > 1 ? atoi(argv[1]) : 30;
+  std::vector<int16_t> pcm = audio_util::GenerateSpeechLikeSignal(
+      duration_s * kSampleRateHz, kSampleRateHz);
+
+  printf("%d s at %d Hz, %d bps, chunks of 10 ms\n", duration_s,
+         kSampleRateHz, kBitrateBps);
+  printf("%-16s %8s %14s %16s %12s\n", "framing", "read", "first pcm at",
+         "first pcm cpu us", "cpu us/s");
+
+  for (int low_latency = 0; low_latency <= 1; low_latency++) {
+    std::vector<unsigned char> stream = Encode(pcm, low_latency);
+    for (size_t read_bytes : {64, 512, 4096}) {
+      Result result = Run(stream, read_bytes);
+      if (result.samples != pcm.size()) {
+        fprintf(stderr, "%zu samples decoded, of %zu\n", result.samples,
+                pcm.size());
+        return 1;
+      }
+      printf("%-16s %8zu %14zu %16.1f %12.1f\n",
+             low_latency ? "ogg low latency" : "ogg", read_bytes,
+             result.first_pcm_bytes, result.first_pcm_seconds * 1e6,
+             result.seconds * 1e6 / duration_s);
+    }
+  }
+  return 0;
+}
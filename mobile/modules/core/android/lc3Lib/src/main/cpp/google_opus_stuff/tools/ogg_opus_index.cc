@@ -0,0 +1,79 @@
+/*
+ * Indexes OggOpus recordings, printing their duration, bitrate and pages,
+ * and the byte offset to decode from to play them from each `-t` time, see
+ * ogg_opus_index.h
+ *
+ *   ogg_opus_index [-t time_ms]... recording [index]
+ *
+ * The sidecar index is loaded from `index`, <recording>.idx by default, or
+ * built and saved there when it is missing or out of date.
+ */
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "../ogg_opus_index.h"
+
+namespace {
+
+void Usage() {
+  fprintf(stderr, "usage: ogg_opus_index [-t time_ms]... recording [index]\n");
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::vector<int64_t> times_ms;
+  int opt;
+  while ((opt = getopt(argc, argv, "t:")) != -1) {
+    switch (opt) {
+      case 't':
+        times_ms.push_back(atoll(optarg));
+        break;
+      default:
+        Usage();
+        return 2;
+    }
+  }
+  if (optind != argc - 1 && optind != argc - 2) {
+    Usage();
+    return 2;
+  }
+  const std::string path = argv[optind];
+  const std::string index_path =
+      optind + 1 < argc ? argv[optind + 1] : path + ".idx";
+
+  audio_util::OggOpusIndex index;
+  const auto start = std::chrono::steady_clock::now();
+  if (!index.Open(path, index_path)) {
+    fprintf(stderr, "%s: not an OggOpus file\n", path.c_str());
+    return 1;
+  }
+  const double seconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+
+  const audio_util::OggOpusIndex::Info& info = index.info();
+  printf("%s: %d channel(s), %d Hz input, pre-skip %d\n", path.c_str(),
+         info.channels, info.input_sample_rate_hz, info.pre_skip);
+  printf("duration %.3f s, %.1f kb/s, %llu pages, %zu indexed, "
+         "%llu corrupted, longest page %.3f s\n",
+         info.duration_ms() / 1000., info.bitrate_bps() / 1000,
+         static_cast<unsigned long long>(info.pages), index.entries().size(),
+         static_cast<unsigned long long>(info.corrupted_pages),
+         info.max_page_granules / 48000.);
+  printf("index %s, opened in %.3f ms\n", index_path.c_str(), seconds * 1e3);
+  for (int64_t time_ms : times_ms) {
+    const audio_util::OggOpusIndex::SeekPoint point = index.Seek(time_ms);
+    printf("%lld ms: offset %llu, granule position %lld\n",
+           static_cast<long long>(time_ms),
+           static_cast<unsigned long long>(point.offset),
+           static_cast<long long>(point.granule_position));
+  }
+  return 0;
+}
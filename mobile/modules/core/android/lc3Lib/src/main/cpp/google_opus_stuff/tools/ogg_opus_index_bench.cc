@@ -0,0 +1,225 @@
+/*
+ * Speed of the OggOpusIndex on a long recording
+ *
+ * A recording of `minutes` of 20 ms packets at 24 kb/s is written to
+ * `directory`, in buffered Ogg framing, pages of up to 4 kB as cut by
+ * libogg, and in low latency framing, a page a packet. The packets are not
+ * encoded audio, only their TOC byte is, as nothing is decoded. For each:
+ *
+ * - The time to scan all the pages by stdio, header then body, their CRC
+ *   checked, as opusinfo, against building the index from the memory
+ *   mapped file, both from the page cache.
+ * - The size of the sidecar index, and the time to load it.
+ * - The time of a seek by the binary search of the index, against that of
+ *   a scan of its entries.
+ *
+ *   ogg_opus_index_bench [minutes] [directory]
+ */
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../ogg_opus_index.h"
+#include "../ogg_page_writer.h"
+
+using audio_util::OggOpusIndex;
+using audio_util::OggPageWriter;
+
+namespace {
+
+constexpr int kPacketGranules = 960;  // 20 ms.
+constexpr int kPacketBytes = 60;      // 24 kb/s.
+constexpr int kPreSkip = 312;
+
+double Seconds(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+// Appends the pages ready, or all of them when `flush`.
+void WritePages(OggPageWriter* writer, bool flush,
+                std::vector<unsigned char>* out) {
+  size_t page_bytes;
+  while ((page_bytes = writer->NextPage(flush)) != 0) {
+    out->resize(out->size() + page_bytes);
+    writer->WritePage(&(*out)[out->size() - page_bytes]);
+  }
+}
+
+std::vector<unsigned char> Recording(int minutes, bool low_latency) {
+  OggPageWriter writer(0x5eed);
+  std::vector<unsigned char> out;
+  const unsigned char head[19] = {'O', 'p', 'u', 's', 'H', 'e', 'a', 'd', 1,
+                                  1, kPreSkip & 0xff, kPreSkip >> 8,
+                                  0x80, 0x3e, 0, 0, 0, 0, 0};
+  writer.AddPacket(head, sizeof(head), 0, false);
+  WritePages(&writer, true, &out);
+  const unsigned char tags[16] = {'O', 'p', 'u', 's', 'T', 'a', 'g', 's'};
+  writer.AddPacket(tags, sizeof(tags), 0, false);
+  WritePages(&writer, true, &out);
+
+  // CELT only, 20 ms, mono.
+  std::vector<unsigned char> packet(kPacketBytes);
+  const int num_packets = minutes * 60 * 50;
+  for (int i = 0; i < num_packets; i++) {
+    packet[0] = 19 << 3;
+    for (int j = 1; j < kPacketBytes; j++) {
+      packet[j] = static_cast<unsigned char>(i * 31 + j);
+    }
+    writer.AddPacket(packet.data(), packet.size(),
+                     kPreSkip + static_cast<int64_t>(i + 1) * kPacketGranules,
+                     i == num_packets - 1);
+    WritePages(&writer, low_latency, &out);
+  }
+  WritePages(&writer, true, &out);
+  return out;
+}
+
+// Pages of the file, read by stdio and their CRC checked, as by opusinfo.
+size_t ScanPages(const std::string& path) {
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) {
+    return 0;
+  }
+  size_t pages = 0;
+  unsigned char header[27 + 255];
+  std::vector<unsigned char> body(255 * 255);
+  while (fread(header, 1, 27, f) == 27 &&
+         fread(header + 27, 1, header[26], f) == header[26]) {
+    size_t body_bytes = 0;
+    for (int i = 0; i < header[26]; i++) {
+      body_bytes += header[27 + i];
+    }
+    if (fread(body.data(), 1, body_bytes, f) != body_bytes) {
+      break;
+    }
+    const uint32_t expected = header[22] | header[23] << 8 |
+                              header[24] << 16 |
+                              static_cast<uint32_t>(header[25]) << 24;
+    header[22] = header[23] = header[24] = header[25] = 0;
+    uint32_t crc = audio_util::OggCrc32(header, 27 + header[26]);
+    crc = audio_util::OggCrc32(body.data(), body_bytes, crc);
+    pages += crc == expected;
+  }
+  fclose(f);
+  return pages;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const int minutes = argc > 1 ? atoi(argv[1]) : 60;
+  const char* tmpdir = getenv("TMPDIR");
+  const std::string directory =
+      argc > 2 ? argv[2] : std::string(tmpdir ? tmpdir : "/tmp");
+  const std::string path = directory + "/ogg_opus_index_bench_" +
+                           std::to_string(getpid()) + ".opus";
+  const std::string index_path = path + ".idx";
+
+  printf("%d min at 24 kb/s, in %s\n", minutes, directory.c_str());
+  printf("%-12s %7s %7s %9s %9s %8s %9s %8s %9s %9s\n", "framing", "MB",
+         "pages", "stdio ms", "index ms", "speedup", "index KB", "load ms",
+         "seek ns", "scan ns");
+  bool ok = true;
+  for (bool low_latency : {false, true}) {
+    const std::vector<unsigned char> recording =
+        Recording(minutes, low_latency);
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f || fwrite(recording.data(), 1, recording.size(), f) !=
+                  recording.size() ||
+        fclose(f) != 0) {
+      fprintf(stderr, "cannot write %s\n", path.c_str());
+      return 1;
+    }
+
+    // Best of 3, the file in the page cache.
+    double stdio_seconds = 0;
+    double index_seconds = 0;
+    size_t pages = 0;
+    OggOpusIndex index;
+    for (int run = 0; run < 3; run++) {
+      auto start = std::chrono::steady_clock::now();
+      pages = ScanPages(path);
+      const double scanned = Seconds(start);
+      start = std::chrono::steady_clock::now();
+      ok &= index.BuildFromFile(path);
+      const double indexed = Seconds(start);
+      if (run == 0 || scanned < stdio_seconds) {
+        stdio_seconds = scanned;
+      }
+      if (run == 0 || indexed < index_seconds) {
+        index_seconds = indexed;
+      }
+    }
+    ok &= index.info().pages == pages &&
+          index.info().duration_ms() == minutes * 60000LL;
+
+    ok &= index.Save(index_path);
+    FILE* saved = fopen(index_path.c_str(), "rb");
+    long index_bytes = 0;
+    if (saved) {
+      fseek(saved, 0, SEEK_END);
+      index_bytes = ftell(saved);
+      fclose(saved);
+    }
+    OggOpusIndex loaded;
+    auto start = std::chrono::steady_clock::now();
+    ok &= loaded.Load(index_path, path);
+    const double load_seconds = Seconds(start);
+
+    // Random times, by the index and by a scan of its entries.
+    std::mt19937 random(1);
+    std::uniform_int_distribution<int64_t> time_ms(0, minutes * 60000LL);
+    const int kSeeks = 100000;
+    std::vector<int64_t> times(kSeeks);
+    for (int64_t& t : times) {
+      t = time_ms(random);
+    }
+    uint64_t checksum = 0;
+    start = std::chrono::steady_clock::now();
+    for (int64_t t : times) {
+      checksum += loaded.Seek(t).offset;
+    }
+    const double seek_seconds = Seconds(start);
+    const std::vector<OggOpusIndex::Entry>& entries = loaded.entries();
+    const int kScans = 1000;
+    uint64_t scan_checksum = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kScans; i++) {
+      const int64_t from = kPreSkip + times[i] * 48 - 3840;
+      size_t j = 0;
+      while (j < entries.size() && entries[j].granule_position <= from) {
+        j++;
+      }
+      scan_checksum += j > 0 ? entries[j - 1].offset
+                             : loaded.info().audio_offset;
+    }
+    const double scan_seconds = Seconds(start);
+    uint64_t expected = 0;
+    for (int i = 0; i < kScans; i++) {
+      expected += loaded.Seek(times[i]).offset;
+    }
+    ok &= scan_checksum == expected && checksum > 0;
+
+    printf("%-12s %7.1f %7zu %9.2f %9.2f %7.2fx %9.1f %8.3f %9.0f %9.0f\n",
+           low_latency ? "low latency" : "buffered",
+           recording.size() / 1048576., pages, stdio_seconds * 1e3,
+           index_seconds * 1e3, stdio_seconds / index_seconds,
+           index_bytes / 1024., load_seconds * 1e3,
+           seek_seconds * 1e9 / kSeeks, scan_seconds * 1e9 / kScans);
+    remove(index_path.c_str());
+  }
+  remove(path.c_str());
+  if (!ok) {
+    fprintf(stderr, "index mismatch\n");
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,106 @@
+/*
+ * Bytes on the wire and CPU time of the OggOpusEncoder framings
+ *
+ * A speech like signal is encoded by chunks of 10 ms, as received from the
+ * glasses, in Ogg framing (buffered and low latency) and in raw length
+ * prefixed framing. The overhead is relative to the Opus payload alone.
+ * The Ogg framings are also run with the pages assembled by libogg, for
+ * the cost of its copies.
+ *
+ *   opus_framing_bench [seconds]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../ogg_opus_encoder.h"
+#include "bench_signal.h"
+
+using audio_util::OggOpusEncoder;
+
+namespace {
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kBitrateBps = 24000;
+constexpr int kChunkElements = kSampleRateHz / 100;
+
+struct Result {
+  size_t bytes;
+  size_t payload_bytes;
+  double seconds;
+};
+
+Result Run(const std::vector<int16_t>& pcm, bool low_latency_mode,
+           OggOpusEncoder::Framing framing, bool use_libogg = false) {
+  OggOpusEncoder::Options options;
+  options.low_latency_mode = low_latency_mode;
+  options.framing = framing;
+  options.use_libogg = use_libogg;
+  OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, options);
+  std::vector<unsigned char> out(1 << 16);
+  Result result = {0, 0, 0};
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i + kChunkElements <= pcm.size(); i += kChunkElements) {
+    int n = encoder.Process(pcm.data() + i, kChunkElements, out.data(),
+                            out.size());
+    if (n < 0) {
+      fprintf(stderr, "Output buffer too small\n");
+      exit(1);
+    }
+    result.bytes += n;
+    for (const OggOpusEncoder::PacketInfo& info : encoder.packets()) {
+      result.payload_bytes += info.length;
+    }
+  }
+  int n = encoder.Flush(out.data(), out.size());
+  result.bytes += n > 0 ? n : 0;
+  for (const OggOpusEncoder::PacketInfo& info : encoder.packets()) {
+    result.payload_bytes += info.length;
+  }
+  result.seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const int duration_s = argc > 1 ? atoi(argv[1]) : 30;
+  std::vector<int16_t> pcm = audio_util::GenerateSpeechLikeSignal(
+      duration_s * kSampleRateHz, kSampleRateHz);
+
+  // The payload is the same in all framings, encoding being deterministic.
+  Result raw = Run(pcm, true, OggOpusEncoder::Framing::kRawLengthPrefixed);
+  Result ogg = Run(pcm, false, OggOpusEncoder::Framing::kOgg);
+  Result ogg_low_latency = Run(pcm, true, OggOpusEncoder::Framing::kOgg);
+  Result libogg = Run(pcm, false, OggOpusEncoder::Framing::kOgg, true);
+  Result libogg_low_latency =
+      Run(pcm, true, OggOpusEncoder::Framing::kOgg, true);
+
+  printf("%d s at %d Hz, %d bps, chunks of 10 ms\n", duration_s,
+         kSampleRateHz, kBitrateBps);
+  printf("%-24s %10s %10s %10s %12s\n", "framing", "bytes", "kbps",
+         "overhead", "cpu us/s");
+
+  const struct {
+    const char* name;
+    const Result& result;
+  } rows[] = {
+      {"raw", raw},
+      {"ogg", ogg},
+      {"ogg low latency", ogg_low_latency},
+      {"libogg", libogg},
+      {"libogg low latency", libogg_low_latency},
+  };
+  for (const auto& row : rows) {
+    printf("%-24s %10zu %10.2f %9.2f%% %12.1f\n", row.name, row.result.bytes,
+           row.result.bytes * 8.0 / duration_s / 1000,
+           100.0 * (row.result.bytes - raw.payload_bytes) / raw.payload_bytes,
+           row.result.seconds * 1e6 / duration_s);
+  }
+  return 0;
+}
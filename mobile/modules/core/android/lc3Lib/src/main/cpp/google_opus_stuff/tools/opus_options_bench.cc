@@ -0,0 +1,98 @@
+/*
+ * Bytes on the wire and CPU time of the OggOpusEncoder settings
+ *
+ * A speech like signal is encoded by chunks of 10 ms, in raw length prefixed
+ * framing, for the application modes, frame durations, DTX, FEC and
+ * complexities considered for the uplink.
+ *
+ *   opus_options_bench [seconds]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../ogg_opus_encoder.h"
+#include "bench_signal.h"
+
+using audio_util::OggOpusEncoder;
+
+namespace {
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kBitrateBps = 24000;
+constexpr int kChunkElements = kSampleRateHz / 100;
+
+struct Config {
+  const char* name;
+  int application;
+  int frame_duration_us;
+  int complexity;
+  bool use_dtx;
+  int fec_loss_percent;  // In-band FEC when non zero.
+};
+
+const Config kConfigs[] = {
+    {"audio 20ms c4", OPUS_APPLICATION_AUDIO, 20000, 4, false, 0},
+    {"voip 20ms c4", OPUS_APPLICATION_VOIP, 20000, 4, false, 0},
+    {"voip 10ms c4", OPUS_APPLICATION_VOIP, 10000, 4, false, 0},
+    {"voip 40ms c4", OPUS_APPLICATION_VOIP, 40000, 4, false, 0},
+    {"voip 60ms c4", OPUS_APPLICATION_VOIP, 60000, 4, false, 0},
+    {"voip 20ms c0", OPUS_APPLICATION_VOIP, 20000, 0, false, 0},
+    {"voip 20ms c8", OPUS_APPLICATION_VOIP, 20000, 8, false, 0},
+    {"voip 20ms dtx", OPUS_APPLICATION_VOIP, 20000, 4, true, 0},
+    {"voip 20ms fec 10%", OPUS_APPLICATION_VOIP, 20000, 4, false, 10},
+    {"voip 60ms dtx fec", OPUS_APPLICATION_VOIP, 60000, 4, true, 10},
+    {"lowdelay 10ms c4", OPUS_APPLICATION_RESTRICTED_LOWDELAY, 10000, 4,
+     false, 0},
+    {"lowdelay 5ms c4", OPUS_APPLICATION_RESTRICTED_LOWDELAY, 5000, 4, false,
+     0},
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const int duration_s = argc > 1 ? atoi(argv[1]) : 30;
+  std::vector<int16_t> pcm = audio_util::GenerateSpeechLikeSignal(
+      duration_s * kSampleRateHz, kSampleRateHz);
+  std::vector<unsigned char> out(1 << 16);
+
+  printf("%d s at %d Hz, %d bps, chunks of 10 ms, raw framing\n", duration_s,
+         kSampleRateHz, kBitrateBps);
+  printf("%-20s %10s %10s %10s %12s\n", "settings", "packets", "bytes", "kbps",
+         "cpu us/s");
+
+  for (const Config& config : kConfigs) {
+    OggOpusEncoder::Options options;
+    options.application = config.application;
+    options.frame_duration_us = config.frame_duration_us;
+    options.complexity = config.complexity;
+    options.use_dtx = config.use_dtx;
+    options.use_inband_fec = config.fec_loss_percent > 0;
+    options.expected_packet_loss_percent = config.fec_loss_percent;
+    options.framing = OggOpusEncoder::Framing::kRawLengthPrefixed;
+    OggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps, options);
+
+    size_t packets = 0, bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i + kChunkElements <= pcm.size();
+         i += kChunkElements) {
+      int n = encoder.Process(pcm.data() + i, kChunkElements, out.data(),
+                              out.size());
+      if (n < 0) {
+        fprintf(stderr, "Output buffer too small\n");
+        return 1;
+      }
+      bytes += n;
+      packets += encoder.packets().size();
+    }
+    double seconds = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+
+    printf("%-20s %10zu %10zu %10.2f %12.1f\n", config.name, packets, bytes,
+           bytes * 8.0 / duration_s / 1000, seconds * 1e6 / duration_s);
+  }
+  return 0;
+}
@@ -0,0 +1,74 @@
+/*
+ * Realtime factor of the ParallelOggOpusEncoder, by number of threads
+ *
+ * Encodes a speech like recording with 1, 2, 4... threads, up to the
+ * hardware concurrency, and checks the streams do not depend on it.
+ *
+ *   parallel_encode_bench [seconds]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "../parallel_ogg_opus_encoder.h"
+#include "bench_signal.h"
+
+using audio_util::OggOpusEncoder;
+using audio_util::ParallelOggOpusEncoder;
+
+namespace {
+
+constexpr int kSampleRateHz = 16000;
+constexpr int kBitrateBps = 24000;
+
+double Encode(const std::vector<int16_t>& pcm, int num_threads,
+              std::vector<unsigned char>* stream) {
+  ParallelOggOpusEncoder::ParallelOptions parallel_options;
+  parallel_options.num_threads = num_threads;
+  ParallelOggOpusEncoder encoder(1, kSampleRateHz, kBitrateBps,
+                                 OggOpusEncoder::Options(), parallel_options);
+
+  auto start = std::chrono::steady_clock::now();
+  *stream = encoder.Encode(pcm.data(), pcm.size());
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const int duration_s = argc > 1 ? atoi(argv[1]) : 600;
+  const int max_threads = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<int16_t> pcm = audio_util::GenerateSpeechLikeSignal(
+      duration_s * kSampleRateHz, kSampleRateHz);
+
+  printf("%d s at %d Hz, %d bps, %d cores\n", duration_s, kSampleRateHz,
+         kBitrateBps, max_threads);
+  printf("%-8s %10s %10s %10s\n", "threads", "bytes", "realtime", "speedup");
+
+  std::vector<unsigned char> ref;
+  double serial_s = 0;
+  for (int num_threads = 1;;
+       num_threads = std::min(num_threads * 2, max_threads)) {
+    std::vector<unsigned char> stream;
+    double s = Encode(pcm, num_threads, &stream);
+    if (num_threads == 1) {
+      ref = stream;
+      serial_s = s;
+    } else if (stream != ref) {
+      fprintf(stderr, "%d threads: stream differs\n", num_threads);
+      return 1;
+    }
+    printf("%-8d %10zu %9.0fx %9.2fx\n", num_threads, stream.size(),
+           duration_s / s, serial_s / s);
+    if (num_threads == max_threads) {
+      break;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,187 @@
+/*
+ * WAV and AIFF files of the audio-in.c readers of opus-tools, for their
+ * test and benchmark
+ */
+
+#ifndef AUDIO_UTIL_TOOLS_PCM_FILE_WRITER_H_
+#define AUDIO_UTIL_TOOLS_PCM_FILE_WRITER_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace audio_util {
+
+struct PcmFileFormat {
+  enum Container {
+    kWav,
+    kWavExtensible,  // WAVE_FORMAT_EXTENSIBLE, the 40 bytes format chunk.
+    kAiff,           // Big endian.
+    kAifcSowt,       // Little endian.
+  };
+
+  Container container;
+  int bits;  // 8, 16 or 24 bit integers, or 32 bit floats in WAV.
+  int num_channels;
+  int sample_rate_hz;
+};
+
+namespace pcm_file_writer_internal {
+
+inline void PutLe(std::string* s, uint32_t x, int bytes) {
+  for (int i = 0; i < bytes; i++) {
+    s->push_back(static_cast<char>(x >> (8 * i)));
+  }
+}
+
+inline void PutBe(std::string* s, uint32_t x, int bytes) {
+  for (int i = bytes - 1; i >= 0; i--) {
+    s->push_back(static_cast<char>(x >> (8 * i)));
+  }
+}
+
+// IEEE 754 80 bit extended, of a positive integer, as AIFF rates.
+inline void PutExtended(std::string* s, uint32_t x) {
+  int exponent = 31;
+  while (!(x >> exponent)) {
+    exponent--;
+  }
+  PutBe(s, 16383 + exponent, 2);
+  PutBe(s, x << (31 - exponent), 4);
+  PutBe(s, 0, 4);
+}
+
+}  // namespace pcm_file_writer_internal
+
+// Samples of `format`, of interleaved `samples` in [-1, 1).
+inline std::string EncodePcmSamples(const PcmFileFormat& format,
+                                    const std::vector<float>& samples) {
+  using pcm_file_writer_internal::PutBe;
+  using pcm_file_writer_internal::PutLe;
+  const bool big_endian = format.container == PcmFileFormat::kAiff;
+  std::string data;
+  data.reserve(samples.size() * format.bits / 8);
+  for (float x : samples) {
+    if (format.bits == 32) {
+      uint32_t bits;
+      memcpy(&bits, &x, sizeof(bits));
+      PutLe(&data, bits, 4);
+      continue;
+    }
+    const long max = (1L << (format.bits - 1)) - 1;
+    long q = std::max(-max - 1, std::min(max, std::lround(x * (max + 1))));
+    if (format.bits == 8) {
+      q += 128;  // Unsigned.
+    }
+    if (big_endian) {
+      PutBe(&data, static_cast<uint32_t>(q), format.bits / 8);
+    } else {
+      PutLe(&data, static_cast<uint32_t>(q), format.bits / 8);
+    }
+  }
+  return data;
+}
+
+// Header of a file of `format` with `num_frames` frames, the length of its
+// samples being `data_size` bytes. `declared_data_size` overrides the
+// length written in the WAV data chunk, as 0xffffffff by stream writers.
+// A chunk to skip precedes the format and the data.
+inline std::string PcmFileHeader(const PcmFileFormat& format,
+                                 uint64_t num_frames, uint64_t data_size,
+                                 uint32_t declared_data_size) {
+  using pcm_file_writer_internal::PutBe;
+  using pcm_file_writer_internal::PutExtended;
+  using pcm_file_writer_internal::PutLe;
+  std::string h;
+  const int block_align = format.num_channels * format.bits / 8;
+  if (format.container == PcmFileFormat::kWav ||
+      format.container == PcmFileFormat::kWavExtensible) {
+    const bool extensible =
+        format.container == PcmFileFormat::kWavExtensible;
+    const int format_tag = format.bits == 32 ? 3 : 1;
+    h += "RIFF";
+    PutLe(&h, static_cast<uint32_t>(std::min<uint64_t>(
+                  data_size + (extensible ? 72 : 48), 0xffffffff)),
+          4);
+    h += "WAVE";
+    h += "LIST";
+    PutLe(&h, 4, 4);
+    h += "INFO";
+    h += "fmt ";
+    PutLe(&h, extensible ? 40 : 16, 4);
+    PutLe(&h, extensible ? 0xfffe : format_tag, 2);
+    PutLe(&h, format.num_channels, 2);
+    PutLe(&h, format.sample_rate_hz, 4);
+    PutLe(&h, format.sample_rate_hz * block_align, 4);
+    PutLe(&h, block_align, 2);
+    PutLe(&h, format.bits, 2);
+    if (extensible) {
+      PutLe(&h, 22, 2);
+      PutLe(&h, format.bits, 2);
+      PutLe(&h, 0, 4);  // Undeclared channel mask.
+      PutLe(&h, format_tag, 2);
+      h += std::string("\x00\x00\x00\x00\x10\x00\x80\x00\x00\xaa\x00\x38"
+                       "\x9b\x71",
+                       14);
+    }
+    h += "data";
+    PutLe(&h, declared_data_size, 4);
+    return h;
+  }
+
+  const bool aifc = format.container == PcmFileFormat::kAifcSowt;
+  const int comm_size = aifc ? 24 : 18;
+  h += "FORM";
+  PutBe(&h, static_cast<uint32_t>(std::min<uint64_t>(
+                4 + 12 + 8 + comm_size + 16 + data_size, 0xffffffff)),
+        4);
+  h += aifc ? "AIFC" : "AIFF";
+  // Odd length, padded.
+  h += "ANNO";
+  PutBe(&h, 3, 4);
+  h += std::string("abc\0", 4);
+  h += "COMM";
+  PutBe(&h, comm_size, 4);
+  PutBe(&h, format.num_channels, 2);
+  PutBe(&h, static_cast<uint32_t>(num_frames), 4);
+  PutBe(&h, format.bits, 2);
+  PutExtended(&h, format.sample_rate_hz);
+  if (aifc) {
+    h += "sowt";
+    h += std::string("\0\0", 2);  // Empty compression name, padded.
+  }
+  h += "SSND";
+  PutBe(&h, static_cast<uint32_t>(
+                std::min<uint64_t>(8 + data_size, 0xffffffff)),
+        4);
+  PutBe(&h, 0, 4);  // Offset.
+  PutBe(&h, 0, 4);  // Block size.
+  return h;
+}
+
+// Writes `samples` as a file of `format` at `path`. Returns false on error.
+inline bool WritePcmFile(const std::string& path, const PcmFileFormat& format,
+                         const std::vector<float>& samples,
+                         uint32_t declared_data_size = 0) {
+  const std::string data = EncodePcmSamples(format, samples);
+  const std::string header = PcmFileHeader(
+      format, samples.size() / format.num_channels, data.size(),
+      declared_data_size ? declared_data_size
+                         : static_cast<uint32_t>(data.size()));
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) {
+    return false;
+  }
+  const bool ok = fwrite(header.data(), 1, header.size(), f) ==
+                      header.size() &&
+                  fwrite(data.data(), 1, data.size(), f) == data.size();
+  return fclose(f) == 0 && ok;
+}
+
+}  // namespace audio_util
+
+#endif  // AUDIO_UTIL_TOOLS_PCM_FILE_WRITER_H_
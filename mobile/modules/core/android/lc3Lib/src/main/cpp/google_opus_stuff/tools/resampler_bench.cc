@@ -0,0 +1,127 @@
+/*
+ * Speed of the Resampler, per quality and kernels
+ *
+ * A speech like signal is resampled by chunks of 10 ms, from 16 to 48 kHz,
+ * the glasses audio to Opus, with the direct filter, and from 44.1 to
+ * 16 kHz, with the interpolated one. For each quality, 0 to 10, and each
+ * kernels the CPU supports, the times realtime, and the speedup over the
+ * scalar kernels.
+ *
+ * Then, for the ratios between 8, 16, 24 and 48 kHz, the fixed ratio
+ * filters against the generic resampler, at the same qualities, with the
+ * best kernels.
+ *
+ * Each measure is the fastest of 3 runs.
+ *
+ *   resampler_bench [seconds]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../resampler.h"
+#include "../resampler_kernels.h"
+#include "bench_signal.h"
+
+using audio_util::Resampler;
+using audio_util::ResamplerKernels;
+
+namespace {
+
+// Runs of each measure, the fastest kept.
+constexpr int kRuns = 3;
+
+// Seconds to resample `pcm`, at `input_rate_hz`, by chunks of 10 ms.
+double Time(const std::vector<int16_t>& pcm, int input_rate_hz,
+            int output_rate_hz, int quality, bool use_fixed_ratio) {
+  Resampler resampler(1, input_rate_hz, output_rate_hz, quality,
+                      use_fixed_ratio);
+  const size_t chunk = input_rate_hz / 100;
+  std::vector<int16_t> out(resampler.MaxOutputSamples(chunk));
+  double best = 0;
+  for (int run = 0; run < kRuns; run++) {
+    resampler.Reset();
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i + chunk <= pcm.size(); i += chunk) {
+      resampler.Process(pcm.data() + i, chunk, out.data(), out.size());
+    }
+    const double seconds = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+    if (run == 0 || seconds < best) {
+      best = seconds;
+    }
+  }
+  return best;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const int duration_s = argc > 1 ? atoi(argv[1]) : 30;
+  const ResamplerKernels best = audio_util::ActiveResamplerKernels();
+  std::vector<ResamplerKernels> kernels;
+  for (ResamplerKernels k :
+       {ResamplerKernels::kScalar, ResamplerKernels::kSse,
+        ResamplerKernels::kAvx2, ResamplerKernels::kNeon}) {
+    if (audio_util::ResamplerKernelsSupported(k)) {
+      kernels.push_back(k);
+    }
+  }
+
+  const int kRates[][2] = {{16000, 48000}, {44100, 16000}};
+  for (const int* rates : kRates) {
+    std::vector<int16_t> pcm =
+        audio_util::GenerateSpeechLikeSignal(duration_s * rates[0], rates[0]);
+    printf("\n%d s, %d Hz to %d Hz, mono, chunks of 10 ms, x realtime\n",
+           duration_s, rates[0], rates[1]);
+    printf("%-8s", "quality");
+    for (ResamplerKernels k : kernels) {
+      printf(" %10s", audio_util::ResamplerKernelsName(k));
+    }
+    printf(" %10s\n", "speedup");
+
+    for (int quality = 0; quality <= 10; quality++) {
+      printf("%-8d", quality);
+      double scalar_seconds = 0;
+      double best_seconds = 0;
+      for (ResamplerKernels k : kernels) {
+        audio_util::UseResamplerKernels(k);
+        const double seconds =
+            Time(pcm, rates[0], rates[1], quality, false);
+        printf(" %10.0f", duration_s / seconds);
+        if (k == ResamplerKernels::kScalar) {
+          scalar_seconds = seconds;
+        }
+        if (k == best) {
+          best_seconds = seconds;
+        }
+      }
+      printf(" %9.2fx\n", scalar_seconds / best_seconds);
+    }
+  }
+  audio_util::UseResamplerKernels(best);
+
+  printf("\n%d s, mono, chunks of 10 ms, %s kernels, x realtime\n",
+         duration_s, audio_util::ResamplerKernelsName(best));
+  printf("%-16s %8s %10s %10s %10s\n", "ratio", "quality", "generic",
+         "fixed", "speedup");
+  const int kFixedRates[][2] = {{16000, 48000}, {48000, 16000},
+                                {16000, 24000}, {24000, 16000},
+                                {8000, 16000},  {48000, 8000}};
+  for (const int* rates : kFixedRates) {
+    std::vector<int16_t> pcm =
+        audio_util::GenerateSpeechLikeSignal(duration_s * rates[0], rates[0]);
+    for (int quality = 3; quality <= 5; quality++) {
+      const double generic = Time(pcm, rates[0], rates[1], quality, false);
+      const double fixed = Time(pcm, rates[0], rates[1], quality, true);
+      char ratio[32];
+      snprintf(ratio, sizeof(ratio), "%d-%d", rates[0], rates[1]);
+      printf("%-16s %8d %10.0f %10.0f %9.2fx\n", ratio, quality,
+             duration_s / generic, duration_s / fixed, generic / fixed);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,78 @@
+/*
+ * Generator of resampler_tables.cc, the fixed ratio filters of the Resampler
+ *
+ * The tables are those the Speex resampler computes at runtime, taken from
+ * its own state: the fixed ratio path filters exactly as the generic one.
+ * To be run again when the ratios or qualities change:
+ *
+ *   resampler_tables_generator > ../resampler_tables.cc
+ */
+
+#include <cstdio>
+
+// Built in, for the filter of its state.
+#include "resample.c"
+
+namespace {
+
+// Ratios, input to output samplerate, between 8, 16, 24 and 48 kHz.
+const int kRatios[][2] = {{1, 2}, {1, 3}, {1, 6}, {2, 3},
+                          {2, 1}, {3, 1}, {6, 1}, {3, 2}};
+// SPEEX_RESAMPLER_QUALITY_VOIP, _DEFAULT and _DESKTOP.
+const int kQualities[] = {3, 4, 5};
+
+}  // namespace
+
+int main() {
+  printf("// Generated by tools/resampler_tables_generator.cc, do not edit.\n"
+         "\n"
+         "#include \"resampler_tables.h\"\n"
+         "\n"
+         "namespace audio_util {\n"
+         "namespace {\n");
+
+  for (const int* ratio : kRatios) {
+    for (int quality : kQualities) {
+      int error = 0;
+      SpeexResamplerState* state =
+          speex_resampler_init(1, ratio[0], ratio[1], quality, &error);
+      if (error != RESAMPLER_ERR_SUCCESS ||
+          state->resampler_ptr != resampler_basic_direct_single ||
+          state->filt_len % 8 != 0) {
+        fprintf(stderr, "%d:%d at quality %d: no direct filter\n", ratio[0],
+                ratio[1], quality);
+        return 1;
+      }
+      const unsigned int phases = state->den_rate;
+      const unsigned int taps = state->filt_len;
+      printf("\n// %d:%d, quality %d: %u phases of %u taps.\n"
+             "const float kTable%dTo%dQuality%d[] = {",
+             ratio[0], ratio[1], quality, phases, taps, ratio[0], ratio[1],
+             quality);
+      for (unsigned int i = 0; i < phases * taps; i++) {
+        printf("%s%.9g,", i % 4 ? " " : "\n    ", state->sinc_table[i]);
+      }
+      printf("\n};\n");
+      speex_resampler_destroy(state);
+    }
+  }
+
+  printf("\n}  // namespace\n\nconst ResamplerTable kResamplerTables[] = {\n");
+  for (const int* ratio : kRatios) {
+    for (int quality : kQualities) {
+      int error = 0;
+      SpeexResamplerState* state =
+          speex_resampler_init(1, ratio[0], ratio[1], quality, &error);
+      printf("    {%d, %d, %d, %u, kTable%dTo%dQuality%d},\n", ratio[0],
+             ratio[1], quality, state->filt_len, ratio[0], ratio[1],
+             quality);
+      speex_resampler_destroy(state);
+    }
+  }
+  printf("};\n\n"
+         "const int kNumResamplerTables =\n"
+         "    sizeof(kResamplerTables) / sizeof(kResamplerTables[0]);\n"
+         "\n"
+         "}  // namespace audio_util\n");
+  return 0;
+}
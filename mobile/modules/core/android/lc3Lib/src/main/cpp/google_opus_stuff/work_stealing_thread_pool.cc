@@ -0,0 +1,127 @@
+#include "work_stealing_thread_pool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace audio_util {
+namespace {
+
+// Pool and worker of the calling thread, when it is a worker.
+thread_local const WorkStealingThreadPool* current_pool = nullptr;
+thread_local int current_worker = -1;
+
+}  // namespace
+
+WorkStealingThreadPool::WorkStealingThreadPool(int num_threads)
+    : queued_(0), pending_(0), next_queue_(0), stopping_(false), stats_() {
+  if (num_threads <= 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  for (int i = 0; i < num_threads; i++) {
+    queues_.emplace_back(new Queue);
+  }
+  for (int i = 0; i < num_threads; i++) {
+    workers_.emplace_back(&WorkStealingThreadPool::Run, this, i);
+  }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+  Wait();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  work_available_.notify_all();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+void WorkStealingThreadPool::Submit(std::function<void()> task) {
+  // Counted before being queued: once queued, the task may be taken and
+  // completed at once, by any worker, and Wait() must not return first.
+  size_t queue;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queued_++;
+    pending_++;
+    queue = current_pool == this ? current_worker
+                                 : next_queue_++ % queues_.size();
+  }
+  {
+    std::lock_guard<std::mutex> lock(queues_[queue]->mutex);
+    queues_[queue]->tasks.push_back(std::move(task));
+  }
+  work_available_.notify_one();
+}
+
+void WorkStealingThreadPool::Wait() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  all_done_.wait(lock, [this]() { return pending_ == 0; });
+}
+
+WorkStealingThreadPool::Stats WorkStealingThreadPool::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+void WorkStealingThreadPool::Run(int worker) {
+  current_pool = this;
+  current_worker = worker;
+  std::function<void()> task;
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      work_available_.wait(lock,
+                           [this]() { return queued_ > 0 || stopping_; });
+      if (stopping_ && queued_ <= 0) {
+        return;
+      }
+    }
+    // Another worker may have taken the task first, or it may not be
+    // pushed yet.
+    if (!Take(worker, &task)) {
+      continue;
+    }
+    task();
+    task = nullptr;  // Its captures are released before the completion.
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.executed++;
+    if (--pending_ == 0) {
+      all_done_.notify_all();
+    }
+  }
+}
+
+bool WorkStealingThreadPool::Take(int worker, std::function<void()>* task) {
+  const int num_queues = static_cast<int>(queues_.size());
+  bool stolen = false;
+  bool taken = false;
+  {
+    Queue& own = *queues_[worker];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.tasks.empty()) {
+      *task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      taken = true;
+    }
+  }
+  for (int i = 1; !taken && i < num_queues; i++) {
+    Queue& other = *queues_[(worker + i) % num_queues];
+    std::lock_guard<std::mutex> lock(other.mutex);
+    if (!other.tasks.empty()) {
+      *task = std::move(other.tasks.front());
+      other.tasks.pop_front();
+      taken = stolen = true;
+    }
+  }
+  if (taken) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queued_--;
+    stats_.stolen += stolen;
+  }
+  return taken;
+}
+
+}  // namespace audio_util
@@ -0,0 +1,83 @@
+#ifndef AUDIO_UTIL_WORK_STEALING_THREAD_POOL_H_
+#define AUDIO_UTIL_WORK_STEALING_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace audio_util {
+
+// Pool of threads running tasks of very uneven lengths, as the files of a
+// corpus, from minutes to hours of audio.
+//
+// Each worker has its own queue. Tasks submitted from outside the pool are
+// spread over the queues in turn; tasks submitted by a task go to the queue
+// of its worker. A worker runs the newest task of its queue, and when it is
+// empty steals the oldest task of another queue: the workers stay busy
+// until the last tasks, whatever the lengths, without contending on a
+// single queue.
+//
+// Thread safe.
+class WorkStealingThreadPool {
+ public:
+  struct Stats {
+    uint64_t executed;  // Tasks run.
+    uint64_t stolen;    // Tasks run by another worker than their queue's.
+  };
+
+  // Starts `num_threads` workers, the hardware concurrency when 0.
+  explicit WorkStealingThreadPool(int num_threads);
+
+  // Waits for the tasks submitted, and stops the workers.
+  ~WorkStealingThreadPool();
+
+  WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+  WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+
+  // Queues `task`, run by a worker.
+  void Submit(std::function<void()> task);
+
+  // Waits until all the tasks submitted, and those they submitted, have
+  // run. Not to be called from a task.
+  void Wait();
+
+  int num_threads() const { return static_cast<int>(workers_.size()); }
+  Stats stats() const;
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  void Run(int worker);
+
+  // Pops the newest task of queue `worker`, or steals the oldest of
+  // another queue. Returns false when all are empty.
+  bool Take(int worker, std::function<void()>* task);
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> workers_;
+
+  // Guards the counts below, which the workers sleep and Wait() waits on.
+  mutable std::mutex mutex_;
+  std::condition_variable work_available_;
+  std::condition_variable all_done_;
+  // Tasks in the queues, counted from their submission: transiently ahead
+  // of the queues while a task is being pushed.
+  int64_t queued_;
+  uint64_t pending_;  // Tasks submitted and not completed.
+  size_t next_queue_;
+  bool stopping_;
+  Stats stats_;
+};
+
+}  // namespace audio_util
+
+#endif  // AUDIO_UTIL_WORK_STEALING_THREAD_POOL_H_
@@ -2,32 +2,77 @@
 #include <jni.h>
 #include <cstdlib>
 #include <cstring>
-#include "include/lc3.h"
+#include <new>
+#include "lc3.h"
+#include "../google_opus_stuff/encoder_metrics.h"
 #include <android/log.h>
 
 #define LOG_TAG "LC3JNI"
 #define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
 
+// Encoder session, the handle given to Java points on it.
+// The LC3 encoder memory directly follows the structure.
+struct EncoderSession {
+    lc3_encoder_t encoder;
+    audio_util::EncoderMetrics metrics;  // Recorded with AUDIO_UTIL_ENCODER_METRICS
+};
+
+static EncoderSession* getEncoderSession(jlong encPtr) {
+    return reinterpret_cast<EncoderSession*>(encPtr);
+}
+
 extern "C" JNIEXPORT jlong JNICALL
 Java_com_mentra_lc3Lib_Lc3Cpp_initEncoder(JNIEnv *env, jclass clazz) {
     int dtUs = 10000;
     int srHz = 16000;
     unsigned encoderSize = lc3_encoder_size(dtUs, srHz);
-    void* encMem = malloc(encoderSize);
-    if (!encMem) return 0;
-    lc3_encoder_t encoder = lc3_setup_encoder(dtUs, srHz, 0, encMem);
-    if (!encoder) {
-        free(encMem);
+    void* mem = malloc(sizeof(EncoderSession) + encoderSize);
+    if (!mem) return 0;
+
+    EncoderSession* session = new (mem) EncoderSession();
+    session->encoder = lc3_setup_encoder(dtUs, srHz, 0, session + 1);
+    if (!session->encoder) {
+        free(session);
         return 0;
     }
 
-    return reinterpret_cast<jlong>(encMem);
+    return reinterpret_cast<jlong>(session);
 }
 
 extern "C" JNIEXPORT void JNICALL
 Java_com_mentra_lc3Lib_Lc3Cpp_freeEncoder(JNIEnv *env, jclass clazz, jlong encPtr) {
-    void* encMem = reinterpret_cast<void*>(encPtr);
-    free(encMem);
+    free(getEncoderSession(encPtr));
+}
+
+// Copy the encoder metrics (audio_util::EncoderMetricsSnapshot) into the
+// direct buffer `out`: encode time and bytes per frame histograms, in
+// native order longs. Returns the bytes written, -1 when `out` is too small.
+extern "C" JNIEXPORT jint JNICALL
+Java_com_mentra_lc3Lib_Lc3Cpp_getEncoderMetrics(JNIEnv *env, jclass clazz, jlong encPtr, jobject out) {
+    EncoderSession* session = getEncoderSession(encPtr);
+    void* outBytes = out ? env->GetDirectBufferAddress(out) : nullptr;
+    if (!session || !outBytes ||
+        env->GetDirectBufferCapacity(out) < (jlong)sizeof(audio_util::EncoderMetricsSnapshot)) {
+        return -1;
+    }
+
+    audio_util::EncoderMetricsSnapshot snapshot;
+    session->metrics.Snapshot(&snapshot);
+    memcpy(outBytes, &snapshot, sizeof(snapshot));
+    return sizeof(snapshot);
+}
+
+// Decoder session, the handle given to Java points on it.
+// The LC3 decoder memory directly follows the structure.
+struct DecoderSession {
+    lc3_decoder_t decoder;
+    uint64_t decodedFrames;     // Frames given for decoding
+    uint64_t invalidFrames;     // Frames rejected by the pre-validation
+    uint64_t concealedFrames;   // Frames output by PLC, invalid ones included
+};
+
+static DecoderSession* getDecoderSession(jlong decPtr) {
+    return reinterpret_cast<DecoderSession*>(decPtr);
 }
 
 extern "C" JNIEXPORT jlong JNICALL
@@ -35,22 +80,57 @@ Java_com_mentra_lc3Lib_Lc3Cpp_initDecoder(JNIEnv *env, jclass clazz) {
     int dtUs = 10000;
     int srHz = 16000;
     unsigned decoderSize = lc3_decoder_size(dtUs, srHz);
-    void* decMem = malloc(decoderSize);
-    if (!decMem) return 0;
+    DecoderSession* session = (DecoderSession*)malloc(sizeof(DecoderSession) + decoderSize);
+    if (!session) return 0;
 
-    lc3_decoder_t decoder = lc3_setup_decoder(dtUs, srHz, 0, decMem);
-    if (!decoder) {
-        free(decMem);
+    memset(session, 0, sizeof(DecoderSession));
+    session->decoder = lc3_setup_decoder(dtUs, srHz, 0, session + 1);
+    if (!session->decoder) {
+        free(session);
         return 0;
     }
 
-    return reinterpret_cast<jlong>(decMem);
+    return reinterpret_cast<jlong>(session);
 }
 
 extern "C" JNIEXPORT void JNICALL
 Java_com_mentra_lc3Lib_Lc3Cpp_freeDecoder(JNIEnv *env, jclass clazz, jlong decPtr) {
-    void* decMem = reinterpret_cast<void*>(decPtr);
-    free(decMem);
+    free(getDecoderSession(decPtr));
+}
+
+extern "C" JNIEXPORT jint JNICALL
+Java_com_mentra_lc3Lib_Lc3Cpp_setDecoderPlcMode(JNIEnv *env, jclass clazz, jlong decPtr, jint mode) {
+    DecoderSession* session = getDecoderSession(decPtr);
+    if (!session) return -1;
+
+    return lc3_decoder_set_plc_mode(session->decoder, (enum lc3_plc_mode)mode);
+}
+
+// Fill `stats` with the decoded, invalid and concealed frame counts of the
+// session. Polling allocates nothing, the array is owned by the caller.
+extern "C" JNIEXPORT void JNICALL
+Java_com_mentra_lc3Lib_Lc3Cpp_getDecoderStats(JNIEnv *env, jclass clazz, jlong decPtr, jlongArray stats) {
+    DecoderSession* session = getDecoderSession(decPtr);
+    if (!session || !stats) return;
+
+    jlong values[3] = {
+        (jlong)session->decodedFrames,
+        (jlong)session->invalidFrames,
+        (jlong)session->concealedFrames,
+    };
+
+    jsize count = env->GetArrayLength(stats);
+    env->SetLongArrayRegion(stats, 0, count < 3 ? count : 3, values);
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_mentra_lc3Lib_Lc3Cpp_resetDecoderStats(JNIEnv *env, jclass clazz, jlong decPtr) {
+    DecoderSession* session = getDecoderSession(decPtr);
+    if (!session) return;
+
+    session->decodedFrames = 0;
+    session->invalidFrames = 0;
+    session->concealedFrames = 0;
 }
 
 // persistent_encoder.cpp
@@ -75,7 +155,8 @@ static jbyteArray encodeLC3WithFrameSize(JNIEnv *env, jlong encPtr, jbyteArray p
 
     int16_t* alignedPcmBuffer = (int16_t*)malloc(bytesPerFrame);
     unsigned char* encodedData = (unsigned char*)malloc(outputSize);
-    lc3_encoder_t encoder = (lc3_encoder_t)reinterpret_cast<void*>(encPtr);
+    EncoderSession* session = getEncoderSession(encPtr);
+    lc3_encoder_t encoder = session->encoder;
 
     for (int i = 0, offset = 0; i < frameCount; i++, offset += encodedFrameSize) {
         for (int j = 0; j < samplesPerFrame; j++) {
@@ -90,8 +171,10 @@ static jbyteArray encodeLC3WithFrameSize(JNIEnv *env, jlong encPtr, jbyteArray p
             }
         }
 
+        session->metrics.BeginFrame();
         int result = lc3_encode(encoder, LC3_PCM_FORMAT_S16, alignedPcmBuffer, 1,
                                 encodedFrameSize, encodedData + offset);
+        session->metrics.EndFrame(encodedFrameSize);
 
         if (result != 0) {
             memset(encodedData + offset, 0, encodedFrameSize);
@@ -114,8 +197,14 @@ Java_com_mentra_lc3Lib_Lc3Cpp_encodeLC3(JNIEnv *env, jclass clazz, jlong encPtr,
     return encodeLC3WithFrameSize(env, encPtr, pcmData, (uint16_t)frameSize);
 }
 
-// Generic LC3 decoding function with configurable frame size
+// Generic LC3 decoding function with configurable frame size.
+// Frames failing the pre-validation are not decoded, but concealed by PLC.
 static jbyteArray decodeLC3WithFrameSize(JNIEnv *env, jlong decPtr, jbyteArray lc3Data, uint16_t encodedFrameSize) {
+    DecoderSession* session = getDecoderSession(decPtr);
+    if (!session || encodedFrameSize == 0) {
+        return env->NewByteArray(0);
+    }
+
     jbyte *lc3Bytes = env->GetByteArrayElements(lc3Data, nullptr);
     int lc3Length = env->GetArrayLength(lc3Data);
 
@@ -130,17 +219,21 @@ static jbyteArray decodeLC3WithFrameSize(JNIEnv *env, jlong decPtr, jbyteArray l
     //      lc3Length, bytesPerFrame, encodedFrameSize, outSize);
 
     unsigned char* outArray = (unsigned char*)malloc(outSize);
-    int16_t* outBuf = (int16_t*)malloc(bytesPerFrame);
 
-    lc3_decoder_t decoder = (lc3_decoder_t)reinterpret_cast<void*>(decPtr);
+    lc3_decoder_t decoder = session->decoder;
 
     jsize offset = 0;
     for (int i = 0; i <= lc3Length - encodedFrameSize; i += encodedFrameSize) {
         unsigned char* framePtr = reinterpret_cast<unsigned char*>(lc3Bytes + i);
-        lc3_decode(decoder, framePtr, encodedFrameSize, LC3_PCM_FORMAT_S16, outBuf, 1);
-        memcpy(outArray + offset, outBuf, bytesPerFrame);
+        bool valid = lc3_check_frame(decoder, framePtr, encodedFrameSize) == 0;
+
+        int result = lc3_decode(decoder, valid ? framePtr : nullptr, encodedFrameSize,
+                                LC3_PCM_FORMAT_S16, outArray + offset, 1);
+
+        session->decodedFrames++;
+        session->invalidFrames += !valid;
+        session->concealedFrames += (result == 1);
         offset += bytesPerFrame;
-        memset(outBuf, 0, bytesPerFrame);
     }
 
     jbyteArray resultArray = env->NewByteArray(outSize);
@@ -148,7 +241,6 @@ static jbyteArray decodeLC3WithFrameSize(JNIEnv *env, jlong decPtr, jbyteArray l
 
     env->ReleaseByteArrayElements(lc3Data, lc3Bytes, JNI_ABORT);
     free(outArray);
-    free(outBuf);
     return resultArray;
 }
 
@@ -1,5 +1,7 @@
 package com.mentra.lc3Lib;
 
+import java.nio.ByteBuffer;
+
 public class Lc3Cpp {
 
     static {
@@ -25,9 +27,45 @@ public class Lc3Cpp {
         return encodeLC3(encoderPtr, pcmData, 20);
     }
 
+    // Layout of the encoder metrics, in longs: histograms of METRICS_HISTOGRAM_LONGS
+    // longs, METRICS_BUCKETS power of two buckets then count, sum and max.
+    // Bucket 0 counts zero values, bucket i values in [2^(i-1), 2^i).
+    public static final int METRICS_BUCKETS = 20;
+    public static final int METRICS_COUNT = METRICS_BUCKETS;
+    public static final int METRICS_SUM = METRICS_BUCKETS + 1;
+    public static final int METRICS_MAX = METRICS_BUCKETS + 2;
+    public static final int METRICS_HISTOGRAM_LONGS = METRICS_BUCKETS + 3;
+    public static final int METRICS_ENCODE_TIME_US = 0;
+    public static final int METRICS_FRAME_BYTES = METRICS_HISTOGRAM_LONGS;
+    public static final int METRICS_BYTES = 4 * METRICS_HISTOGRAM_LONGS * 8;
+
+    // Copy the encoder metrics into the direct buffer `out`, of at least
+    // METRICS_BYTES, as longs in native order. Returns the bytes written, or
+    // -1. All zero unless the library is built with AUDIO_UTIL_ENCODER_METRICS.
+    public static native int getEncoderMetrics(long encoderPtr, ByteBuffer out);
+
+    // Packet loss concealment modes, see lc3_decoder_set_plc_mode()
+    public static final int PLC_MODE_STANDARD = 0;
+    public static final int PLC_MODE_PITCH = 1;
+    public static final int PLC_MODE_PITCH_HQ = 2;
+
     public static native long initDecoder();
     public static native void freeDecoder(long decoderPtr);
 
+    // Select the packet loss concealment mode, returns 0 on success
+    public static native int setDecoderPlcMode(long decoderPtr, int mode);
+
+    // Indices in the array filled by getDecoderStats()
+    public static final int STATS_DECODED_FRAMES = 0;
+    public static final int STATS_INVALID_FRAMES = 1;
+    public static final int STATS_CONCEALED_FRAMES = 2;
+    public static final int STATS_COUNT = 3;
+
+    // Fill `stats` (of STATS_COUNT entries) with the frame counters of the
+    // decoder. Invalid frames are concealed by PLC instead of being decoded.
+    public static native void getDecoderStats(long decoderPtr, long[] stats);
+    public static native void resetDecoderStats(long decoderPtr);
+
     // Parameterized decoding function with frame size
     public static native byte[] decodeLC3(long decoderPtr, byte[] lc3Data, int frameSize);
 
@@ -0,0 +1,56 @@
+package com.mentra.lc3Lib;
+
+import java.nio.ByteBuffer;
+
+public class Lc3OpusTranscoder {
+
+    static {
+        System.loadLibrary("ogg_opus_encoder");
+    }
+
+    private Lc3OpusTranscoder() {
+        // Private constructor to prevent instantiation
+    }
+
+    // Longs per packet in the array filled by getPacketInfo(): offset of the
+    // length prefix, packet length, granule position and timestamp in us
+    public static final int PACKET_INFO_LONGS = 4;
+
+    // Transcoder of a mono LC3 stream, of `lc3FrameBytes` bytes frames lasting
+    // `lc3FrameDurationUs`, into Opus. `application` is one of the
+    // OPUS_APPLICATION_* values, `opusFrameDurationUs` one of 2500, 5000,
+    // 10000, 20000, 40000 or 60000. The output is raw length prefixed packets
+    // when `rawPackets` is set, Ogg pages otherwise. Returns 0 on failure.
+    public static native long init(int lc3FrameDurationUs, int lc3FrameBytes, int sampleRateHz,
+                                   int bitrateBitsPerSecond, int application,
+                                   int opusFrameDurationUs, int complexity, boolean useDtx,
+                                   boolean useInbandFec, int expectedPacketLossPercent,
+                                   boolean rawPackets);
+    public static native void free(long transcoderPtr);
+
+    // Transcode `length` bytes of LC3 frames from `lc3` at `offset` into `out`.
+    // Returns the bytes written, or -1 when `out` is smaller than
+    // maxOutputBytes(length).
+    public static native int transcode(long transcoderPtr, byte[] lc3, int offset, int length,
+                                       byte[] out);
+
+    // Same as transcode(), on direct buffers
+    public static native int transcodeBuffer(long transcoderPtr, ByteBuffer lc3, int offset,
+                                             int length, ByteBuffer out);
+
+    public static native int maxOutputBytes(long transcoderPtr, int length);
+
+    // Tell the transcoder that there will be no more frames. `out` must hold
+    // maxFlushBytes() bytes.
+    public static native int flush(long transcoderPtr, byte[] out);
+    public static native int maxFlushBytes(long transcoderPtr);
+
+    // Fill `info` with PACKET_INFO_LONGS longs per raw packet of the last
+    // transcode() or flush(). Returns the packets, which may exceed those
+    // `info` holds.
+    public static native int getPacketInfo(long transcoderPtr, long[] info);
+
+    // Fill `stats` (of Lc3Cpp.STATS_COUNT entries) with the decoded, invalid and
+    // concealed LC3 frame counts, as Lc3Cpp.getDecoderStats()
+    public static native void getStats(long transcoderPtr, long[] stats);
+}
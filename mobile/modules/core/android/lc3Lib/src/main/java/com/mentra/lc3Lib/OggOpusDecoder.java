@@ -0,0 +1,52 @@
+package com.mentra.lc3Lib;
+
+import java.nio.ByteBuffer;
+
+public class OggOpusDecoder {
+
+    static {
+        System.loadLibrary("ogg_opus_encoder");
+    }
+
+    private OggOpusDecoder() {
+        // Private constructor to prevent instantiation
+    }
+
+    // Indices in the array filled by getStats()
+    public static final int STATS_PAGES = 0;
+    public static final int STATS_PACKETS = 1;
+    public static final int STATS_CORRUPTED_PAGES = 2;
+    public static final int STATS_LOST_PAGES = 3;
+    public static final int STATS_CONCEALED_SAMPLES = 4;
+    public static final int STATS_COUNT = 5;
+
+    // Streaming decoder of an OggOpus stream, to `numChannels` channels of
+    // 16-bit PCM at `sampleRateHz`
+    public static native long init(int sampleRateHz, int numChannels);
+    public static native void free(long decoderPtr);
+
+    // Parse `length` more bytes of the stream from `data` at `offset`, and
+    // decode the packets completed into the direct buffer `pcm`, of at least
+    // minOutputSamples() samples per channel. Packets not fitting are kept: call
+    // again with a 0 `length` until 0 is returned. Returns the samples per
+    // channel written, or -1 when the stream is not supported.
+    public static native int decode(long decoderPtr, byte[] data, int offset, int length,
+                                    ByteBuffer pcm);
+
+    // Same as decode(), the stream bytes read from the direct buffer `data`
+    public static native int decodeBuffer(long decoderPtr, ByteBuffer data, int offset,
+                                          int length, ByteBuffer pcm);
+
+    // Restart at the page found by OggOpusIndex.seek(), whose bytes are given
+    // next, the output starting at `granulePosition`. Returns false until the
+    // headers are decoded.
+    public static native boolean seek(long decoderPtr, long granulePosition);
+
+    public static native int minOutputSamples(long decoderPtr);
+
+    // Whether the last page of the stream was decoded
+    public static native boolean isFinished(long decoderPtr);
+
+    // Fill `stats` (of STATS_COUNT entries) with the page and packet counters
+    public static native void getStats(long decoderPtr, long[] stats);
+}
@@ -0,0 +1,84 @@
+package com.mentra.lc3Lib;
+
+import java.nio.ByteBuffer;
+
+public class OggOpusEncoder {
+
+    static {
+        System.loadLibrary("ogg_opus_encoder");
+    }
+
+    private OggOpusEncoder() {
+        // Private constructor to prevent instantiation
+    }
+
+    // Longs per packet in the array filled by getPacketInfo(): offset of the
+    // length prefix, packet length, granule position and timestamp in us
+    public static final int PACKET_INFO_LONGS = 4;
+
+    // Bytes getMetrics() writes: 92 longs
+    public static final int METRICS_BYTES = 92 * 8;
+
+    // Encoder of `numChannels` interleaved channels of 16-bit PCM at
+    // `sampleRateHz` into an OggOpus stream. An encoder of the same settings
+    // freed before is reused. Returns 0 on failure.
+    public static native long init(int numChannels, int bitrateBitsPerSecond, int sampleRateHz,
+                                   boolean useVbr);
+
+    // Same as init(), the output being raw length prefixed Opus packets
+    public static native long initRawPackets(int numChannels, int bitrateBitsPerSecond,
+                                             int sampleRateHz, boolean useVbr);
+
+    // Same as init(), `application` being one of the OPUS_APPLICATION_* values,
+    // `frameDurationUs` one of 2500, 5000, 10000, 20000, 40000 or 60000. The
+    // output is raw length prefixed packets when `rawPackets` is set, Ogg pages
+    // otherwise.
+    public static native long initWithOptions(int numChannels, int bitrateBitsPerSecond,
+                                              int sampleRateHz, boolean useVbr, int application,
+                                              int frameDurationUs, int complexity,
+                                              boolean useDtx, boolean useInbandFec,
+                                              int expectedPacketLossPercent,
+                                              boolean rawPackets);
+
+    // Same as init(), for 1 to 8 channels encoded as a multistream stream, each
+    // channel its own stream when `uncoupledStreams` is set
+    public static native long initMultistream(int numChannels, int bitrateBitsPerSecond,
+                                              int sampleRateHz, boolean useVbr,
+                                              boolean uncoupledStreams);
+
+    // Release the encoder, kept idle for the next init() of the same settings
+    public static native void free(long encoderPtr);
+
+    // Encode `length` bytes of samples from `samples` at `offset`, an even
+    // number. Returns the encoded bytes, empty on failure.
+    public static native byte[] processAudioBytes(long encoderPtr, byte[] samples, int offset,
+                                                  int length);
+
+    // Same as processAudioBytes(), into `out`. Returns the bytes written, or -1
+    // when `out` is smaller than maxOutputBytes(length).
+    public static native int processAudioBytesInto(long encoderPtr, byte[] samples, int offset,
+                                                   int length, byte[] out);
+
+    // Same as processAudioBytesInto(), on direct buffers
+    public static native int processAudioBuffer(long encoderPtr, ByteBuffer samples, int offset,
+                                                int length, ByteBuffer out);
+
+    public static native int maxOutputBytes(long encoderPtr, int length);
+
+    // Fill `info` with PACKET_INFO_LONGS longs per raw packet of the last
+    // process or flush call. Returns the packets, which may exceed those `info`
+    // holds.
+    public static native int getPacketInfo(long encoderPtr, long[] info);
+
+    // Copy the encoder metrics into the direct buffer `out`, of METRICS_BYTES
+    // bytes at least, in native order. Returns the bytes written, or -1 when
+    // `out` is too small.
+    public static native int getMetrics(long encoderPtr, ByteBuffer out);
+
+    // Tell the encoder that there will be no more samples
+    public static native byte[] flush(long encoderPtr);
+
+    // Start a new stream, of Ogg serial number `serialNumber`, on the same
+    // encoder
+    public static native void reset(long encoderPtr, int serialNumber);
+}
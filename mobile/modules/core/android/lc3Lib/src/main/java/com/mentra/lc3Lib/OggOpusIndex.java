@@ -0,0 +1,48 @@
+package com.mentra.lc3Lib;
+
+public class OggOpusIndex {
+
+    static {
+        System.loadLibrary("ogg_opus_encoder");
+    }
+
+    private OggOpusIndex() {
+        // Private constructor to prevent instantiation
+    }
+
+    // Indices in the array filled by seek() and seekWallTime()
+    public static final int POINT_OFFSET = 0;
+    public static final int POINT_GRANULE_POSITION = 1;
+    public static final int POINT_COUNT = 2;
+
+    // Indices in the array filled by getInfo()
+    public static final int INFO_DURATION_MS = 0;
+    public static final int INFO_BITRATE_BPS = 1;
+    public static final int INFO_CHANNELS = 2;
+    public static final int INFO_INPUT_SAMPLE_RATE_HZ = 3;
+    public static final int INFO_PRE_SKIP = 4;
+    public static final int INFO_AUDIO_OFFSET = 5;
+    public static final int INFO_PAGES = 6;
+    public static final int INFO_CORRUPTED_PAGES = 7;
+    public static final int INFO_INDEXED_PAGES = 8;
+    public static final int INFO_START_TIME_MS = 9;
+    public static final int INFO_COUNT = 10;
+
+    // Open the seek index of the OggOpus recording at `path`, loaded from the
+    // sidecar file at `indexPath`, or built and saved there when missing or out
+    // of date. `startTimeMs` is the wall clock start of the recording, 0 when
+    // unknown. Returns 0 when the recording cannot be indexed.
+    public static native long open(String path, String indexPath, long startTimeMs);
+    public static native void free(long indexPtr);
+
+    // Fill `point` (of POINT_COUNT entries) with the byte offset to read the
+    // recording from, and the granule position to give OggOpusDecoder.seek(),
+    // to play it from `timeMs` after its start. Returns false on failure.
+    public static native boolean seek(long indexPtr, long timeMs, long[] point);
+
+    // Same as seek(), from a wall clock time in ms since the epoch
+    public static native boolean seekWallTime(long indexPtr, long wallTimeMs, long[] point);
+
+    // Fill `info` (of INFO_COUNT entries) with the description of the recording
+    public static native void getInfo(long indexPtr, long[] info);
+}
@@ -0,0 +1,40 @@
+package com.mentra.lc3Lib;
+
+import java.nio.ByteBuffer;
+
+public class Resampler {
+
+    static {
+        System.loadLibrary("ogg_opus_encoder");
+    }
+
+    private Resampler() {
+        // Private constructor to prevent instantiation
+    }
+
+    // Streaming resampler of `numChannels` interleaved channels of 16-bit PCM,
+    // from `inputRateHz` to `outputRateHz`, at `quality` 0 to 10
+    public static native long init(int numChannels, int inputRateHz, int outputRateHz,
+                                   int quality);
+    public static native void free(long resamplerPtr);
+
+    // Samples per channel the output of `numSamples` input samples per channel
+    // may have, the smallest output process() accepts
+    public static native int maxOutputSamples(long resamplerPtr, int numSamples);
+
+    // Resample `numSamples` samples per channel of `pcm`, from the short at
+    // `offset`, into the start of `out`. Returns the samples per channel
+    // written, or -1 when `out` is shorter than maxOutputSamples(numSamples).
+    public static native int process(long resamplerPtr, short[] pcm, int offset, int numSamples,
+                                     short[] out);
+
+    // Same as process(), from and to direct buffers of native order shorts
+    public static native int processBuffer(long resamplerPtr, ByteBuffer pcm, int numSamples,
+                                           ByteBuffer out);
+
+    // Clear the history of the filter, to start a new stream
+    public static native void reset(long resamplerPtr);
+
+    // Delay of the output, in output samples
+    public static native int outputLatency(long resamplerPtr);
+}
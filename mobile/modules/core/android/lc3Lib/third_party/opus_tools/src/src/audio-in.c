@@ -48,6 +48,17 @@
 # else
 #  include <stdlib.h>
 # endif
+# include <sys/mman.h> /*mmap()*/
+# include <sys/stat.h>
+# define USE_MMAP
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64)
+# include <emmintrin.h>
+# define USE_SSE2_CONVERT
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+# include <arm_neon.h>
+# define USE_NEON_CONVERT
 #endif
 
 #ifdef ENABLE_NLS
@@ -142,9 +153,86 @@ input_format *open_audio_file(FILE *in, oe_enc_opt *opt)
     return NULL;
 }
 
-static int seek_forward(FILE *in, unsigned int length)
+/* Where the WAV and AIFF headers are read from: the FILE, or, when it is a
+ * regular file, all of it mapped in memory. Mapped, the chunks are located
+ * by pointer arithmetic, and the samples are converted in place by
+ * wav_map_read, without a copy through stdio. */
+typedef struct {
+    FILE *f;
+    const unsigned char *map;
+    size_t map_size;
+    const unsigned char *pos; /* Of the FILE, when mapped */
+} header_source;
+
+static void source_open(header_source *src, FILE *in, oe_enc_opt *opt)
 {
-    if(fseek(in, length, SEEK_CUR))
+#ifdef USE_MMAP
+    struct stat st;
+    long pos;
+    void *map;
+#endif
+
+    src->f = in;
+    src->map = NULL;
+    src->map_size = 0;
+    src->pos = NULL;
+#ifdef USE_MMAP
+    if(opt->nommap || fstat(fileno(in), &st) || !S_ISREG(st.st_mode) ||
+       (off_t)(size_t)st.st_size != st.st_size)
+        return;
+    pos = ftell(in); /* Past what open_audio_file() read to id the file */
+    if(pos < 0 || pos > st.st_size)
+        return;
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fileno(in), 0);
+    if(map == MAP_FAILED)
+        return; /* Fall back to stdio */
+    madvise(map, st.st_size, MADV_SEQUENTIAL);
+    src->map = map;
+    src->map_size = st.st_size;
+    src->pos = src->map + pos;
+#else
+    (void)opt;
+#endif
+}
+
+/* Unmaps the file, when it was not handed over to a wavfile. */
+static void source_close(header_source *src)
+{
+#ifdef USE_MMAP
+    if(src->map)
+        munmap((void *)src->map, src->map_size);
+#endif
+    src->map = NULL;
+}
+
+static size_t source_remaining(header_source *src)
+{
+    return src->map + src->map_size - src->pos;
+}
+
+static unsigned int source_read(header_source *src, unsigned char *buf,
+                                unsigned int len)
+{
+    if(!src->map)
+        return fread(buf, 1, len, src->f);
+    if(len > source_remaining(src))
+        len = source_remaining(src);
+    memcpy(buf, src->pos, len);
+    src->pos += len;
+    return len;
+}
+
+static int seek_forward(header_source *src, unsigned int length)
+{
+    if(src->map)
+    {
+        /* As fseek(), past the end is not an error, reading there is. */
+        if(length > source_remaining(src))
+            length = source_remaining(src);
+        src->pos += length;
+        return 1;
+    }
+    if(fseek(src->f, length, SEEK_CUR))
     {
         /* Failed. Do it the hard way. */
         unsigned char buf[1024];
@@ -152,7 +240,7 @@ static int seek_forward(FILE *in, unsigned int length)
         int seeked;
         while(seek_needed > 0)
         {
-            seeked = fread(buf, 1, seek_needed>1024?1024:seek_needed, in);
+            seeked = fread(buf, 1, seek_needed>1024?1024:seek_needed, src->f);
             if(!seeked)
                 return 0; /* Couldn't read more, can't read file */
             else
@@ -162,13 +250,13 @@ static int seek_forward(FILE *in, unsigned int length)
     return 1;
 }
 
-static int find_wav_chunk(FILE *in, char *type, unsigned int *len)
+static int find_wav_chunk(header_source *src, char *type, unsigned int *len)
 {
     unsigned char buf[8];
 
     while(1)
     {
-        if(fread(buf,1,8,in) < 8) /* Suck down a chunk specifier */
+        if(source_read(src,buf,8) < 8) /* Suck down a chunk specifier */
         {
             fprintf(stderr, _("Warning: Unexpected EOF in reading WAV header\n"));
             return 0; /* EOF before reaching the appropriate chunk */
@@ -177,7 +265,7 @@ static int find_wav_chunk(FILE *in, char *type, unsigned int *len)
         if(memcmp(buf, type, 4))
         {
             *len = READ_U32_LE(buf+4);
-            if(!seek_forward(in, *len))
+            if(!seek_forward(src, *len))
                 return 0;
 
             buf[4] = 0;
@@ -191,20 +279,23 @@ static int find_wav_chunk(FILE *in, char *type, unsigned int *len)
     }
 }
 
-static int find_aiff_chunk(FILE *in, char *type, unsigned int *len)
+static int find_aiff_chunk(header_source *src, char *type, unsigned int *len)
 {
     unsigned char buf[8];
     int restarted = 0;
 
     while(1)
     {
-        if(fread(buf,1,8,in) <8)
+        if(source_read(src,buf,8) <8)
         {
             if(!restarted) {
                 /* Handle out of order chunks by seeking back to the start
                  * to retry */
                 restarted = 1;
-                fseek(in, 12, SEEK_SET);
+                if(src->map)
+                    src->pos = src->map + 12;
+                else
+                    fseek(src->f, 12, SEEK_SET);
                 continue;
             }
             fprintf(stderr, _("Warning: Unexpected EOF in AIFF chunk\n"));
@@ -218,7 +309,7 @@ static int find_aiff_chunk(FILE *in, char *type, unsigned int *len)
             if((*len) & 0x1)
                 (*len)++;
 
-            if(!seek_forward(in, *len))
+            if(!seek_forward(src, *len))
                 return 0;
         }
         else
@@ -257,6 +348,30 @@ double read_IEEE80(unsigned char *buf)
     return ldexp(f, e-16446);
 }
 
+/* Hands the map of `src`, if any, over to `wav`: its samples from the
+ * current position, up to wav->totalsamples when known, else to the end of
+ * the file, are then read by wav_map_read. */
+static void source_attach(header_source *src, wavfile *wav, oe_enc_opt *opt)
+{
+    size_t frame = wav->channels * (wav->samplesize/8);
+    size_t size;
+
+    wav->map = src->map;
+    wav->map_size = src->map_size;
+    wav->data = NULL;
+    wav->data_end = NULL;
+    if(!src->map)
+        return;
+
+    size = source_remaining(src) / frame * frame;
+    if(wav->totalsamples > 0 && (opus_uint64)wav->totalsamples < size / frame)
+        size = (size_t)wav->totalsamples * frame;
+    wav->data = src->pos;
+    wav->data_end = src->pos + size;
+    opt->read_samples = wav_map_read;
+    src->map = NULL; /* Unmapped by wav_close() */
+}
+
 /* AIFF/AIFC support adapted from the old OggSQUISH application */
 int aiff_id(unsigned char *buf, int len)
 {
@@ -284,7 +399,7 @@ static int aiff_permute_matrix[6][6] =
   {0,1,2,3,4,5},    /* 5.1 surround (WARN)*/
 };
 
-int aiff_open(FILE *in, oe_enc_opt *opt, unsigned char *buf, int buflen)
+static int aiff_parse(header_source *src, oe_enc_opt *opt, unsigned char *buf)
 {
     int aifc; /* AIFC or AIFF? */
     unsigned int len;
@@ -294,14 +409,13 @@ int aiff_open(FILE *in, oe_enc_opt *opt, unsigned char *buf, int buflen)
     aiff_fmt format;
     aifffile *aiff;
     int i;
-    (void)buflen;/*unused*/
 
     if(buf[11]=='C')
         aifc=1;
     else
         aifc=0;
 
-    if(!find_aiff_chunk(in, "COMM", &len))
+    if(!find_aiff_chunk(src, "COMM", &len))
     {
         fprintf(stderr, _("Warning: No common chunk found in AIFF file\n"));
         return 0; /* EOF before COMM chunk */
@@ -315,7 +429,7 @@ int aiff_open(FILE *in, oe_enc_opt *opt, unsigned char *buf, int buflen)
 
     buffer = alloca(len);
 
-    if(fread(buffer,1,len,in) < len)
+    if(source_read(src,buffer,len) < len)
     {
         fprintf(stderr, _("Warning: Unexpected EOF in reading AIFF header\n"));
         return 0;
@@ -349,7 +463,7 @@ int aiff_open(FILE *in, oe_enc_opt *opt, unsigned char *buf, int buflen)
         }
     }
 
-    if(!find_aiff_chunk(in, "SSND", &len))
+    if(!find_aiff_chunk(src, "SSND", &len))
     {
         fprintf(stderr, _("Warning: No SSND chunk found in AIFF file\n"));
         return 0; /* No SSND chunk -> no actual audio */
@@ -361,7 +475,7 @@ int aiff_open(FILE *in, oe_enc_opt *opt, unsigned char *buf, int buflen)
         return 0;
     }
 
-    if(fread(buf2,1,8, in) < 8)
+    if(source_read(src,buf2,8) < 8)
     {
         fprintf(stderr, _("Warning: Unexpected EOF reading AIFF header\n"));
         return 0;
@@ -381,7 +495,7 @@ int aiff_open(FILE *in, oe_enc_opt *opt, unsigned char *buf, int buflen)
         opt->total_samples_per_channel = format.totalframes;
 
         aiff = malloc(sizeof(aifffile));
-        aiff->f = in;
+        aiff->f = src->f;
         aiff->samplesread = 0;
         aiff->channels = format.channels;
         aiff->samplesize = format.samplesize;
@@ -405,7 +519,8 @@ int aiff_open(FILE *in, oe_enc_opt *opt, unsigned char *buf, int buflen)
             for (i=0; i < aiff->channels; i++)
                 aiff->channel_permute[i] = i;
 
-        seek_forward(in, format.offset); /* Swallow some data */
+        seek_forward(src, format.offset); /* Swallow some data */
+        source_attach(src, aiff, opt);
         return 1;
     }
     else
@@ -417,6 +532,18 @@ int aiff_open(FILE *in, oe_enc_opt *opt, unsigned char *buf, int buflen)
     }
 }
 
+int aiff_open(FILE *in, oe_enc_opt *opt, unsigned char *buf, int buflen)
+{
+    header_source src;
+    (void)buflen;/*unused*/
+
+    source_open(&src, in, opt);
+    if(aiff_parse(&src, opt, buf))
+        return 1;
+    source_close(&src);
+    return 0;
+}
+
 int wav_id(unsigned char *buf, int len)
 {
     if(len<12) return 0; /* Something screwed up */
@@ -432,7 +559,7 @@ int wav_id(unsigned char *buf, int len)
     return 1;
 }
 
-int wav_open(FILE *in, oe_enc_opt *opt, unsigned char *oldbuf, int buflen)
+static int wav_parse(header_source *src, oe_enc_opt *opt)
 {
     unsigned char buf[40];
     unsigned int len;
@@ -440,8 +567,6 @@ int wav_open(FILE *in, oe_enc_opt *opt, unsigned char *oldbuf, int buflen)
     wav_fmt format;
     wavfile *wav;
     int i;
-    (void)buflen;/*unused*/
-    (void)oldbuf;/*unused*/
 
     /* Ok. At this point, we know we have a WAV file. Now we have to detect
      * whether we support the subtype, and we have to find the actual data
@@ -449,7 +574,7 @@ int wav_open(FILE *in, oe_enc_opt *opt, unsigned char *oldbuf, int buflen)
      * as a wav file (oldbuf)
      */
 
-    if(!find_wav_chunk(in, "fmt ", &len))
+    if(!find_wav_chunk(src, "fmt ", &len))
         return 0; /* EOF */
 
     if(len < 16)
@@ -472,7 +597,7 @@ int wav_open(FILE *in, oe_enc_opt *opt, unsigned char *oldbuf, int buflen)
 
     if(len>40)len=40;
 
-    if(fread(buf,1,len,in) < len)
+    if(source_read(src,buf,len) < len)
     {
         fprintf(stderr, _("Warning: Unexpected EOF in reading WAV header\n"));
         return 0;
@@ -530,7 +655,7 @@ int wav_open(FILE *in, oe_enc_opt *opt, unsigned char *oldbuf, int buflen)
       format.format = READ_U16_LE(buf+24);
     }
 
-    if(!find_wav_chunk(in, "data", &len))
+    if(!find_wav_chunk(src, "data", &len))
         return 0; /* EOF */
 
     if(format.format == 1)
@@ -571,7 +696,7 @@ int wav_open(FILE *in, oe_enc_opt *opt, unsigned char *oldbuf, int buflen)
         opt->channels = format.channels;
 
         wav = malloc(sizeof(wavfile));
-        wav->f = in;
+        wav->f = src->f;
         wav->samplesread = 0;
         wav->bigendian = 0;
         wav->channels = format.channels; /* This is in several places. The price
@@ -584,26 +709,31 @@ int wav_open(FILE *in, oe_enc_opt *opt, unsigned char *oldbuf, int buflen)
         }
 #ifdef WIN32
         /*On Mingw/Win32 fseek() returns zero on pipes.*/
-        else if (opt->ignorelength==1 || ((GetFileType((HANDLE)_get_osfhandle(fileno(in)))&~FILE_TYPE_REMOTE)!=FILE_TYPE_DISK))
+        else if (opt->ignorelength==1 || ((GetFileType((HANDLE)_get_osfhandle(fileno(src->f)))&~FILE_TYPE_REMOTE)!=FILE_TYPE_DISK))
 #else
         else if (opt->ignorelength==1)
 #endif
         {
            opt->total_samples_per_channel = 0;
         }
+        else if (src->map)
+        {
+            opt->total_samples_per_channel = source_remaining(src)/
+                (format.channels*samplesize);
+        }
         else
         {
             opus_int64 pos;
-            pos = ftell(in);
-            if(fseek(in, 0, SEEK_END) == -1)
+            pos = ftell(src->f);
+            if(fseek(src->f, 0, SEEK_END) == -1)
             {
                 opt->total_samples_per_channel = 0; /* Give up */
             }
             else
             {
-                opt->total_samples_per_channel = (ftell(in) - pos)/
+                opt->total_samples_per_channel = (ftell(src->f) - pos)/
                     (format.channels*samplesize);
-                fseek(in,pos, SEEK_SET);
+                fseek(src->f,pos, SEEK_SET);
             }
         }
         wav->totalsamples = opt->total_samples_per_channel;
@@ -620,6 +750,7 @@ int wav_open(FILE *in, oe_enc_opt *opt, unsigned char *oldbuf, int buflen)
             for (i=0; i < wav->channels; i++)
                 wav->channel_permute[i] = i;
 
+        source_attach(src, wav, opt);
         return 1;
     }
     else
@@ -631,6 +762,19 @@ int wav_open(FILE *in, oe_enc_opt *opt, unsigned char *oldbuf, int buflen)
     }
 }
 
+int wav_open(FILE *in, oe_enc_opt *opt, unsigned char *oldbuf, int buflen)
+{
+    header_source src;
+    (void)buflen;/*unused*/
+    (void)oldbuf;/*unused*/
+
+    source_open(&src, in, opt);
+    if(wav_parse(&src, opt))
+        return 1;
+    source_close(&src);
+    return 0;
+}
+
 long wav_read(void *in, float *buffer, int samples)
 {
     wavfile *f = (wavfile *)in;
@@ -737,10 +881,180 @@ long wav_ieee_read(void *in, float *buffer, int samples)
     return realsamples;
 }
 
+/* Conversions of the mapped samples to float, as wav_read() would. The
+ * integers are exact in float, and the scales powers of two: the vector
+ * loops give the same floats as the scalar ones. F32 is a copy, the host
+ * being little endian, as wav_ieee_read() assumes too. */
+
+static void convert_u8(const unsigned char *in, float *out, long n)
+{
+    long i;
+    for(i = 0; i < n; i++)
+        out[i] = ((int)in[i]-128)/128.0f;
+}
+
+static void convert_s16(const unsigned char *in, float *out, long n,
+                        int bigendian)
+{
+    long i = 0;
+#if defined(USE_SSE2_CONVERT)
+    const __m128 scale = _mm_set1_ps(1/32768.0f);
+    for(; i + 8 <= n; i += 8)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i *)(in + 2*i));
+        if(bigendian)
+            x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+        /* Each sample in the high half of a lane, shifted back down. */
+        _mm_storeu_ps(out + i, _mm_mul_ps(scale, _mm_cvtepi32_ps(
+            _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16))));
+        _mm_storeu_ps(out + i + 4, _mm_mul_ps(scale, _mm_cvtepi32_ps(
+            _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16))));
+    }
+#elif defined(USE_NEON_CONVERT)
+    for(; i + 8 <= n; i += 8)
+    {
+        uint8x16_t bytes = vld1q_u8(in + 2*i);
+        int16x8_t x;
+        if(bigendian)
+            bytes = vrev16q_u8(bytes);
+        x = vreinterpretq_s16_u8(bytes);
+        vst1q_f32(out + i, vcvtq_n_f32_s32(vmovl_s16(vget_low_s16(x)), 15));
+        vst1q_f32(out + i + 4,
+                  vcvtq_n_f32_s32(vmovl_s16(vget_high_s16(x)), 15));
+    }
+#endif
+    if(bigendian)
+        for(; i < n; i++)
+            out[i] = (((signed char)in[2*i]<<8) | in[2*i+1])/32768.0f;
+    else
+        for(; i < n; i++)
+            out[i] = (((signed char)in[2*i+1]<<8) | in[2*i])/32768.0f;
+}
+
+#ifdef USE_NEON_CONVERT
+/* 4 samples of 24 bits, of their sign extended high bytes and their low
+ * 16 bits. */
+static float32x4_t s24_to_float(int16x4_t high, uint16x4_t low)
+{
+    return vcvtq_n_f32_s32(vorrq_s32(vshlq_n_s32(vmovl_s16(high), 16),
+                                     vreinterpretq_s32_u32(vmovl_u16(low))),
+                           23);
+}
+#endif
+
+/* Little endian only. `in` is preceded by the header of its chunk, so the
+ * SSE2 loop reads each sample with the byte before it, in the low byte of
+ * a lane, shifted out with the sign extension. */
+static void convert_s24(const unsigned char *in, float *out, long n)
+{
+    long i = 0;
+#if defined(USE_SSE2_CONVERT)
+    const __m128 scale = _mm_set1_ps(1/8388608.0f);
+    for(; i + 4 <= n; i += 4)
+    {
+        const unsigned char *p = in + 3*i - 1;
+        opus_int32 x[4];
+        memcpy(&x[0], p, 4);
+        memcpy(&x[1], p + 3, 4);
+        memcpy(&x[2], p + 6, 4);
+        memcpy(&x[3], p + 9, 4);
+        _mm_storeu_ps(out + i, _mm_mul_ps(scale, _mm_cvtepi32_ps(
+            _mm_srai_epi32(_mm_loadu_si128((const __m128i *)x), 8))));
+    }
+#elif defined(USE_NEON_CONVERT)
+    for(; i + 16 <= n; i += 16)
+    {
+        const uint8x16x3_t b = vld3q_u8(in + 3*i);
+        const uint16x8_t low0 = vorrq_u16(vmovl_u8(vget_low_u8(b.val[0])),
+                                          vshll_n_u8(vget_low_u8(b.val[1]), 8));
+        const uint16x8_t low1 = vorrq_u16(vmovl_u8(vget_high_u8(b.val[0])),
+                                          vshll_n_u8(vget_high_u8(b.val[1]), 8));
+        const int16x8_t high0 =
+            vmovl_s8(vreinterpret_s8_u8(vget_low_u8(b.val[2])));
+        const int16x8_t high1 =
+            vmovl_s8(vreinterpret_s8_u8(vget_high_u8(b.val[2])));
+        vst1q_f32(out + i,
+                  s24_to_float(vget_low_s16(high0), vget_low_u16(low0)));
+        vst1q_f32(out + i + 4,
+                  s24_to_float(vget_high_s16(high0), vget_high_u16(low0)));
+        vst1q_f32(out + i + 8,
+                  s24_to_float(vget_low_s16(high1), vget_low_u16(low1)));
+        vst1q_f32(out + i + 12,
+                  s24_to_float(vget_high_s16(high1), vget_high_u16(low1)));
+    }
+#endif
+    for(; i < n; i++)
+        out[i] = (((signed char)in[3*i+2] << 16) | (in[3*i+1] << 8) |
+                  in[3*i]) / 8388608.0f;
+}
+
+long wav_map_read(void *in, float *buffer, int samples)
+{
+    wavfile *f = (wavfile *)in;
+    int frame = f->samplesize/8 * f->channels;
+    long realsamples = (f->data_end - f->data)/frame;
+    long n;
+    int i,j;
+    int *ch_permute = f->channel_permute;
+    int permuted = 0;
+
+    if(realsamples > samples)
+        realsamples = samples;
+    n = realsamples*f->channels;
+
+    switch(f->samplesize)
+    {
+    case 8:
+        convert_u8(f->data, buffer, n);
+        break;
+    case 16:
+        convert_s16(f->data, buffer, n, f->bigendian);
+        break;
+    case 24:
+        if(f->bigendian) {
+            fprintf(stderr, _("Big endian 24 bit PCM data is not currently "
+                              "supported, aborting.\n"));
+            return 0;
+        }
+        convert_s24(f->data, buffer, n);
+        break;
+    case 32:
+        memcpy(buffer, f->data, n*sizeof(float));
+        break;
+    default:
+        fprintf(stderr, _("Internal error: attempt to read unsupported "
+                          "bitdepth %d\n"), f->samplesize);
+        return 0;
+    }
+
+    /* Converted in file order, then permuted in place. */
+    for(j=0; j < f->channels; j++)
+        permuted |= ch_permute[j] != j;
+    if(permuted)
+    {
+        float *tmp = alloca(f->channels*sizeof(float));
+        for(i = 0; i < realsamples; i++)
+        {
+            float *samp = buffer + i*f->channels;
+            for(j=0; j < f->channels; j++)
+                tmp[j] = samp[ch_permute[j]];
+            memcpy(samp, tmp, f->channels*sizeof(float));
+        }
+    }
+
+    f->data += realsamples*frame;
+    f->samplesread += realsamples;
+    return realsamples;
+}
+
 void wav_close(void *info)
 {
     wavfile *f = (wavfile *)info;
     free(f->channel_permute);
+#ifdef USE_MMAP
+    if(f->map)
+        munmap((void *)f->map, f->map_size);
+#endif
 
     free(f);
 }
@@ -766,6 +1080,9 @@ int raw_open(FILE *in, oe_enc_opt *opt, unsigned char *buf, int buflen)
     wav->channels =      format.channels;
     wav->samplesize =    opt->samplesize;
     wav->totalsamples =  0;
+    wav->map =           NULL;
+    wav->data =          NULL;
+    wav->data_end =      NULL;
     wav->channel_permute = malloc(wav->channels * sizeof(int));
     for (i=0; i < wav->channels; i++)
       wav->channel_permute[i] = i;
@@ -807,6 +1124,15 @@ void setup_scaler(oe_enc_opt *opt, float scale) {
     d->scale_factor = scale;
 }
 
+void clear_scaler(oe_enc_opt *opt) {
+    scaler *d = opt->readdata;
+
+    opt->read_samples = d->real_reader;
+    opt->readdata = d->real_readdata;
+
+    free(d);
+}
+
 typedef struct {
     audio_read_func real_reader;
     void *real_readdata;
@@ -847,7 +1173,9 @@ static long read_padder(void *data, float *buffer, int samples) {
     return in_samples+extra;
 }
 
-void setup_padder(oe_enc_opt *opt,ogg_int64_t *original_samples) {
+/* Pads by *extra_samples samples. */
+static void setup_padder_by(oe_enc_opt *opt,ogg_int64_t *original_samples,
+                            int *extra_samples) {
     padder *d = calloc(1, sizeof(padder));
 
     d->real_reader = opt->read_samples;
@@ -856,12 +1184,16 @@ void setup_padder(oe_enc_opt *opt,ogg_int64_t *original_samples) {
     opt->read_samples = read_padder;
     opt->readdata = d;
     d->channels = opt->channels;
-    d->extra_samples = &opt->extraout;
+    d->extra_samples = extra_samples;
     d->original_samples=original_samples;
     d->lpc_ptr = -1;
     d->lpc_out = NULL;
 }
 
+void setup_padder(oe_enc_opt *opt,ogg_int64_t *original_samples) {
+    setup_padder_by(opt, original_samples, &opt->extraout);
+}
+
 void clear_padder(oe_enc_opt *opt) {
     padder *d = opt->readdata;
 
@@ -901,7 +1233,8 @@ static long read_resampled(void *d, float *buffer, int samples)
       in_len=*inbuf;
       out_len=samples-out_samples;
       speex_resampler_process_interleaved_float(rs->resampler, pcmbuf, &in_len, buffer+out_samples*rs->channels, &out_len);
-      if(ret==0&&in_len==0){
+      /* A full buffer reads nothing, without being the end */
+      if(ret==0&&in_len==0&&out_len==0){
         for(i=out_samples*rs->channels;i<samples*rs->channels;i++)buffer[i]=0;
         return out_samples;
       }
@@ -983,7 +1316,10 @@ static long read_downmix(void *data, float *buffer, int samples)
     return in_samples;
 }
 
-int setup_downmix(oe_enc_opt *opt, int out_channels) {
+/* Checks a downmix of in_channels to out_channels is supported, and returns
+   its out_channels x in_channels matrix, normalized and multiplied by scale,
+   or NULL. */
+static float *downmix_matrix(int in_channels, int out_channels, float scale) {
     static const float stupid_matrix[7][8][2]={
       /*2*/  {{1,0},{0,1}},
       /*3*/  {{1,0},{0.7071f,0.7071f},{0,1}},
@@ -994,38 +1330,52 @@ int setup_downmix(oe_enc_opt *opt, int out_channels) {
       /*8*/  {{1,0},{0.7071f,0.7071f},{0,1},{0.866f,0.5f},{0.5f,0.866f},{0.866f,0.5f},{0.5f,0.866f},{0.7071f,0.7071f}},
     };
     float sum;
-    downmix *d;
+    float *matrix;
     int i,j;
 
-    if(opt->channels<=out_channels || out_channels>2 || (out_channels==2&&opt->channels>8) || opt->channels<=0 || out_channels<=0) {
+    if(in_channels<=out_channels || out_channels>2 || (out_channels==2&&in_channels>8) || in_channels<=0 || out_channels<=0) {
         fprintf(stderr, "Downmix must actually downmix and only knows mono/stereo out.\n");
-        if(opt->channels>8)fprintf(stderr, "Downmix also only knows how to mix >8ch to mono.\n");
-        return 0;
+        if(in_channels>8)fprintf(stderr, "Downmix also only knows how to mix >8ch to mono.\n");
+        return NULL;
     }
 
+    matrix = malloc(sizeof(float)*in_channels*out_channels);
+
+    if(out_channels==1&&in_channels>8){
+      for(i=0;i<in_channels;i++)matrix[i]=1.0f/in_channels;
+    }else if(out_channels==2){
+      for(j=0;j<out_channels;j++)
+        for(i=0;i<in_channels;i++)matrix[in_channels*j+i]=
+          stupid_matrix[in_channels-2][i][j];
+    }else{
+      for(i=0;i<in_channels;i++)matrix[i]=
+        (stupid_matrix[in_channels-2][i][0])+
+        (stupid_matrix[in_channels-2][i][1]);
+    }
+    sum=0;
+    for(i=0;i<in_channels*out_channels;i++)sum+=matrix[i];
+    sum=(float)out_channels/sum;
+    for(i=0;i<in_channels*out_channels;i++)matrix[i]*=sum;
+    if(scale!=1.0f)
+      for(i=0;i<in_channels*out_channels;i++)matrix[i]*=scale;
+    return matrix;
+}
+
+int setup_downmix(oe_enc_opt *opt, int out_channels) {
+    downmix *d;
+    float *matrix;
+
+    matrix = downmix_matrix(opt->channels, out_channels, 1.0f);
+    if(!matrix)return 0;
+
     d = calloc(1, sizeof(downmix));
     d->bufs = malloc(sizeof(float)*opt->channels*4096);
-    d->matrix = malloc(sizeof(float)*opt->channels*out_channels);
+    d->matrix = matrix;
     d->real_reader = opt->read_samples;
     d->real_readdata = opt->readdata;
     d->in_channels=opt->channels;
     d->out_channels=out_channels;
 
-    if(out_channels==1&&d->in_channels>8){
-      for(i=0;i<d->in_channels;i++)d->matrix[i]=1.0f/d->in_channels;
-    }else if(out_channels==2){
-      for(j=0;j<d->out_channels;j++)
-        for(i=0;i<d->in_channels;i++)d->matrix[d->in_channels*j+i]=
-          stupid_matrix[opt->channels-2][i][j];
-    }else{
-      for(i=0;i<d->in_channels;i++)d->matrix[i]=
-        (stupid_matrix[opt->channels-2][i][0])+
-        (stupid_matrix[opt->channels-2][i][1]);
-    }
-    sum=0;
-    for(i=0;i<d->in_channels*d->out_channels;i++)sum+=d->matrix[i];
-    sum=(float)out_channels/sum;
-    for(i=0;i<d->in_channels*d->out_channels;i++)d->matrix[i]*=sum;
     opt->read_samples = read_downmix;
     opt->readdata = d;
 
@@ -1044,3 +1394,252 @@ void clear_downmix(oe_enc_opt *opt) {
     free(d->matrix);
     free(d);
 }
+
+/* Fused conversion: the input is read by blocks small enough to stay in
+   cache, each scaled and downmixed in place in a single pass, then given
+   straight to the resampler, which writes the caller's buffer. The chained
+   readers above take a pass, and a buffer, per stage. Without a downmix
+   they take no buffer but the resampler's, and the copy of the blocks
+   costs more than it saves: the conversion is then left to them. */
+#define PIPELINE_BLOCK 1024
+
+typedef struct {
+    audio_read_func real_reader;
+    void *real_readdata;
+    int in_channels;
+    int channels;
+    float scale;
+    float *matrix; /* Scale included, NULL when not downmixing */
+    SpeexResamplerState *resampler; /* NULL when not resampling */
+    ogg_int64_t *original_samples;
+    int *extra_samples; /* NULL when not padding */
+    /* Two blocks, the previous one kept for the padding */
+    float *blocks[2];
+    int cur;
+    long prev_len;
+    /* Converted frames of the current block, or of the padding */
+    const float *data;
+    long pos;
+    long len;
+    int eof;
+    float *lpc_out;
+    long lpc_len;
+    /* Chained readers, under real_reader, in place of the above */
+    int chained;
+    int scaled;
+    int padded;
+    int resampled;
+    int no_extra; /* Padding of the input counted but not padded */
+} pipeline;
+
+static void pipeline_convert(pipeline *p, float *block, long n) {
+    const float *m = p->matrix;
+    int in_ch = p->in_channels;
+    long i;
+    int k;
+
+    if(m && p->channels==1){
+      for(i=0;i<n;i++){
+        const float *x = block+i*in_ch;
+        float y = 0;
+        for(k=0;k<in_ch;k++)y+=x[k]*m[k];
+        block[i]=y;
+      }
+    }else if(m){
+      for(i=0;i<n;i++){
+        const float *x = block+i*in_ch;
+        float l = 0, r = 0;
+        for(k=0;k<in_ch;k++){
+          l+=x[k]*m[k];
+          r+=x[k]*m[in_ch+k];
+        }
+        block[2*i]=l;
+        block[2*i+1]=r;
+      }
+    }else if(p->scale!=1.0f){
+      for(i=0;i<n*in_ch;i++)block[i]*=p->scale;
+    }
+}
+
+/* As read_padder: the end of the input extrapolated by LPC, here from the
+   last two blocks. */
+static void pipeline_extrapolate(pipeline *p, long n) {
+    const int lpc_order=32;
+    int ch = p->channels;
+    long h = p->prev_len + n;
+    float *history;
+    int i;
+
+    if(!p->extra_samples || *p->extra_samples<=0)return;
+    p->lpc_len = *p->extra_samples;
+    p->lpc_out = calloc(ch * p->lpc_len, sizeof(*p->lpc_out));
+    if(h<=lpc_order*2)return;
+    history = malloc(sizeof(*history) * h * ch);
+    memcpy(history, p->blocks[!p->cur], sizeof(*history) * p->prev_len * ch);
+    memcpy(history + p->prev_len * ch, p->blocks[p->cur],
+           sizeof(*history) * n * ch);
+    for(i=0;i<ch;i++){
+      float lpc[32];
+      vorbis_lpc_from_data(history+i,lpc,h,lpc_order,ch);
+      vorbis_lpc_predict(lpc,history+i+(h-lpc_order)*ch,lpc_order,
+                         p->lpc_out+i,p->lpc_len,ch);
+    }
+    free(history);
+}
+
+/* Loads the next converted frames; returns 0 at the end. */
+static int pipeline_fill(pipeline *p) {
+    long n;
+    if(!p->eof){
+      p->prev_len = p->data ? p->len : 0;
+      p->cur = !p->cur;
+      n = p->real_reader(p->real_readdata, p->blocks[p->cur], PIPELINE_BLOCK);
+      if(n<0)n=0;
+      if(p->original_samples)*p->original_samples+=n;
+      pipeline_convert(p, p->blocks[p->cur], n);
+      if(n<PIPELINE_BLOCK){
+        p->eof = 1;
+        pipeline_extrapolate(p, n);
+      }
+      p->data = p->blocks[p->cur];
+      p->pos = 0;
+      p->len = n;
+      if(n>0)return 1;
+    }
+    if(p->lpc_len>0){
+      p->data = p->lpc_out;
+      p->pos = 0;
+      p->len = p->lpc_len;
+      *p->extra_samples -= p->lpc_len;
+      p->lpc_len = 0; /* Given once */
+      return 1;
+    }
+    return 0;
+}
+
+static long read_pipeline(void *data, float *buffer, int samples) {
+    pipeline *p = data;
+    int ch = p->channels;
+    long out = 0;
+
+    if(p->chained)return p->real_reader(p->real_readdata, buffer, samples);
+    while(out<samples){
+      if(p->pos==p->len && !pipeline_fill(p))break;
+      if(p->resampler){
+        spx_uint32_t in_len = p->len - p->pos;
+        spx_uint32_t out_len = samples - out;
+        speex_resampler_process_interleaved_float(p->resampler,
+            p->data + p->pos*ch, &in_len, buffer + out*ch, &out_len);
+        p->pos += in_len;
+        out += out_len;
+      }else{
+        long n = p->len - p->pos;
+        if(n>samples-out)n=samples-out;
+        memcpy(buffer + out*ch, p->data + p->pos*ch, sizeof(*buffer)*n*ch);
+        p->pos += n;
+        out += n;
+      }
+    }
+    return out;
+}
+
+/* Scales, pads and resamples by the chained readers, in the order of
+   opusenc. */
+static int setup_chained(oe_enc_opt *opt, const oe_pipeline_opt *popt,
+                         pipeline *p) {
+    int resample = popt->rate>0 && popt->rate!=opt->rate;
+
+    if(resample && (popt->quality<0 || popt->quality>10)){
+      fprintf(stderr, _("resampler error: %s\n"),
+              speex_resampler_strerror(RESAMPLER_ERR_INVALID_ARG));
+      return 0;
+    }
+    p->chained = 1;
+    if(popt->scale!=1.0f){
+      setup_scaler(opt, popt->scale);
+      p->scaled = 1;
+    }
+    if(popt->pad || popt->original_samples){
+      setup_padder_by(opt, popt->original_samples,
+                      popt->pad ? &opt->extraout : &p->no_extra);
+      p->padded = 1;
+    }
+    if(resample){
+      setup_resample(opt, popt->quality, popt->rate);
+      p->resampled = 1;
+    }
+    p->real_reader = opt->read_samples;
+    p->real_readdata = opt->readdata;
+    opt->read_samples = read_pipeline;
+    opt->readdata = p;
+    return 1;
+}
+
+int setup_pipeline(oe_enc_opt *opt, const oe_pipeline_opt *popt) {
+    pipeline *p = calloc(1, sizeof(pipeline));
+    int err;
+
+    p->in_channels = opt->channels;
+    p->channels = opt->channels;
+    p->scale = popt->scale;
+    if(popt->channels>0 && popt->channels<opt->channels){
+      p->matrix = downmix_matrix(opt->channels, popt->channels, popt->scale);
+      /* Unsupported, not downmixed, as by setup_downmix */
+      if(p->matrix)p->channels = popt->channels;
+    }
+    if(!p->matrix){
+      if(setup_chained(opt, popt, p))return 1;
+      free(p);
+      return 0;
+    }
+    if(popt->rate>0 && popt->rate!=opt->rate){
+      p->resampler = speex_resampler_init(p->channels, opt->rate, popt->rate,
+                                          popt->quality, &err);
+      if(!p->resampler){
+        fprintf(stderr, _("resampler error: %s\n"), speex_resampler_strerror(err));
+        free(p->matrix);
+        free(p);
+        return 0;
+      }
+      opt->skip+=speex_resampler_get_output_latency(p->resampler);
+    }
+    p->original_samples = popt->original_samples;
+    if(popt->pad)p->extra_samples = &opt->extraout;
+    p->blocks[0] = malloc(sizeof(float) * PIPELINE_BLOCK * opt->channels);
+    p->blocks[1] = malloc(sizeof(float) * PIPELINE_BLOCK * opt->channels);
+    p->real_reader = opt->read_samples;
+    p->real_readdata = opt->readdata;
+
+    opt->read_samples = read_pipeline;
+    opt->readdata = p;
+    if(p->resampler){
+      if(opt->total_samples_per_channel)
+        opt->total_samples_per_channel = (int)((float)opt->total_samples_per_channel *
+            ((float)popt->rate/(float)opt->rate));
+      opt->rate = popt->rate;
+    }
+    opt->channels = p->channels;
+    return 1;
+}
+
+void clear_pipeline(oe_enc_opt *opt) {
+    pipeline *p = opt->readdata;
+
+    opt->read_samples = p->real_reader;
+    opt->readdata = p->real_readdata;
+    if(p->chained){
+      if(p->resampled)clear_resample(opt);
+      if(p->padded)clear_padder(opt);
+      if(p->scaled)clear_scaler(opt);
+      free(p);
+      return;
+    }
+    opt->channels = p->in_channels; /* other things in cleanup rely on this */
+
+    if(p->resampler)speex_resampler_destroy(p->resampler);
+    free(p->matrix);
+    free(p->blocks[0]);
+    free(p->blocks[1]);
+    free(p->lpc_out);
+    free(p);
+}
@@ -279,6 +279,8 @@ int main(int argc, char **argv)
   inopt.endianness=0;
   inopt.rawmode=0;
   inopt.ignorelength=0;
+  inopt.nommap=0;
+  inopt.nofuse=0;
 
   for(i=0;i<256;i++)mapping[i]=i;
 
@@ -486,16 +488,13 @@ int main(int argc, char **argv)
     downmix=inopt.channels>8?1:2;
   }
 
-  if(downmix>0&&downmix<inopt.channels)downmix=setup_downmix(&inopt,downmix);
-  else downmix=0;
+  if(downmix>0&&downmix<inopt.channels){
+    if(inopt.nofuse)downmix=setup_downmix(&inopt,downmix);
+  }else downmix=0;
 
   rate=inopt.rate;
-  chan=inopt.channels;
   inopt.skip=0;
 
-  /*In order to code the complete length we'll need to do a little padding*/
-  setup_padder(&inopt,&original_samples);
-
   if(rate>24000)coding_rate=48000;
   else if(rate>16000)coding_rate=24000;
   else if(rate>12000)coding_rate=16000;
@@ -504,9 +503,23 @@ int main(int argc, char **argv)
 
   frame_size=frame_size/(48000/coding_rate);
 
-  /*Scale the resampler complexity, but only for 48000 output because
+  /*In order to code the complete length we'll need to do a little padding.
+    Scale the resampler complexity, but only for 48000 output because
     the near-cutoff behavior matters a lot more at lower rates.*/
-  if(rate!=coding_rate)setup_resample(&inopt,coding_rate==48000?complexity/2:5,coding_rate);
+  if(inopt.nofuse){
+    setup_padder(&inopt,&original_samples);
+    if(rate!=coding_rate)setup_resample(&inopt,coding_rate==48000?complexity/2:5,coding_rate);
+  }else{
+    oe_pipeline_opt pipeline;
+    pipeline.scale=1.0f;
+    pipeline.channels=downmix;
+    pipeline.rate=coding_rate;
+    pipeline.quality=coding_rate==48000?complexity/2:5;
+    pipeline.original_samples=&original_samples;
+    pipeline.pad=1;
+    if(!setup_pipeline(&inopt,&pipeline))exit(1);
+  }
+  chan=inopt.channels;
 
   /*OggOpus headers*/ /*FIXME: broke forcemono*/
   header.channels=chan;
@@ -938,9 +951,11 @@ int main(int argc, char **argv)
   free(input);
   if(opt_ctls)free(opt_ctls_ctlval);
 
-  if(rate!=coding_rate)clear_resample(&inopt);
-  clear_padder(&inopt);
-  if(downmix)clear_downmix(&inopt);
+  if(inopt.nofuse){
+    if(rate!=coding_rate)clear_resample(&inopt);
+    clear_padder(&inopt);
+    if(downmix)clear_downmix(&inopt);
+  }else clear_pipeline(&inopt);
   in_format->close_func(inopt.readdata);
   if(fin)fclose(fin);
   if(fout)fclose(fout);
@@ -31,6 +31,8 @@ typedef struct
     int endianness;
     char *infilename;
     int ignorelength;
+    int nommap; /* Read regular files through stdio rather than mmap */
+    int nofuse; /* Convert through the chained readers, not setup_pipeline */
     int skip;
     int extraout;
 } oe_enc_opt;
@@ -42,6 +44,23 @@ void clear_padder(oe_enc_opt *opt);
 int setup_downmix(oe_enc_opt *opt, int out_channels);
 void clear_downmix(oe_enc_opt *opt);
 
+/* Scale, downmix, pad and resample in a single pass over blocks held in
+   cache, in place of the chained setup_scaler, setup_downmix, setup_padder
+   and setup_resample, which are kept as the fallback. Without a downmix,
+   the chained readers are set up in its place */
+typedef struct
+{
+    float scale; /* Gain, 1 for none */
+    int channels; /* Downmixed to 1 or 2 channels, 0 to keep them */
+    long rate; /* Resampled to, 0 to keep it */
+    int quality; /* Of the resampler */
+    ogg_int64_t *original_samples; /* Counts the input samples, or NULL */
+    int pad; /* Extrapolates opt->extraout samples at the end */
+} oe_pipeline_opt;
+
+int setup_pipeline(oe_enc_opt *opt, const oe_pipeline_opt *popt);
+void clear_pipeline(oe_enc_opt *opt);
+
 typedef struct
 {
     int (*id_func)(unsigned char *buf, int len); /* Returns true if can load file */
@@ -70,6 +89,11 @@ typedef struct {
     FILE *f;
     short bigendian;
     int *channel_permute;
+    /* The whole file, when memory mapped, and its samples left to read. */
+    const unsigned char *map;
+    size_t map_size;
+    const unsigned char *data;
+    const unsigned char *data_end;
 } wavfile;
 
 typedef struct {
@@ -97,5 +121,6 @@ void clear_resample(oe_enc_opt *opt);
 
 long wav_read(void *, float *buffer, int samples);
 long wav_ieee_read(void *, float *buffer, int samples);
+long wav_map_read(void *, float *buffer, int samples);
 
 #endif /* __OPUSENC_H */
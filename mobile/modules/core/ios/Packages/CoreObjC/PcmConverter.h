@@ -10,9 +10,15 @@
 NS_ASSUME_NONNULL_BEGIN
 
 @interface PcmConverter : NSObject
+// Size of the encoded LC3 frames, 20 bytes by default
+@property (nonatomic, readonly) uint16_t frameBytes;
+
+- (instancetype)initWithFrameBytes:(uint16_t)frameBytes;
+
 + (void)setupStaticEncoderAndDecoder;
 -(NSMutableData *)decode: (NSData *)lc3data;
 -(NSMutableData *)encode: (NSData *)pcmdata;
+- (void)resetDecoder;
 @end
 
 NS_ASSUME_NONNULL_END
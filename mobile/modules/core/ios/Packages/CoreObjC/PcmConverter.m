@@ -12,7 +12,6 @@
     // Instance variables for persistent decoder
     lc3_decoder_t _lc3_decoder;
     void* _decMem;
-    unsigned char* _outBuf;
     BOOL _decoderInitialized;
     
     // Decoder parameters
@@ -29,11 +28,15 @@ static const int srHz = 16000;
 static const uint16_t outputByteCount = 20;
 
 - (instancetype)init {
+    return [self initWithFrameBytes:outputByteCount];
+}
+
+- (instancetype)initWithFrameBytes:(uint16_t)frameBytes {
     self = [super init];
     if (self) {
+        _frameBytes = MIN(MAX(frameBytes, LC3_MIN_FRAME_BYTES), LC3_MAX_FRAME_BYTES);
         _decoderInitialized = NO;
         _decMem = NULL;
-        _outBuf = NULL;
     }
     return self;
 }
@@ -55,14 +58,6 @@ static const uint16_t outputByteCount = 20;
     
     _lc3_decoder = lc3_setup_decoder(dtUs, srHz, 0, _decMem);
     
-    _outBuf = malloc(_bytesOfFrames);
-    if (_outBuf == NULL) {
-        printf("Failed to allocate memory for outBuf\n");
-        free(_decMem);
-        _decMem = NULL;
-        return;
-    }
-    
     _decoderInitialized = YES;
 }
 
@@ -80,22 +75,25 @@ static const uint16_t outputByteCount = 20;
         return [[NSMutableData alloc] init];
     }
     
-    int totalBytes = (int)lc3data.length;
-    int bytesRead = 0;
+    // Size the output once, a trailing partial frame counts as a frame
+    NSUInteger totalBytes = lc3data.length;
+    NSUInteger frameCount = (totalBytes + _frameBytes - 1) / _frameBytes;
     
-    NSMutableData *pcmData = [[NSMutableData alloc] init];
+    NSMutableData *pcmData = [NSMutableData dataWithLength:frameCount * _bytesOfFrames];
+    const uint8_t *inBuf = lc3data.bytes;
+    uint8_t *outBuf = pcmData.mutableBytes;
     
-    while (bytesRead < totalBytes) {
-        int bytesToRead = MIN(outputByteCount, totalBytes - bytesRead);
-        NSRange range = NSMakeRange(bytesRead, bytesToRead);
-        NSData *subdata = [lc3data subdataWithRange:range];
-        unsigned char *inBuf = (unsigned char *)subdata.bytes;
+    // Frames decoded in place, the short or corrupted ones are concealed
+    for (NSUInteger i = 0; i < frameCount; i++) {
+        const uint8_t *frame = inBuf + i * _frameBytes;
+        BOOL complete = totalBytes - i * _frameBytes >= _frameBytes;
         
-        lc3_decode(_lc3_decoder, inBuf, outputByteCount, LC3_PCM_FORMAT_S16, _outBuf, 1);
+        if (!complete || lc3_check_frame(_lc3_decoder, frame, _frameBytes) != 0) {
+            frame = NULL;
+        }
         
-        NSData *data = [NSData dataWithBytes:_outBuf length:_bytesOfFrames];
-        [pcmData appendData:data];
-        bytesRead += bytesToRead;
+        lc3_decode(_lc3_decoder, frame, _frameBytes, LC3_PCM_FORMAT_S16,
+                   outBuf + i * _bytesOfFrames, 1);
     }
     
     return pcmData;
@@ -113,10 +111,6 @@ static const uint16_t outputByteCount = 20;
         free(_decMem);
         _decMem = NULL;
     }
-    if (_outBuf) {
-        free(_outBuf);
-        _outBuf = NULL;
-    }
     _decoderInitialized = NO;
 }
 @end
@@ -97,6 +97,7 @@ struct ViewState {
     // VAD:
     private var vad: SileroVADStrategy?
     private var vadBuffer = [Data]()
+    private let pcmConverter = PcmConverter() // persistent LC3 decoder for the glasses mic
     private var isSpeaking = false
 
     // STT:
@@ -206,14 +207,12 @@ struct ViewState {
             checkSetVadStatus(speaking: true)
             // first send out whatever's in the vadBuffer (if there is anything):
             emptyVadBuffer()
-            let pcmConverter = PcmConverter()
             let pcmData = pcmConverter.decode(lc3Data) as Data
             //        self.serverComms.sendAudioChunk(lc3Data)
             Bridge.sendMicData(pcmData)
             return
         }
 
-        let pcmConverter = PcmConverter()
         let pcmData = pcmConverter.decode(lc3Data) as Data
 
         guard pcmData.count > 0 else {
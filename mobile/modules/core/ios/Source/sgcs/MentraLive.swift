@@ -934,6 +934,7 @@ class MentraLive: NSObject, SGCManager {
     private var supportsLC3Audio = false
     private var lastReceivedLc3Sequence: Int8 = -1
     private let LC3_FRAME_SIZE = 40 // bytes per LC3 frame
+    private lazy var pcmConverter = PcmConverter(frameBytes: UInt16(LC3_FRAME_SIZE)) // persistent decoder for the stream
     private let MICBEAT_INTERVAL_MS: TimeInterval = 30 * 60 // 30 minutes in seconds
     private var micBeatTimer: Timer?
     private var micBeatCount = 0
@@ -1991,8 +1992,7 @@ class MentraLive: NSObject, SGCManager {
         }
         lastReceivedLc3Sequence = sequenceNumber
 
-        // Decode LC3 to PCM using existing PcmConverter
-        let pcmConverter = PcmConverter()
+        // Decode LC3 to PCM, keeping the decoder state across packets
         guard let pcmData = pcmConverter.decode(lc3Data) as? Data, pcmData.count > 0 else {
             Bridge.log("LIVE: Failed to decode LC3 data to PCM")
             return
@@ -122,6 +122,17 @@ extern "C" {
 #include "lc3_private.h"
 
 
+/**
+ * Library version
+ * Upstream 1.0 base, with the PLC modes and frame checking additions.
+ * The CMake target takes its version from these definitions.
+ */
+
+#define LC3_VERSION_MAJOR  1
+#define LC3_VERSION_MINOR  1
+#define LC3_VERSION_PATCH  0
+
+
 /**
  * Limitations
  * - On the bitrate, in bps, of a stream
@@ -170,6 +181,24 @@ enum lc3_pcm_format {
 };
 
 
+/**
+ * Packet Loss Concealment mode
+ *   STANDARD  Spectral noise substitution, as specified (default)
+ *   PITCH     Time domain repetition of the last pitch period, using the
+ *             LTPF pitch lag of the last good frame. Falls back to the
+ *             standard mode when no pitch has been tracked.
+ *   PITCH_HQ  As PITCH, the lag is refined (or searched, when the LTPF
+ *             did not track a pitch) on the decoded history.
+ *             Costs a correlation search by burst of loss.
+ */
+
+enum lc3_plc_mode {
+    LC3_PLC_MODE_STANDARD,
+    LC3_PLC_MODE_PITCH,
+    LC3_PLC_MODE_PITCH_HQ,
+};
+
+
 /**
  * Handle
  */
@@ -305,6 +334,32 @@ lc3_decoder_t lc3_setup_decoder(
 int lc3_decode(lc3_decoder_t decoder, const void *in, int nbytes,
     enum lc3_pcm_format fmt, void *pcm, int stride);
 
+/**
+ * Check a frame, without decoding it
+ * decoder         Handle of the decoder
+ * in, nbytes      Input bitstream, and size in bytes
+ * return          0: Valid  1: Corrupted, PLC to operate  -1: Wrong parameters
+ *
+ * Only the side data (bandwidth, global gain, TNS, SNS and LTPF data) is
+ * parsed, and its bit budget checked, at a fraction of the cost of a
+ * decoding. The state of the decoder is left untouched.
+ * A frame reported valid can still be rejected by `lc3_decode()`, on
+ * errors detected while decoding the spectral coefficients.
+ * An invalid frame is concealed by calling `lc3_decode()` with `in` NULL.
+ */
+int lc3_check_frame(lc3_decoder_t decoder, const void *in, int nbytes);
+
+/**
+ * Select the Packet Loss Concealment mode of a decoder
+ * decoder         Handle of the decoder
+ * mode            PLC mode, `LC3_PLC_MODE_STANDARD` after setup
+ * return          0: On success  -1: Wrong parameters
+ *
+ * The mode can be changed at any time, it takes effect on the next
+ * frame lost.
+ */
+int lc3_decoder_set_plc_mode(lc3_decoder_t decoder, enum lc3_plc_mode mode);
+
 
 #ifdef __cplusplus
 }
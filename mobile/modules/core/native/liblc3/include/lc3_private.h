@@ -136,6 +136,9 @@ typedef struct lc3_plc_state {
     uint16_t seed;
     int count;
     float alpha;
+
+    int mode;
+    int pitch, lag;
 } lc3_plc_state_t;
 
 struct lc3_decoder {
@@ -82,6 +82,23 @@
 #endif /* __ARM_FEATURE_SAT */
 
 
+/**
+ * Pack halfwords, bottom of `a` and top of `b`
+ * Not provided by `arm_acle.h`, shared by the DSP extension kernels
+ */
+
+#if __ARM_FEATURE_SIMD32 && !(__GNUC__ < 10) && !defined(TEST_ARM)
+
+static inline int16x2_t __pkhbt(int16x2_t a, int16x2_t b)
+{
+    int16x2_t r;
+    __asm("pkhbt %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));
+    return r;
+}
+
+#endif /* __ARM_FEATURE_SIMD32 */
+
+
 /**
  * Convert `dt` in us and `sr` in KHz
  */
@@ -396,7 +396,7 @@ int lc3_encode(struct lc3_encoder *encoder, enum lc3_pcm_format fmt,
     /* --- Processing --- */
 
     struct side_data side;
-    uint16_t xq[LC3_MAX_NE];
+    uint16_t alignas(int32_t) xq[LC3_MAX_NE];
 
     load[fmt](encoder, pcm, stride);
 
@@ -506,6 +506,38 @@ static void store_float(
     }
 }
 
+/**
+ * Decode side data of bitstream
+ * dt, sr          Duration and samplerate of the frame
+ * bits            Bitstream context, setup on the frame
+ * nbytes          Size in bytes of the frame
+ * side            Return the side data
+ * return          0: Ok  < 0: Bitsream error detected
+ */
+static int decode_side(enum lc3_dt dt, enum lc3_srate sr,
+    lc3_bits_t *bits, int nbytes, struct side_data *side)
+{
+    int ret = 0;
+
+    if ((ret = lc3_bwdet_get_bw(bits, sr, &side->bw)) < 0)
+        return ret;
+
+    if ((ret = lc3_spec_get_side(bits, dt, sr, &side->spec)) < 0)
+        return ret;
+
+    lc3_tns_get_data(bits, dt, side->bw, nbytes, &side->tns);
+
+    side->pitch_present = lc3_get_bit(bits);
+
+    if ((ret = lc3_sns_get_data(bits, &side->sns)) < 0)
+        return ret;
+
+    if (side->pitch_present)
+        lc3_ltpf_get_data(bits, &side->ltpf);
+
+    return lc3_check_bits(bits);
+}
+
 /**
  * Decode bitstream
  * decoder         Decoder state
@@ -528,22 +560,9 @@ static int decode(struct lc3_decoder *decoder,
 
     lc3_setup_bits(&bits, LC3_BITS_MODE_READ, (void *)data, nbytes);
 
-    if ((ret = lc3_bwdet_get_bw(&bits, sr, &side->bw)) < 0)
-        return ret;
-
-    if ((ret = lc3_spec_get_side(&bits, dt, sr, &side->spec)) < 0)
+    if ((ret = decode_side(dt, sr, &bits, nbytes, side)) < 0)
         return ret;
 
-    lc3_tns_get_data(&bits, dt, side->bw, nbytes, &side->tns);
-
-    side->pitch_present = lc3_get_bit(&bits);
-
-    if ((ret = lc3_sns_get_data(&bits, &side->sns)) < 0)
-        return ret;
-
-    if (side->pitch_present)
-        lc3_ltpf_get_data(&bits, &side->ltpf);
-
     if ((ret = lc3_spec_decode(&bits, dt, sr,
                     side->bw, nbytes, &side->spec, xf)) < 0)
         return ret;
@@ -579,8 +598,6 @@ static void synthesize(struct lc3_decoder *decoder,
     if (side) {
         enum lc3_bandwidth bw = side->bw;
 
-        lc3_plc_suspend(&decoder->plc);
-
         lc3_tns_synthesize(dt, bw, &side->tns, xf);
 
         lc3_sns_synthesize(dt, sr, &side->sns, xf, xg);
@@ -597,6 +614,15 @@ static void synthesize(struct lc3_decoder *decoder,
 
     lc3_ltpf_synthesize(dt, sr_pcm, nbytes, &decoder->ltpf,
         side && side->pitch_present ? &side->ltpf : NULL, xh, xs);
+
+    if (side) {
+        lc3_plc_recover(dt, sr_pcm, &decoder->plc,
+            side->pitch_present ? decoder->ltpf.pitch : 0, xh, xs);
+
+        lc3_plc_suspend(&decoder->plc);
+
+    } else
+        lc3_plc_conceal(dt, sr_pcm, &decoder->plc, xh, xs);
 }
 
 /**
@@ -702,3 +728,41 @@ int lc3_decode(struct lc3_decoder *decoder, const void *in, int nbytes,
 
     return ret;
 }
+
+/**
+ * Check a frame, without decoding it
+ */
+int lc3_check_frame(struct lc3_decoder *decoder, const void *in, int nbytes)
+{
+    /* --- Check parameters --- */
+
+    if (!decoder || !in)
+        return -1;
+
+    if (nbytes < LC3_MIN_FRAME_BYTES || nbytes > LC3_MAX_FRAME_BYTES)
+        return 1;
+
+    /* --- Parse side data --- */
+
+    struct side_data side;
+    lc3_bits_t bits;
+
+    lc3_setup_bits(&bits, LC3_BITS_MODE_READ, (void *)in, nbytes);
+
+    return decode_side(decoder->dt, decoder->sr, &bits, nbytes, &side) < 0;
+}
+
+/**
+ * Select the Packet Loss Concealment mode of a decoder
+ */
+int lc3_decoder_set_plc_mode(
+    struct lc3_decoder *decoder, enum lc3_plc_mode mode)
+{
+    if (!decoder || mode < LC3_PLC_MODE_STANDARD
+                 || mode > LC3_PLC_MODE_PITCH_HQ)
+        return -1;
+
+    decoder->plc.mode = mode;
+
+    return 0;
+}
@@ -16,20 +16,8 @@
  *
  ******************************************************************************/
 
-#if (__ARM_FEATURE_SIMD32 && !(__GNUC__ < 10) || defined(TEST_ARM))
-
-#ifndef TEST_ARM
-
-#include <arm_acle.h>
-
-static inline int16x2_t __pkhbt(int16x2_t a, int16x2_t b)
-{
-    int16x2_t r;
-    __asm("pkhbt %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));
-    return r;
-}
-
-#endif /* TEST_ARM */
+#if (__ARM_FEATURE_SIMD32 && !(__GNUC__ < 10) && \
+        !defined(LC3_NO_ARM_DSP) || defined(TEST_ARM))
 
 
 /**
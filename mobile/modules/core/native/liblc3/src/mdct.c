@@ -20,6 +20,7 @@
 #include "tables.h"
 
 #include "mdct_neon.h"
+#include "mdct_arm.h"
 
 
 /* ----------------------------------------------------------------------------
@@ -187,7 +188,15 @@ static struct lc3_complex *fft(const struct lc3_complex *x, int n,
     for (i3 = 0; n & (n-1); i3++, is ^= 1)
         fft_bf3(lc3_fft_twiddles_bf3[i3], y[is], y[is ^ 1], n /= 3);
 
-    for (i2 = 0; n > 1; i2++, is ^= 1)
+    i2 = 0;
+
+#ifdef fft_bf2x2
+    for ( ; n > 2; i2 += 2, is ^= 1)
+        fft_bf2x2(lc3_fft_twiddles_bf2[i2][i3],
+            lc3_fft_twiddles_bf2[i2+1][i3], y[is], y[is ^ 1], n >>= 2);
+#endif
+
+    for ( ; n > 1; i2++, is ^= 1)
         fft_bf2(lc3_fft_twiddles_bf2[i2][i3], y[is], y[is ^ 1], n >>= 1);
 
     return y[is];
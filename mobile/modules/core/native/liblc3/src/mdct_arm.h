@@ -0,0 +1,98 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if (__ARM_FEATURE_SIMD32 && __ARM_FP && !(__GNUC__ < 10) && \
+        !defined(LC3_NO_ARM_DSP) || defined(TEST_ARM))
+
+/* The MDCT is computed in single precision float. The DSP extension has no
+ * float lanes, so the butterflies run on the FPU, and are reorganized for
+ * the Cortex-M33 : single issue, one load or store per cycle, and 32 single
+ * precision registers. */
+
+
+/**
+ * FFT Butterfly 2x2 Points
+ * twiddles0       Twiddles of the first radix-2 stage
+ * twiddles1       Twiddles of the second radix-2 stage (2x more points)
+ * x, y            Input and output coefficients
+ * n               Number of interleaved transforms, after the 2 stages
+ *
+ * Two successive radix-2 stages are merged, the intermediate values stay in
+ * registers instead of a round trip through the scratch buffer. The
+ * arithmetic is the same as `fft_bf2()` applied twice, and the result is
+ * bit-exact with it.
+ */
+#ifndef fft_bf2x2
+
+LC3_HOT static inline void arm_fft_bf2x2(
+    const struct lc3_fft_bf2_twiddles *twiddles0,
+    const struct lc3_fft_bf2_twiddles *twiddles1,
+    const struct lc3_complex *x, struct lc3_complex *y, int n)
+{
+    int n2 = twiddles0->n2;
+    const struct lc3_complex *wa = twiddles0->t;
+    const struct lc3_complex *wb0 = twiddles1->t, *wb1 = wb0 + n2;
+
+    const struct lc3_complex *x0 = x, *x1 = x0 + 2*n*n2;
+    const struct lc3_complex *x2 = x0 + n*n2, *x3 = x1 + n*n2;
+
+    for (int i = 0; i < n; i++, y += 4*n2) {
+        struct lc3_complex *y0 = y, *y1 = y0 + n2;
+        struct lc3_complex *y2 = y1 + n2, *y3 = y2 + n2;
+
+        for (int j = 0; j < n2; j++, x0++, x1++, x2++, x3++) {
+            struct lc3_complex a0, a1, b0, b1;
+
+            /* --- First stage, on transforms `i` and `i + n` --- */
+
+            a0.re = x0->re + x1->re * wa[j].re - x1->im * wa[j].im;
+            a0.im = x0->im + x1->im * wa[j].re + x1->re * wa[j].im;
+
+            a1.re = x0->re - x1->re * wa[j].re + x1->im * wa[j].im;
+            a1.im = x0->im - x1->im * wa[j].re - x1->re * wa[j].im;
+
+            b0.re = x2->re + x3->re * wa[j].re - x3->im * wa[j].im;
+            b0.im = x2->im + x3->im * wa[j].re + x3->re * wa[j].im;
+
+            b1.re = x2->re - x3->re * wa[j].re + x3->im * wa[j].im;
+            b1.im = x2->im - x3->im * wa[j].re - x3->re * wa[j].im;
+
+            /* --- Second stage --- */
+
+            y0[j].re = a0.re + b0.re * wb0[j].re - b0.im * wb0[j].im;
+            y0[j].im = a0.im + b0.im * wb0[j].re + b0.re * wb0[j].im;
+
+            y2[j].re = a0.re - b0.re * wb0[j].re + b0.im * wb0[j].im;
+            y2[j].im = a0.im - b0.im * wb0[j].re - b0.re * wb0[j].im;
+
+            y1[j].re = a1.re + b1.re * wb1[j].re - b1.im * wb1[j].im;
+            y1[j].im = a1.im + b1.im * wb1[j].re + b1.re * wb1[j].im;
+
+            y3[j].re = a1.re - b1.re * wb1[j].re + b1.im * wb1[j].im;
+            y3[j].im = a1.im - b1.im * wb1[j].re - b1.re * wb1[j].im;
+        }
+    }
+}
+
+#ifndef TEST_ARM
+#define fft_bf2x2 arm_fft_bf2x2
+#endif
+
+#endif /* fft_bf2x2 */
+
+#endif /* __ARM_FEATURE_SIMD32 */
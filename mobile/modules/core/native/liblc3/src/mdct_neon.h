@@ -16,7 +16,7 @@
  *
  ******************************************************************************/
 
-#if __ARM_NEON && __ARM_ARCH_ISA_A64 && \
+#if __ARM_NEON && __ARM_ARCH_ISA_A64 && !defined(LC3_NO_NEON) && \
         !defined(TEST_ARM) || defined(TEST_NEON)
 
 #ifndef TEST_NEON
@@ -0,0 +1,258 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include "plc.h"
+
+
+/**
+ * Reset Packet Loss Concealment state
+ */
+void lc3_plc_reset(struct lc3_plc_state *plc)
+{
+    plc->seed = 24607;
+    plc->mode = LC3_PLC_MODE_STANDARD;
+    plc->pitch = 0;
+    lc3_plc_suspend(plc);
+}
+
+/**
+ * Suspend PLC execution (Good frame received)
+ */
+void lc3_plc_suspend(struct lc3_plc_state *plc)
+{
+    plc->count = 1;
+    plc->alpha = 1.0f;
+    plc->lag = 0;
+}
+
+/**
+ * Synthesis of a PLC frame
+ */
+void lc3_plc_synthesize(enum lc3_dt dt, enum lc3_srate sr,
+    struct lc3_plc_state *plc, const float *x, float *y)
+{
+    uint16_t seed = plc->seed;
+    float alpha = plc->alpha;
+    int ne = LC3_NE(dt, sr);
+
+    alpha *= (plc->count < 4 ? 1.0f :
+              plc->count < 8 ? 0.9f : 0.85f);
+
+    for (int i = 0; i < ne; i++) {
+        seed = (16831 + seed * 12821) & 0xffff;
+        y[i] = alpha * (seed & 0x8000 ? -x[i] : x[i]);
+    }
+
+    plc->seed = seed;
+    plc->alpha = alpha;
+    plc->count++;
+}
+
+
+/* ----------------------------------------------------------------------------
+ *  Time domain concealment
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Return the address of a past sample in the ring buffer
+ * xh, nh          Ring buffer of decoded samples
+ * x               Position of the current frame in the ring buffer
+ * k               Distance, in samples, before the current frame
+ */
+static inline const float *ring_past(
+    const float *xh, int nh, const float *x, int k)
+{
+    return x - xh >= k ? x - k : x - k + nh;
+}
+
+/**
+ * Normalized correlation of the history
+ * xh, nh          Ring buffer of decoded samples
+ * x               Position of the current frame in the ring buffer
+ * lag, n          Lag of correlation, and number of samples correlated
+ * return          Correlation of the `n` last samples with the ones
+ *                 `lag` samples before, normalized to -1 .. 1
+ */
+LC3_HOT static float correlate(
+    const float *xh, int nh, const float *x, int lag, int n)
+{
+    const float *y_end = xh + nh - 1;
+    const float *u = ring_past(xh, nh, x, n);
+    const float *v = ring_past(xh, nh, x, n + lag);
+    float uv = 0, uu = 0, vv = 0;
+
+    for (int i = 0; i < n; i++) {
+        uv += *u * *v, uu += *u * *u, vv += *v * *v;
+        u = u < y_end ? u + 1 : xh;
+        v = v < y_end ? v + 1 : xh;
+    }
+
+    return uu > 0 && vv > 0 ? uv / sqrtf(uu * vv) : 0;
+}
+
+/**
+ * Resolve the lag of the concealment
+ * dt, sr          Duration and samplerate of the frame
+ * plc             PLC State
+ * xh              Base address of ring buffer of decoded samples
+ * x               Position of the current frame in the ring buffer
+ * return          Lag in samples, 0 when the history is not periodic
+ */
+static int resolve_lag(enum lc3_dt dt, enum lc3_srate sr,
+    const struct lc3_plc_state *plc, const float *xh, const float *x)
+{
+    int nh = LC3_NH(dt, sr);
+    int ns = LC3_NS(dt, sr);
+    int lag = (plc->pitch + 2) >> 2;
+
+    if (plc->mode < LC3_PLC_MODE_PITCH_HQ)
+        return lag;
+
+    /* --- Search around the LTPF pitch, or on the whole range --- */
+
+    int khz = LC3_SRATE_KHZ(sr);
+    int lag_min = (5 * khz) / 2;
+    int lag_max = LC3_MIN((228*10 * khz + 64) / 128, nh - ns - 2*khz);
+
+    if (lag > 0) {
+        lag_min = LC3_MAX(lag_min, lag - khz/4);
+        lag_max = LC3_MIN(lag_max, lag + khz/4);
+    }
+
+    float r_max = lag > 0 ? 0.f : 0.6f;
+
+    for (int l = lag_min; l <= lag_max; l++) {
+        float r = correlate(xh, nh, x, l, LC3_MIN(ns/2, nh - ns - l));
+        if (r > r_max)
+            r_max = r, lag = l;
+    }
+
+    return lag;
+}
+
+/**
+ * Gain of the extension by period of repetition
+ * dt, sr          Duration and samplerate of the frame
+ * nlost           Number of consecutive frames lost, including current one
+ * lag             Period of repetition
+ * return          Gain to apply on each period
+ *
+ * The extension is held during 20 ms, then attenuated by 0.8 and 0.6
+ * per 10 ms, respectively up to, and after, 40 ms of loss.
+ */
+static float resolve_gain(
+    enum lc3_dt dt, enum lc3_srate sr, int nlost, int lag)
+{
+    int dt_us = nlost * LC3_DT_US(dt);
+
+    float a = dt_us <= 20000 ? 1.0f :
+              dt_us <= 40000 ? 0.8f : 0.6f;
+
+    return a < 1.0f ? powf(a, (float)lag / (10 * LC3_SRATE_KHZ(sr))) : a;
+}
+
+/**
+ * Periodic extension of the history, by repetition of the last period
+ * xh, nh          Ring buffer of decoded samples
+ * x, n            Samples of the frame in the ring buffer
+ * lag, a          Period of repetition, and gain applied on each period
+ * nf, fade        Crossfade of the `nf` first samples of the frame,
+ *                 1: Extension fades in  -1: Extension fades out
+ *
+ * After the crossfade, samples are replaced by the extension when it
+ * fades in, and left untouched when it fades out.
+ */
+LC3_HOT static void extend(const float *xh, int nh,
+    float *x, int n, int lag, float a, int nf, int fade)
+{
+    const float *y0 = ring_past(xh, nh, x, lag);
+    const float *y_end = xh + nh - 1;
+    const float *y = y0;
+
+    float g = a;
+    float w = fade > 0 ? 0.f : 1.f;
+    float w_incr = nf > 0 ? (float)fade / nf : 0.f;
+
+    if (fade < 0)
+        n = LC3_MIN(n, nf);
+
+    for (int i = 0, j = 0; i < n; i++) {
+        float v = g * *y;
+
+        if (i < nf) {
+            x[i] = w * v + (1 - w) * x[i];
+            w += w_incr;
+        } else
+            x[i] = v;
+
+        if (++j < lag) {
+            y = y < y_end ? y + 1 : xh;
+        } else {
+            y = y0, j = 0;
+            g *= a;
+        }
+    }
+}
+
+/**
+ * Time domain concealment of a frame
+ */
+void lc3_plc_conceal(enum lc3_dt dt, enum lc3_srate sr,
+    struct lc3_plc_state *plc, const float *xh, float *x)
+{
+    int nh = LC3_NH(dt, sr);
+    int ns = LC3_NS(dt, sr);
+    int nlost = plc->count - 1;
+
+    if (plc->mode == LC3_PLC_MODE_STANDARD)
+        return;
+
+    /* --- The lag is resolved once by burst of loss --- */
+
+    if (nlost <= 1)
+        plc->lag = resolve_lag(dt, sr, plc, xh, x);
+
+    if (plc->lag <= 0)
+        return;
+
+    /* --- Crossfade with the spectral concealment on entry --- */
+
+    extend(xh, nh, x, ns, plc->lag,
+        resolve_gain(dt, sr, nlost, plc->lag), nlost > 1 ? 0 : ns/8, 1);
+}
+
+/**
+ * Recovery of a time domain concealment
+ */
+void lc3_plc_recover(enum lc3_dt dt, enum lc3_srate sr,
+    struct lc3_plc_state *plc, int pitch, const float *xh, float *x)
+{
+    int nh = LC3_NH(dt, sr);
+    int ns = LC3_NS(dt, sr);
+    int nlost = plc->count - 1;
+
+    plc->pitch = pitch;
+
+    if (nlost <= 0 || plc->lag <= 0)
+        return;
+
+    /* --- Crossfade the extension with the decoded frame --- */
+
+    extend(xh, nh, x, ns, plc->lag,
+        resolve_gain(dt, sr, nlost + 1, plc->lag), ns/4, -1);
+}
@@ -0,0 +1,75 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if (__ARM_FEATURE_SIMD32 && !(__GNUC__ < 10) && \
+        !defined(LC3_NO_ARM_DSP) || defined(TEST_ARM))
+
+
+/**
+ * Import
+ */
+
+static float unquantize_gain(int);
+
+
+/**
+ * Spectrum quantization
+ * The quantized coefficients `xq` are assumed aligned on 32 bits
+ *
+ * A pair of coefficients is built in a core register, packed with PKHBT,
+ * and written with a single store. The significant count is updated from
+ * the packed pair. The result is bit-exact with the C version.
+ */
+#ifndef quantize
+
+LC3_HOT static void arm_quantize(enum lc3_dt dt, enum lc3_srate sr,
+    int g_int, float *x, uint16_t *xq, int *nq)
+{
+    float g_inv = 1 / unquantize_gain(g_int);
+    int ne = LC3_NE(dt, sr);
+
+    int16x2_t *xq2 = (int16x2_t *)xq;
+
+    *nq = ne;
+
+    for (int i = 0; i < ne; i += 2) {
+        int32_t x0, x1;
+        int16x2_t q;
+
+        x[i+0] *= g_inv;
+        x[i+1] *= g_inv;
+
+        x0 = fminf(fabsf(x[i+0]) + 6.f/16, INT16_MAX);
+        x1 = fminf(fabsf(x[i+1]) + 6.f/16, INT16_MAX);
+
+        x0 = (x0 << 1) + ((x0 > 0) & (x[i+0] < 0));
+        x1 = (x1 << 1) + ((x1 > 0) & (x[i+1] < 0));
+
+        *(xq2++) = q = __pkhbt(x0, (uint32_t)x1 << 16);
+
+        *nq = q ? ne : *nq - 2;
+    }
+}
+
+#ifndef TEST_ARM
+#define quantize arm_quantize
+#endif
+
+#endif /* quantize */
+
+#endif /* __ARM_FEATURE_SIMD32 */
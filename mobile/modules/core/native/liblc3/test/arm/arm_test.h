@@ -0,0 +1,83 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - Host tests of the ARM DSP extension kernels
+ *
+ * Each module is built with `TEST_ARM`, that compiles the `arm_` kernels
+ * beside the portable C versions, without substituting them. The kernels
+ * are checked bit-exact against the C versions, and timed against them.
+ * On the host the timings only reflect the data flow of the kernels, the
+ * intrinsics are emulated; the cycle counts are measured on the target.
+ */
+
+#ifndef __LC3_TEST_ARM_H
+#define __LC3_TEST_ARM_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+extern int failures;
+
+#define CHECK(cond, ...) do {                            \
+    if (!(cond)) {                                       \
+        fprintf(stderr, "%s:%d: ", __FILE__, __LINE__);  \
+        fprintf(stderr, __VA_ARGS__);                    \
+        fputc('\n', stderr);                             \
+        failures++;                                      \
+    } } while (0)
+
+#define ARRAY_SIZE(a) ( (int)(sizeof(a) / sizeof(*(a))) )
+
+/**
+ * Deterministic pseudo-random generator, and monotonic time in seconds
+ */
+
+static inline uint32_t xrand(uint32_t *s)
+{
+    *s = *s * 1664525 + 1013904223;
+    return *s >> 8;
+}
+
+static inline double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * Print the time of a kernel and its C version, per call
+ */
+
+static inline void report(const char *name, double t_c, double t_arm, int n)
+{
+    printf("  %-24s C %8.1f ns  ARM %8.1f ns  (x%.2f)\n",
+        name, t_c * 1e9 / n, t_arm * 1e9 / n, t_c / t_arm);
+}
+
+/**
+ * Checks of the modules
+ */
+
+void check_ltpf(void);
+void check_mdct(void);
+void check_spec(void);
+
+#endif /* __LC3_TEST_ARM_H */
@@ -0,0 +1,113 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "simd32.h"
+#include <ltpf.c>
+
+#include "arm_test.h"
+
+#define NBENCH 5000
+
+void check_ltpf(void)
+{
+    static const struct {
+        int sr_khz;
+        void (*c)(struct lc3_ltpf_hp50_state *,
+            const int16_t *, int16_t *, int);
+        void (*arm)(struct lc3_ltpf_hp50_state *,
+            const int16_t *, int16_t *, int);
+    } resamplers[] = {
+        {  8, resample_8k_12k8 , arm_resample_8k_12k8  },
+        { 16, resample_16k_12k8, arm_resample_16k_12k8 },
+        { 24, resample_24k_12k8, arm_resample_24k_12k8 },
+        { 32, resample_32k_12k8, arm_resample_32k_12k8 },
+        { 48, resample_48k_12k8, arm_resample_48k_12k8 },
+    };
+
+    enum { NH = 64, NS = 480, NY = 128 };
+
+    int16_t alignas(int32_t) buf[NH + NS];
+    int16_t y_c[NY], y_arm[NY];
+    float r_c[48], r_arm[48];
+    volatile float sink = 0;
+    uint32_t s = 1;
+
+    printf("ltpf\n");
+
+    for (int i = 0; i < NH + NS; i++)
+        buf[i] = (int16_t)xrand(&s);
+
+    /* --- Resampling to 12.8 KHz, 10 ms frames --- */
+
+    for (int ir = 0; ir < ARRAY_SIZE(resamplers); ir++) {
+        struct lc3_ltpf_hp50_state hp50_c = { 0 }, hp50_arm = { 0 };
+        const int16_t *x = buf + NH;
+
+        for (int k = 0; k < 4; k++) {
+            resamplers[ir].c(&hp50_c, x, y_c, NY);
+            resamplers[ir].arm(&hp50_arm, x, y_arm, NY);
+
+            CHECK(memcmp(y_c, y_arm, sizeof(y_c)) == 0 &&
+                  hp50_c.s1 == hp50_arm.s1 && hp50_c.s2 == hp50_arm.s2,
+                  "resample %d KHz, frame %d", resamplers[ir].sr_khz, k);
+        }
+
+        double t = now_s();
+        for (int k = 0; k < NBENCH; k++)
+            resamplers[ir].c(&hp50_c, x, y_c, NY), sink += y_c[0];
+        double t_c = now_s() - t;
+
+        t = now_s();
+        for (int k = 0; k < NBENCH; k++)
+            resamplers[ir].arm(&hp50_arm, x, y_arm, NY), sink += y_arm[0];
+        double t_arm = now_s() - t;
+
+        char name[32];
+        snprintf(name, sizeof(name), "resample %d KHz", resamplers[ir].sr_khz);
+        report(name, t_c, t_arm, NBENCH);
+    }
+
+    /* --- Correlation, on aligned and unaligned lags --- */
+
+    const int16_t *a = buf + NH + NS - 128;
+
+    for (int r0 = 16; r0 < 24; r0++)
+        for (int nc = 1; nc <= ARRAY_SIZE(r_c); nc += 7) {
+            correlate(a, a - r0, 128, r_c, nc);
+            arm_correlate(a, a - r0, 128, r_arm, nc);
+
+            CHECK(memcmp(r_c, r_arm, nc * sizeof(*r_c)) == 0,
+                  "correlate lag %d, %d values", r0, nc);
+        }
+
+    double t = now_s();
+    for (int k = 0; k < NBENCH; k++)
+        correlate(a, a - 17, 128, r_c, 43), sink += r_c[0];
+    double t_c = now_s() - t;
+
+    t = now_s();
+    for (int k = 0; k < NBENCH; k++)
+        arm_correlate(a, a - 17, 128, r_arm, 43), sink += r_arm[0];
+    double t_arm = now_s() - t;
+
+    report("correlate 43 lags", t_c, t_arm, NBENCH);
+
+    (void)sink;
+}
@@ -0,0 +1,103 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "simd32.h"
+#include <mdct.c>
+
+#include "arm_test.h"
+
+#define NBENCH 5000
+
+static void random_complex(uint32_t *s, struct lc3_complex *x, int n)
+{
+    for (int i = 0; i < n; i++) {
+        x[i].re = (float)((int32_t)xrand(s) - (1 << 23)) / (1 << 8);
+        x[i].im = (float)((int32_t)xrand(s) - (1 << 23)) / (1 << 8);
+    }
+}
+
+/**
+ * Two radix-2 stages, as applied by `fft()` with the C butterflies
+ */
+static void fft_bf2_twice(
+    const struct lc3_fft_bf2_twiddles *t0,
+    const struct lc3_fft_bf2_twiddles *t1,
+    const struct lc3_complex *x, struct lc3_complex *y, int n)
+{
+    struct lc3_complex z[LC3_MAX_NS / 2];
+
+    fft_bf2(t0, x, z, 2*n);
+    fft_bf2(t1, z, y, n);
+}
+
+void check_mdct(void)
+{
+    static const int max_points = LC3_MAX_NS / 2;
+    struct lc3_complex x[LC3_MAX_NS / 2];
+    struct lc3_complex y_c[LC3_MAX_NS / 2], y_arm[LC3_MAX_NS / 2];
+    volatile float sink = 0;
+    uint32_t s = 1;
+
+    printf("mdct\n");
+
+    /* The radix-2 stages are listed up to 160 points, 5 stages */
+
+    for (int i3 = 0; i3 < 3; i3++)
+        for (int i2 = 0; i2 + 1 < 5; i2++) {
+            const struct lc3_fft_bf2_twiddles *t0 = lc3_fft_twiddles_bf2[i2][i3];
+            const struct lc3_fft_bf2_twiddles *t1 = lc3_fft_twiddles_bf2[i2+1][i3];
+            if (!t0 || !t1)
+                continue;
+
+            /* --- Bit-exactness, up to the largest transform --- */
+
+            for (int n = 1; 4 * t0->n2 * n <= max_points; n *= 2) {
+                for (int k = 0; k < 16; k++) {
+                    random_complex(&s, x, 4 * t0->n2 * n);
+
+                    fft_bf2_twice(t0, t1, x, y_c, n);
+                    arm_fft_bf2x2(t0, t1, x, y_arm, n);
+
+                    CHECK(memcmp(y_c, y_arm,
+                        4 * t0->n2 * n * sizeof(*y_c)) == 0,
+                        "fft_bf2x2 %d points, %d transforms",
+                        4 * t0->n2, n);
+                }
+            }
+
+            /* --- Timing, on a single transform --- */
+
+            double t = now_s();
+            for (int k = 0; k < NBENCH; k++)
+                fft_bf2_twice(t0, t1, x, y_c, 1), sink += y_c[0].re;
+            double t_c = now_s() - t;
+
+            t = now_s();
+            for (int k = 0; k < NBENCH; k++)
+                arm_fft_bf2x2(t0, t1, x, y_arm, 1), sink += y_arm[0].re;
+            double t_arm = now_s() - t;
+
+            char name[32];
+            snprintf(name, sizeof(name), "fft_bf2x2 %d points", 4 * t0->n2);
+            report(name, t_c, t_arm, NBENCH);
+        }
+
+    (void)sink;
+}
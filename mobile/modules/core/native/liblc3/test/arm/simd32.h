@@ -0,0 +1,65 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - Host emulation of the ARMv7 / ARMv8-M DSP extension intrinsics
+ *
+ * Used with `TEST_ARM` to build the `*_arm.h` kernels on the host, as
+ * defined by ACLE on a little-endian core. The Q flag is not emulated.
+ */
+
+#ifndef __LC3_TEST_SIMD32_H
+#define __LC3_TEST_SIMD32_H
+
+#include <stdint.h>
+
+typedef int32_t int16x2_t;
+
+#define __lo16(v)  ( (int32_t)(int16_t)(v) )
+#define __hi16(v)  ( (int32_t)(v) >> 16 )
+
+/**
+ * Dual 16-bit signed multiply, with 32 and 64 bits accumulation
+ */
+
+static inline int32_t __smlad(int16x2_t a, int16x2_t b, int32_t u)
+{
+    return (int32_t)((uint32_t)u +
+        (uint32_t)(__lo16(a) * __lo16(b)) + (uint32_t)(__hi16(a) * __hi16(b)));
+}
+
+static inline int64_t __smlald(int16x2_t a, int16x2_t b, int64_t u)
+{
+    return u + __lo16(a) * __lo16(b) + __hi16(a) * __hi16(b);
+}
+
+static inline int64_t __smlaldx(int16x2_t a, int16x2_t b, int64_t u)
+{
+    return u + __lo16(a) * __hi16(b) + __hi16(a) * __lo16(b);
+}
+
+/**
+ * Pack halfwords, bottom of `a` and top of `b`
+ */
+
+static inline int16x2_t __pkhbt(int16x2_t a, int16x2_t b)
+{
+    return (int16x2_t)(((uint32_t)a & 0xffff) | ((uint32_t)b & 0xffff0000));
+}
+
+#endif /* __LC3_TEST_SIMD32_H */
@@ -0,0 +1,91 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "simd32.h"
+#include <spec.c>
+
+#include "arm_test.h"
+
+#define NBENCH 5000
+
+void check_spec(void)
+{
+    static const enum lc3_dt dt_list[] = { LC3_DT_7M5, LC3_DT_10M };
+    static const int g_list[] = { -50, 0, 20, 40, 80, 120, 180 };
+
+    float x[LC3_MAX_NE], x_c[LC3_MAX_NE], x_arm[LC3_MAX_NE];
+    uint16_t alignas(int32_t) xq_c[LC3_MAX_NE];
+    uint16_t alignas(int32_t) xq_arm[LC3_MAX_NE];
+    volatile int sink = 0;
+    uint32_t s = 1;
+
+    printf("spec\n");
+
+    for (int idt = 0; idt < ARRAY_SIZE(dt_list); idt++)
+        for (enum lc3_srate sr = LC3_SRATE_8K; sr <= LC3_SRATE_48K; sr++) {
+            enum lc3_dt dt = dt_list[idt];
+            int ne = LC3_NE(dt, sr);
+
+            /* --- Bit-exactness, with a band-limited tail of zeros,
+             *     saturated and vanishing coefficients --- */
+
+            for (int ig = 0; ig < ARRAY_SIZE(g_list); ig++)
+                for (int k = 0; k < 8; k++) {
+                    int nz = ne - (ne >> (k % 4));
+                    int nq_c, nq_arm;
+
+                    for (int i = 0; i < ne; i++)
+                        x[i] = i >= nz ? 0 : (float)((int32_t)xrand(&s)
+                            - (1 << 23)) / (1 << (k < 4 ? 2 : 12));
+
+                    memcpy(x_c, x, ne * sizeof(*x));
+                    memcpy(x_arm, x, ne * sizeof(*x));
+
+                    quantize(dt, sr, g_list[ig], x_c, xq_c, &nq_c);
+                    arm_quantize(dt, sr, g_list[ig], x_arm, xq_arm, &nq_arm);
+
+                    CHECK(nq_c == nq_arm &&
+                          memcmp(xq_c, xq_arm, ne * sizeof(*xq_c)) == 0 &&
+                          memcmp(x_c, x_arm, ne * sizeof(*x_c)) == 0,
+                          "quantize dt %d sr %d g %d", dt, sr, g_list[ig]);
+                }
+
+            /* --- Timing --- */
+
+            int nq;
+
+            double t = now_s();
+            for (int k = 0; k < NBENCH; k++)
+                quantize(dt, sr, 0, x, xq_c, &nq), sink += nq;
+            double t_c = now_s() - t;
+
+            t = now_s();
+            for (int k = 0; k < NBENCH; k++)
+                arm_quantize(dt, sr, 0, x, xq_arm, &nq), sink += nq;
+            double t_arm = now_s() - t;
+
+            char name[32];
+            snprintf(name, sizeof(name), "quantize %d us %d KHz",
+                LC3_DT_US(dt), LC3_SRATE_KHZ(sr));
+            report(name, t_c, t_arm, NBENCH);
+        }
+
+    (void)sink;
+}
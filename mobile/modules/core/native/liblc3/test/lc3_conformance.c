@@ -0,0 +1,464 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - Conformance, regression and throughput checks
+ *
+ * The golden fixtures hold, for each frame duration, samplerate and a
+ * low / medium / high frame size, the bitstream produced from a
+ * deterministic test signal, the digest of its decoding and its SNR :
+ *
+ * - `golden.txt`  dt_us sr_hz nbytes nframes bitstream_fnv pcm_fnv snr_db
+ * - `golden.bin`  The bitstreams, concatenated in the order of the list
+ *
+ * The checks :
+ *
+ * - The golden bitstreams are decoded, and the own encoding of the
+ *   test signal is decoded, both within 0.5 dB of the golden SNR.
+ * - With `--bitexact`, the encoding and decoding must match the golden
+ *   fixtures bit to bit. The fixtures come from the portable C backend,
+ *   other backends and FPU contraction modes only meet the SNR bounds.
+ *
+ * Usage :
+ *   lc3_conformance [--bitexact] <golden.txt> <golden.bin>
+ *   lc3_conformance --generate <golden.txt> <golden.bin>
+ *   lc3_conformance --bench <min realtime factor> [<baseline> [<tolerance %>]]
+ *   lc3_conformance --bench-save <baseline>
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include <lc3.h>
+
+#define NFRAMES     20
+#define SNR_MARGIN  0.5
+
+
+/* ----------------------------------------------------------------------------
+ *  Test signal and measures
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Integer only sine approximation (Bhaskara), of a 16 bits phase
+ * Computed without the math library, the signal is identical on
+ * every platform.
+ */
+static int isin(unsigned phase)
+{
+    int x = phase & 0x7fff, s = phase & 0x8000 ? -1 : 1;
+    int64_t p = (int64_t)x * (0x8000 - x);
+
+    return s * (int)((p * 16 * 32767) / ((5LL << 30) - 4 * p));
+}
+
+/**
+ * Deterministic test signal, two gliding tones and a noise floor
+ */
+static void generate(int16_t *x, int n, int sr_hz)
+{
+    unsigned p0 = 0, p1 = 0, seed = 1;
+
+    for (int i = 0; i < n; i++) {
+        int f0 =  300 + (  400 * i) / n;
+        int f1 = 1800 - (  900 * i) / n;
+
+        p0 += (f0 << 16) / sr_hz;
+        p1 += (f1 << 16) / sr_hz;
+        seed = seed * 1103515245u + 12345u;
+
+        x[i] = (int16_t)( (isin(p0) >> 2) + (isin(p1) >> 3) +
+                          ((int)((seed >> 16) & 0x3ff) - 0x200) );
+    }
+}
+
+/**
+ * FNV-1a 64 bits digest
+ */
+static uint64_t fnv(uint64_t h, const void *data, size_t size)
+{
+    const uint8_t *p = data;
+
+    while (size--)
+        h = (h ^ *(p++)) * 0x100000001b3ull;
+
+    return h;
+}
+
+#define FNV_INIT  0xcbf29ce484222325ull
+
+static uint64_t pcm_digest(const int16_t *x, int n)
+{
+    uint64_t h = FNV_INIT;
+
+    for (int i = 0; i < n; i++) {
+        uint8_t b[2] = { x[i] & 0xff, (x[i] >> 8) & 0xff };
+        h = fnv(h, b, 2);
+    }
+
+    return h;
+}
+
+/**
+ * SNR in dB of the decoded signal `y`, compensated in delay
+ * The first two frames, warming up the codec, are not considered
+ */
+static double snr(int dt_us, int sr_hz, const int16_t *x, const int16_t *y, int n)
+{
+    int ns = lc3_frame_samples(dt_us, sr_hz);
+    int nd = lc3_delay_samples(dt_us, sr_hz);
+    double es = 0, ee = 0;
+
+    for (int i = 2*ns; i < n - nd; i++) {
+        double d = x[i] - y[i + nd];
+        es += (double)x[i] * x[i], ee += d * d;
+    }
+
+    return 10 * log10((es + 1) / (ee + 1));
+}
+
+
+/* ----------------------------------------------------------------------------
+ *  Configurations
+ * -------------------------------------------------------------------------- */
+
+struct config {
+    int dt_us, sr_hz, nbytes;
+};
+
+/**
+ * Enumerate the configurations, for each frame duration and samplerate :
+ * lowest and highest frame sizes, and the one at 64 Kbps
+ * Return the number of configurations
+ */
+static int enumerate(struct config *configs)
+{
+    static const int dt_list[] = { 7500, 10000 };
+    static const int sr_list[] = { 8000, 16000, 24000, 32000, 48000 };
+    int n = 0;
+
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 5; j++) {
+            int dt_us = dt_list[i], sr_hz = sr_list[j];
+            int max_bytes = (LC3_MAX_BITRATE / 8) * dt_us / 1000000;
+            int sizes[] = {
+                LC3_MIN_FRAME_BYTES, (64000 / 8) * dt_us / 1000000,
+                max_bytes < LC3_MAX_FRAME_BYTES ? max_bytes : LC3_MAX_FRAME_BYTES
+            };
+
+            for (int k = 0; k < 3; k++)
+                configs[n++] = (struct config){ dt_us, sr_hz, sizes[k] };
+        }
+
+    return n;
+}
+
+/**
+ * Encode and decode `nf` frames of `x` for a configuration
+ * The bitstream `b` is decoded when `encode` is false
+ */
+static void run(const struct config *c, bool encode,
+    const int16_t *x, uint8_t *b, int16_t *y, int nf)
+{
+    int ns = lc3_frame_samples(c->dt_us, c->sr_hz);
+
+    lc3_encoder_mem_48k_t enc_mem;
+    lc3_decoder_mem_48k_t dec_mem;
+
+    lc3_encoder_t enc = lc3_setup_encoder(c->dt_us, c->sr_hz, 0, &enc_mem);
+    lc3_decoder_t dec = lc3_setup_decoder(c->dt_us, c->sr_hz, 0, &dec_mem);
+
+    for (int i = 0; i < nf; i++) {
+        if (encode)
+            lc3_encode(enc, LC3_PCM_FORMAT_S16,
+                x + i*ns, 1, c->nbytes, b + i*c->nbytes);
+
+        lc3_decode(dec, b + i*c->nbytes, c->nbytes,
+            LC3_PCM_FORMAT_S16, y + i*ns, 1);
+    }
+}
+
+
+/* ----------------------------------------------------------------------------
+ *  Golden fixtures
+ * -------------------------------------------------------------------------- */
+
+static int generate_golden(const char *txt_path, const char *bin_path)
+{
+    struct config configs[32];
+    int nc = enumerate(configs);
+
+    FILE *ftxt = fopen(txt_path, "w");
+    FILE *fbin = fopen(bin_path, "wb");
+    if (!ftxt || !fbin) {
+        fprintf(stderr, "Cannot create golden files\n");
+        return 1;
+    }
+
+    fprintf(ftxt,
+        "# LC3 golden fixtures, generated by `lc3_conformance --generate`\n"
+        "# dt_us sr_hz nbytes nframes bitstream_fnv pcm_fnv snr_db\n");
+
+    for (int i = 0; i < nc; i++) {
+        const struct config *c = &configs[i];
+        int n = NFRAMES * lc3_frame_samples(c->dt_us, c->sr_hz);
+
+        int16_t x[NFRAMES * LC3_MAX_FRAME_SAMPLES];
+        int16_t y[NFRAMES * LC3_MAX_FRAME_SAMPLES];
+        uint8_t b[NFRAMES * LC3_MAX_FRAME_BYTES];
+
+        generate(x, n, c->sr_hz);
+        run(c, true, x, b, y, NFRAMES);
+
+        fwrite(b, c->nbytes, NFRAMES, fbin);
+        fprintf(ftxt, "%5d %5d %3d %d %016llx %016llx %.2f\n",
+            c->dt_us, c->sr_hz, c->nbytes, NFRAMES,
+            (unsigned long long)fnv(FNV_INIT, b, NFRAMES * c->nbytes),
+            (unsigned long long)pcm_digest(y, n),
+            snr(c->dt_us, c->sr_hz, x, y, n));
+    }
+
+    fclose(ftxt);
+    fclose(fbin);
+
+    return 0;
+}
+
+static int check_golden(const char *txt_path, const char *bin_path, bool bitexact)
+{
+    FILE *ftxt = fopen(txt_path, "r");
+    FILE *fbin = fopen(bin_path, "rb");
+    if (!ftxt || !fbin) {
+        fprintf(stderr, "Cannot open golden files\n");
+        return 1;
+    }
+
+    char line[256];
+    int nchecked = 0, nfailed = 0;
+
+    while (fgets(line, sizeof(line), ftxt)) {
+        struct config c;
+        unsigned long long b_fnv, y_fnv;
+        int nf;
+        double g_snr;
+
+        if (line[0] == '#')
+            continue;
+
+        if (sscanf(line, "%d %d %d %d %llx %llx %lf", &c.dt_us, &c.sr_hz,
+                &c.nbytes, &nf, &b_fnv, &y_fnv, &g_snr) != 7 ||
+                nf > NFRAMES || lc3_frame_samples(c.dt_us, c.sr_hz) < 0 ||
+                c.nbytes < LC3_MIN_FRAME_BYTES ||
+                c.nbytes > LC3_MAX_FRAME_BYTES) {
+            fprintf(stderr, "Malformed golden line: %s", line);
+            return 1;
+        }
+
+        int n = nf * lc3_frame_samples(c.dt_us, c.sr_hz);
+
+        int16_t x[NFRAMES * LC3_MAX_FRAME_SAMPLES];
+        int16_t y[NFRAMES * LC3_MAX_FRAME_SAMPLES];
+        uint8_t g[NFRAMES * LC3_MAX_FRAME_BYTES];
+        uint8_t b[NFRAMES * LC3_MAX_FRAME_BYTES];
+
+        if (fread(g, c.nbytes, nf, fbin) != (size_t)nf ||
+                fnv(FNV_INIT, g, nf * c.nbytes) != b_fnv) {
+            fprintf(stderr, "Corrupted golden bitstream (%d us, %d Hz, %d)\n",
+                c.dt_us, c.sr_hz, c.nbytes);
+            return 1;
+        }
+
+        generate(x, n, c.sr_hz);
+
+        /* Decoding of the golden bitstream */
+
+        run(&c, false, x, g, y, nf);
+
+        double d_snr = snr(c.dt_us, c.sr_hz, x, y, n);
+        bool ok = d_snr >= g_snr - SNR_MARGIN;
+        ok = ok && (!bitexact || pcm_digest(y, n) == y_fnv);
+
+        /* Encoding, then decoding, of the test signal */
+
+        run(&c, true, x, b, y, nf);
+
+        double e_snr = snr(c.dt_us, c.sr_hz, x, y, n);
+        ok = ok && e_snr >= g_snr - SNR_MARGIN;
+        ok = ok && (!bitexact || memcmp(b, g, nf * c.nbytes) == 0);
+
+        printf("%5d us %5d Hz %3d bytes  SNR %6.2f dB  "
+               "decoding %6.2f dB  encoding %6.2f dB  %s\n",
+            c.dt_us, c.sr_hz, c.nbytes, g_snr, d_snr, e_snr,
+            ok ? "OK" : "FAILED");
+
+        nchecked++, nfailed += !ok;
+    }
+
+    fclose(ftxt);
+    fclose(fbin);
+
+    printf("%d configurations checked%s, %d failed\n",
+        nchecked, bitexact ? " bit-exact" : "", nfailed);
+
+    return nchecked > 0 && nfailed == 0 ? 0 : 1;
+}
+
+
+/* ----------------------------------------------------------------------------
+ *  Throughput
+ * -------------------------------------------------------------------------- */
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * Realtime factor of encoding then decoding a configuration
+ * The measure is the best of a few runs, of about 100 ms each
+ */
+static double bench(const struct config *c)
+{
+    int ns = lc3_frame_samples(c->dt_us, c->sr_hz);
+    int n = NFRAMES * ns;
+
+    int16_t x[NFRAMES * LC3_MAX_FRAME_SAMPLES];
+    int16_t y[NFRAMES * LC3_MAX_FRAME_SAMPLES];
+    uint8_t b[NFRAMES * LC3_MAX_FRAME_BYTES];
+
+    generate(x, n, c->sr_hz);
+
+    double best = 0;
+
+    for (int k = 0; k < 5; k++) {
+        double t0 = now_s(), t;
+        int nf = 0;
+
+        do {
+            run(c, true, x, b, y, NFRAMES);
+            nf += NFRAMES;
+        } while ((t = now_s() - t0) < 0.1);
+
+        double rt = (nf * c->dt_us * 1e-6) / t;
+        best = rt > best ? rt : best;
+    }
+
+    return best;
+}
+
+static const struct config bench_configs[] = {
+    { 10000, 16000, 20 }, { 10000, 16000, 40 },
+    { 10000, 48000, 80 }, {  7500, 48000, 60 },
+};
+
+#define NUM_BENCH_CONFIGS \
+    (int)(sizeof(bench_configs) / sizeof(*bench_configs))
+
+static int run_bench(double min_rt, const char *baseline_path, double tolerance)
+{
+    double baseline[NUM_BENCH_CONFIGS] = { 0 };
+    int nfailed = 0;
+
+    FILE *f = baseline_path ? fopen(baseline_path, "r") : NULL;
+    for (int i = 0; f && i < NUM_BENCH_CONFIGS; i++)
+        if (fscanf(f, "%*d %*d %*d %lf", &baseline[i]) != 1)
+            baseline[i] = 0;
+    if (f)
+        fclose(f);
+
+    for (int i = 0; i < NUM_BENCH_CONFIGS; i++) {
+        const struct config *c = &bench_configs[i];
+
+        double rt = bench(c);
+        double floor = min_rt;
+        if (baseline[i] * (1 - tolerance) > floor)
+            floor = baseline[i] * (1 - tolerance);
+
+        bool ok = rt >= floor;
+        printf("%5d us %5d Hz %3d bytes  %8.1fx realtime  (min %.1fx)  %s\n",
+            c->dt_us, c->sr_hz, c->nbytes, rt, floor, ok ? "OK" : "REGRESSED");
+
+        nfailed += !ok;
+    }
+
+    return nfailed ? 1 : 0;
+}
+
+static int save_bench(const char *baseline_path)
+{
+    FILE *f = fopen(baseline_path, "w");
+    if (!f) {
+        fprintf(stderr, "Cannot create `%s`\n", baseline_path);
+        return 1;
+    }
+
+    for (int i = 0; i < NUM_BENCH_CONFIGS; i++) {
+        const struct config *c = &bench_configs[i];
+        fprintf(f, "%d %d %d %.1f\n", c->dt_us, c->sr_hz, c->nbytes, bench(c));
+    }
+
+    fclose(f);
+
+    return 0;
+}
+
+
+/* ----------------------------------------------------------------------------
+ *  Entry point
+ * -------------------------------------------------------------------------- */
+
+static int usage(const char *name)
+{
+    fprintf(stderr,
+        "Usage :\n"
+        "  %s [--bitexact] <golden.txt> <golden.bin>\n"
+        "  %s --generate <golden.txt> <golden.bin>\n"
+        "  %s --bench <min realtime factor> [<baseline> [<tolerance %%>]]\n"
+        "  %s --bench-save <baseline>\n",
+        name, name, name, name);
+
+    return 2;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc == 4 && strcmp(argv[1], "--generate") == 0)
+        return generate_golden(argv[2], argv[3]);
+
+    if (argc >= 3 && argc <= 5 && strcmp(argv[1], "--bench") == 0)
+        return run_bench(atof(argv[2]),
+            argc > 3 ? argv[3] : NULL, argc > 4 ? atof(argv[4]) / 100 : 0.2);
+
+    if (argc == 3 && strcmp(argv[1], "--bench-save") == 0)
+        return save_bench(argv[2]);
+
+    if (argc == 4 && strcmp(argv[1], "--bitexact") == 0)
+        return check_golden(argv[2], argv[3], true);
+
+    if (argc == 3 && argv[1][0] != '-')
+        return check_golden(argv[1], argv[2], false);
+
+    return usage(argv[0]);
+}
@@ -0,0 +1,225 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - Host tests of the codec core
+ *
+ * - Encoding / decoding round trip, for each frame duration and samplerate
+ * - Frame checking, on valid, corrupted and malformed frames
+ * - Packet loss concealment, for each mode
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <lc3.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static int failures;
+
+#define CHECK(cond, ...) do {                            \
+    if (!(cond)) {                                       \
+        fprintf(stderr, "%s:%d: ", __FILE__, __LINE__);  \
+        fprintf(stderr, __VA_ARGS__);                    \
+        fputc('\n', stderr);                             \
+        failures++;                                      \
+    } } while (0)
+
+
+static const int dt_list[] = { 7500, 10000 };
+static const int sr_list[] = { 8000, 16000, 24000, 32000, 48000 };
+
+#define ARRAY_SIZE(a) ( (int)(sizeof(a) / sizeof(*(a))) )
+
+
+/**
+ * Two tones test signal, below 4 KHz
+ */
+static void generate(int16_t *x, int n, int sr_hz)
+{
+    for (int i = 0; i < n; i++)
+        x[i] = (int16_t)(
+            6000 * sin(2 * M_PI *  440 * i / sr_hz) +
+            3000 * sin(2 * M_PI * 1250 * i / sr_hz) );
+}
+
+/**
+ * Encode then decode `nf` frames of the test signal
+ * Return the SNR in dB, of the decoded signal compensated in delay
+ */
+static double roundtrip(int dt_us, int sr_hz, int nbytes, int nf)
+{
+    int ns = lc3_frame_samples(dt_us, sr_hz);
+    int nd = lc3_delay_samples(dt_us, sr_hz);
+
+    int16_t *x = calloc(nf * ns, sizeof(*x));
+    int16_t *y = calloc(nf * ns, sizeof(*y));
+    uint8_t *frame = malloc(nbytes);
+
+    void *enc_mem = malloc(lc3_encoder_size(dt_us, sr_hz));
+    void *dec_mem = malloc(lc3_decoder_size(dt_us, sr_hz));
+
+    lc3_encoder_t enc = lc3_setup_encoder(dt_us, sr_hz, 0, enc_mem);
+    lc3_decoder_t dec = lc3_setup_decoder(dt_us, sr_hz, 0, dec_mem);
+
+    generate(x, nf * ns, sr_hz);
+
+    for (int i = 0; i < nf; i++) {
+        CHECK(lc3_encode(enc, LC3_PCM_FORMAT_S16,
+            x + i*ns, 1, nbytes, frame) == 0, "encode failed");
+
+        CHECK(lc3_decode(dec, frame, nbytes,
+            LC3_PCM_FORMAT_S16, y + i*ns, 1) == 0, "decode failed");
+    }
+
+    double es = 0, ee = 0;
+    for (int i = 4*ns; i < nf*ns - nd; i++) {
+        double d = x[i] - y[i + nd];
+        es += (double)x[i] * x[i], ee += d * d;
+    }
+
+    free(x); free(y); free(frame);
+    free(enc_mem); free(dec_mem);
+
+    return 10 * log10((es + 1) / (ee + 1));
+}
+
+static void test_roundtrip(void)
+{
+    for (int i = 0; i < ARRAY_SIZE(dt_list); i++)
+        for (int j = 0; j < ARRAY_SIZE(sr_list); j++) {
+            int dt_us = dt_list[i], sr_hz = sr_list[j];
+            int nbytes = (64000 * dt_us) / (8 * 1000000);
+
+            double snr = roundtrip(dt_us, sr_hz, nbytes, 100);
+            CHECK(snr > 15, "%d us, %d Hz: SNR %.1f dB", dt_us, sr_hz, snr);
+        }
+}
+
+/**
+ * Frame checking, and concealment of the rejected frames
+ */
+static void test_check_frame(void)
+{
+    const int dt_us = 10000, sr_hz = 16000, nbytes = 40;
+    int ns = lc3_frame_samples(dt_us, sr_hz);
+
+    int16_t x[LC3_MAX_FRAME_SAMPLES];
+    uint8_t frame[LC3_MAX_FRAME_BYTES];
+
+    lc3_encoder_mem_16k_t enc_mem;
+    lc3_decoder_mem_16k_t dec_mem;
+
+    lc3_encoder_t enc = lc3_setup_encoder(dt_us, sr_hz, 0, &enc_mem);
+    lc3_decoder_t dec = lc3_setup_decoder(dt_us, sr_hz, 0, &dec_mem);
+
+    generate(x, ns, sr_hz);
+    lc3_encode(enc, LC3_PCM_FORMAT_S16, x, 1, nbytes, frame);
+
+    CHECK(lc3_check_frame(dec, frame, nbytes) == 0, "valid frame rejected");
+    CHECK(lc3_check_frame(dec, NULL, nbytes) < 0, "NULL frame accepted");
+    CHECK(lc3_check_frame(NULL, frame, nbytes) < 0, "NULL decoder accepted");
+    CHECK(lc3_check_frame(dec, frame, LC3_MIN_FRAME_BYTES - 1) == 1,
+        "undersized frame accepted");
+    CHECK(lc3_check_frame(dec, frame, LC3_MAX_FRAME_BYTES + 1) == 1,
+        "oversized frame accepted");
+
+    /* Checking does not alter the decoder state, and a frame rejected
+     * is also rejected by decoding (the spectral data, not checked,
+     * can still fail decoding) */
+
+    unsigned seed = 1;
+    int nrejected = 0;
+
+    for (int i = 0; i < 1000; i++) {
+        for (int j = 0; j < nbytes; j++)
+            frame[j] = (seed = seed * 1103515245u + 12345u) >> 16;
+
+        int check = lc3_check_frame(dec, frame, nbytes);
+        int ret = lc3_decode(dec, frame, nbytes, LC3_PCM_FORMAT_S16, x, 1);
+
+        CHECK(check == 0 || check == 1, "unexpected check result %d", check);
+        CHECK(!check || ret == 1, "rejected frame decoded");
+        nrejected += check;
+    }
+
+    CHECK(nrejected > 0, "no random frame rejected");
+}
+
+/**
+ * Concealment runs, and fades out, in every mode
+ */
+static void test_plc(void)
+{
+    const int dt_us = 10000, sr_hz = 16000, nbytes = 20, nf = 50;
+    int ns = lc3_frame_samples(dt_us, sr_hz);
+
+    int16_t x[LC3_MAX_FRAME_SAMPLES];
+    uint8_t frame[LC3_MAX_FRAME_BYTES];
+
+    lc3_encoder_mem_16k_t enc_mem;
+    lc3_decoder_mem_16k_t dec_mem;
+
+    for (int mode = LC3_PLC_MODE_STANDARD;
+            mode <= LC3_PLC_MODE_PITCH_HQ; mode++) {
+
+        lc3_encoder_t enc = lc3_setup_encoder(dt_us, sr_hz, 0, &enc_mem);
+        lc3_decoder_t dec = lc3_setup_decoder(dt_us, sr_hz, 0, &dec_mem);
+
+        CHECK(lc3_decoder_set_plc_mode(dec, mode) == 0,
+            "mode %d not accepted", mode);
+
+        for (int i = 0; i < nf; i++) {
+            generate(x, ns, sr_hz);
+            lc3_encode(enc, LC3_PCM_FORMAT_S16, x, 1, nbytes, frame);
+            lc3_decode(dec, frame, nbytes, LC3_PCM_FORMAT_S16, x, 1);
+        }
+
+        for (int i = 0; i < nf; i++)
+            CHECK(lc3_decode(dec, NULL, nbytes,
+                LC3_PCM_FORMAT_S16, x, 1) == 1, "frame not concealed");
+
+        int peak = 0;
+        for (int j = 0; j < ns; j++)
+            peak = abs(x[j]) > peak ? abs(x[j]) : peak;
+
+        CHECK(peak < 100, "mode %d: no fade out (%d)", mode, peak);
+    }
+
+    lc3_decoder_t dec = lc3_setup_decoder(dt_us, sr_hz, 0, &dec_mem);
+    CHECK(lc3_decoder_set_plc_mode(dec, -1) < 0, "bad mode accepted");
+    CHECK(lc3_decoder_set_plc_mode(NULL, 0) < 0, "NULL decoder accepted");
+}
+
+int main(void)
+{
+    test_roundtrip();
+    test_check_frame();
+    test_plc();
+
+    printf("liblc3 %d.%d.%d: %s\n",
+        LC3_VERSION_MAJOR, LC3_VERSION_MINOR, LC3_VERSION_PATCH,
+        failures ? "FAILED" : "OK");
+
+    return failures ? 1 : 0;
+}
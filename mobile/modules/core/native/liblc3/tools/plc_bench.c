@@ -0,0 +1,263 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - Packet Loss Concealment benchmark
+ *
+ * Encodes a synthetic speech like signal, then decodes it under random
+ * and bursty (Gilbert-Elliott) frame losses, for each PLC mode.
+ * The concealed frames, and the ones following a loss, are compared
+ * to a loss-free decoding :
+ *
+ * - SNR   Segmental SNR, in dB (waveform match, penalizes phase drifts)
+ * - LSD   Log-Spectral Distance, in dB (phase insensitive)
+ * - CPU   Average decoding time by frame, in us
+ *
+ * Built on host, with the `plc_bench` target of the library.
+ *
+ * Usage : plc_bench [frame bytes (20)] [samplerate (16000)] [dt us (10000)]
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include <lc3.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define DURATION_S  20
+#define NFFT        512
+
+
+/**
+ * Deterministic pseudo-random generator, uniform in [0, 1[
+ */
+static float frand(unsigned *seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return (float)((*seed >> 8) & 0xffffff) / (1 << 24);
+}
+
+/**
+ * Generate a speech like signal : syllables of gliding harmonic
+ * voiced sounds, separated by fricatives like noise and silences
+ */
+static void generate(int16_t *x, int n, int sr_hz)
+{
+    unsigned seed = 1;
+    float phase = 0;
+
+    for (int i = 0; i < n; ) {
+
+        int nv = (int)((0.12f + 0.25f * frand(&seed)) * sr_hz);
+        int nu = (int)((0.03f + 0.06f * frand(&seed)) * sr_hz);
+        int nz = (int)((0.02f + 0.10f * frand(&seed)) * sr_hz);
+
+        float f0 = 90 + 140 * frand(&seed);
+        float df0 = (frand(&seed) - 0.5f) * 80 / nv;
+        float amp = 2000 + 6000 * frand(&seed);
+
+        for (int j = 0; j < nv && i < n; j++, i++) {
+            float f = f0 + df0 * j, v = 0;
+            float env = sinf((float)M_PI * j / nv);
+
+            phase += 2 * (float)M_PI * f / sr_hz;
+            if (phase > 2 * (float)M_PI)
+                phase -= 2 * (float)M_PI;
+
+            for (int k = 1; k * f < 0.45f * sr_hz && k <= 40; k++)
+                v += sinf(k * phase) / k;
+
+            x[i] = (int16_t)(amp * env * v);
+        }
+
+        for (int j = 0; j < nu && i < n; j++, i++)
+            x[i] = (int16_t)(0.2f * amp * (frand(&seed) - 0.5f));
+
+        for (int j = 0; j < nz && i < n; j++, i++)
+            x[i] = 0;
+    }
+}
+
+/**
+ * Loss patterns
+ * rate            Average loss rate
+ * burst           Average length of bursts, 1 for independent losses
+ */
+struct pattern {
+    const char *name;
+    float rate, burst;
+};
+
+static void generate_losses(bool *lost, int n, const struct pattern *p)
+{
+    unsigned seed = 7;
+    float q = 1.f / p->burst;
+    float r = p->rate * q / (1 - p->rate);
+    bool bad = false;
+
+    for (int i = 0; i < n; i++) {
+        bad = bad ? frand(&seed) >= q : frand(&seed) < r;
+        lost[i] = bad;
+    }
+}
+
+/**
+ * Log power spectrum of a frame (Hann windowed, direct DFT)
+ */
+static void spectrum(const int16_t *x, int n, float *e, int ne)
+{
+    for (int k = 0; k < ne; k++) {
+        float re = 0, im = 0;
+
+        for (int i = 0; i < n; i++) {
+            float w = 0.5f - 0.5f * cosf(2 * (float)M_PI * i / n);
+            float a = 2 * (float)M_PI * k * i / (2 * ne);
+            re += w * x[i] * cosf(a);
+            im -= w * x[i] * sinf(a);
+        }
+
+        e[k] = 10 * log10f(re*re + im*im + 1e3f);
+    }
+}
+
+static double now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+int main(int argc, char *argv[])
+{
+    int nbytes = argc > 1 ? atoi(argv[1]) : 20;
+    int sr_hz = argc > 2 ? atoi(argv[2]) : 16000;
+    int dt_us = argc > 3 ? atoi(argv[3]) : 10000;
+
+    int ns = lc3_frame_samples(dt_us, sr_hz);
+    if (ns < 0 || nbytes < LC3_MIN_FRAME_BYTES || nbytes > LC3_MAX_FRAME_BYTES) {
+        fprintf(stderr, "Bad parameters\n");
+        return 1;
+    }
+
+    int nf = (DURATION_S * sr_hz) / ns;
+
+    int16_t *x = malloc(nf * ns * sizeof(*x));
+    int16_t *y_ref = malloc(nf * ns * sizeof(*y_ref));
+    int16_t *y = malloc(nf * ns * sizeof(*y));
+    uint8_t *frames = malloc(nf * nbytes);
+    bool *lost = malloc(nf * sizeof(*lost));
+
+    void *enc_mem = malloc(lc3_encoder_size(dt_us, sr_hz));
+    void *dec_mem = malloc(lc3_decoder_size(dt_us, sr_hz));
+
+    /* --- Encode and reference decoding --- */
+
+    generate(x, nf * ns, sr_hz);
+
+    lc3_encoder_t enc = lc3_setup_encoder(dt_us, sr_hz, 0, enc_mem);
+    for (int i = 0; i < nf; i++)
+        lc3_encode(enc, LC3_PCM_FORMAT_S16,
+            x + i*ns, 1, nbytes, frames + i*nbytes);
+
+    lc3_decoder_t dec = lc3_setup_decoder(dt_us, sr_hz, 0, dec_mem);
+    for (int i = 0; i < nf; i++)
+        lc3_decode(dec, frames + i*nbytes, nbytes,
+            LC3_PCM_FORMAT_S16, y_ref + i*ns, 1);
+
+    /* --- Decode with losses --- */
+
+    static const struct pattern patterns[] = {
+        { "random  5%", 0.05f, 1 }, { "random 10%", 0.10f, 1 },
+        { "random 20%", 0.20f, 1 }, { "burst   5%", 0.05f, 3 },
+        { "burst  10%", 0.10f, 3 }, { "burst  20%", 0.20f, 3 },
+    };
+
+    static const char *modes[] = { "standard", "pitch", "pitch-hq" };
+
+    printf("LC3 PLC benchmark: %d us, %d Hz, %d bytes, %d frames\n\n",
+        dt_us, sr_hz, nbytes, nf);
+    printf("%-11s %-9s %8s %8s %8s\n", "loss", "mode", "SNR dB", "LSD dB", "CPU us");
+
+    for (int ip = 0; ip < (int)(sizeof(patterns) / sizeof(*patterns)); ip++) {
+        generate_losses(lost, nf, &patterns[ip]);
+
+        for (int mode = LC3_PLC_MODE_STANDARD;
+                mode <= LC3_PLC_MODE_PITCH_HQ; mode++) {
+
+            dec = lc3_setup_decoder(dt_us, sr_hz, 0, dec_mem);
+            lc3_decoder_set_plc_mode(dec, mode);
+
+            double t0 = now_us();
+
+            for (int i = 0; i < nf; i++)
+                lc3_decode(dec, lost[i] ? NULL : frames + i*nbytes, nbytes,
+                    LC3_PCM_FORMAT_S16, y + i*ns, 1);
+
+            double cpu = (now_us() - t0) / nf;
+
+            double snr = 0, lsd = 0;
+            int count = 0;
+
+            for (int i = 0; i < nf; i++) {
+                if (!lost[i] && !(i > 0 && lost[i-1]))
+                    continue;
+
+                const int16_t *r = y_ref + i*ns, *s = y + i*ns;
+                double es = 0, ee = 0;
+
+                for (int j = 0; j < ns; j++) {
+                    double d = r[j] - s[j];
+                    es += (double)r[j] * r[j], ee += d*d;
+                }
+
+                if (es < ns * 100.)
+                    continue;
+
+                float er[NFFT/2], ey[NFFT/2], dl = 0;
+                int nk = ns < NFFT/2 ? ns : NFFT/2;
+
+                spectrum(r, ns, er, nk);
+                spectrum(s, ns, ey, nk);
+                for (int k = 0; k < nk; k++)
+                    dl += (er[k] - ey[k]) * (er[k] - ey[k]);
+
+                snr += fmax(-10., fmin(35., 10 * log10((es + 1) / (ee + 1))));
+                lsd += sqrt(dl / nk);
+                count++;
+            }
+
+            printf("%-11s %-9s %8.2f %8.2f %8.2f\n",
+                patterns[ip].name, modes[mode],
+                count ? snr / count : 0, count ? lsd / count : 0, cpu);
+        }
+    }
+
+    free(x); free(y_ref); free(y);
+    free(frames); free(lost);
+    free(enc_mem); free(dec_mem);
+
+    return 0;
+}